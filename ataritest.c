@@ -7,6 +7,9 @@
  * ataritest --dumprom address=0xe00000 size=192 or size=256
  * ataritest --init 512 or 1024 or 2048 or 4096
  * ataritest --memory tests=rwx size=512 loop=yes
+ * ataritest --replay file=trace.bin
+ * ataritest --busstats loop=yes
+ * ataritest --latency --memspeed
  * 
  * 
  */
@@ -30,6 +33,7 @@
 #include <sys/ioctl.h>
 #include "emulator.h"
 #include "gpio/ps_protocol.h"
+#include "gpio/ps_trace.h"
 
 #define SIZE_KILO 1024
 #define SIZE_MEGA (1024 * 1024)
@@ -61,6 +65,7 @@ void poke ( uint32_t address, uint8_t data );
 void dump ( uint32_t ROMsize, uint32_t ROMaddress );
 void memspeed ( uint32_t length );
 void hwTest ( void );
+int busstats ( int loop );
 
 int doReads;
 int doWrites;
@@ -81,6 +86,9 @@ int cmdInit = 0;
 int cmdMemSpeed = 0;
 int targetF = 200;
 int cmdHWTEST = 0;
+int cmdReplay = 0;
+int cmdLatency = 0;
+char replayFile [80];
 uint32_t ROMsize = 192;
 uint32_t ROMaddress = 0x00e00000;
 uint16_t clrPattern = 0x0000;
@@ -174,6 +182,10 @@ int main(int argc, char *argv[])
 
     cur_loop = 1;
 
+    /* the only command that wants the emulator running */
+    if ( argc > 1 && strcmp ( argv [1], "--busstats" ) == 0 )
+        return busstats ( argc > 2 && strcmp ( argv [2], "loop=yes" ) == 0 );
+
     if ( check_emulator () ) 
     {
         printf("PiStorm emulator running, please stop this before running ataritest\n");
@@ -407,6 +419,15 @@ test_loop:
             hwTest ();
 
         }
+
+        if ( cmdReplay )
+        {
+            if ( ps_trace_replay ( replayFile ) )
+                return 1;
+        }
+
+        if ( cmdLatency )
+            ps_stats_print ( ps_stats );
     }
 
     else
@@ -433,6 +454,14 @@ test_loop:
                  "--init <size=xxx>\n"
                  "     configures ATARI MMU for the specified size.\n"
                  "     <size> 512 to 4096. If not supplied, 512 is used\n"
+                 "--replay file=<trace>\n"
+                 "     runs a bus trace recorded with emulator --trace and reports\n"
+                 "     transaction counts and timing per region and function code.\n"
+                 "--latency\n"
+                 "     after the tests print bus latency per transaction type.\n"
+                 "--busstats <loop=yes>\n"
+                 "     print the bus latency of the running emulator.\n"
+                 "     <loop> prints it again every second until CNTRL-C is entered.\n"
         );
 
         exit (0);
@@ -454,6 +483,33 @@ void m68k_set_irq(unsigned int level) {
 }
 
 
+int busstats ( int loop )
+{
+    const t_ps_stats_page *page = ps_stats_attach ();
+
+    if ( page == NULL )
+    {
+        printf ( "No bus statistics found - is the emulator running?\n" );
+        return 1;
+    }
+
+    do
+    {
+        printf ( "emulator pid %u\n", page->pid );
+        ps_stats_print ( page );
+
+        if ( loop )
+        {
+            sleep ( 1 );
+            printf ( "\n" );
+        }
+    }
+    while ( loop );
+
+    return 0;
+}
+
+
 void memspeed ( uint32_t length )
 {
     uint32_t address;
@@ -492,6 +548,73 @@ void memspeed ( uint32_t length )
 
     printf ( "WRITE: %d ms = %.2f MB/s\n", (nanoEnd - nanoStart), 
         ( 1.0 / ( (float)(nanoEnd - nanoStart) ) * length ) / 1024 );     /* MB/s */
+
+    if ( !ps_burst )
+        return;
+
+    /* BURST - 8 KB blocks */
+    uint16_t block [4096];
+    uint32_t errors = 0;
+
+    clock_gettime ( CLOCK_REALTIME, &tmsStart );
+
+    for ( address = 0; address < length; address += sizeof (block) )
+        ps_read_block ( address, block, sizeof (block) / 2 );
+
+    clock_gettime ( CLOCK_REALTIME, &tmsEnd );
+
+    nanoStart = (tmsStart.tv_sec * 1000) + (tmsStart.tv_nsec / 1000000);
+    nanoEnd = (tmsEnd.tv_sec * 1000) + (tmsEnd.tv_nsec / 1000000);
+
+    printf ( "BURST READ:  %ld ms = %.2f MB/s\n", (nanoEnd - nanoStart), 
+        ( 1.0 / ( (float)(nanoEnd - nanoStart) ) * length ) / 1024 );     /* MB/s */
+
+    for ( int n = 0; n < 4096; n++ )
+        block [n] = rand ();
+
+    clock_gettime ( CLOCK_REALTIME, &tmsStart );
+
+    for ( address = 0; address < length; address += sizeof (block) )
+        ps_write_block ( address, block, sizeof (block) / 2 );
+
+    clock_gettime ( CLOCK_REALTIME, &tmsEnd );
+
+    nanoStart = (tmsStart.tv_sec * 1000) + (tmsStart.tv_nsec / 1000000);
+    nanoEnd = (tmsEnd.tv_sec * 1000) + (tmsEnd.tv_nsec / 1000000);
+
+    printf ( "BURST WRITE: %ld ms = %.2f MB/s\n", (nanoEnd - nanoStart), 
+        ( 1.0 / ( (float)(nanoEnd - nanoStart) ) * length ) / 1024 );     /* MB/s */
+
+    /* burst writes must read back the same with single cycles */
+    for ( address = 0; address < length; address += 2 )
+        if ( read16 ( address ) != block [(address % sizeof (block)) / 2] )
+            errors++;
+
+    printf ( "BURST VERIFY: %d errors\n", errors );
+
+    /* a block across 64K must not land 64K lower - guard that area with single writes */
+    errors = 0;
+
+    for ( address = 0x2FF00; address < 0x30100; address += 2 )
+        write16 ( address - 0x10000, 0xA5A5 );
+
+    ps_write_block ( 0x2FF00, block, 0x100 );
+
+    for ( address = 0x2FF00; address < 0x30100; address += 2 )
+    {
+        if ( read16 ( address ) != block [(address - 0x2FF00) / 2] )
+            errors++;
+
+        if ( read16 ( address - 0x10000 ) != 0xA5A5 )
+            errors++;
+    }
+
+    ps_read_block ( 0x2FF00, block + 0x100, 0x100 );
+
+    if ( memcmp ( block, block + 0x100, 0x200 ) )
+        errors++;
+
+    printf ( "BURST 64K CROSSING: %d errors\n", errors );
 }
 
 
@@ -1978,6 +2101,48 @@ int parser ( int argc, char **argv )
             //printf ( "targetF = %d\n", targetF );
         }
 
+        //  syntax --replay file=trace.bin
+        if ( strcmp ( cmdptr, "replay" ) == 0 )
+        {
+            valid = 0; 
+
+            if ( a < argc - 1 )
+            {
+                strncpy ( arg, argv [++a], 80 );
+                aptr = strtok ( arg, "=" );
+        
+                if ( strcmp ( aptr, "file" ) == 0 )
+                {
+                    tptr = strtok ( NULL, "" );
+
+                    if ( tptr )
+                    {
+                        strncpy ( replayFile, tptr, sizeof ( replayFile ) - 1 );
+                        valid = 1;
+                    }
+                }
+            }
+
+            if ( valid )
+                cmdReplay = 1;
+        }
+
+        //  syntax --bus sim,latency=250
+        if ( strcmp ( cmdptr, "bus" ) == 0 && a < argc - 1 )
+        {
+            if ( ps_select_backend ( argv [++a] ) )
+                return 0;
+        }
+
+        if ( strcmp ( cmdptr, "burst" ) == 0 )
+            ps_burst = 1;
+
+        if ( strcmp ( cmdptr, "posted" ) == 0 )
+            ps_posted = 1;
+
+        if ( strcmp ( cmdptr, "latency" ) == 0 )
+            cmdLatency = 1;
+
         if ( strcmp ( cmdptr, "hardware" ) == 0 )
         {
             cmdHWTEST = 1;
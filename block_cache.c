@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+
+/*
+  Predecoded block cache
+
+  Recording, invalidation and statistics for the blocks described in
+  block_cache.h. m68k_execute_bef () does the lookups and replays them.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "block_cache.h"
+
+bool            Bcache_enabled;
+t_bcache_block *bcache;
+uint32_t       *bcache_gen;
+uint8_t        *bcache_has_code;
+t_bcache_stats  bcache_stats;
+
+static uint32_t recording_pc;
+static uint32_t recording_region;
+
+
+/* called again on every reset - the memory map may have changed, start empty */
+int bcache_init ( void )
+{
+  if ( bcache )
+  {
+    bcache_flush ();
+
+    return 0;
+  }
+
+  bcache          = malloc ( BCACHE_BLOCKS * sizeof ( t_bcache_block ) );
+  bcache_gen      = calloc ( BCACHE_REGIONS, sizeof ( uint32_t ) );
+  bcache_has_code = calloc ( BCACHE_REGIONS, sizeof ( uint8_t ) );
+
+  if ( !bcache || !bcache_gen || !bcache_has_code )
+  {
+    printf ( "[BCACHE] Cannot allocate the block cache, disabled\n" );
+
+    free ( bcache );
+    free ( bcache_gen );
+    free ( bcache_has_code );
+    bcache = NULL;
+    Bcache_enabled = false;
+
+    return -1;
+  }
+
+  bcache_flush ();
+
+  printf ( "[BCACHE] %d blocks of up to %d instructions\n", BCACHE_BLOCKS, BCACHE_MAX_INSNS );
+
+  return 0;
+}
+
+
+void bcache_flush ( void )
+{
+  for ( int n = 0; n < BCACHE_BLOCKS; n++ )
+    bcache [n].pc = ~0;
+}
+
+
+void bcache_invalidate ( uint32_t address )
+{
+  uint32_t r = address >> BCACHE_REGION_SHIFT;
+
+  bcache_gen [r]++;
+  bcache_has_code [r] = 0;
+
+  bcache_stats.invalidated++;
+}
+
+
+/* start recording at pc - NULL unless it is host backed and not too close to the end of its region */
+t_bcache_block *bcache_begin ( uint32_t pc, uint32_t address )
+{
+  mmap_page_t *page = mmap_lookup ( address );
+  t_bcache_block *blk;
+  uint32_t r = address >> BCACHE_REGION_SHIFT;
+
+  if ( page->type != MMAP_HOST_RAM && page->type != MMAP_HOST_ROM )
+    return NULL;
+
+  if ( ( address & ( ( 1 << BCACHE_REGION_SHIFT ) - 1 ) ) > ( 1 << BCACHE_REGION_SHIFT ) - BCACHE_INSN_MAX_LEN )
+    return NULL;
+
+  blk = &bcache [( pc >> 1 ) & ( BCACHE_BLOCKS - 1 )];
+
+  blk->pc    = ~0;
+  blk->count = 0;
+  blk->gen   = bcache_gen [r];
+
+  /* from here on CPU writes to the region are tracked */
+  bcache_has_code [r] = 1;
+  page->code = 1;
+
+  recording_pc     = pc;
+  recording_region = r;
+
+  return blk;
+}
+
+
+/*
+ * add the instruction at pc that just ran and left REG_PC at next - returns
+ * NULL once the block is finished (committed) or given up on
+ */
+t_bcache_block *bcache_record ( t_bcache_block *blk, uint32_t pc, uint16_t ir, bcache_handler handler, uint8_t cycles, uint32_t next )
+{
+  uint32_t limit = ( 1 << BCACHE_REGION_SHIFT ) - BCACHE_INSN_MAX_LEN;
+
+  /* the code wrote to its own region */
+  if ( blk->gen != bcache_gen [recording_region] )
+    return NULL;
+
+  /* something other than the last instruction moved the PC, an interrupt between slices */
+  if ( pc != ( blk->count ? blk->next [blk->count - 1] : recording_pc ) )
+  {
+    bcache_commit ( blk );
+
+    return NULL;
+  }
+
+  blk->ir      [blk->count] = ir;
+  blk->handler [blk->count] = handler;
+  blk->cycles  [blk->count] = cycles;
+  blk->next    [blk->count] = next;
+  blk->count++;
+
+  if ( blk->count == BCACHE_MAX_INSNS
+    || next <= pc
+    || ( next ^ pc ) >> BCACHE_REGION_SHIFT
+    || ( next & ( ( 1 << BCACHE_REGION_SHIFT ) - 1 ) ) > limit )
+  {
+    bcache_commit ( blk );
+
+    return NULL;
+  }
+
+  return blk;
+}
+
+
+void bcache_commit ( t_bcache_block *blk )
+{
+  /* a single instruction saves nothing */
+  if ( blk->count < 2 )
+    return;
+
+  blk->pc = recording_pc;
+
+  bcache_stats.built++;
+}
+
+
+void bcache_report ( void )
+{
+  if ( !Bcache_enabled )
+    return;
+
+  printf ( "[BCACHE] %llu blocks built, %llu invalidations\n",
+    (unsigned long long)bcache_stats.built, (unsigned long long)bcache_stats.invalidated );
+
+  if ( bcache_stats.blocks )
+    printf ( "[BCACHE] %llu blocks run, %.1f instructions per block, %.1f%% left early\n",
+      (unsigned long long)bcache_stats.blocks,
+      (double)bcache_stats.insns / bcache_stats.blocks,
+      100.0 * bcache_stats.exits / bcache_stats.blocks );
+}
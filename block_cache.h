@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+/**
+ * pistorm
+ * predecoded block cache for 68k code in host backed memory (mapped ROM, ALT-RAM)
+ */
+
+#ifndef _BLOCK_CACHE_H
+#define _BLOCK_CACHE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "m68k.h"
+#include "memory_mapped.h"
+
+/*
+ * A block is the run of instructions m68k_execute_bef () saw from a start PC:
+ * opcode word, handler and cycle cost of each, plus the PC each one left
+ * behind. Replaying it skips the opcode fetch and decode; after every
+ * instruction REG_PC must match the recorded PC or the block is left, so a
+ * branch going the other way or an exception just falls back to the normal
+ * loop.
+ *
+ * Blocks never leave a 4K region. A CPU write to a region that has blocks
+ * bumps its generation, which invalidates them.
+ */
+#define BCACHE_BLOCKS        4096          /* direct mapped on PC */
+#define BCACHE_MAX_INSNS     32
+#define BCACHE_REGION_SHIFT  12
+#define BCACHE_REGIONS       ( 1 << ( 32 - BCACHE_REGION_SHIFT ) )
+#define BCACHE_INSN_MAX_LEN  22            /* longest 68020 instruction, bytes */
+
+typedef void ( *bcache_handler ) ( struct m68ki_cpu_core *state );
+
+typedef struct {
+  uint32_t       pc;                       /* first instruction, ~0 when the slot is free */
+  uint32_t       gen;                      /* region generation when recorded */
+  uint32_t       count;
+  uint32_t       next    [BCACHE_MAX_INSNS];
+  uint16_t       ir      [BCACHE_MAX_INSNS];
+  uint8_t        cycles  [BCACHE_MAX_INSNS];
+  bcache_handler handler [BCACHE_MAX_INSNS];
+} t_bcache_block;
+
+typedef struct {
+  uint64_t blocks;          /* blocks replayed */
+  uint64_t insns;           /* instructions replayed */
+  uint64_t exits;           /* blocks left early - PC did not match */
+  uint64_t built;
+  uint64_t invalidated;     /* region generation bumps */
+} t_bcache_stats;
+
+extern bool            Bcache_enabled;
+extern t_bcache_block *bcache;
+extern uint32_t       *bcache_gen;
+extern uint8_t        *bcache_has_code;
+extern t_bcache_stats  bcache_stats;
+
+int  bcache_init ( void );
+void bcache_flush ( void );
+void bcache_invalidate ( uint32_t address );
+void bcache_report ( void );
+
+t_bcache_block *bcache_begin ( uint32_t pc, uint32_t address );
+t_bcache_block *bcache_record ( t_bcache_block *blk, uint32_t pc, uint16_t ir, bcache_handler handler, uint8_t cycles, uint32_t next );
+void bcache_commit ( t_bcache_block *blk );
+
+
+static inline t_bcache_block *bcache_lookup ( uint32_t pc, uint32_t address )
+{
+  t_bcache_block *blk = &bcache [( pc >> 1 ) & ( BCACHE_BLOCKS - 1 )];
+
+  if ( blk->pc != pc || blk->gen != bcache_gen [address >> BCACHE_REGION_SHIFT] )
+    return NULL;
+
+  return blk;
+}
+
+
+/* CPU wrote size bytes at address in a host RAM page that has blocks */
+static inline void bcache_write ( uint32_t address, int size )
+{
+  if ( bcache_has_code [address >> BCACHE_REGION_SHIFT] )
+    bcache_invalidate ( address );
+
+  if ( bcache_has_code [( address + size - 1 ) >> BCACHE_REGION_SHIFT] )
+    bcache_invalidate ( address + size - 1 );
+}
+
+#endif /* _BLOCK_CACHE_H */
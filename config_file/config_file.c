@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "platforms/platforms.h"
+#include "memory_mapped.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -254,7 +255,7 @@ void add_mapping(struct emulator_config *cfg, unsigned int type, unsigned int ad
     case MAPTYPE_RAM:
       //DEBUG_PRINTF ("[CFG] Allocating %d bytes for RAM mapping (%d MB)...\n", size, size / 1024 / 1024);
 alloc_mapram:
-      cfg->map_data[index] = (unsigned char *)malloc(size);
+      cfg->map_data[index] = (unsigned char *)malloc(MMAP_MEM_SIZE(size));
       if (!cfg->map_data[index]) {
         DEBUG_PRINTF ("[CFG] ERROR: Unable to allocate memory for mapped RAM!\n");
         goto mapping_failed;
@@ -293,7 +294,7 @@ alloc_mapram:
 //printf ( "[SXB] filename %s is %d bytes\n", filename, file_size );
         fseek (in, 0, SEEK_SET);
 
-        cfg->map_data[index] = (unsigned char *)calloc (1, cfg->map_size[index]);
+        cfg->map_data[index] = (unsigned char *)calloc (1, MMAP_MEM_SIZE(cfg->map_size[index]));
         cfg->image_size[index] = file_size; //(cfg->map_size[index] <= file_size) ? cfg->map_size[index] : file_size;
 
         if (!cfg->map_data[index]) 
@@ -309,6 +310,7 @@ alloc_mapram:
         *((unsigned int*)cfg->map_data[index]) = be32toh (file_size); /* write filesize to disk image header */
 
         err = fread (cfg->map_data[index] + headersz, cfg->image_size[index], 1, in);
+        mmap_mem_swap (cfg->map_data[index], MMAP_MEM_SIZE(cfg->map_size[index]));
 
         if ( err == 0 )
         {
@@ -365,7 +367,7 @@ alloc_mapram:
         cfg->map_high[index] = addr + cfg->map_size[index];
       }
       fseek(in, 0, SEEK_SET);
-      cfg->map_data[index] = (unsigned char *)calloc(1, cfg->map_size[index]);
+      cfg->map_data[index] = (unsigned char *)calloc(1, MMAP_MEM_SIZE(cfg->map_size[index]));
       cfg->rom_size[index] = (cfg->map_size[index] <= file_size) ? cfg->map_size[index] : file_size;
       if (!cfg->map_data[index]) {
         DEBUG_PRINTF ("[CFG] ERROR: Unable to allocate memory for mapped ROM!\n");
@@ -373,6 +375,7 @@ alloc_mapram:
       }
       memset(cfg->map_data[index], 0x00, cfg->map_size[index]);
       fread(cfg->map_data[index], cfg->rom_size[index], 1, in);
+      mmap_mem_swap(cfg->map_data[index], MMAP_MEM_SIZE(cfg->map_size[index]));
       if (in)
         fclose(in);
 skip_file_ops:
@@ -6,6 +6,11 @@
 #include "platforms/atari/atari-registers.h"
 #include "platforms/atari/pistorm-dev/pistorm-dev-enums.h"
 #include "gpio/ps_protocol.h"
+#include "gpio/ps_trace.h"
+#include "memory_mapped.h"
+#include "block_cache.h"
+#include "icache.h"
+#include "profiler.h"
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -18,10 +23,10 @@
 #include "platforms/atari/et4000.h"
 #include <termios.h>
 #include <fcntl.h>
+#include <time.h>
+#include <sys/stat.h>
 
 /* test defines */
-#define MYWTC 0
-
 
 #define DEBUGPRINT 1
 #if DEBUGPRINT
@@ -57,10 +62,19 @@ extern char *get_pistorm_cfg_filename ();
 extern void set_pistorm_cfg_filename (char *);
 extern uint m68ki_read_imm16_addr_slowpath ( m68ki_cpu_core *state, uint32_t pc );
 extern void blitInit ( void );
-extern uint8_t ps_read_8 ( uint32_t address );
+extern int blitRead ( uint8_t type, uint32_t addr, uint32_t *res );
+extern int blitWrite ( uint8_t type, uint32_t addr, uint32_t val );
+extern void adjust_ranges_atari ( struct emulator_config *cfg );
 
 
 static inline void m68k_execute_bef ( m68ki_cpu_core *, int );
+static void slice_report ( void );
+static void irq_report ( void );
+static void wcb_report ( void );
+static inline void wcb_drain ( void );
+static void idle_report ( void );
+void memory_map_build ( void );
+static void memory_map_benchmark ( void );
 //void *ide_task ( void* );
 //void *misc_task ( void* vptr );
 
@@ -76,6 +90,11 @@ uint8_t load_new_config = 0;
 int mem_fd;
 unsigned int cpu_type = M68K_CPU_TYPE_68000;
 unsigned int loop_cycles = 12;
+unsigned int IPL_poll_ns = 5000;
+bool Slice_adaptive;
+bool Fuse_enabled;
+bool Vector_shadow;
+bool MMAP_benchmark;
 struct emulator_config *cfg = NULL;
 bool RTG_enabled;
 bool RTC_enabled;
@@ -96,7 +115,6 @@ extern bool RTG_enabled;
 extern bool ET4000Initialised;
 extern volatile unsigned int *gpio;
 extern const char *cpu_types[];
-extern volatile bool PS_LOCK;
 //extern volatile bool ioDone;
 //extern volatile bool g_iack;
 
@@ -118,324 +136,731 @@ void cpu3 ( void )
 	sched_setaffinity ( 0, sizeof (cpu_set_t), &cpuset );
 }
 
-#if !MYWTC
-#define CACHESIZE 4096*1024
-#define CACHESIZEBYTES CACHESIZE * sizeof(uint16_t)
+/*
+ * WTC coherency - FDC/ACSI DMA and the blitter write ST-RAM behind the cache.
+ * CPU writes to their registers are sniffed, so that DMA completion and a
+ * blitter start only drop the range those can have written, not all of it.
+ */
+#define WTC_DMA_BASE    0x00FF8600  /* sector count 8604, mode 8606, address 8609/0B/0D */
+#define WTC_BLIT_BASE   0x00FF8A00  /* destination 8A32, increments 8A2E/30, counts 8A36/38 */
+#define WTC_SECTOR      512
+
+static uint8_t  wtc_dma_regs [0x10];    /* as last written by the CPU */
+static uint8_t  wtc_blit_regs [0x40];
+static uint32_t wtc_dma_addr;           /* where the next transfer starts */
+static bool     wtc_dma_addr_set;
+static uint32_t wtc_dma_count;          /* sectors programmed since the last completion */
+static bool     wtc_dma_to_disk;        /* mode bit 8 when they were - ST-RAM is only read */
+static bool     wtc_blit_dirty = true;  /* blitter set up anew since the last start */
+static bool     wtc_blit_dst_set;       /* destination written since the last start - the blitter advances it */
+static bool     wtc_blit_running;
+static uint32_t wtc_blit_lo, wtc_blit_hi; /* what the running blit can write */
+
+static void wtc_invalidate ( uint32_t lo, uint32_t hi );
+
+static uint32_t wtc_reg ( const uint8_t *regs, int offset, int bytes )
+{
+  uint32_t v = 0;
 
-uint16_t cache[CACHESIZE]; // top byte used as valid flag
-static short flushstate = 0; // 0 active, 1 flush request
-pthread_mutex_t cachemutex;
+  while ( bytes-- )
+    v = ( v << 8 ) | regs [offset++];
 
-int do_cache( uint32_t address, int size, unsigned int *value, int isread ) {
-	// size is 1,2,4
-  static short flushstatereq = 0; // go around the houses a bit as don't want to lock for mutex
+  return v;
+}
 
-  if( flushstate > 0) // cache is invalid
-    return 0;
+/* everything the blitter can write with the registers as set up - TOS restarts a blit many times, only once counts */
+static void wtc_blit_range ( void )
+{
+  uint32_t dst    = wtc_reg ( wtc_blit_regs, 0x32, 4 ) & 0x00FFFFFE;
+  int64_t  xinc   = (int16_t)wtc_reg ( wtc_blit_regs, 0x2E, 2 );
+  int64_t  yinc   = (int16_t)wtc_reg ( wtc_blit_regs, 0x30, 2 );
+  int64_t  xcount = wtc_reg ( wtc_blit_regs, 0x36, 2 ) ? wtc_reg ( wtc_blit_regs, 0x36, 2 ) : 0x10000;
+  int64_t  ycount = wtc_reg ( wtc_blit_regs, 0x38, 2 ) ? wtc_reg ( wtc_blit_regs, 0x38, 2 ) : 0x10000;
+  int64_t  line   = ( xcount - 1 ) * xinc;
+  int64_t  last   = ( ycount - 1 ) * ( line + yinc );
+  int64_t  lo     = dst + ( line < 0 ? line : 0 ) + ( last < 0 ? last : 0 );
+  int64_t  hi     = dst + ( line > 0 ? line : 0 ) + ( last > 0 ? last : 0 ) + 2;
+
+  lo = lo < 0 ? 0 : lo;
+  hi = hi > ATARI_MEMORY_SIZE ? ATARI_MEMORY_SIZE : hi;
+
+  /* set up anew while it ran - it can still have written the old range */
+  if ( wtc_blit_running && wtc_blit_lo < wtc_blit_hi )
+  {
+    lo = lo < wtc_blit_lo ? lo : wtc_blit_lo;
+    hi = hi > wtc_blit_hi ? hi : wtc_blit_hi;
+  }
+
+  wtc_blit_lo = lo;
+  wtc_blit_hi = hi;
+
+  wtc_invalidate ( wtc_blit_lo, wtc_blit_hi );
+}
+
+/*
+ * the blitter counts destination and Y count down as it runs - restarted without
+ * them rewritten, the shadow copy is stale, so take what the blitter holds now
+ */
+static void wtc_blit_reload ( void )
+{
+  uint8_t  old [6];
+  uint32_t dst = ps_read_32 ( WTC_BLIT_BASE + 0x32 );
+  uint16_t ycount = ps_read_16 ( WTC_BLIT_BASE + 0x38 );
+
+  memcpy ( old, wtc_blit_regs + 0x32, 4 );
+  memcpy ( old + 4, wtc_blit_regs + 0x38, 2 );
+
+  for ( int i = 0; i < 4; i++ )
+    wtc_blit_regs [0x32 + i] = dst >> ( 24 - 8 * i );
 
-  if( flushstatereq && !flushstate ) { // there's been a request to flush and it's not yet set the flush thread's state variable
-      if( !pthread_mutex_trylock(&cachemutex) ) {
-        flushstate = 1;
-        flushstatereq = 0;
-        pthread_mutex_unlock(&cachemutex);
+  wtc_blit_regs [0x38] = ycount >> 8;
+  wtc_blit_regs [0x39] = ycount;
+
+  if ( memcmp ( old, wtc_blit_regs + 0x32, 4 ) || memcmp ( old + 4, wtc_blit_regs + 0x38, 2 ) )
+    wtc_blit_dirty = true;
+}
+
+static bool wtc_dma_done ( void );
+
+/* CPU write to the IO area - true when the whole cache has to go */
+static bool wtc_sniff_write ( uint32_t address, int size, uint32_t value )
+{
+  bool count = false, start = false, flush = false;
+
+  for ( int i = 0; i < size; i++ )
+  {
+    uint32_t a = ( address + i ) & 0x00FFFFFF;
+    uint8_t  b = value >> ( 8 * ( size - 1 - i ) );
+
+    if ( a >= WTC_DMA_BASE && a < WTC_DMA_BASE + sizeof ( wtc_dma_regs ) )
+    {
+      wtc_dma_regs [a - WTC_DMA_BASE] = b;
+
+      if ( a == 0x00FF8609 || a == 0x00FF860B || a == 0x00FF860D )
+      {
+        wtc_dma_addr = wtc_reg ( wtc_dma_regs, 0x9, 1 ) << 16 | wtc_reg ( wtc_dma_regs, 0xB, 1 ) << 8 | wtc_reg ( wtc_dma_regs, 0xD, 1 );
+        wtc_dma_addr_set = true;
       }
-      return 0;
-  }
 
-  // DMA registers of interest are at 0x00FF8604 (trigger DMA) and 0x00FFFA01 (MFP GPIP bits to check for completion).
-  // Sniff reads from 0x00FFFA01 with a mask against 0x20. If this results is 0, a DMA interrupt has triggered
-  // Blitter not yet sniffed (disable it)
-  if( isread && address == 0x00FFFA01 ) {
-    *value = ps_read_8 ( address );
-    if( ( *value & 0x20 ) == 0 ) {
-    //if( ( (*value & 0x20) || (*value & 0x08) ) == 0 ) {
-      flushstatereq=1;
+      count |= ( a == 0x00FF8605 );
     }
-    return 1; // we return success here as we've done the read for you
+
+    else if ( a >= WTC_BLIT_BASE && a < WTC_BLIT_BASE + sizeof ( wtc_blit_regs ) )
+    {
+      wtc_blit_regs [a - WTC_BLIT_BASE] = b;
+
+      if ( a == 0x00FF8A3C )
+        start = b & 0x80;
+
+      else if ( a != 0x00FF8A3D )
+        wtc_blit_dirty = true;
+
+      if ( a >= 0x00FF8A32 && a < 0x00FF8A36 )
+        wtc_blit_dst_set = true;
+    }
+  }
+
+  /* 8604 is the sector count while bit 4 of the mode register is set */
+  if ( count && ( wtc_reg ( wtc_dma_regs, 0x6, 2 ) & 0x10 ) )
+  {
+    /* one still outstanding finished without the CPU looking at GPIP */
+    flush = wtc_dma_done ();
+
+    wtc_dma_count   = wtc_dma_regs [0x5];
+    wtc_dma_to_disk = wtc_dma_regs [0x6] & 0x01;
   }
+
+  if ( start )
+  {
+    /* a restart while it runs carries on with the range already dropped */
+    if ( !wtc_blit_running && !wtc_blit_dst_set )
+      wtc_blit_reload ();
+
+    if ( wtc_blit_dirty )
+      wtc_blit_range ();
+
+    wtc_blit_dirty = false;
+    wtc_blit_dst_set = false;
+    wtc_blit_running = true;
+  }
+
+  return flush;
+}
+
+/* CPU read the blitter control register - once BUSY is seen clear, drop anything read while it ran */
+static void wtc_sniff_blit_done ( uint32_t value )
+{
+  if ( wtc_blit_running && !( value & 0x80 ) )
+  {
+    wtc_invalidate ( wtc_blit_lo, wtc_blit_hi );
+    wtc_blit_running = false;
+  }
+}
+
 /*
-  if( isread && address == 0x00FFFA09 ) {
-    //printf ( "do_cache () got blitter\n" );
-    *value = ps_read_8 ( address );
-    if( ( *value & 0x08 ) == 1 ) {
-      printf ( "do_cache () blitter in use\n" );
-      flushstatereq=1;
-    }
-    return 1; // we return success here as we've done the read for you
+ * faux blitter - its registers are always current and a blit runs to the end
+ * inside blitWrite (), so take them as they are and drop the range up front
+ */
+static void wtc_sniff_faux_blit ( uint32_t address, int size, uint32_t value )
+{
+  static const uint8_t words [] = { 0x2E, 0x30, 0x36, 0x38 };
+  uint32_t v;
+
+  for ( int i = 0; i < (int)sizeof ( words ); i++ )
+  {
+    blitRead ( OP_TYPE_WORD, WTC_BLIT_BASE + words [i], &v );
+    wtc_blit_regs [words [i]]     = v >> 8;
+    wtc_blit_regs [words [i] + 1] = v;
   }
-*/
-  //if( !(address >= 0x000800 && address < 0x400000 ) ) // STRAM only without low RAM (have to perform this check late as sniffing registers above)
-  if( !(address >= 0x0005B0 && (address < ATARI_MEMORY_SIZE) ) ) 
-    return 0;
 
-	if( isread ) {
-    switch(size) {
-      case(4):
-        if( !(cache[address] & 0x1000) || !(cache[address+1] & 0x01000) || !(cache[address+2] & 0x1000) || !(cache[address+3] & 0x01000) ){
-//          printf("MISS\n");
-          return 0;
-        }
-        *value = ((0xff & cache[address]) << 24) | ((0xff & cache[address+1]) << 16) | ((0xff & cache[address+2]) << 8 ) | ((0xff & cache[address+3]));
-        return 1;
-        break;
-      case(2):
-        if( !(cache[address] & 0x1000) || !(cache[address+1] & 0x01000) ) {
-//          printf("MISS\n");
-          return 0;
-        }
-        *value = ((0xff & cache[address]) << 8) | (0xff & cache[address+1]);
-        return 1;
-        break;
-      case(1):
-      default:
-        if( (cache[address] & 0x1000) == 0 ) {
-//          printf("MISS\n");
-          return 0;
-        }
-        *value = 0xff & cache[address];
-//        printf("HIT (%8.8x = %2.2x)\n", address, *value);
-        return 1;
-        break;
-    }
+  blitRead ( OP_TYPE_LONGWORD, WTC_BLIT_BASE + 0x32, &v );
+
+  for ( int i = 0; i < 4; i++ )
+    wtc_blit_regs [0x32 + i] = v >> ( 24 - 8 * i );
+
+  wtc_blit_dirty   = true;
+  wtc_blit_dst_set = true;
+  wtc_blit_running = false;
+
+  wtc_sniff_write ( address, size, value );
+
+  wtc_blit_running = false;
+}
+
+/* FDC/ACSI interrupt seen - true when the transfer is not known and the whole cache has to go */
+static bool wtc_dma_done ( void )
+{
+  uint32_t bytes = wtc_dma_count * WTC_SECTOR;
+
+  if ( wtc_dma_count == 0 )
+    return false;
+
+  if ( !wtc_dma_addr_set )
+  {
+    wtc_dma_count = 0;
+
+    return true;
   }
-  else {
-    switch( size ) {
-      case(4):
-        cache[address]    = 0x1000 | ( *value >> 24 ); // the 0x10 in top byte indicates valid cache entry
-        cache[address+1]  = 0x1000 | ( 0xff & ( *value >> 16 ) );
-        cache[address+2]  = 0x1000 | ( 0xff & ( *value >> 8 ) );
-        cache[address+3]  = 0x1000 | ( 0xff & *value );
-        break;
-      case(2):
-        cache[address]    = 0x1000 | ( *value >> 8 );
-        cache[address+1]  = 0x1000 | ( 0xff & *value );
-        break;
-      case(1):
-      default:
-        cache[address]    = 0x1000 | *value;
-        break;
-    }
+
+  if ( !wtc_dma_to_disk )
+    wtc_invalidate ( wtc_dma_addr, wtc_dma_addr + bytes > ATARI_MEMORY_SIZE ? ATARI_MEMORY_SIZE : wtc_dma_addr + bytes );
+
+  /* the address counter carries on from there */
+  wtc_dma_addr  += bytes;
+  wtc_dma_count = 0;
+
+  return false;
+}
+
+
+/*
+ * Write-through cache of ST-RAM (setvar wtc). The data is kept in the same
+ * word layout as the host mapped memory, with one tag per 16 byte line - the
+ * epoch it was written in and which of its bytes are valid. A flush only
+ * moves the epoch on, lines tagged with an older one no longer hit.
+ */
+#define WTC_LINE_SHIFT  4
+#define WTC_LINE        ( 1 << WTC_LINE_SHIFT )
+#define WTC_EPOCH       0x10000     /* epoch is the top half of a tag, the valid bytes the bottom */
+
+#define WTC_REGION_SHIFT 12         /* line fill back off is kept per 4KB */
+#define WTC_FILL_LOW    0x800       /* below is supervisor only - a user read must still see its bus error */
+
+/* what a read miss brings in (setvar wtcfill) */
+enum {
+  WTC_FILL_NONE,                    /* nothing, only CPU writes fill the cache */
+  WTC_FILL_WORD,                    /* the bytes read */
+  WTC_FILL_LINE,                    /* the whole line, one burst or four longs */
+  WTC_FILL_ADAPTIVE                 /* the line, but just the bytes read in regions DMA/blitter keep overwriting */
+};
+
+unsigned int WTC_fill;
+
+static uint8_t  *wtc_data;
+static uint32_t *wtc_tags;
+static uint8_t  *wtc_backoff;      /* word fills left per region before lines are tried again */
+static uint32_t  wtc_epoch = WTC_EPOCH;
+
+static struct {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t line_fills;
+  uint64_t word_fills;
+  uint64_t fill_reads;              /* bus transactions spent on fills */
+  uint64_t invalidates;
+  uint64_t flushes;
+} wtc_stats;
+
+static bool wtc_init ( void )
+{
+  wtc_data    = malloc ( MMAP_MEM_SIZE ( ATARI_MEMORY_SIZE ) );
+  wtc_tags    = calloc ( ATARI_MEMORY_SIZE >> WTC_LINE_SHIFT, sizeof ( wtc_tags [0] ) );
+  wtc_backoff = calloc ( ATARI_MEMORY_SIZE >> WTC_REGION_SHIFT, 1 );
+
+  return wtc_data && wtc_tags && wtc_backoff;
+}
+
+static void wtc_report ( void )
+{
+  uint64_t reads = wtc_stats.hits + wtc_stats.misses;
+
+  if ( !WTC_initialised || reads == 0 )
+    return;
+
+  printf ( "[WTC] %llu reads, %.1f%% hits, %llu line fills, %llu word fills, %llu bus reads to fill, %llu ranges invalidated, %llu flushes\n",
+    (unsigned long long)reads, 100.0 * wtc_stats.hits / reads, 
+    (unsigned long long)wtc_stats.line_fills, (unsigned long long)wtc_stats.word_fills, 
+    (unsigned long long)wtc_stats.fill_reads, (unsigned long long)wtc_stats.invalidates,
+    (unsigned long long)wtc_stats.flushes );
+}
+
+static void wtc_flush ( void )
+{
+  wtc_stats.flushes++;
+  wtc_epoch += WTC_EPOCH;
+
+  /* wrapped - tags from 65535 flushes ago would match again */
+  if ( wtc_epoch == 0 )
+  {
+    memset ( wtc_tags, 0, ( ATARI_MEMORY_SIZE >> WTC_LINE_SHIFT ) * sizeof ( wtc_tags [0] ) );
+    wtc_epoch = WTC_EPOCH;
+  }
+}
+
+static void wtc_invalidate ( uint32_t lo, uint32_t hi )
+{
+  uint32_t end;
+
+  if ( lo >= hi )
+    return;
+
+  wtc_stats.invalidates++;
+
+  /* regions written behind the cache's back - filling whole lines there is likely wasted */
+  for ( uint32_t r = lo >> WTC_REGION_SHIFT; r <= ( hi - 1 ) >> WTC_REGION_SHIFT; r++ )
+    wtc_backoff [r] = wtc_backoff [r] > 119 ? 255 : wtc_backoff [r] * 2 + 16;
+
+  for ( ; lo < hi; lo = end )
+  {
+    end = ( lo | ( WTC_LINE - 1 ) ) + 1;
+
+    if ( end > hi )
+      end = hi;
+
+    wtc_tags [lo >> WTC_LINE_SHIFT] &= ~( ( ( 1u << ( end - lo ) ) - 1 ) << ( lo & ( WTC_LINE - 1 ) ) );
   }
-  return 1;
 }
 
-// separate thread to reduce impact of flushing 8MB memory each time!
-void *cacheflusher( void *dummy ) {
-  static uint8_t c = 0;
+/* read miss - bring in what WTC_fill asks for and serve the read from it, false when it is left to the caller */
+static bool wtc_fill ( uint32_t address, int size, uint32_t *value, uint32_t *tag, uint32_t bits )
+{
+  uint32_t line = address & ~( WTC_LINE - 1 );
+  uint16_t words [WTC_LINE / 2];
+  bool     whole = WTC_fill == WTC_FILL_LINE;
+
+  if ( WTC_fill == WTC_FILL_NONE || address < WTC_FILL_LOW )
+    return false;
+
+  if ( WTC_fill == WTC_FILL_ADAPTIVE )
+  {
+    uint8_t *backoff = &wtc_backoff [address >> WTC_REGION_SHIFT];
+
+    whole = *backoff == 0;
 
-  while( !cpu_emulation_running ) {
-    sleep(1);
+    if ( *backoff )
+      ( *backoff )--;
   }
 
-  while( cpu_emulation_running ) 
+  if ( ( *tag & ~( WTC_EPOCH - 1 ) ) != wtc_epoch )
+    *tag = wtc_epoch;
+
+  if ( whole )
   {
-    if( flushstate ) 
+    if ( ps_burst )
     {
-      memset( cache, 0, CACHESIZEBYTES );
-      pthread_mutex_lock( &cachemutex );
-      flushstate = 0;
-      pthread_mutex_unlock( &cachemutex );
-      //printf("Cache flushed [%d]     \r", c++ );
-      //fflush(stdout);
+      ps_read_block ( line, words, WTC_LINE / 2 );
+      wtc_stats.fill_reads++;
     }
 
-    else
-      usleep(1e5);
+    else for ( int n = 0; n < WTC_LINE / 2; n += 2 )
+    {
+      uint32_t v = ps_read_32 ( line + n * 2 );
+
+      words [n]     = v >> 16;
+      words [n + 1] = v;
+      wtc_stats.fill_reads++;
+    }
+
+    for ( int n = 0; n < WTC_LINE / 2; n++ )
+      mmap_mem_write_16 ( wtc_data, line + n * 2, words [n] );
+
+    *tag |= ( 1u << WTC_LINE ) - 1;
+    wtc_stats.line_fills++;
   }
-  //printf("End of Flushing thread\n");
-}
 
-#else
+  else
+  {
+    switch ( size )
+    {
+      case 4:
+        mmap_mem_write_32 ( wtc_data, address, ps_read_32 ( address ) );
+        break;
+
+      case 2:
+        mmap_mem_write_16 ( wtc_data, address, ps_read_16 ( address ) );
+        break;
 
-#define HIT 1
-#define MISS 0
+      default:
+        mmap_mem_write_8 ( wtc_data, address, ps_read_8 ( address ) );
+        break;
+    }
 
-static uint8_t *cache_p;
-static uint16_t *cacheTable_p;
-static short flushstate = 0; // 0 active, 1 flush request
-pthread_mutex_t cachemutex;
+    *tag |= bits;
+    wtc_stats.word_fills++;
+    wtc_stats.fill_reads++;
+  }
 
+  switch ( size )
+  {
+    case 4:
+      *value = mmap_mem_read_32 ( wtc_data, address );
+      break;
 
+    case 2:
+      *value = mmap_mem_read_16 ( wtc_data, address );
+      break;
+
+    default:
+      *value = mmap_mem_read_8 ( wtc_data, address );
+      break;
+  }
+
+  return true;
+}
 
 int do_cache ( uint32_t address, int size, uint32_t *value, int isread ) 
 {
-  static uint32_t cacheTblAddress;
-  static uint16_t cacheHitBits;
-  static uint8_t  offset;
-  static short    flushstatereq = 0; // go around the houses a bit as don't want to lock for mutex
-  static int      ret;
+  uint32_t *tag;
+  uint32_t bits;
 
+  /* DMA and blitter set up */
+  if ( !isread && ( address & 0x00FFF000 ) == 0x00FF8000 && wtc_sniff_write ( address, size, *value ) )
+    wtc_flush ();
 
-  if ( flushstate > 0 ) // cache is invalid
-    return 0;
-
-  if ( flushstatereq && !flushstate ) // there's been a request to flush and it's not yet set the flush thread's state variable
+  if ( isread && address == 0x00FF8A3C && size < 4 && wtc_blit_running )
   {
-      if ( !pthread_mutex_trylock ( &cachemutex ) ) 
-      {
-        flushstate = 1;
-        flushstatereq = 0;
-
-        pthread_mutex_unlock ( &cachemutex );
-      }
-      memset ( cacheTable_p, 0, ATARI_MEMORY_SIZE >> 4 );
+    *value = size == 1 ? ps_read_8 ( address ) : ps_read_16 ( address );
+    wtc_sniff_blit_done ( size == 1 ? *value : *value >> 8 );
 
-      return 0;
+    return 1;
   }
 
   // DMA registers of interest are at 0x00FF8604 (trigger DMA) and 0x00FFFA01 (MFP GPIP bits to check for completion).
   // Sniff reads from 0x00FFFA01 with a mask against 0x20. If this results is 0, a DMA interrupt has triggered
-  // Blitter not yet sniffed (disable it)
   if ( isread && address == 0x00FFFA01 ) 
   {
     *value = ps_read_8 ( address );
 
-    if ( ( *value & 0x20 ) == 0 )
-    {
-      flushstatereq = 1;
-    }
+    if ( ( *value & 0x20 ) == 0 && wtc_dma_done () )
+      wtc_flush ();
 
     return 1; // we return success here as we've done the read for you
   }    
 
   // STRAM only without low RAM (have to perform this check late as sniffing registers above)
-  if ( ! ( address >= 0x0005B0 && (address < ATARI_MEMORY_SIZE) ) )
-  //if ( address >= ATARI_MEMORY_SIZE )
+  if ( address < 0x0005B0 || address + size > ATARI_MEMORY_SIZE )
     return 0;
 
-	if ( isread ) 
+  tag  = &wtc_tags [address >> WTC_LINE_SHIFT];
+  bits = ( ( 1u << size ) - 1 ) << ( address & ( WTC_LINE - 1 ) );
+
+  /* runs into the next line - only 020+ get here, a byte at a time */
+  if ( bits >= WTC_EPOCH )
+  {
+    if ( isread )
+      return 0;
+
+    for ( int n = 0; n < size; n++ )
+    {
+      uint32_t b = *value >> ( 8 * ( size - 1 - n ) );
+
+      do_cache ( address + n, 1, &b, 0 );
+    }
+
+    return 1;
+  }
+
+  if ( isread ) 
   {
-    ret = HIT;
-    cacheTblAddress = address >> 4; /* convert address to cache hit table byte */
-    offset = address & 0x0f;    /* LSB is used as shift count */
+    /* epoch matches and all the bytes are there */
+    if ( ( *tag ^ ( wtc_epoch | bits ) ) & ( ~( WTC_EPOCH - 1 ) | bits ) )
+    {
+      wtc_stats.misses++;
+
+      return wtc_fill ( address, size, value, tag, bits );
+    }
+
+    wtc_stats.hits++;
 
     switch ( size ) 
     {
-      /* addresses ending in 0, 4, 8, C */
       case 4:
-        cacheHitBits = (0x0F << offset); /* match the bit(s) of the LSB */
-        
-        if ( ( cacheTable_p [cacheTblAddress] & cacheHitBits ) != cacheHitBits)
-        {
-          //printf ( "4 MISS address 0x%X, cacheTable 0x%X, cache bits 0x%X\n", address, cacheTblAddress, cacheHitBits );
-          ret = MISS;
-        }
+        *value = mmap_mem_read_32 ( wtc_data, address );
+        break;
 
-        else
-          *value = (cache_p [address] << 24) | 
-              (cache_p [address + 1] << 16) | 
-              (cache_p [address + 2] << 8)  | 
-               cache_p [address + 3];
+      case 2:
+        *value = mmap_mem_read_16 ( wtc_data, address );
+        break;
 
+      default:
+        *value = mmap_mem_read_8 ( wtc_data, address );
         break;
+    }
 
-      /* addresses ending in 0, 2, 4, 6, 8, A, C, E */
-      case 2:
-        cacheHitBits = (0x03 << offset);
-        
-        if ( ( cacheTable_p [cacheTblAddress] & cacheHitBits ) != cacheHitBits )
-        {
-          //printf ( "2 MISS address 0x%X, cacheTable 0x%X, cache bits 0x%X\n", address, cacheTblAddress, cacheHitBits );
-          ret = MISS;
-        }
+    return 1;
+  }
 
-        else
-          *value = (cache_p [address] << 8) | cache_p [address + 1];
-    
+  switch ( size ) 
+  {
+    case 4:
+      mmap_mem_write_32 ( wtc_data, address, *value );
+      break;
+
+    case 2:
+      mmap_mem_write_16 ( wtc_data, address, *value );
+      break;
+
+    default:
+      mmap_mem_write_8 ( wtc_data, address, *value );
+      break;
+  }
+
+  /* a line left from an older epoch starts out empty again */
+  if ( ( *tag & ~( WTC_EPOCH - 1 ) ) != wtc_epoch )
+    *tag = wtc_epoch;
+
+  *tag |= bits;
+
+  return 1;
+}
+
+
+/*
+ * idle detection (setvar idle)
+ * The CPU is stopped with nothing to take, or goes round a short loop that
+ * changes no register, writes nothing and reads the same from the bus every
+ * time - TOS polling the ACIA or waiting for _hz_200 to move. Instead of
+ * spinning, end the slice and sleep until the IPL changes or Idle_us have
+ * passed, then let the loop go round once more to see whether it still is.
+ */
+unsigned int Idle_us;
+uint32_t idle_sig;              /* bus reads since the last backward branch */
+uint32_t idle_writes;           /* CPU writes since the last backward branch */
+
+#define IDLE_LOOP_BYTES   32    /* furthest a branch may go back to close a polling loop */
+#define IDLE_ITERATIONS   16    /* identical iterations before the loop counts as idle */
+#define IDLE_POLL_NS      20000 /* IPL checked this often while asleep */
+
+#define IDLE_BUS_READ(a,v) do { idle_sig = ( idle_sig ^ (a) ^ ( (uint32_t)(v) << 8 ) ) * 16777619u; } while (0)
+
+static struct {
+  uint32_t pc;                  /* loop head - the branch target */
+  uint32_t sig;
+  uint32_t sr;
+  uint32_t regs [16];
+  uint32_t same;                /* iterations in a row like the one before */
+  bool     idle;                /* slice was ended in the loop, sleep before the next */
+} idle_loop;
+
+static struct {
+  uint64_t loops;               /* sleeps in a polling loop */
+  uint64_t stops;               /* sleeps in STOP */
+  uint64_t wakes;               /* cut short by an IPL change */
+  uint64_t ns;
+} idle_stats;
+
+
+/* the instruction at REG_PPC went back to REG_PC - is it the same iteration as last time? */
+static void __attribute__((noinline)) idle_loop_branch ( m68ki_cpu_core *state )
+{
+  uint32_t sr = m68ki_get_sr ( state );
+
+  if ( REG_PC == idle_loop.pc && idle_sig == idle_loop.sig && idle_writes == 0 
+    && sr == idle_loop.sr && memcmp ( idle_loop.regs, REG_DA, sizeof ( idle_loop.regs ) ) == 0 )
+  {
+    if ( ++idle_loop.same >= IDLE_ITERATIONS )
+    {
+      /* the rest of the slice would only go round again */
+      idle_loop.idle = true;
+      SET_CYCLES ( 0 );
+    }
+  }
+
+  else
+  {
+    idle_loop.pc   = REG_PC;
+    idle_loop.sig  = idle_sig;
+    idle_loop.sr   = sr;
+    idle_loop.same = 0;
+    memcpy ( idle_loop.regs, REG_DA, sizeof ( idle_loop.regs ) );
+  }
+
+  idle_sig = 0;
+  idle_writes = 0;
+}
+
+
+static inline void idle_check ( m68ki_cpu_core *state )
+{
+  if ( Idle_us && REG_PC < REG_PPC && REG_PPC - REG_PC <= IDLE_LOOP_BYTES )
+    idle_loop_branch ( state );
+}
+
+
+/*
+ * called between slices once interrupts have been looked at. Wakes early
+ * when IPL_ZERO falls, or - while the CPU is masking a pending level - when
+ * the level in the status register changes.
+ */
+static void idle_wait ( void )
+{
+  const struct timespec poll = { 0, IDLE_POLL_NS };
+  struct timespec start, now;
+  uint64_t ns;
+
+  if ( idle_loop.idle )
+    idle_stats.loops++;
+
+  else if ( CPU_STOPPED )
+    idle_stats.stops++;
+
+  else
+    return;
+
+  idle_loop.idle = false;
+
+  clock_gettime ( CLOCK_MONOTONIC, &start );
+
+  for ( ;; )
+  {
+    nanosleep ( &poll, NULL );
+
+    clock_gettime ( CLOCK_MONOTONIC, &now );
+    ns = ( now.tv_sec - start.tv_sec ) * 1000000000L + ( now.tv_nsec - start.tv_nsec );
+
+    if ( ns >= Idle_us * 1000ULL || !cpu_emulation_running )
+      break;
+
+    if ( ps_get_ipl_zero () )
+    {
+      /* a masked level went away */
+      if ( last_irq )
         break;
+    }
 
-      case 1:
-      default:
-        cacheHitBits = (0x01 << offset);
-     
-        if ( ( cacheTable_p [cacheTblAddress] & cacheHitBits ) != cacheHitBits )
-        {
-          //printf ( "1 MISS address 0x%X, cacheTable 0x%X, cache bits 0x%X\n", address, cacheTblAddress, cacheHitBits );
-          ret = MISS;
-        }
+    else if ( last_irq == 0 || ( ps_read_status_reg () >> 13 ) != last_irq )
+    {
+      idle_stats.wakes++;
+
+      break;
+    }
+  }
+
+  idle_stats.ns += ns;
+}
+
+
+static void idle_report ( void )
+{
+  if ( !Idle_us || idle_stats.loops + idle_stats.stops == 0 )
+    return;
+
+  printf ( "[IDLE] %llu sleeps in polling loops, %llu in STOP, %llu woken by an interrupt, %llu ms asleep\n",
+    (unsigned long long)idle_stats.loops, (unsigned long long)idle_stats.stops,
+    (unsigned long long)idle_stats.wakes, (unsigned long long)( idle_stats.ns / 1000000 ) );
+}
+
+
+#if (1)
+/* collect a posted write one instruction late and take any bus error - true when one was taken */
+static inline bool m68k_end_instruction ( m68ki_cpu_core *state )
+{
+  /* posted write still outstanding one instruction later - collect it now */
+  if ( ps_write_pending )
+  {
+    if ( ps_write_pending == 1 )
+      ps_sync ();
 
-        else
-          *value = cache_p [address];
+    else
+      ps_write_pending--;
+  }
+
+  if ( g_buserr || ps_posted_berr )
+  {
+    m68ki_exception_bus_error ( state ); 
+    g_buserr = 0;
+    ps_posted_berr = 0;
+
+    return true;
+  }
+
+  return false;
+}
 
-        break;
-    }
 
-    //if ( ret == HIT )
-    //  printf ( "HIT (%8.8x = %2.2x)\n", address, *value );
+/* 
+ * replay a predecoded block - leave it as soon as the cycles run out, an
+ * instruction goes somewhere other than it did when recorded, or the code
+ * region is written to 
+ */
+static inline void bcache_run ( m68ki_cpu_core *state, t_bcache_block *blk )
+{
+  uint32_t  pc     = blk->pc;
+  uint32_t  gen    = blk->gen;
+  uint32_t *region = &bcache_gen [ADDRESS_68K ( pc ) >> BCACHE_REGION_SHIFT];
 
-    return ret;
-  }
+  bcache_stats.blocks++;
 
-  else 
+  for ( uint32_t i = 0; i < blk->count; i++ )
   {
-    cacheTblAddress = address >> 4;
-    offset = address & 0x0f;
-    //printf ( "cache write 0x%X 0x%X size = %d, offset = 0x%X - cacheTblAddress = 0x%X\n", address, *value, size, offset, cacheTblAddress );
-    
-    switch ( size ) 
-    {
-      case 4:
-        cache_p [address]     = *value >> 24;
-        cache_p [address + 1] = *value >> 16;
-        cache_p [address + 2] = *value >> 8;
-        cache_p [address + 3] = *value;
-        cacheTable_p [cacheTblAddress] |= (0x0F << offset);
+    m68ki_use_data_space ();
 
-        break;
+    REG_PPC = pc;
+    REG_PC  = pc + 2;
+    REG_IR  = blk->ir [i];
 
-      case 2:
-        cache_p [address]     = *value >> 8;
-        cache_p [address + 1] = *value;
-        cacheTable_p [cacheTblAddress] |= (0x03 << offset);
-        //printf ( "filling cacheTable 0x%X with 0x%X\n", cacheTblAddress, (0x03 << offset) );
-        break;
+    if ( prof_opcodes )
+      prof_insn ( pc, REG_IR );
 
-      case 1:
-      default:
-        cache_p [address]     = *value;
-        cacheTable_p [cacheTblAddress] |= (0x01 << offset);
+    blk->handler [i] (state);
 
-        break;
-    }
-  }
+    USE_CYCLES ( blk->cycles [i] );
+    bcache_stats.insns++;
 
-  return 1;
-}
+    idle_check ( state );
 
+    if ( m68k_end_instruction ( state ) || GET_CYCLES () <= 0 )
+      break;
 
-// separate thread to reduce impact of flushing 8MB memory each time!
-// overhead reduced now by using cache bit table - from 8MB down to 512KB
-void *cacheflusher ( void *dummy ) 
-{
-  while ( !cpu_emulation_running ) 
-  {
-    sleep (1);
-  }
+    pc = blk->next [i];
 
-  while ( cpu_emulation_running ) 
-  {
-    if ( flushstate ) 
+    if ( REG_PC != pc || *region != gen )
     {
-      memset ( cacheTable_p, 0, ATARI_MEMORY_SIZE >> 4 );
-      memset ( cache_p, 0, ATARI_MEMORY_SIZE );
+      bcache_stats.exits++;
 
-      pthread_mutex_lock ( &cachemutex );
-      flushstate = 0;
-      pthread_mutex_unlock ( &cachemutex );
-      //printf ( "Cache flushed\n" );
+      break;
     }
-
-    else
-      usleep (1000); //(1e5);
   }
-  //printf("End of Flushing thread\n");
+
+  /* the opcode prefetch was skipped - don't let the normal loop trust what is left in it */
+  CPU_PREF_ADDR = ~0;
 }
-#endif
 
 
-#if (1)
 static inline void m68k_execute_bef ( m68ki_cpu_core *state, int num_cycles )
 {
+  static t_bcache_block *bcache_rec;
+
 	/* Set our pool of clock cycles available */
 	SET_CYCLES ( num_cycles );
 	m68ki_initial_cycles = num_cycles;
@@ -445,21 +870,60 @@ static inline void m68k_execute_bef ( m68ki_cpu_core *state, int num_cycles )
 	{
 		/* Main loop.  Keep going until we run out of clock cycles */
 execute:      
+    /* blocks are recorded by logical PC and replayed without the PMMU looking at them */
+    if ( Bcache_enabled && !PMMU_ENABLED )
+    {
+      t_bcache_block *blk = bcache_lookup ( REG_PC, ADDRESS_68K ( REG_PC ) );
+
+      if ( blk )
+      {
+        if ( bcache_rec )
+        {
+          bcache_commit ( bcache_rec );
+          bcache_rec = NULL;
+        }
+
+        bcache_run ( state, blk );
+
+        if ( GET_CYCLES () > 0 )
+          goto execute;
+
+        goto done;
+      }
+
+      if ( !bcache_rec )
+        bcache_rec = bcache_begin ( REG_PC, ADDRESS_68K ( REG_PC ) );
+    }
+
     m68ki_use_data_space ();
 
     REG_PPC = REG_PC;
     REG_IR = m68ki_read_imm16_addr_slowpath ( state, REG_PC );
+
+    if ( prof_opcodes )
+      prof_insn ( REG_PPC, REG_IR );
       
     m68ki_instruction_jump_table [REG_IR] (state);
 
     USE_CYCLES ( CYC_INSTRUCTION [REG_IR] );
 
-    if ( g_buserr )
+    idle_check ( state );
+
+    if ( bcache_rec )
     {
-      m68ki_exception_bus_error ( state ); 
-      g_buserr = 0;
+      /* an instruction that bus errors ends the block without being part of it */
+      if ( g_buserr || ps_posted_berr || PMMU_ENABLED )
+      {
+        bcache_commit ( bcache_rec );
+        bcache_rec = NULL;
+      }
+
+      else
+        bcache_rec = bcache_record ( bcache_rec, REG_PPC, REG_IR, m68ki_instruction_jump_table [REG_IR], CYC_INSTRUCTION [REG_IR], REG_PC );
     }
 
+    m68k_end_instruction ( state );
+
     //else
     //  USE_CYCLES ( CYC_INSTRUCTION [REG_IR] );
 
@@ -467,6 +931,7 @@ execute:
     if ( GET_CYCLES () > 0 )
       goto execute;
 
+done:
     REG_PPC = REG_PC;
 	}
 
@@ -552,6 +1017,25 @@ void sigint_handler ( int sig_num )
   cpu_emulation_running = 0;
   
   DEBUG_PRINTF ( "\n[MAIN] Exiting\n" );
+
+  slice_report ();
+  irq_report ();
+  wcb_report ();
+  wtc_report ();
+  idle_report ();
+  bcache_report ();
+  icache_report ();
+
+  if ( m68ki_fused_count )
+    printf ( "[FUSE] %llu instruction pairs run fused\n", (unsigned long long)m68ki_fused_count );
+
+  ps_bus_report ();
+  if ( ps_stats_enabled )
+    ps_stats_print ( ps_stats );
+
+  ps_stats_unpublish ();
+  ps_trace_stop ();
+  prof_stop ();
   
   if ( mem_fd )
     close ( mem_fd );
@@ -571,24 +1055,192 @@ void sigint_handler ( int sig_num )
   oldt.c_lflag |= ECHO;
   tcsetattr ( STDIN_FILENO, TCSANOW, &oldt );
   fcntl ( STDIN_FILENO, F_SETFL, oldf );
-#if MYWTC
-  free ( cacheTable_p );
-  free ( cache_p );
-#endif
-
-  if ( WTC_initialised )
-    pthread_mutex_destroy ( &cachemutex );
+  free ( wtc_tags );
+  free ( wtc_data );
 
   exit ( 0 );
 }
 
 
+/*
+ * adaptive timeslice (setvar adaptive)
+ * halve the slice while an interrupt is pending or the CPU is touching the IO
+ * area (MFP polling, sound, video registers), double it while a slice made no
+ * bus accesses at all - code and data in ROM/ALT-RAM. Bounded to 1/8 .. 8x
+ * of loopcycles.
+ */
+static unsigned int slice_cycles;
+static unsigned int slice_min, slice_max;
+volatile uint32_t slice_bus;
+volatile uint32_t slice_io;
+
+#define SLICE_BUS_ACCESS(a) do { slice_bus++; if ( ( (a) & 0xFFFF8000 ) == 0x00FF8000 ) slice_io++; } while (0)
+
+static struct {
+  uint64_t slices;
+  uint64_t cycles;
+  uint64_t hist [16];     /* slice sizes, power of 2 buckets */
+  uint64_t irqs;
+  uint64_t latency_ns;    /* last slice end with IPL 0 to IACK - an upper bound */
+  uint64_t latency_max;
+  struct timespec quiet;  /* last slice end with IPL 0 */
+} slice_stats;
+
+
+static inline void slice_adapt ( void )
+{
+  int b = 31 - __builtin_clz ( slice_cycles );
+
+  slice_stats.slices++;
+  slice_stats.cycles += slice_cycles;
+  slice_stats.hist [b > 15 ? 15 : b]++;
+
+  if ( last_irq || slice_io )
+    slice_cycles = slice_cycles / 2 < slice_min ? slice_min : slice_cycles / 2;
+
+  else if ( slice_bus == 0 )
+    slice_cycles = slice_cycles * 2 > slice_max ? slice_max : slice_cycles * 2;
+
+  if ( last_irq == 0 )
+    clock_gettime ( CLOCK_MONOTONIC, &slice_stats.quiet );
+
+  slice_bus = 0;
+  slice_io = 0;
+}
+
+
+/* called on IACK - first acknowledge after a quiet slice counts */
+static inline void slice_irq_latency ( void )
+{
+  struct timespec now;
+  uint64_t ns;
+
+  if ( slice_stats.quiet.tv_sec == 0 )
+    return;
+
+  clock_gettime ( CLOCK_MONOTONIC, &now );
+
+  ns = ( now.tv_sec - slice_stats.quiet.tv_sec ) * 1000000000L + ( now.tv_nsec - slice_stats.quiet.tv_nsec );
+
+  slice_stats.irqs++;
+  slice_stats.latency_ns += ns;
+
+  if ( ns > slice_stats.latency_max )
+    slice_stats.latency_max = ns;
+
+  slice_stats.quiet.tv_sec = 0;
+}
+
+
+static void slice_report ( void )
+{
+  if ( !Slice_adaptive || slice_stats.slices == 0 )
+    return;
+
+  printf ( "[SLICE] %llu slices, average %llu cycles (%u..%u)\n", 
+    (unsigned long long)slice_stats.slices, (unsigned long long)( slice_stats.cycles / slice_stats.slices ), slice_min, slice_max );
+
+  for ( int b = 0; b < 16; b++ )
+    if ( slice_stats.hist [b] )
+      printf ( "[SLICE]   %5u+ cycles %5.1f%%\n", 1 << b, 100.0 * slice_stats.hist [b] / slice_stats.slices );
+
+  if ( slice_stats.irqs )
+    printf ( "[SLICE] %llu interrupts, latency average %llu us max %llu us\n", 
+      (unsigned long long)slice_stats.irqs, 
+      (unsigned long long)( slice_stats.latency_ns / slice_stats.irqs / 1000 ), 
+      (unsigned long long)( slice_stats.latency_max / 1000 ) );
+}
+
+
+/*
+ * IPL_ZERO is low - decide whether the status register has to be read. 
+ * Always when the pending level is new or the CPU would take it. A level the
+ * CPU masks (HBL on the ST sits at IPL 2 most of the time) is only re-read
+ * every IPL_poll_ns, so a higher level behind it still gets through.
+ */
+static inline bool ipl_status_due ( m68ki_cpu_core *state )
+{
+  static struct timespec last;
+  struct timespec now;
+
+  if ( last_irq == 0 || last_irq == 7 || ( last_irq << 8 ) > FLAG_INT_MASK || IPL_poll_ns == 0 )
+  {
+    clock_gettime ( CLOCK_MONOTONIC, &last );
+
+    return true;
+  }
+
+  clock_gettime ( CLOCK_MONOTONIC, &now );
+
+  if ( ( now.tv_sec - last.tv_sec ) * 1000000000L + ( now.tv_nsec - last.tv_nsec ) < IPL_poll_ns )
+    return false;
+
+  last = now;
+
+  return true;
+}
+
+
+static struct {
+  uint64_t taken;
+  uint64_t masked;        /* levels left pending because SR masks them */
+  uint64_t ns;            /* IACK, vector fetch and stack frame */
+  uint64_t bus;
+} irq_stats;
+
+/*
+ * Hand the pending level to the CPU. Nothing can happen while SR masks it
+ * (unless it is a new NMI), so the level is only latched and
+ * m68ki_check_interrupts () is skipped - on the ST that is every slice with
+ * HBL pending. Taken interrupts are timed for irq_report ().
+ */
+static inline void cpu_deliver_irq ( m68ki_cpu_core *state, uint32_t level )
+{
+  struct timespec start, end;
+  uint32_t bus;
+
+  m68k_set_irq ( level );
+
+  if ( !state->nmi_pending && ( level << 8 ) <= FLAG_INT_MASK )
+  {
+    if ( level )
+      irq_stats.masked++;
+
+    return;
+  }
+
+  clock_gettime ( CLOCK_MONOTONIC, &start );
+  bus = slice_bus;
+
+  m68ki_check_interrupts ( state );
+
+  clock_gettime ( CLOCK_MONOTONIC, &end );
+
+  irq_stats.taken++;
+  irq_stats.ns += ( end.tv_sec - start.tv_sec ) * 1000000000L + ( end.tv_nsec - start.tv_nsec );
+  irq_stats.bus += slice_bus - bus;
+}
+
+
+static void irq_report ( void )
+{
+  if ( irq_stats.taken == 0 )
+    return;
+
+  printf ( "[IRQ] %llu interrupts taken, %llu ns and %.1f bus accesses each, %llu masked levels not checked\n",
+    (unsigned long long)irq_stats.taken, (unsigned long long)( irq_stats.ns / irq_stats.taken ),
+    (double)irq_stats.bus / irq_stats.taken, (unsigned long long)irq_stats.masked );
+}
+
+
 void *cpu_task () 
 {
   const struct sched_param priority = {99};
   uint16_t status;
 	m68ki_cpu_core *state = &m68ki_cpu;
 
+  ps_bus_register ( "cpu" );
+
   state->gpio = gpio;
 	m68k_pulse_reset(state);
 
@@ -601,8 +1253,14 @@ void *cpu_task ()
   while ( !cpu_emulation_running )
     ;
 
+  slice_cycles = loop_cycles;
+  slice_min = loop_cycles / 8 ? loop_cycles / 8 : 1;
+  slice_max = loop_cycles * 8;
+
 run:
-  m68k_execute_bef ( state, loop_cycles );
+  m68k_execute_bef ( state, slice_cycles );
+
+  wcb_drain ();
 
 #if (0)
   status = ps_read_status_reg ();
@@ -682,56 +1340,292 @@ run:
   }  
 #else
 
-  status = ps_read_status_reg ();
+  /* 
+   * the CPLD drives IPL_ZERO high while no interrupt is pending and the ST is
+   * not in reset - only go to the bus for the status register when it is low
+   */
+  if ( ps_get_ipl_zero () )
+    last_irq = 0;
 
-  if ( status == 0xFFFF )
+  else if ( ipl_status_due ( state ) )
   {
-    printf ( "bad status\n" );
+    status = ps_read_status_reg ();
+
+    if ( status == 0xFFFF )
+    {
+      printf ( "bad status\n" );
+    }
+
+    else
+    {
+      if ( status & 0x2 ) 
+      {
+        M68K_END_TIMESLICE;
+
+        printf ( "[CPU] Emulation reset - status = 0x%X\n", status );
+
+        usleep ( 1000000 ); 
+
+        m68k_pulse_reset ( state );
+      }
+
+      else
+      {
+        last_irq = status >> 13;
+
+        //printf ( "IPL %d\n", last_irq );
+
+        if ( last_irq != 0 )
+          cpu_deliver_irq ( state, last_irq );
+      }
+    }
+  }
+
+  if ( last_irq == 0 )
+    cpu_deliver_irq ( state, 0 );
+  
+#endif  
+#endif
+  if ( Idle_us )
+    idle_wait ();
+
+  if ( Slice_adaptive )
+    slice_adapt ();
+
+  if ( !cpu_emulation_running )
+  {
+    printf ("[CPU] End of CPU thread\n");
+
+    return (void *)NULL;
+  }
+
+  goto run; /* cryptodad - goto is faster than using while () */
+}
+
+
+/*
+ * ROM shadow (setvar romshadow [cart] [verify]). The motherboard TOS, and with
+ * cart a cartridge at 0xFA0000, is read over the bus once, kept in
+ * ROM_CACHE_DIR and mapped as host ROM. The cache key is the CRC32 of the
+ * header (TOS version at +2, os_base at +8, build date at +0x18) and the last
+ * word of every 4K, so later boots find the image with a few dozen bus reads
+ * and load it from the file. verify reads the whole ROM every boot and
+ * replaces a saved copy that differs anywhere. The cached files are plain
+ * dumps, they can be used with map type=rom as they are.
+ */
+#define ROM_CACHE_DIR   "romcache"
+#define ROM_HEAD_BYTES  0x30
+#define ROM_SAMPLE_STEP 0x1000
+#define ROM_SAMPLE_MAX  ( ROM_HEAD_BYTES + 256 * SIZE_KILO / ROM_SAMPLE_STEP * 2 )
+
+bool ROM_shadow;
+bool ROM_shadow_cart;
+bool ROM_shadow_verify;
+
+static uint32_t rom_crc32 ( const uint8_t *p, uint32_t n )
+{
+  uint32_t crc = 0xFFFFFFFF;
+
+  while ( n-- )
+  {
+    crc ^= *p++;
+
+    for ( int k = 0; k < 8; k++ )
+      crc = ( crc >> 1 ) ^ ( 0xEDB88320 & -( crc & 1 ) );
+  }
+
+  return ~crc;
+}
+
+/* big endian, as the bytes sit on the bus - the layout of an ataritest --dumprom */
+static void rom_bus_read ( uint32_t address, uint8_t *buf, uint32_t size )
+{
+  static uint16_t words [0x800];
+  uint32_t n;
+
+  for ( uint32_t off = 0; off < size; off += n * 2 )
+  {
+    n = ( size - off ) / 2 < 0x800 ? ( size - off ) / 2 : 0x800;
+
+    ps_read_block ( address + off, words, n );
+
+    for ( uint32_t w = 0; w < n; w++ )
+    {
+      buf [off + w * 2]     = words [w] >> 8;
+      buf [off + w * 2 + 1] = words [w];
+    }
+  }
+}
+
+/* the bytes the cache key is made of - from the bus, or from an image when given one */
+static uint32_t rom_sample ( uint32_t base, uint32_t size, const uint8_t *image, uint8_t *sample )
+{
+  uint32_t n = ROM_HEAD_BYTES;
+
+  if ( image )
+    memcpy ( sample, image, ROM_HEAD_BYTES );
+
+  else
+    rom_bus_read ( base, sample, ROM_HEAD_BYTES );
+
+  for ( uint32_t off = ROM_SAMPLE_STEP - 2; off < size; off += ROM_SAMPLE_STEP, n += 2 )
+  {
+    if ( image )
+      memcpy ( sample + n, image + off, 2 );
+
+    else
+    {
+      uint16_t w = ps_read_16 ( base + off );
+
+      sample [n]     = w >> 8;
+      sample [n + 1] = w;
+    }
+  }
+
+  return n;
+}
+
+static void rom_shadow_map ( uint32_t base, uint32_t size, char *name )
+{
+  uint8_t  sample [ROM_SAMPLE_MAX], saved_sample [ROM_SAMPLE_MAX];
+  uint8_t  *image, *bus;
+  uint32_t n;
+  char     file [64];
+  FILE     *f;
+  bool     cached, read = false;
+
+  for ( int i = 0; i < MAX_NUM_MAPPED_ITEMS; i++ )
+  {
+    if ( cfg->map_type [i] != MAPTYPE_NONE && base < cfg->map_high [i] && base + size > cfg->map_offset [i] )
+    {
+      printf ( "[ROM] %s at 0x%06X is mapped by the config - not shadowed\n", name, base );
+
+      return;
+    }
+  }
+
+  image = malloc ( size );
+
+  if ( image == NULL )
+    return;
+
+  n = rom_sample ( base, size, NULL, sample );
+  snprintf ( file, sizeof ( file ), ROM_CACHE_DIR "/%s-%06X-%08X.img", name, base, rom_crc32 ( sample, n ) );
+
+  f = fopen ( file, "rb" );
+  cached = f && fread ( image, size, 1, f ) == 1
+    && rom_sample ( base, size, image, saved_sample ) == n && memcmp ( sample, saved_sample, n ) == 0;
+
+  if ( f )
+    fclose ( f );
+
+  if ( cached && ROM_shadow_verify )
+  {
+    bus = malloc ( size );
+
+    if ( bus == NULL )
+    {
+      free ( image );
+
+      return;
+    }
+
+    rom_bus_read ( base, bus, size );
+
+    if ( memcmp ( image, bus, size ) )
+    {
+      printf ( "[ROM] %s at 0x%06X differs from %s - replaced\n", name, base, file );
+
+      memcpy ( image, bus, size );
+      cached = false;
+    }
+
+    free ( bus );
+    read = true;
   }
 
+  if ( cached )
+    printf ( "[ROM] %s at 0x%06X shadowed from %s%s\n", name, base, file, ROM_shadow_verify ? " (verified)" : "" );
+
   else
   {
-    if ( status & 0x2 ) 
+    /* verify has just read it */
+    if ( !read )
+      rom_bus_read ( base, image, size );
+
+    mkdir ( ROM_CACHE_DIR, 0755 );
+
+    f = fopen ( file, "wb" );
+
+    if ( f == NULL || fwrite ( image, size, 1, f ) != 1 )
     {
-      M68K_END_TIMESLICE;
+      printf ( "[ROM] Cannot write %s - %s left on the bus\n", file, name );
+
+      if ( f )
+      {
+        fclose ( f );
+        remove ( file );
+      }
+
+      free ( image );
+
+      return;
+    }
+
+    fclose ( f );
+
+    printf ( "[ROM] %s at 0x%06X read from the bus (%d KB, CRC32 %08X), cached as %s\n", 
+      name, base, size / 1024, rom_crc32 ( image, size ), file );
+  }
+
+  free ( image );
+
+  add_mapping ( cfg, MAPTYPE_ROM, base, size, -1, file, name, 0 );
+}
+
+/* TOS starts with a BRA and holds its own base address (os_beg) at offset 8 */
+static bool rom_is_tos ( uint32_t base )
+{
+  uint8_t hdr [12];
+
+  rom_bus_read ( base, hdr, sizeof ( hdr ) );
+
+  return hdr [0] == 0x60 && ( ( (uint32_t)hdr [8] << 24 ) | ( hdr [9] << 16 ) | ( hdr [10] << 8 ) | hdr [11] ) == base;
+}
 
-      printf ( "[CPU] Emulation reset - status = 0x%X\n", status );
+static void rom_shadow ( void )
+{
+  uint8_t magic [4];
+  uint8_t cur = fc;
 
-      usleep ( 1000000 ); 
+  if ( !ROM_shadow )
+    return;
 
-      m68k_pulse_reset ( state );
-    }
+  fc = 6;
 
-    else
-    {
-      last_irq = status >> 13;
+  if ( rom_is_tos ( 0x00E00000 ) )
+    rom_shadow_map ( 0x00E00000, 256 * SIZE_KILO, "TOS" );
 
-      //printf ( "IPL %d\n", last_irq );
+  else if ( rom_is_tos ( 0x00FC0000 ) )
+    rom_shadow_map ( 0x00FC0000, 192 * SIZE_KILO, "TOS" );
 
-      if ( last_irq != 0 )
-      {
-        m68k_set_irq ( last_irq );
-        m68ki_check_interrupts ( state );
-      }
-    }
-  }
+  else
+    printf ( "[ROM] No TOS found at 0xE00000 or 0xFC0000 - nothing shadowed\n" );
 
-  if ( last_irq == 0 )
-  {
-    m68k_set_irq ( 0 );
-    m68ki_check_interrupts ( state );
-  }  
-  
-#endif  
-#endif
-  if ( !cpu_emulation_running )
+  if ( ROM_shadow_cart )
   {
-    printf ("[CPU] End of CPU thread\n");
+    rom_bus_read ( 0x00FA0000, magic, sizeof ( magic ) );
 
-    return (void *)NULL;
+    /* an application cartridge - diagnostic ones (0xFA52235F) take over at reset and are left alone */
+    if ( magic [0] == 0xAB && magic [1] == 0xCD && magic [2] == 0xEF && magic [3] == 0x42 )
+      rom_shadow_map ( 0x00FA0000, 128 * SIZE_KILO, "Cartridge" );
   }
 
-  goto run; /* cryptodad - goto is faster than using while () */
+  /* an ST without the STe ROM area answers 0xE00000 with a bus error */
+  g_buserr = 0;
+  fc = cur;
+
+  adjust_ranges_atari ( cfg );
 }
 
 
@@ -740,8 +1634,10 @@ int main ( int argc, char *argv[] )
   const struct sched_param priority = {99};
   int g;
   int err;
-  pthread_t rtg_tid, cpu_tid, flush_tid;
+  pthread_t rtg_tid, cpu_tid;
   time_t t;
+  const char *trace_filename = NULL;
+  const char *profile_filename = NULL;
 #ifndef PI3
   int targetF = 125;
 #else
@@ -786,6 +1682,46 @@ int main ( int argc, char *argv[] )
       }
     }
 
+    if ( strcmp ( argv [g], "--membench" ) == 0 )
+      MMAP_benchmark = true;
+
+    /* FPU fast path against softfloat, needs no config or hardware */
+    if ( strcmp ( argv [g], "--fputest" ) == 0 )
+      return m68k_fpu_check_fast_path ( g + 1 < argc ? atoi ( argv [g + 1] ) : 100000 ) ? 1 : 0;
+
+    if ( strcmp ( argv [g], "--trace" ) == 0 )
+    {
+      if ( g + 1 >= argc ) 
+      {
+        DEBUG_PRINTF ( "%s switch found, but missing parameter.\n", argv[g] );
+      } 
+
+      else
+        trace_filename = argv [++g];
+    }
+
+    if ( strcmp ( argv [g], "--profile" ) == 0 )
+    {
+      if ( g + 1 >= argc ) 
+      {
+        DEBUG_PRINTF ( "%s switch found, but missing parameter.\n", argv[g] );
+      } 
+
+      else
+        profile_filename = argv [++g];
+    }
+
+    if ( strcmp ( argv [g], "--bus" ) == 0 )
+    {
+      if ( g + 1 >= argc ) 
+      {
+        DEBUG_PRINTF ( "%s switch found, but missing parameter.\n", argv[g] );
+      } 
+
+      else if ( ps_select_backend ( argv [++g] ) )
+        return 1;
+    }
+
     if ( strcmp ( argv [g], "--clock" ) == 0 )
     {
       if ( g + 1 >= argc ) 
@@ -850,6 +1786,15 @@ int main ( int argc, char *argv[] )
     cfg->platform->platform_initial_setup ( cfg );
   }
 
+  /* time the memory dispatch without touching the Atari bus */
+  if ( MMAP_benchmark )
+  {
+    memory_map_build ();
+    memory_map_benchmark ();
+
+    return 0;
+  }
+
   /* determine ROM */
   bool ROM = 0;
   
@@ -868,6 +1813,15 @@ int main ( int argc, char *argv[] )
 
   mlockall ( MCL_CURRENT );  // lock in memory to keep us from paging out
 
+  ps_bus_register ( "main" );
+  ps_stats_publish ();
+
+  if ( trace_filename && ps_trace_start ( trace_filename ) )
+    return 1;
+
+  if ( profile_filename && prof_start ( profile_filename ) )
+    return 1;
+
   ps_setup_protocol ( targetF );
   ps_reset_state_machine ();
   ps_pulse_reset ();
@@ -878,6 +1832,13 @@ int main ( int argc, char *argv[] )
 	m68k_set_cpu_type ( &m68ki_cpu, cpu_type );
   m68k_set_int_ack_callback ( &cpu_irq_ack );
 
+  /* the block cache records and replays single handlers, a fused one would run away from it */
+  if ( Fuse_enabled && Bcache_enabled )
+    printf ( "[MAIN] Fused handlers can not be used with the block cache - not fusing\n" );
+
+  else if ( Fuse_enabled )
+    printf ( "[MAIN] Fused handlers installed for %d opcodes\n", m68ki_fuse_opcode_table () );
+
   cpu_pulse_reset ();
 
   /* Initialise Interfaces */
@@ -897,6 +1858,11 @@ int main ( int argc, char *argv[] )
 
     printf ( "[MAIN] Faux Blitter Initialised\n" );
   }
+
+  rom_shadow ();
+
+  /* devices are known now - (re)build the memory dispatch table */
+  memory_map_build ();
  
   err = pthread_create ( &cpu_tid, NULL, &cpu_task, NULL );
 
@@ -935,16 +1901,20 @@ int main ( int argc, char *argv[] )
 
   usleep ( 5 );
 
+  static const uint16_t probe [4] = { 0x1256, 0xA55A, 0x0FF0, 0xC33C };
+  uint16_t back [4];
+
   for ( int m = 0, s = 0x00080000; m < 4; m++, s <<= 1 )
   {     
     usleep ( 5 );
 
-    ps_write_8 ( s, 0x12 );
-    ps_write_8 ( s + 1, 0x56 );
+    ps_write_block ( s, probe, 4 );
 
     usleep ( 5 );
 
-    if ( ps_read_8 ( s ) != 0x12 || ps_read_8 ( s + 1 ) != 0x56 )
+    ps_read_block ( s, back, 4 );
+
+    if ( memcmp ( probe, back, sizeof ( probe ) ) )
     {
       ATARI_MEMORY_SIZE = s;
 
@@ -968,36 +1938,11 @@ int main ( int argc, char *argv[] )
 
   if ( WTC_enabled )
   {
-#if MYWTC
-    cache_p = malloc ( ATARI_MEMORY_SIZE );
-    cacheTable_p = malloc ( ATARI_MEMORY_SIZE / 16 );
-
-    if ( cache_p && cacheTable_p )
-    {
-#endif
+    if ( wtc_init () )
       WTC_initialised = true;
-#if (1)
-      pthread_mutex_init ( &cachemutex, NULL );
-      err = pthread_create ( &flush_tid, NULL, &cacheflusher, NULL );
-
-      if ( err != 0 )
-        DEBUG_PRINTF ( "[ERROR] Cannot create WTC Flushing thread: [%s]", strerror (err) );
-
-      else 
-      {
-        pthread_setname_np ( rtg_tid, "pistorm: flusher" );
-        printf ( "[MAIN] WTC Flushing thread created successfully\n" );
-      }
-#endif
-
-#if MYWTC
-    }
 
     else
-    {
-      DEBUG_PRINTF ( "[ERROR] Failed to allocate memory to WTC\n", strerror (err) );
-    }
-#endif
+      DEBUG_PRINTF ( "[ERROR] Failed to allocate memory to WTC\n" );
   }
 
 
@@ -1040,27 +1985,231 @@ int main ( int argc, char *argv[] )
 }
 
 
+/*
+ * Write-through copy of the exception vectors at 0x008-0x3FF. Every trap,
+ * interrupt and exception fetches a long from there - once a vector has been
+ * read or written over the bus it is served from here. Only supervisor longs
+ * are kept, so user mode accesses still go out and take their bus error.
+ */
+#define VECTOR_SHADOW_TOP 0x400
+
+static uint32_t vector_shadow [VECTOR_SHADOW_TOP / 4];
+static uint32_t vector_valid [VECTOR_SHADOW_TOP / 128];  /* one bit per vector */
+
+static inline void vector_shadow_flush ( void )
+{
+  memset ( vector_valid, 0, sizeof ( vector_valid ) );
+}
+
+static inline bool vector_shadow_read ( uint32_t address, uint32_t *value )
+{
+  uint32_t v = address >> 2;
+
+  if ( !Vector_shadow || address >= VECTOR_SHADOW_TOP || ( address & 3 ) || !( fc & 4 ) )
+    return false;
+
+  if ( !( vector_valid [v >> 5] & ( 1u << ( v & 31 ) ) ) )
+    return false;
+
+  *value = vector_shadow [v];
+
+  return true;
+}
+
+/* bus read or write of vectors - keep an aligned supervisor long, drop anything else it touches */
+static inline void vector_shadow_update ( uint32_t address, int size, uint32_t value )
+{
+  uint32_t v;
+
+  if ( !Vector_shadow || address >= VECTOR_SHADOW_TOP )
+    return;
+
+  if ( size == 4 && !( address & 3 ) && ( fc & 4 ) && !g_buserr )
+  {
+    v = address >> 2;
+    vector_shadow [v] = value;
+    vector_valid [v >> 5] |= 1u << ( v & 31 );
+
+    return;
+  }
+
+  for ( uint32_t a = address & ~3; a < address + size && a < VECTOR_SHADOW_TOP; a += 4 )
+  {
+    v = a >> 2;
+    vector_valid [v >> 5] &= ~( 1u << ( v & 31 ) );
+  }
+}
+
+
+/*
+ * Write combining (setvar combine). Byte and word stores to plain ST-RAM are
+ * held back and merged with the next store when it is adjacent, has the same
+ * FC and the lot still fits an aligned-to-even long - two bytes go out as one
+ * word write, two words as one long. Anything else (IO, devices, reads that
+ * may see the bytes, interrupts, slice end) drains it first, so the ST only
+ * ever sees RAM writes late, never out of order with its registers.
+ */
+#define WCB_LOW 0x800           /* below is supervisor only - a user store must still see its bus error */
+
+bool Write_combine;
+
+static struct {
+  uint32_t lo, hi;              /* pending bytes lo..hi-1, empty when equal */
+  uint8_t  fc;
+  uint8_t  b [8];               /* indexed by address & 7 */
+} wcb;
+
+static struct {
+  uint64_t stores;
+  uint64_t writes;
+} wcb_stats;
+
+static void __attribute__((noinline)) wcb_flush ( void )
+{
+  uint32_t a = wcb.lo;
+  uint8_t  cur = fc;
+
+  fc = wcb.fc;
+
+  if ( a & 1 )
+  {
+    ps_write_8 ( a, wcb.b [a & 7] );
+    wcb_stats.writes++;
+    a++;
+  }
+
+  if ( wcb.hi - a == 4 )
+  {
+    ps_write_32 ( a, ( (uint32_t)wcb.b [a & 7] << 24 ) | ( wcb.b [( a + 1 ) & 7] << 16 ) | ( wcb.b [( a + 2 ) & 7] << 8 ) | wcb.b [( a + 3 ) & 7] );
+    wcb_stats.writes++;
+    a += 4;
+  }
+
+  else if ( wcb.hi - a >= 2 )
+  {
+    ps_write_16 ( a, ( wcb.b [a & 7] << 8 ) | wcb.b [( a + 1 ) & 7] );
+    wcb_stats.writes++;
+    a += 2;
+  }
+
+  if ( a < wcb.hi )
+  {
+    ps_write_8 ( a, wcb.b [a & 7] );
+    wcb_stats.writes++;
+  }
+
+  wcb.hi = wcb.lo;
+  fc = cur;
+}
+
+static inline void wcb_drain ( void )
+{
+  if ( wcb.lo != wcb.hi )
+    wcb_flush ();
+}
+
+/* bus read - drain if it is outside ST-RAM or shares a 16 byte line (a WTC fill) with the pending bytes */
+static inline void wcb_read ( uint32_t address, int size )
+{
+  if ( wcb.lo != wcb.hi
+    && ( address >= ATARI_MEMORY_SIZE
+      || ( ( address >> 4 ) <= ( ( wcb.hi - 1 ) >> 4 ) && ( ( address + size - 1 ) >> 4 ) >= ( wcb.lo >> 4 ) ) ) )
+    wcb_flush ();
+}
+
+/* shared page (IO, page 0, config maps) - drain unless the access is to ST-RAM the buffer could hold */
+static inline void wcb_slow ( uint32_t address )
+{
+  if ( wcb.lo != wcb.hi && ( address < WCB_LOW || address >= ATARI_MEMORY_SIZE ) )
+    wcb_flush ();
+}
+
+/* byte or word store to ST-RAM - true when it has been taken into the buffer */
+static inline bool wcb_store ( uint32_t address, int size, uint32_t value )
+{
+  uint32_t lo, hi;
+
+  if ( !Write_combine || address < WCB_LOW || address + size > ATARI_MEMORY_SIZE )
+    return false;
+
+  if ( wcb.lo != wcb.hi )
+  {
+    lo = address < wcb.lo ? address : wcb.lo;
+    hi = address + size > wcb.hi ? address + size : wcb.hi;
+
+    if ( fc != wcb.fc || address > wcb.hi || address + size < wcb.lo || ( ( hi + 1 ) & ~1 ) - ( lo & ~1 ) > 4 )
+    {
+      wcb_flush ();
+      lo = address;
+      hi = address + size;
+    }
+  }
+
+  else
+  {
+    lo = address;
+    hi = address + size;
+  }
+
+  wcb.lo = lo;
+  wcb.hi = hi;
+  wcb.fc = fc;
+
+  if ( size == 2 )
+  {
+    wcb.b [address & 7]         = value >> 8;
+    wcb.b [( address + 1 ) & 7] = value;
+  }
+
+  else
+    wcb.b [address & 7] = value;
+
+  wcb_stats.stores++;
+
+  /* an aligned long cannot grow any further */
+  if ( !( lo & 1 ) && hi - lo == 4 )
+    wcb_flush ();
+
+  return true;
+}
+
+static void wcb_report ( void )
+{
+  if ( wcb_stats.stores == 0 )
+    return;
+
+  wcb_drain ();
+
+  printf ( "[WCB] %llu byte/word stores went out as %llu bus writes\n",
+    (unsigned long long)wcb_stats.stores, (unsigned long long)wcb_stats.writes );
+}
+
+
 /* CPU RESET instruction has been called */
 void cpu_pulse_reset ( void ) 
 {
+  wcb_drain ();
+
   if ( WTC_initialised )
-  {
-    pthread_mutex_lock( &cachemutex );
-    flushstate = 1;
-    pthread_mutex_unlock( &cachemutex );
-  }
+    wtc_flush ();
 
   /* re-initialise graphics */
   if ( ET4000Initialised )
     et4000Init ();
 
+  if ( cfg )
+    memory_map_build ();
+
   //printf ( "reset instruction\n" );
   ps_pulse_reset ();
 
   /* clear ATARI system vectors and system variables */
   //for ( uint32_t n = 0x380; n < 0x5B4; n += 2 )
-  for ( uint32_t n = 0x8; n < 0x5B4; n += 2 )
-    ps_write_16 ( n, 0 );
+  static const uint16_t sysvars [(0x5B4 - 0x8) / 2];
+
+  ps_write_block ( 0x8, sysvars, (0x5B4 - 0x8) / 2 );
+
+  vector_shadow_flush ();
 }
 
 
@@ -1075,22 +2224,137 @@ inline uint16_t cpu_irq_ack ( int level )
   static uint32_t ack;
   static uint8_t vec;
 
+  if ( Slice_adaptive )
+    slice_irq_latency ();
+
+  wcb_drain ();
+
   fc  = 0x7; // CPU interrupt acknowledge
   ack = 0x00fffff0 | (level << 1);
+
+  /* 
+   * HBL and VBL are autovectored - the GLUE answers with VPA and no vector.
+   * The cycle still has to run, it is what clears the GLUE's pending latch.
+   */
+  if ( level == 2 || level == 4 )
+  {
+    ps_read_16 ( ack );
+
+    return M68K_INT_ACK_AUTOVECTOR;
+  }
+
   vec = ps_read_16 ( ack );
-  
-  //if ( level < 6 ) // autovectors
-  if ( level == 2 || level == 4 ) // autovectors
-  	return 24 + level;
-  
+
   return vec;
 }
 
 
 
 
-extern int blitRead ( uint8_t type, uint32_t addr, uint32_t *res );
-extern int blitWrite ( uint8_t type, uint32_t addr, uint32_t val );
+/* Set Atari's date/time - picked up by TOS program -> pistorm.prg */
+/* FFFC40 is undefined in the Atari-Compendium, coming after MSTe RTC defines */
+/* pistorm.prg reads these two 16bit addresses, then writes date/time to IKBD */
+static int rtcRead ( uint8_t type, uint32_t addr, uint32_t *res )
+{
+  uint16_t atari_dt;
+  uint16_t atari_tm;
+  time_t t = time ( NULL );
+  struct tm tm = *localtime ( &t );
+
+  atari_dt  = (tm.tm_year - 80) << 9;
+  atari_dt |= (tm.tm_mon + 1) << 5;
+  atari_dt |=  tm.tm_mday;
+
+  atari_tm  = tm.tm_hour << 11;
+  atari_tm |= tm.tm_min << 5;
+  atari_tm |= tm.tm_sec / 2;
+
+  if ( addr == 0x00FFFC40 )
+    *res = atari_dt;
+
+  else if ( addr == 0x00FFFC42 )
+    *res = atari_tm;
+
+  return 1;
+}
+
+/* RTC is read only, writes go out to the bus */
+static int rtcWrite ( uint8_t type, uint32_t addr, uint32_t val )
+{
+  return 0;
+}
+
+static int et4000PageRead ( uint8_t type, uint32_t addr, uint32_t *res )
+{
+  return et4000Read ( addr, res, type );
+}
+
+static int et4000PageWrite ( uint8_t type, uint32_t addr, uint32_t val )
+{
+  et4000Write ( addr, val, type );
+
+  return 1;
+}
+
+static int registerPageRead ( uint8_t type, uint32_t addr, uint32_t *res )
+{
+  return cfg->platform->register_read ( addr, type, res ) != -1;
+}
+
+/* the faux blitter writes ST-RAM straight to the bus */
+static int blitPageWrite ( uint8_t type, uint32_t addr, uint32_t val )
+{
+  if ( WTC_initialised )
+    wtc_sniff_faux_blit ( addr, type == OP_TYPE_BYTE ? 1 : type == OP_TYPE_WORD ? 2 : 4, val );
+
+  return blitWrite ( type, addr, val );
+}
+
+static int registerPageWrite ( uint8_t type, uint32_t addr, uint32_t val )
+{
+  return cfg->platform->register_write ( addr, val, type ) != -1;
+}
+
+
+/* 
+ * Build the page table used by m68k_read/write_memory_* from the config maps 
+ * and the enabled devices. Called at startup and on every reset.
+ */
+void memory_map_build ( void )
+{
+  mmap_devices [MMAP_DEV_BLITTER].read   = blitRead;
+  mmap_devices [MMAP_DEV_BLITTER].write  = blitPageWrite;
+  mmap_devices [MMAP_DEV_ET4000].read    = et4000PageRead;
+  mmap_devices [MMAP_DEV_ET4000].write   = et4000PageWrite;
+  mmap_devices [MMAP_DEV_RTC].read       = rtcRead;
+  mmap_devices [MMAP_DEV_RTC].write      = rtcWrite;
+  mmap_devices [MMAP_DEV_REGISTER].read  = registerPageRead;
+  mmap_devices [MMAP_DEV_REGISTER].write = registerPageWrite;
+
+  mmap_build ( cfg );
+
+  if ( Bcache_enabled )
+    bcache_init ();
+
+  icache_init ();
+
+  /* same priorities as platform_read_check () - overlaps end up MMAP_SLOW */
+  if ( Blitter_enabled )
+    mmap_set_range ( BLITTERBASE, BLITTERBASE + BLITTERSIZE, MMAP_DEVICE, NULL, MMAP_DEV_BLITTER );
+
+  if ( ET4000Initialised )
+  {
+    mmap_set_range ( NOVA_ET4000_VRAMBASE, NOVA_ET4000_REGTOP, MMAP_DEVICE, NULL, MMAP_DEV_ET4000 );
+    mmap_set_range ( 0xFEC00000, 0xFEDC0400, MMAP_DEVICE, NULL, MMAP_DEV_ET4000 );
+  }
+
+  if ( RTC_enabled )
+    mmap_set_range ( 0x00FFFC40, 0x00FFFC44, MMAP_DEVICE, NULL, MMAP_DEV_RTC );
+
+  /* IDE is mirrored high and masked down before the map lookup */
+  if ( IDE_enabled )
+    mmap_set_range ( IDEBASEADDR, IDETOPADDR, MMAP_SLOW, NULL, MMAP_DEV_NONE );
+}
 
 static inline int32_t platform_read_check ( uint8_t type, uint32_t addr, uint32_t *res ) 
 {
@@ -1135,58 +2399,102 @@ static inline int32_t platform_read_check ( uint8_t type, uint32_t addr, uint32_
   /* pistorm.prg reads these two 16bit addresses, then writes date/time to IKBD */
   if ( RTC_enabled && (addr >= 0x00FFFC40 && addr < 0x00FFFC44) )
   {
-    uint16_t atari_dt;
-    uint16_t atari_tm;
-    time_t t = time ( NULL );
-    struct tm tm = *localtime ( &t );
-
-    atari_dt  = (tm.tm_year - 80) << 9;
-    atari_dt |= (tm.tm_mon + 1) << 5;
-    atari_dt |=  tm.tm_mday;
+    return rtcRead ( type, addr, res );
+  }
 
-    atari_tm  = tm.tm_hour << 11;
-    atari_tm |= tm.tm_min << 5;
-    atari_tm |= tm.tm_sec / 2;
+  if ( IDE_enabled && (addr >= IDEBASEADDR && addr < IDETOPADDR) )
+  {
+    addr &= 0x00ffffff;
+  }
 
-    if ( addr == 0x00FFFC40 )
-      *res = atari_dt;
+  if ( ( addr >= cfg->mapped_low && addr < cfg->mapped_high ) )
+  {
+    if ( handle_mapped_read ( cfg, addr, &target, type ) != -1 ) 
+    {
+      *res = target;
+      
+      return 1;
+    }
+  }
 
-    else if ( addr == 0x00FFFC42 )
-      *res = atari_tm;
+  return 0;
+}
 
-    return 1;
+/*
+ * CPU wrote to the Atari bus - drop any cached code there, or all of it when
+ * the hardware blitter is started (BUSY in its control register at 0xFF8A3C).
+ * The vector shadow follows the write, or is dropped with the code.
+ */
+static inline void icache_bus_write ( uint32_t address, int size, uint32_t value )
+{
+  if ( address <= 0xFF8A3C && address + size > 0xFF8A3C
+    && ( value >> ( 8 * ( address + size - 1 - 0xFF8A3C ) ) ) & 0x80 )
+  {
+    icache_flush ();
+    vector_shadow_flush ();
   }
 
-  if ( IDE_enabled && (addr >= IDEBASEADDR && addr < IDETOPADDR) )
+  else
   {
-    addr &= 0x00ffffff;
+    icache_write ( address, size );
+    vector_shadow_update ( address, size, value );
   }
+}
 
-  if ( ( addr >= cfg->mapped_low && addr < cfg->mapped_high ) )
+
+/* MFP GPIP bit 5 going low - FDC/ACSI DMA finished and may have loaded code (or vectors) */
+static inline void icache_bus_read_8 ( uint32_t address, uint32_t value )
+{
+  static uint8_t dma_done;
+
+  if ( address != 0xFFFA01 )
+    return;
+
+  if ( !( value & 0x20 ) && !dma_done )
   {
-    if ( handle_mapped_read ( cfg, addr, &target, type ) != -1 ) 
-    {
-      *res = target;
-      
-      return 1;
-    }
+    icache_flush ();
+    vector_shadow_flush ();
   }
 
-  return 0;
+  dma_done = !( value & 0x20 );
 }
 
+
 unsigned int m68k_read_memory_8 ( uint32_t address ) 
 {
   static uint32_t value;
   static uint32_t r;
 
-  PS_LOCK = true;
+  mmap_page_t *page = mmap_lookup ( address );
 
-  if ( platform_read_check ( OP_TYPE_BYTE, address, &platform_res ) ) 
+  switch ( page->type )
   {
-    PS_LOCK = false;
+    case MMAP_BUS:
+      break;
+
+    case MMAP_HOST_RAM:
+    case MMAP_HOST_ROM:
+      return mmap_host_read_8 ( page, address );
+
+    case MMAP_DEVICE:
+      wcb_drain ();
+
+      if ( mmap_devices [page->dev].read ( OP_TYPE_BYTE, address, &platform_res ) ) 
+      {
+        return platform_res;
+      }
 
-    return platform_res;
+      break;
+
+    default:
+      wcb_slow ( address );
+
+      if ( platform_read_check ( OP_TYPE_BYTE, address, &platform_res ) ) 
+      {
+        return platform_res;
+      }
+
+      break;
   }
 
   if ( ( address & 0xFF000000 ) == 0xFF000000 )
@@ -1201,11 +2509,13 @@ unsigned int m68k_read_memory_8 ( uint32_t address )
   }
   */
 
+  wcb_read ( address, 1 );
+
   if ( WTC_initialised )
   {
     if ( do_cache ( address, 1, &value, 1 ) )
     {
-      PS_LOCK = false;
+      icache_bus_read_8 ( address, value );
 
       return value;
     }
@@ -1224,10 +2534,13 @@ unsigned int m68k_read_memory_8 ( uint32_t address )
   }
 */
 
+  SLICE_BUS_ACCESS ( address );
+
   r = ps_read_8 ( address ); 
 
-  PS_LOCK = false;
-  
+  IDLE_BUS_READ ( address, r );
+  icache_bus_read_8 ( address, r );
+
   return r;
 }
 
@@ -1237,13 +2550,42 @@ unsigned int m68k_read_memory_16 ( uint32_t address )
   static uint32_t value;
   static uint32_t r;
 
-  PS_LOCK = true;
+  mmap_page_t *page = mmap_lookup ( address );
 
-  if ( platform_read_check ( OP_TYPE_WORD, address, &platform_res ) ) 
+  switch ( page->type )
   {
-    PS_LOCK = false;
+    case MMAP_BUS:
+      break;
+
+    case MMAP_HOST_RAM:
+    case MMAP_HOST_ROM:
+      if ( !mmap_crosses_page ( address, 2 ) )
+      {
+        return mmap_host_read_16 ( page, address );
+      }
+
+      goto slow;
+
+    case MMAP_DEVICE:
+      wcb_drain ();
+
+      if ( mmap_devices [page->dev].read ( OP_TYPE_WORD, address, &platform_res ) ) 
+      {
+        return platform_res;
+      }
+
+      break;
+
+    default:
+slow:
+      wcb_slow ( address );
+
+      if ( platform_read_check ( OP_TYPE_WORD, address, &platform_res ) ) 
+      {
+        return platform_res;
+      }
 
-    return platform_res;
+      break;
   }
 
   if ( ( address & 0xFF000000 ) == 0xFF000000 ) 
@@ -1257,20 +2599,22 @@ unsigned int m68k_read_memory_16 ( uint32_t address )
   }
   */
 
+  wcb_read ( address, 2 );
+
   if ( WTC_initialised )
   {
     if ( do_cache ( address, 2, &value, 1 ) )
     {
-      PS_LOCK = false;
-
       return value;
     }
   }
 
+  SLICE_BUS_ACCESS ( address );
+
   r = ps_read_16 ( address );
 
-  PS_LOCK = false;
-  
+  IDLE_BUS_READ ( address, r );
+
   return r;
 }
 
@@ -1280,13 +2624,42 @@ unsigned int m68k_read_memory_32 ( uint32_t address )
   static uint32_t value;
   static uint32_t r;
 
-  PS_LOCK = true;
+  mmap_page_t *page = mmap_lookup ( address );
 
-  if (platform_read_check ( OP_TYPE_LONGWORD, address, &platform_res ) ) 
+  switch ( page->type )
   {
-    PS_LOCK = false;
+    case MMAP_BUS:
+      break;
+
+    case MMAP_HOST_RAM:
+    case MMAP_HOST_ROM:
+      if ( !mmap_crosses_page ( address, 4 ) )
+      {
+        return mmap_host_read_32 ( page, address );
+      }
+
+      goto slow;
+
+    case MMAP_DEVICE:
+      wcb_drain ();
+
+      if ( mmap_devices [page->dev].read ( OP_TYPE_LONGWORD, address, &platform_res ) ) 
+      {
+        return platform_res;
+      }
+
+      break;
+
+    default:
+slow:
+      wcb_slow ( address );
 
-    return platform_res;
+      if ( platform_read_check ( OP_TYPE_LONGWORD, address, &platform_res ) ) 
+      {
+        return platform_res;
+      }
+
+      break;
   }
 
   if ( ( address & 0xFF000000 ) == 0xFF000000 ) 
@@ -1300,20 +2673,27 @@ unsigned int m68k_read_memory_32 ( uint32_t address )
   }
   */
 
+  wcb_read ( address, 4 );
+
+  if ( vector_shadow_read ( address, &r ) )
+    return r;
+
   if ( WTC_initialised )
   {
     if ( do_cache( address, 4, &value, 1 ) )
     {
-      PS_LOCK = false;
-
       return value;
     }
   }
 
+  SLICE_BUS_ACCESS ( address );
+
   r = ps_read_32 ( address );
 
-  PS_LOCK = false;
-  
+  IDLE_BUS_READ ( address, r );
+
+  vector_shadow_update ( address, 4, r );
+
   return r;
 }
 
@@ -1330,7 +2710,7 @@ static inline int32_t platform_write_check ( uint8_t type, uint32_t addr, uint32
 
     addr &= 0x00FFFFFF;
 
-    blitWrite ( type, addr, val );
+    blitPageWrite ( type, addr, val );
 
     return 1;
   }
@@ -1377,12 +2757,46 @@ static inline int32_t platform_write_check ( uint8_t type, uint32_t addr, uint32
 
 void m68k_write_memory_8 ( uint32_t address, unsigned int value ) 
 {
-  PS_LOCK = true;
+  mmap_page_t *page = mmap_lookup ( address );
 
-  if ( platform_write_check ( OP_TYPE_BYTE, address, value ) )
+  idle_writes++;
+
+  switch ( page->type )
   {
-    PS_LOCK = false;
-    return;
+    case MMAP_BUS:
+      break;
+
+    case MMAP_HOST_RAM:
+    case MMAP_HOST_ROM:
+      if ( page->type == MMAP_HOST_RAM )
+      {
+        mmap_host_write_8 ( page, address, value );
+
+        if ( page->code )
+          bcache_write ( address, 1 );
+      }
+
+      return;
+
+    case MMAP_DEVICE:
+      wcb_drain ();
+
+      if ( mmap_devices [page->dev].write ( OP_TYPE_BYTE, address, value ) )
+      {
+        return;
+      }
+
+      break;
+
+    default:
+      wcb_slow ( address );
+
+      if ( platform_write_check ( OP_TYPE_BYTE, address, value ) )
+      {
+        return;
+      }
+
+      break;
   }
    
   if ( ( address & 0xFF000000 ) == 0xFF000000 ) 
@@ -1392,27 +2806,75 @@ void m68k_write_memory_8 ( uint32_t address, unsigned int value )
   if ( address & 0xFF000000 )
   {
     //printf ( "8wr why here? address = 0x%X\n", address );
-    PS_LOCK = false;
     return;
   }
 
-  ps_write_8 ( address, value );
+  SLICE_BUS_ACCESS ( address );
+
+  if ( !wcb_store ( address, 1, value ) )
+  {
+    wcb_drain ();
+    ps_write_8 ( address, value );
+  }
+
+  icache_bus_write ( address, 1, value );
 
   if ( WTC_initialised )
     do_cache ( address, 1, &value, 0 );
-
-  PS_LOCK = false;
 }
 
 
 void m68k_write_memory_16 ( uint32_t address, unsigned int value ) 
 {
-  PS_LOCK = true;
+  mmap_page_t *page = mmap_lookup ( address );
+
+  idle_writes++;
 
-  if ( platform_write_check ( OP_TYPE_WORD, address, value ) )
+  switch ( page->type )
   {
-    PS_LOCK = false;
-    return;
+    case MMAP_BUS:
+      break;
+
+    case MMAP_HOST_RAM:
+    case MMAP_HOST_ROM:
+      if ( mmap_crosses_page ( address, 2 ) )
+      {
+        if ( Bcache_enabled )
+          bcache_write ( address, 2 );
+
+        goto slow;
+      }
+
+      if ( page->type == MMAP_HOST_RAM )
+      {
+        mmap_host_write_16 ( page, address, value );
+
+        if ( page->code )
+          bcache_write ( address, 2 );
+      }
+
+      return;
+
+    case MMAP_DEVICE:
+      wcb_drain ();
+
+      if ( mmap_devices [page->dev].write ( OP_TYPE_WORD, address, value ) )
+      {
+        return;
+      }
+
+      break;
+
+    default:
+slow:
+      wcb_slow ( address );
+
+      if ( platform_write_check ( OP_TYPE_WORD, address, value ) )
+      {
+        return;
+      }
+
+      break;
   }
 
   if ( ( address & 0xFF000000 ) == 0xFF000000 ) 
@@ -1426,23 +2888,72 @@ void m68k_write_memory_16 ( uint32_t address, unsigned int value )
   }
   */
 
-  ps_write_16 ( address, value );
+  SLICE_BUS_ACCESS ( address );
+
+  if ( !wcb_store ( address, 2, value ) )
+  {
+    wcb_drain ();
+    ps_write_16 ( address, value );
+  }
+
+  icache_bus_write ( address, 2, value );
 
   if ( WTC_initialised )
     do_cache ( address, 2, &value, 0 );
-
-  PS_LOCK = false;
 }
 
 
 void m68k_write_memory_32 ( uint32_t address, unsigned int value ) 
 {
-  PS_LOCK = true;
+  mmap_page_t *page = mmap_lookup ( address );
 
-  if ( platform_write_check ( OP_TYPE_LONGWORD, address, value ) )
+  idle_writes++;
+
+  switch ( page->type )
   {
-    PS_LOCK = false;
-    return;
+    case MMAP_BUS:
+      break;
+
+    case MMAP_HOST_RAM:
+    case MMAP_HOST_ROM:
+      if ( mmap_crosses_page ( address, 4 ) )
+      {
+        if ( Bcache_enabled )
+          bcache_write ( address, 4 );
+
+        goto slow;
+      }
+
+      if ( page->type == MMAP_HOST_RAM )
+      {
+        mmap_host_write_32 ( page, address, value );
+
+        if ( page->code )
+          bcache_write ( address, 4 );
+      }
+
+      return;
+
+    case MMAP_DEVICE:
+      wcb_drain ();
+
+      if ( mmap_devices [page->dev].write ( OP_TYPE_LONGWORD, address, value ) )
+      {
+        return;
+      }
+
+      break;
+
+    default:
+slow:
+      wcb_slow ( address );
+
+      if ( platform_write_check ( OP_TYPE_LONGWORD, address, value ) )
+      {
+        return;
+      }
+
+      break;
   }
 
   if ( ( address & 0xFF000000 ) == 0xFF000000 ) 
@@ -1456,12 +2967,126 @@ void m68k_write_memory_32 ( uint32_t address, unsigned int value )
   }
   */
  
+  SLICE_BUS_ACCESS ( address );
+
+  wcb_drain ();
   ps_write_32 ( address, value );
 
+  icache_bus_write ( address, 4, value );
+
   if ( WTC_initialised )
     do_cache ( address, 4, &value, 0 );
+}
+
+
+/*
+ * MOVEM and exception frame blocks - plain ST-RAM that no device, host page
+ * or config map claims goes out as a single bus burst, the rest is split
+ * into the normal long/word accesses. A burst keeps A23-A16 from its first
+ * word, so a block crossing 64K is split as well
+ */
+static inline int bus_block_ok ( uint32_t address, unsigned int count )
+{
+  uint32_t end = address + count * 2;
+  mmap_page_t *first, *last;
+
+  if ( !ps_burst || !count || ( address & 1 ) || end > ATARI_MEMORY_SIZE )
+    return 0;
+
+  if ( ( address ^ ( end - 1 ) ) >> 16 )
+    return 0;
+
+  first = mmap_lookup ( address );
+  last  = mmap_lookup ( end - 1 );
+
+  if ( ( first->type != MMAP_BUS && first->type != MMAP_SLOW )
+    || ( last->type != MMAP_BUS && last->type != MMAP_SLOW ) )
+    return 0;
+
+  if ( first->type == MMAP_BUS && last->type == MMAP_BUS )
+    return 1;
+
+  for ( int i = 0; i < MAX_NUM_MAPPED_ITEMS && cfg->map_type[i] != MAPTYPE_NONE; i++ )
+  {
+    if ( address < cfg->map_high[i] && end > cfg->map_offset[i] )
+      return 0;
+  }
+
+  return 1;
+}
+
+
+void m68k_read_memory_words ( uint32_t address, uint16_t *words, unsigned int count )
+{
+  unsigned int n = 0;
+
+  if ( !WTC_initialised && bus_block_ok ( address, count ) )
+  {
+    slice_bus += count - 1;
+    SLICE_BUS_ACCESS ( address );
+
+    wcb_read ( address, count * 2 );
+    ps_read_block ( address, words, count );
+
+    for ( ; n < count; n++ )
+      IDLE_BUS_READ ( address + n * 2, words [n] );
+
+    return;
+  }
+
+  for ( ; n + 1 < count; n += 2 )
+  {
+    uint32_t v = m68k_read_memory_32 ( address + n * 2 );
+
+    words [n]     = v >> 16;
+    words [n + 1] = v;
+  }
+
+  if ( n < count )
+    words [n] = m68k_read_memory_16 ( address + n * 2 );
+}
+
+
+void m68k_write_memory_words ( uint32_t address, const uint16_t *words, unsigned int count )
+{
+  unsigned int n = 0;
+  uint32_t value;
+
+  if ( bus_block_ok ( address, count ) )
+  {
+    idle_writes++;
+    slice_bus += count - 1;
+    SLICE_BUS_ACCESS ( address );
+
+    wcb_drain ();
+    ps_write_block ( address, words, count );
+
+    for ( ; n < count; n += 2 )
+    {
+      if ( n + 1 < count )
+        icache_bus_write ( address + n * 2, 4, ( (uint32_t)words [n] << 16 ) | words [n + 1] );
+
+      else
+        icache_bus_write ( address + n * 2, 2, words [n] );
+    }
 
-  PS_LOCK = false;
+    if ( WTC_initialised )
+    {
+      for ( n = 0; n < count; n++ )
+      {
+        value = words [n];
+        do_cache ( address + n * 2, 2, &value, 0 );
+      }
+    }
+
+    return;
+  }
+
+  for ( ; n + 1 < count; n += 2 )
+    m68k_write_memory_32 ( address + n * 2, ( (uint32_t)words [n] << 16 ) | words [n + 1] );
+
+  if ( n < count )
+    m68k_write_memory_16 ( address + n * 2, words [n] );
 }
 
 
@@ -1469,3 +3094,97 @@ void cpu_set_fc ( unsigned int _fc )
 {
 	fc = _fc;
 }
+
+
+#define MMAP_BENCH_ADDRS 4096
+#define MMAP_BENCH_LOOPS 2000
+
+static double bench_ns ( struct timespec *start, struct timespec *end, uint64_t accesses )
+{
+  return ( ( end->tv_sec - start->tv_sec ) * 1e9 + ( end->tv_nsec - start->tv_nsec ) ) / accesses;
+}
+
+/* 
+ * --membench
+ * per-access cost of the range check chain against the page table, for 
+ * every host mapped region and for plain ST-RAM addresses that end up on the bus.
+ * Nothing here touches the GPIO.
+ */
+static void memory_map_benchmark ( void )
+{
+  static uint32_t addrs [MMAP_BENCH_ADDRS];
+  struct timespec start, end;
+  volatile uint32_t sink = 0;
+  uint32_t res;
+  uint64_t n;
+
+  mmap_dump ();
+
+  printf ( "[BENCH] %-16s %12s %12s\n", "region", "ranges ns", "table ns" );
+
+  for ( int i = -1; i < MAX_NUM_MAPPED_ITEMS; i++ )
+  {
+    const char *name;
+    uint32_t base, size;
+
+    if ( i == -1 )
+    {
+      name = "ST-RAM (bus)";
+      base = 0x00010000;
+      size = 0x00070000;
+    }
+
+    else if ( cfg->map_type [i] == MAPTYPE_ROM || cfg->map_type [i] == MAPTYPE_RAM )
+    {
+      name = cfg->map_id [i];
+      base = cfg->map_offset [i];
+      size = cfg->map_size [i];
+    }
+
+    else
+      continue;
+
+    if ( size < 4 )
+      continue;
+
+    srand ( 1 );
+
+    for ( int a = 0; a < MMAP_BENCH_ADDRS; a++ )
+      addrs [a] = base + ( ( (uint32_t)rand () % ( size - 4 ) ) & ~1 );
+
+    n = (uint64_t)MMAP_BENCH_ADDRS * MMAP_BENCH_LOOPS;
+
+    /* before - the range checks and map list walk */
+    clock_gettime ( CLOCK_MONOTONIC, &start );
+
+    for ( int l = 0; l < MMAP_BENCH_LOOPS; l++ )
+      for ( int a = 0; a < MMAP_BENCH_ADDRS; a++ )
+      {
+        if ( platform_read_check ( OP_TYPE_WORD, addrs [a], &res ) )
+          sink += res;
+      }
+
+    clock_gettime ( CLOCK_MONOTONIC, &end );
+
+    double before = bench_ns ( &start, &end, n );
+
+    /* after - bus pages stop at the lookup, host pages do the real read */
+    clock_gettime ( CLOCK_MONOTONIC, &start );
+
+    for ( int l = 0; l < MMAP_BENCH_LOOPS; l++ )
+      for ( int a = 0; a < MMAP_BENCH_ADDRS; a++ )
+      {
+        mmap_page_t *page = mmap_lookup ( addrs [a] );
+
+        if ( page->type == MMAP_HOST_RAM || page->type == MMAP_HOST_ROM )
+          sink += m68k_read_memory_16 ( addrs [a] );
+
+        else if ( page->type != MMAP_BUS && platform_read_check ( OP_TYPE_WORD, addrs [a], &res ) )
+          sink += res;
+      }
+
+    clock_gettime ( CLOCK_MONOTONIC, &end );
+
+    printf ( "[BENCH] %-16s %12.2f %12.2f\n", name, before, bench_ns ( &start, &end, n ) );
+  }
+}
@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: MIT
+
+/*
+  Bus ownership
+
+  Slow paths of ps_bus.h - contended acquire, hand off on release and
+  stepping aside - plus the per thread contention counters printed on exit.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <sched.h>
+#include "ps_bus.h"
+
+#if defined(__aarch64__) || defined(__arm__)
+#define BUS_RELAX() __asm__ volatile ( "yield" )
+#elif defined(__x86_64__) || defined(__i386__)
+#define BUS_RELAX() __asm__ volatile ( "pause" )
+#else
+#define BUS_RELAX()
+#endif
+
+/* spins before a waiter starts giving its core away - the owner may not be running */
+#define BUS_SPINS 100
+
+volatile uint32_t ps_bus_owner = PS_BUS_FREE;
+volatile uint32_t ps_bus_waiting;
+
+__thread uint32_t ps_bus_self;
+__thread uint32_t ps_bus_depth;
+
+/* slot 0 is PS_BUS_FREE, never used */
+t_ps_bus_stats ps_bus_stats [PS_BUS_MAX_THREADS];
+
+static volatile uint32_t next_id = 1;
+
+
+static inline uint64_t bus_now ( void )
+{
+  struct timespec ts;
+
+  clock_gettime ( CLOCK_MONOTONIC, &ts );
+
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+
+uint32_t ps_bus_register ( const char *name )
+{
+  uint32_t id;
+
+  if ( ps_bus_self )
+  {
+    if ( name )
+      ps_bus_stats [ps_bus_self].name = name;
+
+    return ps_bus_self;
+  }
+
+  id = __atomic_fetch_add ( &next_id, 1, __ATOMIC_RELAXED );
+
+  /* ids index ps_bus_stats and are bits in ps_bus_waiting, sharing one would break both */
+  if ( id >= PS_BUS_MAX_THREADS )
+  {
+    printf ( "[BUS] too many threads using the bus, can not register %s\n", name ? name : "thread" );
+    exit ( 1 );
+  }
+
+  ps_bus_stats [id].name = name ? name : "thread";
+  ps_bus_self = id;
+
+  return id;
+}
+
+
+/* CAS in ps_bus_acquire () failed - queue up and wait for FREE or a hand off */
+void ps_bus_acquire_slow ( void )
+{
+  uint32_t self = ps_bus_self;
+  uint32_t bit = 1u << self;
+  uint32_t expected;
+  uint32_t spins = 0;
+  uint64_t start = bus_now ();
+  t_ps_bus_stats *st = &ps_bus_stats [ps_bus_self];
+
+  st->contended++;
+
+  __atomic_fetch_or ( &ps_bus_waiting, bit, __ATOMIC_SEQ_CST );
+
+  for ( ;; )
+  {
+    expected = __atomic_load_n ( &ps_bus_owner, __ATOMIC_ACQUIRE );
+
+    if ( expected == self )
+    {
+      st->handoffs++;
+      break;
+    }
+
+    if ( expected == PS_BUS_FREE
+      && __atomic_compare_exchange_n ( &ps_bus_owner, &expected, self, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED ) )
+      break;
+
+    if ( ++spins < BUS_SPINS )
+      BUS_RELAX ();
+
+    else
+      sched_yield ();
+  }
+
+  __atomic_fetch_and ( &ps_bus_waiting, ~bit, __ATOMIC_RELAXED );
+
+  st->wait_ns += bus_now () - start;
+}
+
+
+/* outermost release with someone waiting - give the bus to the next id after ours */
+void ps_bus_handoff ( void )
+{
+  uint32_t waiting = __atomic_load_n ( &ps_bus_waiting, __ATOMIC_ACQUIRE ) & ~( 1u << ps_bus_self );
+  uint32_t next;
+
+  if ( !waiting )
+  {
+    __atomic_store_n ( &ps_bus_owner, PS_BUS_FREE, __ATOMIC_RELEASE );
+
+    return;
+  }
+
+  /* round robin so two waiters can not starve a third */
+  next = waiting & ~( ( 2u << ps_bus_self ) - 1 );
+  next = __builtin_ctz ( next ? next : waiting );
+
+  __atomic_store_n ( &ps_bus_owner, next, __ATOMIC_RELEASE );
+}
+
+
+void ps_bus_step_aside_slow ( void )
+{
+  uint32_t owner;
+  uint32_t spins = 0;
+  uint64_t start = bus_now ();
+  t_ps_bus_stats *st;
+
+  if ( !ps_bus_self )
+    ps_bus_register ( NULL );
+
+  st = &ps_bus_stats [ps_bus_self];
+
+  while ( ( owner = __atomic_load_n ( &ps_bus_owner, __ATOMIC_ACQUIRE ) ) != PS_BUS_FREE )
+  {
+    /* we are the owner - nothing to step aside for */
+    if ( owner == ps_bus_self )
+      return;
+
+    if ( ++spins < BUS_SPINS )
+      BUS_RELAX ();
+
+    else
+      sched_yield ();
+  }
+
+  st->steps++;
+  st->wait_ns += bus_now () - start;
+}
+
+
+void ps_bus_report ( void )
+{
+  for ( int n = 0; n < PS_BUS_MAX_THREADS; n++ )
+  {
+    t_ps_bus_stats *st = &ps_bus_stats [n];
+
+    if ( !st->acquires && !st->steps )
+      continue;
+
+    printf ( "[BUS] %-8s %llu acquires, %llu contended, %llu handed over, %llu step asides, %.3f ms waiting\n",
+      st->name,
+      (unsigned long long)st->acquires,
+      (unsigned long long)st->contended,
+      (unsigned long long)st->handoffs,
+      (unsigned long long)st->steps,
+      st->wait_ns / 1e6 );
+  }
+}
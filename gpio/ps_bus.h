@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: MIT
+/**
+ * pistorm
+ * bus ownership - which thread may drive the GPIO/CPLD bus
+ */
+
+#ifndef _PS_BUS_H
+#define _PS_BUS_H
+
+#include <stdint.h>
+
+/*
+ * ps_bus_owner holds the id of the thread driving the bus, PS_BUS_FREE when
+ * nobody does. Ids come from ps_bus_register (), threads that never register
+ * get one on their first acquire.
+ *
+ * acquire - CAS FREE -> self. The owner may acquire again (the blitter
+ *           and block transfers run inside a 68k access), only the
+ *           outermost release gives the bus up.
+ * release - when ps_bus_waiting has a bit set the bus is handed straight to
+ *           that thread instead of going FREE, so a busy CPU thread can not
+ *           take it back before the waiter sees it.
+ * step aside - wait until the bus is FREE without taking it, for threads
+ *           that only want to stay off the memory bus while a transaction
+ *           is on the wire (RTG render).
+ */
+#define PS_BUS_FREE        0
+#define PS_BUS_MAX_THREADS 8
+
+extern volatile uint32_t ps_bus_owner;
+extern volatile uint32_t ps_bus_waiting;   /* bit n set - thread id n wants the bus */
+
+extern __thread uint32_t ps_bus_self;
+extern __thread uint32_t ps_bus_depth;
+
+typedef struct {
+  const char *name;
+  uint64_t    acquires;
+  uint64_t    contended;    /* acquires that found the bus owned by someone else */
+  uint64_t    handoffs;     /* times the bus was handed to this thread by release */
+  uint64_t    wait_ns;      /* spent in contended acquires and ps_bus_step_aside () */
+  uint64_t    steps;        /* ps_bus_step_aside () calls that had to wait */
+} t_ps_bus_stats;
+
+extern t_ps_bus_stats ps_bus_stats [PS_BUS_MAX_THREADS];
+
+uint32_t ps_bus_register ( const char *name );
+void     ps_bus_acquire_slow ( void );
+void     ps_bus_handoff ( void );
+void     ps_bus_step_aside_slow ( void );
+void     ps_bus_report ( void );
+
+
+static inline void ps_bus_acquire ( void )
+{
+  uint32_t expected = PS_BUS_FREE;
+
+  if ( ps_bus_depth++ )
+    return;
+
+  if ( !ps_bus_self )
+    ps_bus_register ( NULL );
+
+  ps_bus_stats [ps_bus_self].acquires++;
+
+  if ( !__atomic_compare_exchange_n ( &ps_bus_owner, &expected, ps_bus_self, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED ) )
+    ps_bus_acquire_slow ();
+}
+
+
+static inline void ps_bus_release ( void )
+{
+  if ( --ps_bus_depth )
+    return;
+
+  if ( __atomic_load_n ( &ps_bus_waiting, __ATOMIC_RELAXED ) )
+    ps_bus_handoff ();
+
+  else
+    __atomic_store_n ( &ps_bus_owner, PS_BUS_FREE, __ATOMIC_RELEASE );
+}
+
+
+static inline void ps_bus_step_aside ( void )
+{
+  if ( __atomic_load_n ( &ps_bus_owner, __ATOMIC_ACQUIRE ) != PS_BUS_FREE )
+    ps_bus_step_aside_slow ();
+}
+
+#endif /* _PS_BUS_H */
@@ -26,14 +26,19 @@
 #include <stdbool.h>
 
 
-#define CHECK_IRQ(x) (!(x & 0x02) )
-#define CHECK_BERR(x) (!(x & 0x20) )
-#define TXN_END 0xFFFFCC // 0xffffec
 #define PIN_BERR PIN_RESET
 
-#ifdef STATS
-t_stats RWstats;
-#endif
+/* spin until the CPLD drops TXN_IN_PROGRESS, l ends up with the last GPLEV read */
+#define TXN_WAIT(l) \
+  if ( ( (l) = gpio [13] ) & 1 ) \
+  { \
+    uint64_t t0 = ps_stats_now (); \
+    uint32_t spins = 0; \
+    while ( ( (l) = gpio [13] ) & 1 ) \
+      spins++; \
+    ps_stats_txn_wait ( t0, spins ); \
+  }
+
 volatile uint16_t g_irq;
 volatile uint32_t g_buserr;
 volatile uint32_t *gpio;
@@ -41,6 +46,12 @@ volatile uint32_t *gpclk;
 volatile uint32_t *gpioBASE;
 //volatile bool PS_LOCK;
 uint8_t fc;
+uint8_t ps_burst;
+uint8_t ps_posted;
+volatile uint8_t ps_write_pending;
+volatile uint8_t ps_posted_berr;
+
+static unsigned int status_reg; /* last value written to REG_STATUS */
 
 void (*callback_berr) (uint16_t status, uint32_t address, int mode) = NULL;
 
@@ -172,6 +183,7 @@ static void setup_gpclk ( int targetF )
 
   printf ( "[INIT] Using clock divisor %.3f with PLL%c\n", div, PLL_TO_USE == PLLC ? 'C' : 'D' );
   printf ( "[INIT] GPIO clock is %.3f MHz\n", clk / div );//PLL_TO_USE == PLLC ? cpuf / div : coref / div );
+  ps_stats_set_backend ( "gpio", clk * 1000 / div );
 
   *(gpclk + (CLK_GP0_CTL / 4)) = CLK_PASSWD | (1 << 5); /* kill the clock */
   usleep (100);
@@ -201,7 +213,7 @@ printf ( "[INIT] Using PLL%c\n", pll == 4 ? 'A' : pll == 5 ? 'C' : pll == 6 ? 'D
 }
 
 
-void ps_setup_protocol ( int targetF ) 
+static void gpio_setup_protocol ( int targetF ) 
 {
   setup_io ();
   setup_gpclk ( targetF );
@@ -214,11 +226,33 @@ void ps_setup_protocol ( int targetF )
 }
 
 
-inline
-void ps_write_16 ( uint32_t address, uint16_t data )
+/* 
+ * wait for an outstanding posted write and collect its result - a bus error
+ * is kept in ps_posted_berr so the following transaction cannot clear it
+ */
+static void gpio_sync ( void ) 
+{
+  uint32_t l;
+
+  TXN_WAIT ( l );
+
+  g_irq = CHECK_IRQ (l);
+
+  if ( CHECK_BERR (l) )
+    ps_posted_berr = 1;
+
+  ps_write_pending = 0;
+}
+
+#define GPIO_SYNC if ( ps_write_pending ) gpio_sync ()
+
+
+static void gpio_write_16 ( uint32_t address, uint16_t data )
 {
   static uint32_t l;
 
+  GPIO_SYNC;
+
 #if (1)
   gpio [0] = GPFSEL0_OUTPUT;
   gpio [1] = GPFSEL1_OUTPUT;
@@ -243,14 +277,17 @@ void ps_write_16 ( uint32_t address, uint16_t data )
   gpio [1] = GPFSEL1_INPUT;
   gpio [2] = GPFSEL2_INPUT;
 
-	while ( ( l = gpio [13] ) & 1 ); // wait for firmware to signal transaction completed
+  /* posted - completion and bus error are collected by gpio_sync () */
+  if ( ps_posted )
+    ps_write_pending = 2;
 
-  g_irq = CHECK_IRQ (l);
-  g_buserr = CHECK_BERR (l);
+  else
+  {
+    TXN_WAIT ( l );
 
-#ifdef STATS
-  RWstats.w16++;  
-#endif
+    g_irq = CHECK_IRQ (l);
+    g_buserr = CHECK_BERR (l);
+  }
 
 #else
   GPFSEL_OUTPUT;
@@ -269,11 +306,12 @@ void ps_write_16 ( uint32_t address, uint16_t data )
 }
 
 
-inline
-void ps_write_8 ( uint32_t address, uint16_t data ) 
+static void gpio_write_8 ( uint32_t address, uint16_t data ) 
 {
   static uint32_t l;
 
+  GPIO_SYNC;
+
   if ((address & 1) == 0)
     data <<= 8;
 
@@ -304,15 +342,18 @@ void ps_write_8 ( uint32_t address, uint16_t data )
   gpio [1] = GPFSEL1_INPUT;
   gpio [2] = GPFSEL2_INPUT;
   
-	while ( ( l = gpio [13] ) & 1 );
+  /* posted - completion and bus error are collected by gpio_sync () */
+  if ( ps_posted )
+    ps_write_pending = 2;
 
-  g_irq = CHECK_IRQ (l);
-  g_buserr = CHECK_BERR (l);
-  
-#ifdef STATS
-  RWstats.w8++;
-#endif
+  else
+  {
+    TXN_WAIT ( l );
 
+    g_irq = CHECK_IRQ (l);
+    g_buserr = CHECK_BERR (l);
+  }
+  
 #else
   GPFSEL_OUTPUT;
 
@@ -330,11 +371,12 @@ void ps_write_8 ( uint32_t address, uint16_t data )
 }
 
 
-inline
-void ps_write_32 ( uint32_t address, uint32_t value ) 
+static void gpio_write_32 ( uint32_t address, uint32_t value ) 
 {
   static uint32_t l;
 
+  GPIO_SYNC;
+
 #if (1)
   gpio [0] = GPFSEL0_OUTPUT;
   gpio [1] = GPFSEL1_OUTPUT;
@@ -359,7 +401,7 @@ void ps_write_32 ( uint32_t address, uint32_t value )
   gpio [1] = GPFSEL1_INPUT;
   //gpio [2] = GPFSEL2_INPUT;
 
-	while ( gpio [13] & 1 ); // wait for firmware to signal transaction completed
+	TXN_WAIT ( l );
 
 
   address += 2;
@@ -387,11 +429,17 @@ void ps_write_32 ( uint32_t address, uint32_t value )
   gpio [1] = GPFSEL1_INPUT;
   gpio [2] = GPFSEL2_INPUT;
 
-	while ( ( l = gpio [13] ) & 1 ); // wait for firmware to signal transaction completed
+  /* posted - completion and bus error are collected by gpio_sync () */
+  if ( ps_posted )
+    ps_write_pending = 2;
 
+  else
+  {
+    TXN_WAIT ( l );
 
-  g_irq = CHECK_IRQ (l);
-  g_buserr = CHECK_BERR (l);
+    g_irq = CHECK_IRQ (l);
+    g_buserr = CHECK_BERR (l);
+  }
 #else
   GPFSEL_OUTPUT;
 
@@ -421,11 +469,12 @@ void ps_write_32 ( uint32_t address, uint32_t value )
 }
 
 
-inline
-uint16_t ps_read_16 ( uint32_t address ) 
+static uint16_t gpio_read_16 ( uint32_t address ) 
 {
 	static uint32_t l;
 
+  GPIO_SYNC;
+
   gpio [0] = GPFSEL0_OUTPUT;
   gpio [1] = GPFSEL1_OUTPUT;
   gpio [2] = GPFSEL2_OUTPUT;
@@ -446,8 +495,7 @@ uint16_t ps_read_16 ( uint32_t address )
   gpio [1] = GPFSEL1_INPUT;
   gpio [2] = GPFSEL2_INPUT;
 
-  while ( ( l = gpio [13] ) & 1 )
-    ;
+  TXN_WAIT ( l );
   
 #ifdef PI3
   l = gpio [13];
@@ -458,19 +506,16 @@ uint16_t ps_read_16 ( uint32_t address )
   g_irq = CHECK_IRQ (l);
   g_buserr = CHECK_BERR (l);
 
-#ifdef STATS
-  RWstats.r16++;
-#endif
-
 return (l >> 8);
 }
 
 
-inline
-uint8_t ps_read_8 ( uint32_t address ) 
+static uint8_t gpio_read_8 ( uint32_t address ) 
 {
   static uint32_t l;
 
+  GPIO_SYNC;
+
   gpio [0] = GPFSEL0_OUTPUT;
   gpio [1] = GPFSEL1_OUTPUT;
   gpio [2] = GPFSEL2_OUTPUT;
@@ -491,8 +536,7 @@ uint8_t ps_read_8 ( uint32_t address )
   gpio [1] = GPFSEL1_INPUT;
   gpio [2] = GPFSEL2_INPUT;
   
-  while ( ( l = gpio [13] ) & 1 )
-    ;
+  TXN_WAIT ( l );
 
 #ifdef PI3
   l = gpio [13];
@@ -503,10 +547,6 @@ uint8_t ps_read_8 ( uint32_t address )
   g_irq = CHECK_IRQ (l);
   g_buserr = CHECK_BERR (l);
 
-#ifdef STATS
-  RWstats.r8++;
-#endif
-
 if ( (address & 1) == 0 )
   return (l >> 16);
 
@@ -515,8 +555,7 @@ else
 }
 
 
-inline
-uint32_t ps_read_32 ( uint32_t address ) 
+static uint32_t gpio_read_32 ( uint32_t address ) 
 {
 #if (0)
   return ( ps_read_16 ( address ) << 16 ) | ps_read_16 ( address + 2 );
@@ -525,6 +564,8 @@ uint32_t ps_read_32 ( uint32_t address )
   static uint32_t l;
   static uint32_t d;
 
+  GPIO_SYNC;
+
   gpio [0] = GPFSEL0_OUTPUT;
   gpio [1] = GPFSEL1_OUTPUT;
   gpio [2] = GPFSEL2_OUTPUT;
@@ -545,7 +586,7 @@ uint32_t ps_read_32 ( uint32_t address )
   gpio [1] = GPFSEL1_INPUT;
   //gpio [2] = GPFSEL2_INPUT;
 
-  while ( gpio [13] & 1 );
+  TXN_WAIT ( l );
   
   l = gpio [13];
 
@@ -576,7 +617,7 @@ uint32_t ps_read_32 ( uint32_t address )
   gpio [1] = GPFSEL1_INPUT;
   gpio [2] = GPFSEL2_INPUT;
 
-  while ( gpio [13] & 1 );
+  TXN_WAIT ( l );
   
   l = gpio [13];
 
@@ -586,22 +627,21 @@ uint32_t ps_read_32 ( uint32_t address )
   g_irq = CHECK_IRQ (l);
   g_buserr = CHECK_BERR (l);
 
-#ifdef STATS
-  RWstats.r16++;
-#endif
-
 return d | ( (l >> 8) & 0xFFFF );
 #endif
 }
 
 
-inline
-void ps_write_status_reg ( unsigned int value ) 
+static void gpio_write_status_reg ( unsigned int value ) 
 {
+  GPIO_SYNC;
+
   gpio [0] = GPFSEL0_OUTPUT;
   gpio [1] = GPFSEL1_OUTPUT;
   gpio [2] = GPFSEL2_OUTPUT;
 
+  status_reg = value;
+
   gpio [7] = ((value & 0xffff) << 8) | 0x8C;//(REG_STATUS << PIN_A0) | (1 << PIN_WR);
   gpio [7] = 0x80;
   gpio [10] = 0x80;
@@ -611,32 +651,256 @@ void ps_write_status_reg ( unsigned int value )
   gpio [1] = GPFSEL1_INPUT;
   gpio [2] = GPFSEL2_INPUT;
 
-#ifdef STATS
-  RWstats.wstatus++;
-#endif
 }
 
 
-inline
-uint16_t ps_read_status_reg () 
+static uint16_t gpio_read_status_reg () 
 {
   static uint32_t l;
 
-  while ( gpio [13] & 1 );
+  GPIO_SYNC;
+
+  TXN_WAIT ( l );
 
   gpio [7] = 0x4C; //(REG_STATUS << PIN_A0) | (1 << PIN_RD);
 
-  while ( gpio [13] & 1 );
+  TXN_WAIT ( l );
 
   l = gpio [13];
 
   gpio [10] = TXN_END;
 
-#ifdef STATS
-  RWstats.rstatus++;
+  return (l >> 8);
+}
+
+
+static unsigned int gpio_get_ipl_zero ( void ) 
+{
+  return gpio [13] & (1 << PIN_IPL_ZERO);
+}
+
+
+/*
+ * burst transfers - ADDR_HI is only written for the first word, every
+ * further cycle is started by the ADDR_LO write with A23-A16 still latched,
+ * so a block must not cross a 64K boundary (ps_*_block () split them).
+ * Writes keep the data bus in output mode for the whole block. 
+ * Rewriting REG_STATUS takes the CPLD out of burst mode again.
+ */
+static void gpio_write_block ( uint32_t address, const uint16_t *data, uint32_t words ) 
+{
+  static uint32_t l;
+
+  GPIO_SYNC;
+
+  gpio [0] = GPFSEL0_OUTPUT;
+  gpio [1] = GPFSEL1_OUTPUT;
+  gpio [2] = GPFSEL2_OUTPUT;
+
+  for ( uint32_t n = 0; n < words; n++, address += 2 )
+  {
+    gpio [7] = ( data [n] << 8 );// | 0x80;//CMD_REG_DATA | (1 << PIN_WR);
+    gpio [7] = 0x80;
+    gpio [10] = 0x80;
+    gpio [10] = TXN_END;
+
+    gpio [7] = ( (address & 0xffff) << 8 ) | 0x04;//CMD_ADDR_LO | (1 << PIN_WR);
+    gpio [7] = 0x80;
+    gpio [10] = 0x80;
+    gpio [10] = TXN_END;
+
+    if ( n == 0 )
+    {
+      gpio [7] = ( ( (fc << 13) | ADDR_HI_BIT_BURST | (address >> 16) ) << 8 ) | 0x08;//CMD_ADDR_HI | (1 << PIN_WR);
+      gpio [7] = 0x80;
+      gpio [10] = 0x80;
+      gpio [10] = TXN_END; 
+    }
+
+    TXN_WAIT ( l );
+
+    if ( CHECK_BERR (l) )
+      break;
+  }
+
+  gpio_write_status_reg ( status_reg );
+
+  g_irq = CHECK_IRQ (l);
+  g_buserr = CHECK_BERR (l);
+
+}
+
+
+static void gpio_read_block ( uint32_t address, uint16_t *data, uint32_t words ) 
+{
+  static uint32_t l;
+
+  GPIO_SYNC;
+
+  for ( uint32_t n = 0; n < words; n++, address += 2 )
+  {
+    gpio [0] = GPFSEL0_OUTPUT;
+    gpio [1] = GPFSEL1_OUTPUT;
+    gpio [2] = GPFSEL2_OUTPUT;
+
+    gpio [7] = ( (address & 0xffff) << 8 ) | 0x04;//CMD_ADDR_LO | (1 << PIN_WR);
+    gpio [7] = 0x80;
+    gpio [10] = 0x80;
+    gpio [10] = TXN_END;
+
+    if ( n == 0 )
+    {
+      gpio [7] = ( ( (fc << 13) | ADDR_HI_BIT_BURST | 0x0200 | (address >> 16) ) << 8 ) | 0x08;//CMD_ADDR_HI | (1 << PIN_WR);
+      gpio [7] = 0x80;
+      gpio [10] = 0x80;
+      gpio [10] = TXN_END;
+    }
+
+    gpio [7] = 0x40;//(REG_DATA << PIN_A0) | (1 << PIN_RD);
+
+    gpio [0] = GPFSEL0_INPUT;
+    gpio [1] = GPFSEL1_INPUT;
+    gpio [2] = GPFSEL2_INPUT;
+
+    TXN_WAIT ( l );
+
+#ifdef PI3
+    l = gpio [13];
 #endif
 
-  return (l >> 8);
+    gpio [10] = TXN_END;
+
+    data [n] = l >> 8;
+
+    if ( CHECK_BERR (l) )
+      break;
+  }
+
+  gpio_write_status_reg ( status_reg );
+
+  g_irq = CHECK_IRQ (l);
+  g_buserr = CHECK_BERR (l);
+
+}
+
+
+const t_ps_backend ps_gpio_backend = {
+  .name         = "gpio",
+  .setup        = gpio_setup_protocol,
+  .read_8       = gpio_read_8,
+  .read_16      = gpio_read_16,
+  .read_32      = gpio_read_32,
+  .write_8      = gpio_write_8,
+  .write_16     = gpio_write_16,
+  .write_32     = gpio_write_32,
+  .read_status  = gpio_read_status_reg,
+  .write_status = gpio_write_status_reg,
+  .get_ipl_zero = gpio_get_ipl_zero,
+  .read_block   = gpio_read_block,
+  .write_block  = gpio_write_block,
+  .sync         = gpio_sync,
+};
+
+const t_ps_backend *ps_bus = &ps_gpio_backend;
+
+
+/* 
+ * pick the bus backend - "gpio" (default) or "sim[,options]" 
+ * must be called before ps_setup_protocol ()
+ */
+int ps_select_backend ( const char *spec ) 
+{
+  if ( spec == NULL || strcmp ( spec, "gpio" ) == 0 )
+  {
+    ps_bus = &ps_gpio_backend;
+
+    return 0;
+  }
+
+  if ( strncmp ( spec, "sim", 3 ) == 0 && ( spec [3] == 0 || spec [3] == ',' ) )
+  {
+    ps_bus = &ps_sim_backend;
+    ps_sim_configure ( spec [3] ? spec + 4 : "" );
+
+    return 0;
+  }
+
+  printf ( "[INIT] Unknown bus backend %s\n", spec );
+
+  return -1;
+}
+
+
+/* words left before A23-A16 change - a burst keeps the ADDR_HI of its first word */
+static inline uint32_t ps_block_run ( uint32_t address, uint32_t words )
+{
+  uint32_t run = ( 0x10000 - ( address & 0xFFFF ) ) / 2;
+
+  return words < run ? words : run;
+}
+
+
+/* 
+ * move a run of contiguous 16 bit words to/from the ST - falls back to one
+ * ps_read_16 ()/ps_write_16 () per word when burst mode is not enabled.
+ * Bursts are split at 64K boundaries.
+ */
+void ps_read_block ( uint32_t address, uint16_t *data, uint32_t words ) 
+{
+  uint64_t t;
+  uint32_t run;
+
+  ps_bus_acquire ();
+
+  if ( ps_burst && ps_bus->read_block )
+  {
+    for ( ; words; words -= run, address += run * 2, data += run )
+    {
+      run = ps_block_run ( address, words );
+
+      t = ps_stats_now ();
+      ps_bus->read_block ( address, data, run );
+      ps_stats_record_n ( PS_OP_R16, t, run );
+    }
+  }
+
+  else for ( uint32_t n = 0; n < words; n++, address += 2 )
+    data [n] = ps_read_16 ( address );
+
+  ps_bus_release ();
+}
+
+
+void ps_write_block ( uint32_t address, const uint16_t *data, uint32_t words ) 
+{
+  uint64_t t;
+  uint32_t run;
+
+  ps_bus_acquire ();
+
+  if ( ps_burst && ps_bus->write_block )
+  {
+    for ( ; words; words -= run, address += run * 2, data += run )
+    {
+      run = ps_block_run ( address, words );
+
+      t = ps_stats_now ();
+      ps_bus->write_block ( address, data, run );
+      ps_stats_record_n ( PS_OP_W16, t, run );
+    }
+  }
+
+  else for ( uint32_t n = 0; n < words; n++, address += 2 )
+    ps_write_16 ( address, data [n] );
+
+  ps_bus_release ();
+}
+
+
+void ps_setup_protocol ( int targetF ) 
+{
+  ps_stats_set_backend ( ps_bus->name, 0 );
+  ps_bus->setup ( targetF );
 }
 
 
@@ -8,6 +8,10 @@
 #ifndef _PS_PROTOCOL_H
 #define _PS_PROTOCOL_H
 
+#include <stdint.h>
+#include "ps_bus.h"
+#include "ps_stats.h"
+
 #define PIN_TXN_IN_PROGRESS 0
 #define PIN_IPL_ZERO 1
 #define PIN_A0 2
@@ -27,6 +31,9 @@
 #define STATUS_BIT_BERR 1
 #define STATUS_BIT_RESET 2
 
+/* ADDR_HI bit - CPLD keeps fc/size/A23-A16 and starts a cycle on every ADDR_LO write until the next REG_STATUS write */
+#define ADDR_HI_BIT_BURST 0x0400
+
 #define STATUS_MASK_IPL 0xe000
 #define STATUS_SHIFT_IPL 13
 
@@ -174,26 +181,177 @@ typedef union
 
 } t_a32;
 
-uint8_t ps_read_8(uint32_t address);
-uint16_t ps_read_16(uint32_t address);
-uint32_t ps_read_32(uint32_t address);
-//uint8_t ps_read_8(t_a32 address);
-//uint16_t ps_read_16(t_a32 address);
-//uint32_t ps_read_32(t_a32 address);
+/* status bits as seen on GPLEV after a transaction */
+#define CHECK_IRQ(x) (!(x & 0x02) )
+#define CHECK_BERR(x) (!(x & 0x20) )
+#define TXN_END 0xFFFFCC // 0xffffec
+
+
+/* 
+ * Bus backend - the real GPIO/CPLD interface or the software model of it in 
+ * ps_sim.c. Chosen once at startup with ps_select_backend ().
+ */
+typedef struct ps_backend {
+  const char   *name;
+  void         (*setup)        ( int targetF );
+  uint8_t      (*read_8)       ( uint32_t address );
+  uint16_t     (*read_16)      ( uint32_t address );
+  uint32_t     (*read_32)      ( uint32_t address );
+  void         (*write_8)      ( uint32_t address, uint16_t data );
+  void         (*write_16)     ( uint32_t address, uint16_t data );
+  void         (*write_32)     ( uint32_t address, uint32_t data );
+  uint16_t     (*read_status)  ( void );
+  void         (*write_status) ( unsigned int value );
+  unsigned int (*get_ipl_zero) ( void );
+  void         (*read_block)   ( uint32_t address, uint16_t *data, uint32_t words );
+  void         (*write_block)  ( uint32_t address, const uint16_t *data, uint32_t words );
+  void         (*sync)         ( void );
+} t_ps_backend;
+
+extern const t_ps_backend *ps_bus;
+extern const t_ps_backend ps_gpio_backend;
+extern const t_ps_backend ps_sim_backend;
+
+int  ps_select_backend ( const char *spec );
+void ps_sim_configure ( const char *opts );
+
+
+extern uint8_t fc;
+
+/* every transaction owns the bus for its duration (ps_bus.h) and is timed (ps_stats.h) */
+static inline uint8_t ps_read_8 ( uint32_t address ) 
+{
+  uint8_t r;
+  uint64_t t;
+
+  ps_bus_acquire ();
+  t = ps_stats_now ();
+  r = ps_bus->read_8 ( address );
+  ps_stats_record ( PS_OP_R8, t );
+  ps_bus_release ();
 
-void ps_write_8(uint32_t address, uint16_t data);
-//void ps_write_8(t_a32 address, uint16_t data);
-void ps_write_16(uint32_t address, uint16_t data);
-//void ps_write_16(t_a32 address, uint16_t data);
-void ps_write_32(uint32_t address, uint32_t data);
-//void ps_write_32(t_a32 address, uint32_t data);
+  return r;
+}
+
+static inline uint16_t ps_read_16 ( uint32_t address ) 
+{
+  uint16_t r;
+  uint64_t t;
 
-uint16_t ps_read_status_reg();
-void ps_write_status_reg(unsigned int value);
+  ps_bus_acquire ();
+  t = ps_stats_now ();
+  r = ps_bus->read_16 ( address );
+  ps_stats_record ( fc == 7 ? PS_OP_IACK : PS_OP_R16, t );
+  ps_bus_release ();
 
-void ps_setup_protocol();
-void ps_reset_state_machine();
-void ps_pulse_reset();
+  return r;
+}
+
+static inline uint32_t ps_read_32 ( uint32_t address ) 
+{
+  uint32_t r;
+  uint64_t t;
+
+  ps_bus_acquire ();
+  t = ps_stats_now ();
+  r = ps_bus->read_32 ( address );
+  ps_stats_record ( PS_OP_R32, t );
+  ps_bus_release ();
+
+  return r;
+}
+
+static inline void ps_write_8 ( uint32_t address, uint16_t data ) 
+{
+  uint64_t t;
+
+  ps_bus_acquire ();
+  t = ps_stats_now ();
+  ps_bus->write_8 ( address, data );
+  ps_stats_record ( PS_OP_W8, t );
+  ps_bus_release ();
+}
+
+static inline void ps_write_16 ( uint32_t address, uint16_t data ) 
+{
+  uint64_t t;
+
+  ps_bus_acquire ();
+  t = ps_stats_now ();
+  ps_bus->write_16 ( address, data );
+  ps_stats_record ( PS_OP_W16, t );
+  ps_bus_release ();
+}
+
+static inline void ps_write_32 ( uint32_t address, uint32_t data ) 
+{
+  uint64_t t;
+
+  ps_bus_acquire ();
+  t = ps_stats_now ();
+  ps_bus->write_32 ( address, data );
+  ps_stats_record ( PS_OP_W32, t );
+  ps_bus_release ();
+}
+
+static inline uint16_t ps_read_status_reg ( void ) 
+{
+  uint16_t r;
+  uint64_t t;
+
+  ps_bus_acquire ();
+  t = ps_stats_now ();
+  r = ps_bus->read_status ();
+  ps_stats_record ( PS_OP_STATUS, t );
+  ps_bus_release ();
+
+  return r;
+}
+
+static inline void ps_write_status_reg ( unsigned int value ) 
+{
+  uint64_t t;
+
+  ps_bus_acquire ();
+  t = ps_stats_now ();
+  ps_bus->write_status ( value );
+  ps_stats_record ( PS_OP_STATUS, t );
+  ps_bus_release ();
+}
+
+static inline unsigned int ps_get_ipl_zero ( void ) 
+{
+  return ps_bus->get_ipl_zero ();
+}
+
+/* contiguous word transfers - burst mode when the CPLD firmware has it (setvar burst) */
+extern uint8_t ps_burst;
+
+void ps_read_block ( uint32_t address, uint16_t *data, uint32_t words );
+void ps_write_block ( uint32_t address, const uint16_t *data, uint32_t words );
+
+/* 
+ * posted writes (setvar posted) - a write returns once the CPLD has latched it,
+ * the next transaction or ps_sync () waits for it. ps_write_pending counts down
+ * once per instruction, see m68k_execute_bef ()
+ */
+extern uint8_t ps_posted;
+extern volatile uint8_t ps_write_pending;
+extern volatile uint8_t ps_posted_berr;
+
+static inline void ps_sync ( void ) 
+{
+  if ( ps_write_pending )
+  {
+    ps_bus_acquire ();
+    ps_bus->sync ();
+    ps_bus_release ();
+  }
+}
+
+void ps_setup_protocol ( int targetF );
+void ps_reset_state_machine ();
+void ps_pulse_reset ();
 
 /* cryptodad */
 /* cryptodad */
@@ -201,8 +359,6 @@ void ps_pulse_reset();
 void ps_config ();
 void ps_berrIAK ( uint32_t, int );
 
-unsigned int ps_get_ipl_zero();
-
 #define read8 ps_read_8
 #define read16 ps_read_16
 #define read32 ps_read_32
@@ -227,18 +383,6 @@ static inline uint32_t ps_read_32_ex(volatile uint32_t *gpio, uint32_t address)
 #define gpio_get_irq ps_get_ipl_zero
 
 
-/* cryptodad */
-typedef struct stats {
-  uint32_t wstatus;
-  uint32_t w16;
-  uint32_t w8;
-  uint32_t rstatus;
-  uint32_t r16;
-  uint32_t r8;
-  uint32_t wtotal;
-  uint32_t rtotal;
-} t_stats;
-
 /* cryptodad - m68kcpu.h uses this - only beneficial with 68020 */
 //#define CHIP_FASTPATH
 //#define FASTPATH_UPPER 0x400000 //0x200000
@@ -0,0 +1,554 @@
+// SPDX-License-Identifier: MIT
+
+/*
+  Software model of the PiStorm Atari CPLD (rtl/pistormSXB_devEPM570.v)
+
+  Lets the emulator, ataritest and the benchmarks run on a host without a Pi
+  or an ST. The Pi side talks to it through the same register sequence as the
+  GPIO backend - REG_DATA, REG_ADDR_LO, REG_ADDR_HI to start a transaction,
+  REG_STATUS for IPL/reset - and sees TXN_IN_PROGRESS, IPL_ZERO and BERR on
+  a modelled GPLEV word.
+
+  Behind the CPLD there is a small ST: ST-RAM (4MB by default), an optional
+  TOS image, the IO page at 0xFF8000 as plain storage and a 50Hz VBL on IPL 4.
+
+  select with --bus sim[,latency=<ns>][,ram=<KB>][,rom=<file>][,novbl]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include "ps_protocol.h"
+
+#define SIM_RAM_SIZE    (4 * 1024 * 1024)
+#define SIM_IO_BASE     0x00FF8000
+#define SIM_IO_SIZE     0x00008000
+#define SIM_IACK_BASE   0x00FFFFF0
+#define SIM_VBL_NS      (1000000000 / 50)
+#define SIM_VBL_LEVEL   4
+#define SIM_MFP_GPIP    0x00FFFA01
+
+/* GPLEV bits, see CHECK_IRQ () and CHECK_BERR () */
+#define SIM_LEV_TXN     (1 << PIN_TXN_IN_PROGRESS)
+#define SIM_LEV_IPLZERO (1 << PIN_IPL_ZERO)
+#define SIM_LEV_BERR    0x20
+
+extern volatile uint16_t g_irq;
+extern volatile uint32_t g_buserr;
+extern uint8_t fc;
+
+static struct {
+  uint16_t data_out;  /* REG_DATA as written by the Pi */
+  uint16_t data_in;   /* read latch - valid at the end of a read transaction */
+  uint16_t addr_lo;
+  uint16_t addr_hi;   /* kept for burst cycles */
+  bool     burst;
+  uint16_t status;    /* last REG_STATUS write */
+  uint8_t  rd_reg;    /* register driven onto PI_D while PI_RD is asserted */
+  uint64_t txn_end;   /* PI_TXN_IN_PROGRESS drops at this time (ns) */
+  bool     berr;
+  uint8_t  pending;   /* one bit per IPL level */
+} cpld;
+
+static uint8_t  *sim_ram;
+static uint32_t  sim_ram_size = SIM_RAM_SIZE;
+static uint8_t  *sim_rom;
+static uint32_t  sim_rom_base;
+static uint32_t  sim_rom_size;
+static char     *sim_rom_file;
+static uint8_t   sim_io [SIM_IO_SIZE];
+static uint32_t  sim_latency_ns;
+static bool      sim_vbl = true;
+static uint64_t  sim_next_vbl;
+
+
+static inline uint64_t sim_now ( void )
+{
+  struct timespec ts;
+
+  clock_gettime ( CLOCK_MONOTONIC, &ts );
+
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+
+static uint8_t sim_ipl ( void )
+{
+  if ( sim_vbl && sim_now () >= sim_next_vbl )
+  {
+    cpld.pending |= 1 << SIM_VBL_LEVEL;
+    sim_next_vbl = sim_now () + SIM_VBL_NS;
+  }
+
+  for ( int l = 7; l > 0; l-- )
+    if ( cpld.pending & (1 << l) )
+      return l;
+
+  return 0;
+}
+
+
+/* one 68k bus cycle - address is 24 bits, reads always return the full word */
+static uint16_t sim_bus_cycle ( uint32_t address, uint8_t cycle_fc, bool read, bool byte, uint16_t data )
+{
+  uint8_t *mem = NULL;
+  uint32_t even = address & 0x00FFFFFE;
+
+  cpld.berr = false;
+
+  /* interrupt acknowledge - autovector and clear the request like the GLUE does */
+  if ( cycle_fc == 7 && ( address & 0x00FFFFF0 ) == SIM_IACK_BASE )
+  {
+    uint8_t level = ( address >> 1 ) & 7;
+
+    cpld.pending &= ~(1 << level);
+
+    return 24 + level;
+  }
+
+  /* first 8 bytes of the address space come from ROM */
+  if ( even < 8 && read && sim_rom )
+    mem = sim_rom + even;
+
+  else if ( even < sim_ram_size )
+  {
+    /* system area is supervisor only */
+    if ( even < 0x800 && !( cycle_fc & 4 ) )
+    {
+      cpld.berr = true;
+
+      return 0xFFFF;
+    }
+
+    mem = sim_ram + even;
+  }
+
+  else if ( sim_rom && even >= sim_rom_base && even < sim_rom_base + sim_rom_size )
+  {
+    if ( !read )
+    {
+      cpld.berr = true;
+
+      return 0xFFFF;
+    }
+
+    mem = sim_rom + ( even - sim_rom_base );
+  }
+
+  else if ( even >= SIM_IO_BASE )
+  {
+    /* nothing pending on the MFP - no DMA/ACSI/FDC completion */
+    if ( read && even == ( SIM_MFP_GPIP & ~1 ) )
+      return 0xFFFF;
+
+    mem = sim_io + ( even - SIM_IO_BASE );
+  }
+
+  /* cartridge port floats high */
+  else if ( even >= 0x00FA0000 && even < 0x00FC0000 && read )
+    return 0xFFFF;
+
+  else
+  {
+    cpld.berr = true;
+
+    return 0xFFFF;
+  }
+
+  if ( read )
+    return ( mem [0] << 8 ) | mem [1];
+
+  if ( !byte )
+  {
+    mem [0] = data >> 8;
+    mem [1] = data;
+  }
+
+  /* UDS for even, LDS for odd addresses */
+  else if ( address & 1 )
+    mem [1] = data;
+
+  else
+    mem [0] = data >> 8;
+
+  return 0xFFFF;
+}
+
+
+static void sim_start_txn ( void )
+{
+  uint16_t hi = cpld.addr_hi;
+
+  cpld.data_in = sim_bus_cycle ( ( ( hi & 0xFF ) << 16 ) | cpld.addr_lo,
+                                 hi >> 13,
+                                 hi & 0x0200,
+                                 hi & 0x0100,
+                                 cpld.data_out );
+
+  cpld.txn_end = sim_latency_ns ? sim_now () + sim_latency_ns : 0;
+}
+
+
+static void sim_write_reg ( uint8_t reg, uint16_t value )
+{
+  switch ( reg )
+  {
+    case REG_DATA:
+      cpld.data_out = value;
+      break;
+
+    /* in burst mode this starts the next cycle with the latched ADDR_HI */
+    case REG_ADDR_LO:
+      cpld.addr_lo = value;
+
+      if ( cpld.burst )
+        sim_start_txn ();
+
+      break;
+
+    /* PI_D[15:13] fc, [10] burst, [9] read, [8] byte, [7:0] A23-A16 - starts the transaction */
+    case REG_ADDR_HI:
+      cpld.addr_hi = value;
+      cpld.burst = value & ADDR_HI_BIT_BURST;
+
+      sim_start_txn ();
+      break;
+
+    case REG_STATUS:
+      cpld.status = value;
+      cpld.burst = false;
+
+      if ( value & STATUS_BIT_INIT )
+        cpld.txn_end = 0;
+
+      break;
+  }
+}
+
+
+/* what the Pi would read from GPLEV */
+static uint32_t sim_lev ( void )
+{
+  uint32_t l = 0;
+  uint8_t  ipl = sim_ipl ();
+
+  if ( cpld.txn_end && sim_now () < cpld.txn_end )
+    l |= SIM_LEV_TXN;
+
+  if ( ipl == 0 && !( cpld.status & STATUS_BIT_RESET ) )
+    l |= SIM_LEV_IPLZERO;
+
+  if ( !cpld.berr )
+    l |= SIM_LEV_BERR;
+
+  if ( cpld.rd_reg == REG_STATUS )
+    l |= (uint32_t)( ( ipl << STATUS_SHIFT_IPL ) | ( cpld.status & STATUS_BIT_RESET ) ) << 8;
+
+  else
+    l |= (uint32_t)cpld.data_in << 8;
+
+  return l;
+}
+
+
+static inline uint32_t sim_wait_txn ( void )
+{
+  uint32_t l;
+
+  while ( ( l = sim_lev () ) & SIM_LEV_TXN )
+    ;
+
+  g_irq = CHECK_IRQ (l);
+  g_buserr = CHECK_BERR (l);
+
+  return l;
+}
+
+
+/* collect an outstanding posted write, see gpio_sync () */
+static void sim_sync ( void )
+{
+  uint32_t l;
+
+  while ( ( l = sim_lev () ) & SIM_LEV_TXN )
+    ;
+
+  g_irq = CHECK_IRQ (l);
+
+  if ( CHECK_BERR (l) )
+    ps_posted_berr = 1;
+
+  ps_write_pending = 0;
+}
+
+#define SIM_SYNC if ( ps_write_pending ) sim_sync ()
+
+
+static inline void sim_end_write ( void )
+{
+  if ( ps_posted )
+    ps_write_pending = 2;
+
+  else
+    sim_wait_txn ();
+}
+
+
+static void sim_write_16 ( uint32_t address, uint16_t data )
+{
+  SIM_SYNC;
+
+  sim_write_reg ( REG_DATA, data );
+  sim_write_reg ( REG_ADDR_LO, address & 0xFFFF );
+  sim_write_reg ( REG_ADDR_HI, (fc << 13) | (address >> 16) );
+
+  sim_end_write ();
+}
+
+
+static void sim_write_8 ( uint32_t address, uint16_t data )
+{
+  SIM_SYNC;
+
+  if ( (address & 1) == 0 )
+    data <<= 8;
+
+  else
+    data &= 0xff;
+
+  sim_write_reg ( REG_DATA, data );
+  sim_write_reg ( REG_ADDR_LO, address & 0xFFFF );
+  sim_write_reg ( REG_ADDR_HI, (fc << 13) | 0x0100 | (address >> 16) );
+
+  sim_end_write ();
+}
+
+
+static void sim_write_32 ( uint32_t address, uint32_t value )
+{
+  sim_write_16 ( address, value >> 16 );
+  sim_write_16 ( address + 2, value );
+}
+
+
+static uint16_t sim_read_16 ( uint32_t address )
+{
+  SIM_SYNC;
+
+  sim_write_reg ( REG_ADDR_LO, address & 0xFFFF );
+  sim_write_reg ( REG_ADDR_HI, (fc << 13) | 0x0200 | (address >> 16) );
+  cpld.rd_reg = REG_DATA;
+
+  return sim_wait_txn () >> 8;
+}
+
+
+static uint8_t sim_read_8 ( uint32_t address )
+{
+  uint32_t l;
+
+  SIM_SYNC;
+
+  sim_write_reg ( REG_ADDR_LO, address & 0xFFFF );
+  sim_write_reg ( REG_ADDR_HI, (fc << 13) | 0x0300 | (address >> 16) );
+  cpld.rd_reg = REG_DATA;
+
+  l = sim_wait_txn ();
+
+  if ( (address & 1) == 0 )
+    return (l >> 16);
+
+  else
+    return (l >> 8);
+}
+
+
+static uint32_t sim_read_32 ( uint32_t address )
+{
+  uint32_t d = sim_read_16 ( address ) << 16;
+
+  return d | sim_read_16 ( address + 2 );
+}
+
+
+static void sim_write_status_reg ( unsigned int value )
+{
+  SIM_SYNC;
+
+  sim_write_reg ( REG_STATUS, value );
+}
+
+
+static uint16_t sim_read_status_reg ( void )
+{
+  uint32_t l;
+
+  SIM_SYNC;
+
+  cpld.rd_reg = REG_STATUS;
+  l = sim_wait_txn ();
+  cpld.rd_reg = REG_DATA;
+
+  return (l >> 8);
+}
+
+
+static unsigned int sim_get_ipl_zero ( void )
+{
+  return sim_lev () & SIM_LEV_IPLZERO;
+}
+
+
+/* same register sequence as gpio_write_block () / gpio_read_block () - never across 64K */
+static void sim_write_block ( uint32_t address, const uint16_t *data, uint32_t words )
+{
+  SIM_SYNC;
+
+  for ( uint32_t n = 0; n < words; n++, address += 2 )
+  {
+    sim_write_reg ( REG_DATA, data [n] );
+    sim_write_reg ( REG_ADDR_LO, address & 0xFFFF );
+
+    if ( n == 0 )
+      sim_write_reg ( REG_ADDR_HI, (fc << 13) | ADDR_HI_BIT_BURST | (address >> 16) );
+
+    if ( CHECK_BERR ( sim_wait_txn () ) )
+      break;
+  }
+
+  sim_write_reg ( REG_STATUS, cpld.status );
+}
+
+
+static void sim_read_block ( uint32_t address, uint16_t *data, uint32_t words )
+{
+  uint32_t l;
+
+  SIM_SYNC;
+
+  cpld.rd_reg = REG_DATA;
+
+  for ( uint32_t n = 0; n < words; n++, address += 2 )
+  {
+    sim_write_reg ( REG_ADDR_LO, address & 0xFFFF );
+
+    if ( n == 0 )
+      sim_write_reg ( REG_ADDR_HI, (fc << 13) | ADDR_HI_BIT_BURST | 0x0200 | (address >> 16) );
+
+    l = sim_wait_txn ();
+    data [n] = l >> 8;
+
+    if ( CHECK_BERR (l) )
+      break;
+  }
+
+  sim_write_reg ( REG_STATUS, cpld.status );
+}
+
+
+static void sim_load_rom ( void )
+{
+  FILE *in = fopen ( sim_rom_file, "rb" );
+  long size;
+
+  if ( in == NULL )
+  {
+    printf ( "[SIM] Cannot open ROM image %s\n", sim_rom_file );
+
+    return;
+  }
+
+  fseek ( in, 0, SEEK_END );
+  size = ftell ( in );
+  fseek ( in, 0, SEEK_SET );
+
+  /* 192K images live at 0xFC0000, 256K (STe) at 0xE00000 */
+  sim_rom_base = size > 192 * 1024 ? 0x00E00000 : 0x00FC0000;
+  sim_rom_size = size;
+  sim_rom = calloc ( 1, size );
+
+  if ( sim_rom == NULL || fread ( sim_rom, size, 1, in ) != 1 )
+  {
+    printf ( "[SIM] Failed to read ROM image %s\n", sim_rom_file );
+
+    free ( sim_rom );
+    sim_rom = NULL;
+  }
+
+  else
+    printf ( "[SIM] TOS image %s at 0x%06X\n", sim_rom_file, sim_rom_base );
+
+  fclose ( in );
+}
+
+
+void ps_sim_configure ( const char *opts )
+{
+  char *copy = strdup ( opts );
+  char *save;
+
+  for ( char *opt = strtok_r ( copy, ",", &save ); opt; opt = strtok_r ( NULL, ",", &save ) )
+  {
+    if ( strncmp ( opt, "latency=", 8 ) == 0 )
+      sim_latency_ns = strtoul ( opt + 8, NULL, 0 );
+
+    else if ( strncmp ( opt, "ram=", 4 ) == 0 )
+      sim_ram_size = strtoul ( opt + 4, NULL, 0 ) * 1024;
+
+    else if ( strncmp ( opt, "rom=", 4 ) == 0 )
+      sim_rom_file = strdup ( opt + 4 );
+
+    else if ( strcmp ( opt, "novbl" ) == 0 )
+      sim_vbl = false;
+
+    else
+      printf ( "[SIM] Unknown option %s\n", opt );
+  }
+
+  free ( copy );
+
+  if ( sim_ram_size == 0 || sim_ram_size > SIM_RAM_SIZE )
+    sim_ram_size = SIM_RAM_SIZE;
+}
+
+
+static void sim_setup_protocol ( int targetF )
+{
+  sim_ram = calloc ( 1, sim_ram_size );
+
+  if ( sim_ram == NULL )
+  {
+    printf ( "[SIM] Cannot allocate %d KB ST-RAM\n", sim_ram_size / 1024 );
+    exit ( -1 );
+  }
+
+  if ( sim_rom_file )
+    sim_load_rom ();
+
+  memset ( &cpld, 0, sizeof ( cpld ) );
+  sim_next_vbl = sim_now () + SIM_VBL_NS;
+
+  printf ( "[SIM] Simulated CPLD - %d KB ST-RAM, %d ns per transaction%s\n",
+    sim_ram_size / 1024, sim_latency_ns, sim_vbl ? ", 50Hz VBL" : "" );
+}
+
+
+const t_ps_backend ps_sim_backend = {
+  .name         = "sim",
+  .setup        = sim_setup_protocol,
+  .read_8       = sim_read_8,
+  .read_16      = sim_read_16,
+  .read_32      = sim_read_32,
+  .write_8      = sim_write_8,
+  .write_16     = sim_write_16,
+  .write_32     = sim_write_32,
+  .read_status  = sim_read_status_reg,
+  .write_status = sim_write_status_reg,
+  .get_ipl_zero = sim_get_ipl_zero,
+  .read_block   = sim_read_block,
+  .write_block  = sim_write_block,
+  .sync         = sim_sync,
+};
@@ -0,0 +1,217 @@
+// SPDX-License-Identifier: MIT
+
+/*
+  Bus latency statistics
+
+  Every ps_* transaction is timed and lands in a per operation histogram
+  (see ps_stats.h), unless setvar nobusstats turned that off. The emulator publishes the counters as the POSIX shared
+  memory object PS_STATS_SHM so they can be sampled while it runs, e.g. with
+  ataritest --busstats loop=yes. Until then, and in ataritest, they live in
+  a private page.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "ps_stats.h"
+
+static t_ps_stats_page local_page;
+static int published;
+
+t_ps_stats_page *ps_stats = &local_page;
+uint8_t ps_stats_enabled = 1;
+
+static const char *op_names [PS_OP_NUM] = {
+  "read 8", "read 16", "read 32", "write 8", "write 16", "write 32", "status", "IACK",
+};
+
+
+static uint64_t tick_hz ( void )
+{
+#if defined(__aarch64__)
+  uint64_t f;
+
+  __asm__ volatile ( "mrs %0, cntfrq_el0" : "=r" ( f ) );
+
+  return f;
+#elif defined(__arm__)
+  uint32_t f;
+
+  __asm__ volatile ( "mrc p15, 0, %0, c14, c0, 0" : "=r" ( f ) );
+
+  return f;
+#else
+  return 1000000000ULL;
+#endif
+}
+
+
+static void page_init ( t_ps_stats_page *page )
+{
+  page->magic   = PS_STATS_MAGIC;
+  page->version = PS_STATS_VERSION;
+  page->buckets = PS_STATS_BUCKETS;
+  page->pid     = getpid ();
+  page->tick_hz = tick_hz ();
+}
+
+
+/* move the counters into shared memory - anything recorded so far comes along */
+int ps_stats_publish ( void )
+{
+  t_ps_stats_page *page;
+  int fd;
+
+  fd = shm_open ( PS_STATS_SHM, O_CREAT | O_RDWR, 0644 );
+
+  if ( fd < 0 || ftruncate ( fd, sizeof ( t_ps_stats_page ) ) )
+  {
+    printf ( "[STATS] can not create shared memory %s, bus statistics stay private\n", PS_STATS_SHM );
+
+    if ( fd >= 0 )
+      close ( fd );
+
+    page_init ( ps_stats );
+
+    return -1;
+  }
+
+  page = mmap ( NULL, sizeof ( t_ps_stats_page ), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  close ( fd );
+
+  if ( page == MAP_FAILED )
+  {
+    printf ( "[STATS] can not map shared memory %s, bus statistics stay private\n", PS_STATS_SHM );
+    page_init ( ps_stats );
+
+    return -1;
+  }
+
+  memcpy ( page, ps_stats, sizeof ( t_ps_stats_page ) );
+  page_init ( page );
+
+  ps_stats = page;
+  published = 1;
+
+  return 0;
+}
+
+
+void ps_stats_unpublish ( void )
+{
+  if ( !published )
+    return;
+
+  memcpy ( &local_page, ps_stats, sizeof ( t_ps_stats_page ) );
+  munmap ( ps_stats, sizeof ( t_ps_stats_page ) );
+  ps_stats = &local_page;
+
+  shm_unlink ( PS_STATS_SHM );
+  published = 0;
+}
+
+
+/* read only view of a running emulator's counters, NULL when there is none */
+const t_ps_stats_page *ps_stats_attach ( void )
+{
+  const t_ps_stats_page *page;
+  int fd;
+
+  fd = shm_open ( PS_STATS_SHM, O_RDONLY, 0 );
+
+  if ( fd < 0 )
+    return NULL;
+
+  page = mmap ( NULL, sizeof ( t_ps_stats_page ), PROT_READ, MAP_SHARED, fd, 0 );
+  close ( fd );
+
+  if ( page == MAP_FAILED )
+    return NULL;
+
+  if ( page->magic != PS_STATS_MAGIC || page->version != PS_STATS_VERSION )
+  {
+    munmap ( (void *)page, sizeof ( t_ps_stats_page ) );
+
+    return NULL;
+  }
+
+  return page;
+}
+
+
+void ps_stats_set_backend ( const char *name, uint32_t pi_clk_khz )
+{
+  if ( !ps_stats->magic )
+    page_init ( ps_stats );
+
+  strncpy ( ps_stats->backend, name, sizeof ( ps_stats->backend ) - 1 );
+  ps_stats->pi_clk_khz = pi_clk_khz;
+}
+
+
+/* lowest latency, in ticks, that lands in bucket b */
+static uint64_t bucket_floor ( int b )
+{
+  if ( b < 4 )
+    return b;
+
+  return (uint64_t)( 4 + ( b & 3 ) ) << ( b / 4 - 1 );
+}
+
+
+static uint64_t percentile ( const t_ps_op_stats *o, int pct )
+{
+  uint64_t want = ( o->count * pct + 99 ) / 100;
+  uint64_t seen = 0;
+
+  for ( int b = 0; b < PS_STATS_BUCKETS; b++ )
+  {
+    seen += o->hist [b];
+
+    /* upper edge of the bucket, so a percentile is never flattering */
+    if ( seen >= want )
+      return b + 1 < PS_STATS_BUCKETS ? bucket_floor ( b + 1 ) - 1 : o->max;
+  }
+
+  return o->max;
+}
+
+
+void ps_stats_print ( const t_ps_stats_page *page )
+{
+  double ns = page->tick_hz ? 1e9 / page->tick_hz : 1.0;
+
+  printf ( "[STATS] %s bus", page->backend [0] ? page->backend : "unknown" );
+
+  if ( page->pi_clk_khz )
+    printf ( ", PI_CLK %.3f MHz", page->pi_clk_khz / 1000.0 );
+
+  printf ( ", latency in ns\n" );
+  printf ( "[STATS] %-9s %12s %8s %8s %8s %8s\n", "", "count", "mean", "p50", "p99", "max" );
+
+  for ( int op = 0; op < PS_OP_NUM; op++ )
+  {
+    const t_ps_op_stats *o = &page->op [op];
+
+    if ( !o->count )
+      continue;
+
+    printf ( "[STATS] %-9s %12llu %8.0f %8.0f %8.0f %8.0f\n",
+      op_names [op],
+      (unsigned long long)o->count,
+      o->ticks * ns / o->count,
+      percentile ( o, 50 ) * ns,
+      percentile ( o, 99 ) * ns,
+      o->max * ns );
+  }
+
+  if ( page->txn_waits )
+    printf ( "[STATS] TXN_IN_PROGRESS waited on %llu times, %llu spins, %.3f ms\n",
+      (unsigned long long)page->txn_waits,
+      (unsigned long long)page->txn_spins,
+      page->txn_ticks * ns / 1e6 );
+}
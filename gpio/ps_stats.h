@@ -0,0 +1,164 @@
+// SPDX-License-Identifier: MIT
+/**
+ * pistorm
+ * bus latency histograms - published in shared memory while the emulator runs
+ */
+
+#ifndef _PS_STATS_H
+#define _PS_STATS_H
+
+#include <stdint.h>
+
+#define PS_STATS_SHM      "/pistorm-stats"
+#define PS_STATS_MAGIC    0x53545350 /* "PSTS" */
+#define PS_STATS_VERSION  1
+
+/* 4 buckets per power of two of the latency in ticks */
+#define PS_STATS_BUCKETS  128
+
+typedef enum {
+  PS_OP_R8,
+  PS_OP_R16,
+  PS_OP_R32,
+  PS_OP_W8,
+  PS_OP_W16,
+  PS_OP_W32,
+  PS_OP_STATUS,   /* CPLD status register, read or write */
+  PS_OP_IACK,     /* 16 bit read with FC 7 */
+  PS_OP_NUM,
+} ps_stats_ops;
+
+typedef struct {
+  uint64_t count;
+  uint64_t ticks;         /* sum of all latencies */
+  uint64_t max;
+  uint64_t hist [PS_STATS_BUCKETS];
+} t_ps_op_stats;
+
+/*
+ * one writer (whoever owns the bus), any number of readers - readers may see a
+ * count and its histogram a transaction apart, nothing more
+ */
+typedef struct {
+  uint32_t      magic;
+  uint16_t      version;
+  uint16_t      buckets;
+  uint32_t      pid;
+  uint32_t      pi_clk_khz;   /* PI_CLK actually programmed, 0 when not on the GPIO backend */
+  uint64_t      tick_hz;      /* latencies are in ticks of this clock */
+  char          backend [16];
+  uint64_t      txn_waits;    /* times TXN_IN_PROGRESS was still set when first looked at */
+  uint64_t      txn_spins;    /* GPLEV reads spent waiting for it to drop */
+  uint64_t      txn_ticks;    /* time spent waiting for it to drop */
+  t_ps_op_stats op [PS_OP_NUM];
+} t_ps_stats_page;
+
+extern t_ps_stats_page *ps_stats;
+
+int  ps_stats_publish ( void );
+void ps_stats_unpublish ( void );
+const t_ps_stats_page *ps_stats_attach ( void );
+void ps_stats_set_backend ( const char *name, uint32_t pi_clk_khz );
+void ps_stats_print ( const t_ps_stats_page *page );
+
+
+/* cleared by setvar nobusstats - the wrappers below then cost a predictable branch */
+extern uint8_t ps_stats_enabled;
+
+/* ARM generic timer (the kernel opens it to EL0 for the vDSO), CLOCK_MONOTONIC_RAW elsewhere */
+#if defined(__aarch64__)
+static inline uint64_t ps_stats_now ( void )
+{
+  uint64_t t;
+
+  if ( !ps_stats_enabled )
+    return 0;
+
+  __asm__ volatile ( "mrs %0, cntvct_el0" : "=r" ( t ) );
+
+  return t;
+}
+#elif defined(__arm__)
+static inline uint64_t ps_stats_now ( void )
+{
+  uint64_t t;
+
+  if ( !ps_stats_enabled )
+    return 0;
+
+  __asm__ volatile ( "mrrc p15, 1, %Q0, %R0, c14" : "=r" ( t ) );
+
+  return t;
+}
+#else
+#include <time.h>
+
+static inline uint64_t ps_stats_now ( void )
+{
+  struct timespec ts;
+
+  if ( !ps_stats_enabled )
+    return 0;
+
+  clock_gettime ( CLOCK_MONOTONIC_RAW, &ts );
+
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+#endif
+
+
+static inline int ps_stats_bucket ( uint64_t ticks )
+{
+  int msb;
+
+  if ( ticks < 4 )
+    return ticks;
+
+  msb = 63 - __builtin_clzll ( ticks );
+
+  if ( msb > 32 )
+    return PS_STATS_BUCKETS - 1;
+
+  return ( msb - 1 ) * 4 + ( ( ticks >> ( msb - 2 ) ) & 3 );
+}
+
+
+/* n transactions that took ticks in total - n > 1 for block transfers */
+static inline void ps_stats_record_n ( int op, uint64_t start, uint32_t n )
+{
+  uint64_t ticks, each;
+  t_ps_op_stats *o;
+
+  if ( !ps_stats_enabled )
+    return;
+
+  ticks = ps_stats_now () - start;
+  each  = n > 1 ? ticks / n : ticks;
+  o     = &ps_stats->op [op];
+
+  o->count += n;
+  o->ticks += ticks;
+  o->hist [ps_stats_bucket ( each )] += n;
+
+  if ( each > o->max )
+    o->max = each;
+}
+
+
+static inline void ps_stats_record ( int op, uint64_t start )
+{
+  ps_stats_record_n ( op, start, 1 );
+}
+
+
+static inline void ps_stats_txn_wait ( uint64_t start, uint32_t spins )
+{
+  if ( !ps_stats_enabled )
+    return;
+
+  ps_stats->txn_waits++;
+  ps_stats->txn_spins += spins;
+  ps_stats->txn_ticks += ps_stats_now () - start;
+}
+
+#endif /* _PS_STATS_H */
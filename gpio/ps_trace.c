@@ -0,0 +1,576 @@
+// SPDX-License-Identifier: MIT
+
+/*
+  Bus transaction trace
+
+  ps_trace_start () puts a recording backend in front of the selected one
+  (gpio or sim). Every ps_* call is timed and stored in a lock free ring,
+  a writer thread streams the ring to a file of t_ps_trace_rec records.
+
+  ps_trace_replay () feeds such a file back through the current backend and
+  reports transaction counts and timing per memory region and per FC.
+
+  emulator --trace <file>, ataritest --replay file=<file>
+*/
+
+// see feature_set_macros(7)
+#define _GNU_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "ps_protocol.h"
+#include "ps_trace.h"
+
+#define TRACE_RING_SIZE (1 << 18)   /* records, 6 MB */
+#define TRACE_RING_MASK (TRACE_RING_SIZE - 1)
+#define REPLAY_BLOCK    4096        /* words */
+
+extern volatile uint16_t g_irq;
+extern volatile uint32_t g_buserr;
+extern uint8_t fc;
+
+typedef struct {
+  volatile uint64_t seq;  /* index + 1 once the record is complete */
+  t_ps_trace_rec    rec;
+} t_trace_slot;
+
+static t_trace_slot       *ring;
+static volatile uint64_t   ring_head;   /* next slot to claim */
+static volatile uint64_t   ring_tail;   /* next slot the writer saves */
+static volatile uint64_t   dropped;
+static volatile bool       writer_running;
+static pthread_t           writer_tid;
+static FILE               *trace_file;
+static uint64_t            trace_start;
+
+static const t_ps_backend *traced;
+static t_ps_backend        trace_backend;
+
+
+static inline uint64_t trace_now ( void )
+{
+  struct timespec ts;
+
+  clock_gettime ( CLOCK_MONOTONIC, &ts );
+
+  return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+
+static inline void trace_record ( uint64_t start, uint64_t end, uint32_t address, uint32_t data, uint8_t flags )
+{
+  uint64_t n;
+  t_trace_slot *slot;
+
+  /* full - the writer thread is behind, drop rather than stall the CPU */
+  if ( ring_head - ring_tail >= TRACE_RING_SIZE )
+  {
+    dropped++;
+
+    return;
+  }
+
+  n = __atomic_fetch_add ( &ring_head, 1, __ATOMIC_RELAXED );
+  slot = &ring [n & TRACE_RING_MASK];
+
+  slot->rec.ns       = start - trace_start;
+  slot->rec.address  = address;
+  slot->rec.data     = data;
+  slot->rec.duration = end - start > UINT32_MAX ? UINT32_MAX : end - start;
+  slot->rec.fc       = fc;
+  slot->rec.flags    = flags | ( g_buserr ? PS_TRACE_BERR : 0 ) | ( g_irq ? PS_TRACE_IRQ : 0 );
+  slot->rec.reserved = 0;
+
+  __atomic_store_n ( &slot->seq, n + 1, __ATOMIC_RELEASE );
+}
+
+
+static void *trace_writer ( void *arg )
+{
+  while ( writer_running || ring_tail != ring_head )
+  {
+    t_trace_slot *slot = &ring [ring_tail & TRACE_RING_MASK];
+
+    if ( __atomic_load_n ( &slot->seq, __ATOMIC_ACQUIRE ) != ring_tail + 1 )
+    {
+      if ( !writer_running )
+        break;
+
+      usleep ( 1000 );
+      continue;
+    }
+
+    fwrite ( &slot->rec, sizeof ( t_ps_trace_rec ), 1, trace_file );
+
+    __atomic_store_n ( &ring_tail, ring_tail + 1, __ATOMIC_RELEASE );
+  }
+
+  return NULL;
+}
+
+
+static void trace_setup ( int targetF )
+{
+  traced->setup ( targetF );
+}
+
+
+static uint8_t trace_read_8 ( uint32_t address )
+{
+  uint64_t t = trace_now ();
+  uint8_t d = traced->read_8 ( address );
+
+  trace_record ( t, trace_now (), address, d, 1 );
+
+  return d;
+}
+
+
+static uint16_t trace_read_16 ( uint32_t address )
+{
+  uint64_t t = trace_now ();
+  uint16_t d = traced->read_16 ( address );
+
+  trace_record ( t, trace_now (), address, d, 2 );
+
+  return d;
+}
+
+
+static uint32_t trace_read_32 ( uint32_t address )
+{
+  uint64_t t = trace_now ();
+  uint32_t d = traced->read_32 ( address );
+
+  trace_record ( t, trace_now (), address, d, 4 );
+
+  return d;
+}
+
+
+static void trace_write_8 ( uint32_t address, uint16_t data )
+{
+  uint64_t t = trace_now ();
+
+  traced->write_8 ( address, data );
+  trace_record ( t, trace_now (), address, data & 0xFF, 1 | PS_TRACE_WRITE );
+}
+
+
+static void trace_write_16 ( uint32_t address, uint16_t data )
+{
+  uint64_t t = trace_now ();
+
+  traced->write_16 ( address, data );
+  trace_record ( t, trace_now (), address, data, 2 | PS_TRACE_WRITE );
+}
+
+
+static void trace_write_32 ( uint32_t address, uint32_t data )
+{
+  uint64_t t = trace_now ();
+
+  traced->write_32 ( address, data );
+  trace_record ( t, trace_now (), address, data, 4 | PS_TRACE_WRITE );
+}
+
+
+static uint16_t trace_read_status ( void )
+{
+  uint64_t t = trace_now ();
+  uint16_t d = traced->read_status ();
+
+  trace_record ( t, trace_now (), 0, d, PS_TRACE_STATUS );
+
+  return d;
+}
+
+
+static void trace_write_status ( unsigned int value )
+{
+  uint64_t t = trace_now ();
+
+  traced->write_status ( value );
+  trace_record ( t, trace_now (), 0, value, PS_TRACE_STATUS | PS_TRACE_WRITE );
+}
+
+
+static unsigned int trace_get_ipl_zero ( void )
+{
+  return traced->get_ipl_zero ();
+}
+
+
+/* one record per word, the block time is shared out evenly */
+static void trace_read_block ( uint32_t address, uint16_t *data, uint32_t words )
+{
+  uint64_t t = trace_now ();
+
+  uint64_t per;
+
+  traced->read_block ( address, data, words );
+  per = words ? ( trace_now () - t ) / words : 0;
+
+  for ( uint32_t n = 0; n < words; n++ )
+    trace_record ( t, t + per, address + n * 2, data [n], 2 | PS_TRACE_BLOCK );
+}
+
+
+static void trace_write_block ( uint32_t address, const uint16_t *data, uint32_t words )
+{
+  uint64_t t = trace_now ();
+
+  uint64_t per;
+
+  traced->write_block ( address, data, words );
+  per = words ? ( trace_now () - t ) / words : 0;
+
+  for ( uint32_t n = 0; n < words; n++ )
+    trace_record ( t, t + per, address + n * 2, data [n], 2 | PS_TRACE_BLOCK | PS_TRACE_WRITE );
+}
+
+
+static void trace_sync ( void )
+{
+  traced->sync ();
+}
+
+
+/*
+ * start recording to filename - wraps the backend chosen with
+ * ps_select_backend (), call before ps_setup_protocol ()
+ */
+int ps_trace_start ( const char *filename )
+{
+  t_ps_trace_header header;
+  struct timespec ts;
+
+  trace_file = fopen ( filename, "wb" );
+
+  if ( trace_file == NULL )
+  {
+    printf ( "[TRACE] Cannot create %s\n", filename );
+
+    return -1;
+  }
+
+  ring = calloc ( TRACE_RING_SIZE, sizeof ( t_trace_slot ) );
+
+  if ( ring == NULL )
+  {
+    printf ( "[TRACE] Cannot allocate trace buffer\n" );
+    fclose ( trace_file );
+
+    return -1;
+  }
+
+  clock_gettime ( CLOCK_REALTIME, &ts );
+
+  header.magic       = PS_TRACE_MAGIC;
+  header.version     = PS_TRACE_VERSION;
+  header.record_size = sizeof ( t_ps_trace_rec );
+  header.start       = (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+
+  fwrite ( &header, sizeof ( header ), 1, trace_file );
+
+  trace_start = trace_now ();
+  writer_running = true;
+
+  if ( pthread_create ( &writer_tid, NULL, &trace_writer, NULL ) )
+  {
+    printf ( "[TRACE] Cannot create writer thread\n" );
+    fclose ( trace_file );
+
+    return -1;
+  }
+
+  pthread_setname_np ( writer_tid, "pistorm: trace" );
+
+  traced = ps_bus;
+
+  trace_backend              = *traced;
+  trace_backend.name         = "trace";
+  trace_backend.setup        = trace_setup;
+  trace_backend.read_8       = trace_read_8;
+  trace_backend.read_16      = trace_read_16;
+  trace_backend.read_32      = trace_read_32;
+  trace_backend.write_8      = trace_write_8;
+  trace_backend.write_16     = trace_write_16;
+  trace_backend.write_32     = trace_write_32;
+  trace_backend.read_status  = trace_read_status;
+  trace_backend.write_status = trace_write_status;
+  trace_backend.get_ipl_zero = trace_get_ipl_zero;
+  trace_backend.read_block   = traced->read_block ? trace_read_block : NULL;
+  trace_backend.write_block  = traced->write_block ? trace_write_block : NULL;
+  trace_backend.sync         = trace_sync;
+
+  ps_bus = &trace_backend;
+
+  printf ( "[TRACE] Recording %s transactions to %s\n", traced->name, filename );
+
+  return 0;
+}
+
+
+void ps_trace_stop ( void )
+{
+  if ( trace_file == NULL )
+    return;
+
+  ps_bus = traced;
+
+  writer_running = false;
+  pthread_join ( writer_tid, NULL );
+
+  printf ( "[TRACE] %llu transactions recorded, %llu dropped\n",
+    (unsigned long long)ring_tail, (unsigned long long)dropped );
+
+  fclose ( trace_file );
+  trace_file = NULL;
+}
+
+
+
+/* replay */
+
+enum {
+  REGION_STRAM,
+  REGION_ROM,
+  REGION_CART,
+  REGION_IO,
+  REGION_STATUS,
+  REGION_OTHER,
+  REGION_NUM
+};
+
+static const char *region_names [REGION_NUM] = { "ST-RAM", "ROM", "cartridge", "IO", "status", "other" };
+
+typedef struct {
+  uint64_t reads;
+  uint64_t writes;
+  uint64_t berr;
+  uint64_t recorded_ns;
+  uint64_t replayed_ns;
+} t_replay_stats;
+
+
+static int replay_region ( t_ps_trace_rec *r )
+{
+  uint32_t a = r->address & 0x00FFFFFF;
+
+  if ( r->flags & PS_TRACE_STATUS )
+    return REGION_STATUS;
+
+  if ( a < 0x00400000 )
+    return REGION_STRAM;
+
+  if ( ( a >= 0x00E00000 && a < 0x00E40000 ) || ( a >= 0x00FC0000 && a < 0x00FF0000 ) )
+    return REGION_ROM;
+
+  if ( a >= 0x00FA0000 && a < 0x00FC0000 )
+    return REGION_CART;
+
+  if ( a >= 0x00FF8000 )
+    return REGION_IO;
+
+  return REGION_OTHER;
+}
+
+
+static void replay_count ( t_replay_stats *s, t_ps_trace_rec *r, uint64_t ns )
+{
+  if ( r->flags & PS_TRACE_WRITE )
+    s->writes++;
+
+  else
+    s->reads++;
+
+  if ( r->flags & PS_TRACE_BERR )
+    s->berr++;
+
+  s->recorded_ns += r->duration;
+  s->replayed_ns += ns;
+}
+
+
+static void replay_print ( const char *name, t_replay_stats *s )
+{
+  uint64_t ops = s->reads + s->writes;
+
+  if ( ops == 0 )
+    return;
+
+  printf ( "  %-10s %10llu %10llu %8llu %10llu %10llu\n", name,
+    (unsigned long long)s->reads, (unsigned long long)s->writes, (unsigned long long)s->berr,
+    (unsigned long long)( s->recorded_ns / ops ), (unsigned long long)( s->replayed_ns / ops ) );
+}
+
+
+/* issue one recorded transaction, returns the time it took */
+static uint64_t replay_one ( t_ps_trace_rec *r )
+{
+  uint64_t t = trace_now ();
+
+  fc = r->fc;
+
+  if ( r->flags & PS_TRACE_STATUS )
+  {
+    if ( r->flags & PS_TRACE_WRITE )
+      ps_write_status_reg ( r->data );
+
+    else
+      ps_read_status_reg ();
+  }
+
+  else if ( r->flags & PS_TRACE_WRITE )
+  {
+    switch ( r->flags & PS_TRACE_SIZE_MASK )
+    {
+      case 1: ps_write_8 ( r->address, r->data ); break;
+      case 2: ps_write_16 ( r->address, r->data ); break;
+      case 4: ps_write_32 ( r->address, r->data ); break;
+    }
+  }
+
+  else
+  {
+    switch ( r->flags & PS_TRACE_SIZE_MASK )
+    {
+      case 1: ps_read_8 ( r->address ); break;
+      case 2: ps_read_16 ( r->address ); break;
+      case 4: ps_read_32 ( r->address ); break;
+    }
+  }
+
+  ps_sync ();
+
+  return trace_now () - t;
+}
+
+
+/*
+ * run a trace through the current bus backend - writes are replayed with
+ * their recorded data, block transfers as blocks again
+ */
+int ps_trace_replay ( const char *filename )
+{
+  t_ps_trace_header header;
+  t_ps_trace_rec *recs;
+  t_replay_stats regions [REGION_NUM] = { 0 };
+  t_replay_stats fcs [8] = { 0 };
+  static uint16_t block [REPLAY_BLOCK];
+  uint64_t count, total = 0;
+  long size;
+  FILE *in = fopen ( filename, "rb" );
+
+  if ( in == NULL )
+  {
+    printf ( "[TRACE] Cannot open %s\n", filename );
+
+    return -1;
+  }
+
+  if ( fread ( &header, sizeof ( header ), 1, in ) != 1
+    || header.magic != PS_TRACE_MAGIC
+    || header.version != PS_TRACE_VERSION
+    || header.record_size != sizeof ( t_ps_trace_rec ) )
+  {
+    printf ( "[TRACE] %s is not a version %d trace file\n", filename, PS_TRACE_VERSION );
+    fclose ( in );
+
+    return -1;
+  }
+
+  fseek ( in, 0, SEEK_END );
+  size = ftell ( in ) - sizeof ( header );
+  fseek ( in, sizeof ( header ), SEEK_SET );
+
+  count = size / sizeof ( t_ps_trace_rec );
+  recs = malloc ( count * sizeof ( t_ps_trace_rec ) );
+
+  if ( recs == NULL || fread ( recs, sizeof ( t_ps_trace_rec ), count, in ) != count )
+  {
+    printf ( "[TRACE] Failed to read %s\n", filename );
+    free ( recs );
+    fclose ( in );
+
+    return -1;
+  }
+
+  fclose ( in );
+
+  printf ( "Replaying %llu transactions (%.3f s recorded) through the %s backend\n",
+    (unsigned long long)count, count ? recs [count - 1].ns / 1e9 : 0.0, ps_bus->name );
+
+  for ( uint64_t n = 0; n < count; )
+  {
+    t_ps_trace_rec *r = &recs [n];
+    uint64_t ns;
+    uint32_t words = 1;
+
+    if ( r->flags & PS_TRACE_BLOCK )
+    {
+      /* gather the rest of the block - contiguous words, same direction */
+      while ( n + words < count && words < REPLAY_BLOCK
+        && ( recs [n + words].flags & ( PS_TRACE_BLOCK | PS_TRACE_WRITE ) ) == ( r->flags & ( PS_TRACE_BLOCK | PS_TRACE_WRITE ) )
+        && recs [n + words].address == r->address + words * 2
+        && recs [n + words].ns == r->ns )
+        words++;
+
+      for ( uint32_t w = 0; w < words; w++ )
+        block [w] = recs [n + w].data;
+
+      fc = r->fc;
+      ns = trace_now ();
+
+      if ( r->flags & PS_TRACE_WRITE )
+        ps_write_block ( r->address, block, words );
+
+      else
+        ps_read_block ( r->address, block, words );
+
+      ns = ( trace_now () - ns ) / words;
+    }
+
+    else
+      ns = replay_one ( r );
+
+    for ( uint32_t w = 0; w < words; w++ )
+    {
+      replay_count ( &regions [replay_region ( &recs [n + w] )], &recs [n + w], ns );
+
+      if ( !( recs [n + w].flags & PS_TRACE_STATUS ) )
+        replay_count ( &fcs [recs [n + w].fc & 7], &recs [n + w], ns );
+    }
+
+    total += ns * words;
+    n += words;
+  }
+
+  printf ( "\n  %-10s %10s %10s %8s %10s %10s\n", "region", "reads", "writes", "berr", "rec ns/op", "rep ns/op" );
+
+  for ( int i = 0; i < REGION_NUM; i++ )
+    replay_print ( region_names [i], &regions [i] );
+
+  printf ( "\n  %-10s %10s %10s %8s %10s %10s\n", "fc", "reads", "writes", "berr", "rec ns/op", "rep ns/op" );
+
+  for ( int i = 0; i < 8; i++ )
+  {
+    char name [8];
+
+    snprintf ( name, sizeof ( name ), "%d", i );
+    replay_print ( name, &fcs [i] );
+  }
+
+  printf ( "\nReplay took %.3f s on the bus\n", total / 1e9 );
+
+  free ( recs );
+
+  return 0;
+}
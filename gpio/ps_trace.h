@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: MIT
+/**
+ * pistorm
+ * bus transaction trace - recorder and replay
+ */
+
+#ifndef _PS_TRACE_H
+#define _PS_TRACE_H
+
+#include <stdint.h>
+
+#define PS_TRACE_MAGIC      0x52545350 /* "PSTR" */
+#define PS_TRACE_VERSION    1
+
+/* t_ps_trace_rec flags */
+#define PS_TRACE_SIZE_MASK  0x07    /* 1, 2 or 4 bytes */
+#define PS_TRACE_WRITE      0x08
+#define PS_TRACE_BERR       0x10
+#define PS_TRACE_IRQ        0x20    /* IPL was not zero at the end of the transaction */
+#define PS_TRACE_BLOCK      0x40    /* one word of ps_read_block () / ps_write_block () */
+#define PS_TRACE_STATUS     0x80    /* CPLD status register, data is the register value */
+
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t record_size;
+  uint64_t start;       /* CLOCK_REALTIME at the start of the trace, ns */
+} t_ps_trace_header;
+
+/* 24 bytes, written to the file as is (host byte order) */
+typedef struct {
+  uint64_t ns;          /* since the start of the trace */
+  uint32_t address;
+  uint32_t data;
+  uint32_t duration;    /* ns spent in the bus backend */
+  uint8_t  fc;
+  uint8_t  flags;
+  uint16_t reserved;
+} t_ps_trace_rec;
+
+int  ps_trace_start ( const char *filename );
+void ps_trace_stop ( void );
+int  ps_trace_replay ( const char *filename );
+
+#endif /* _PS_TRACE_H */
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: MIT
+
+/*
+  Instruction cache
+
+  Storage, sizing and statistics for the cache described in icache.h.
+  Lookups and fills are done by m68ki_ic_readimm16 () in m68kcpu.h.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "icache.h"
+
+uint32_t       Icache_bytes = ICACHE_ARCH_BYTES;
+t_icache_stats icache_stats;
+
+/* usable before icache_init (), the CPU is reset before the config is read */
+static t_icache_line icache_arch [ICACHE_ARCH_BYTES / 4];
+
+t_icache_line *icache      = icache_arch;
+uint32_t       icache_mask = ICACHE_ARCH_BYTES / 4 - 1;
+
+
+int icache_init ( void )
+{
+  t_icache_line *lines;
+
+  if ( Icache_bytes == ICACHE_ARCH_BYTES || icache != icache_arch )
+    return 0;
+
+  if ( Icache_bytes < ICACHE_ARCH_BYTES || Icache_bytes > ICACHE_MAX_BYTES || ( Icache_bytes & ( Icache_bytes - 1 ) ) )
+  {
+    printf ( "[ICACHE] size %u is not a power of two between %d and %d, using %d bytes\n",
+      Icache_bytes, ICACHE_ARCH_BYTES, ICACHE_MAX_BYTES, ICACHE_ARCH_BYTES );
+
+    Icache_bytes = ICACHE_ARCH_BYTES;
+
+    return -1;
+  }
+
+  lines = calloc ( Icache_bytes / 4, sizeof ( t_icache_line ) );
+
+  if ( !lines )
+  {
+    printf ( "[ICACHE] Cannot allocate %u bytes, using %d\n", Icache_bytes, ICACHE_ARCH_BYTES );
+
+    Icache_bytes = ICACHE_ARCH_BYTES;
+
+    return -1;
+  }
+
+  icache      = lines;
+  icache_mask = Icache_bytes / 4 - 1;
+
+  printf ( "[ICACHE] %u KB instruction cache\n", Icache_bytes / 1024 );
+
+  return 0;
+}
+
+
+void icache_flush ( void )
+{
+  memset ( icache, 0, ( icache_mask + 1 ) * sizeof ( t_icache_line ) );
+
+  icache_stats.flushes++;
+}
+
+
+/* CACR CEI - the entry CAAR points at */
+void icache_clear_entry ( uint32_t address )
+{
+  icache [( address >> 2 ) & icache_mask].tag = 0;
+}
+
+
+void icache_report ( void )
+{
+  uint64_t fetches = icache_stats.hits + icache_stats.misses + icache_stats.frozen;
+
+  if ( !fetches )
+    return;
+
+  printf ( "[ICACHE] %llu fetches, %.1f%% hits, %llu fills, %llu frozen misses\n",
+    (unsigned long long)fetches,
+    100.0 * icache_stats.hits / fetches,
+    (unsigned long long)icache_stats.misses,
+    (unsigned long long)icache_stats.frozen );
+
+  printf ( "[ICACHE] %llu lines invalidated by writes, %llu flushes\n",
+    (unsigned long long)icache_stats.invalidated,
+    (unsigned long long)icache_stats.flushes );
+}
@@ -0,0 +1,73 @@
+// SPDX-License-Identifier: MIT
+/**
+ * pistorm
+ * 68020/68030 instruction cache for code fetched over the Atari bus
+ */
+
+#ifndef _ICACHE_H
+#define _ICACHE_H
+
+#include <stdint.h>
+
+/*
+ * Direct mapped, one longword per line like the 68020's own 256 byte cache.
+ * setvar icache <bytes> makes it larger - the CPU can't tell, it only ever
+ * sees fewer bus cycles. CACR enable, freeze and clear work as on the real
+ * chip. Unlike the real chip, every CPU write, emulated blit and finished
+ * DMA transfer keeps the cache coherent, TOS does not expect one.
+ *
+ * Code in host backed pages (mapped ROM, ALT-RAM) is never cached here.
+ */
+#define ICACHE_ARCH_BYTES  256
+#define ICACHE_MAX_BYTES   ( 1024 * 1024 )
+
+/* tag is the longword address with the low bits used as flags, 0 is an empty line */
+#define ICACHE_VALID       0x1
+#define ICACHE_SUPER       0x2
+
+typedef struct {
+  uint32_t tag;
+  uint32_t data;
+} t_icache_line;
+
+typedef struct {
+  uint64_t hits;
+  uint64_t misses;          /* line filled from the bus */
+  uint64_t frozen;          /* misses that could not fill, CACR freeze */
+  uint64_t invalidated;     /* lines dropped by writes */
+  uint64_t flushes;         /* whole cache - CACR clear, reset, DMA, hardware blitter */
+} t_icache_stats;
+
+extern uint32_t        Icache_bytes;
+extern t_icache_line  *icache;
+extern uint32_t        icache_mask;
+extern t_icache_stats  icache_stats;
+
+int  icache_init ( void );
+void icache_flush ( void );
+void icache_clear_entry ( uint32_t address );
+void icache_report ( void );
+
+
+static inline void icache_drop ( uint32_t address )
+{
+  t_icache_line *line = &icache [( address >> 2 ) & icache_mask];
+
+  if ( line->tag && ( line->tag & ~3 ) == ( address & ~3 ) )
+  {
+    line->tag = 0;
+    icache_stats.invalidated++;
+  }
+}
+
+
+/* something wrote size bytes at address on the Atari bus */
+static inline void icache_write ( uint32_t address, int size )
+{
+  icache_drop ( address );
+
+  if ( ( ( address + size - 1 ) ^ address ) & ~3 )
+    icache_drop ( address + size - 1 );
+}
+
+#endif /* _ICACHE_H */
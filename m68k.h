@@ -209,6 +209,10 @@ void m68k_write_memory_8(unsigned int address, unsigned int value);
 void m68k_write_memory_16(unsigned int address, unsigned int value);
 void m68k_write_memory_32(unsigned int address, unsigned int value);
 
+/* Block of big-endian words, for MOVEM and exception frames */
+void m68k_read_memory_words(unsigned int address, uint16_t *words, unsigned int count);
+void m68k_write_memory_words(unsigned int address, const uint16_t *words, unsigned int count);
+
 /* PiStorm speed hax */
 void m68k_add_ram_range(uint32_t addr, uint32_t upper, unsigned char *ptr);
 void m68k_add_rom_range(uint32_t addr, uint32_t upper, unsigned char *ptr);
@@ -403,6 +407,11 @@ unsigned int m68k_disassemble(char* str_buff, unsigned int pc, unsigned int cpu_
  */
 unsigned int m68k_disassemble_raw(char* str_buff, unsigned int pc, const unsigned char* opdata, const unsigned char* argdata, unsigned int cpu_type);
 
+/* Compare the FPU's host arithmetic fast path against softfloat on count
+ * random operand pairs per precision. Returns the number of mismatches.
+ */
+unsigned int m68k_fpu_check_fast_path(unsigned int count);
+
 
 /* ======================================================================== */
 /* ============================== MAME STUFF ============================== */
@@ -112,6 +112,12 @@ M68KMAKE_PROTOTYPE_FOOTER
 /* Build the opcode handler table */
 void m68ki_build_opcode_table(void);
 
+/* Fill the jump table with the handlers compiled for a CPU_TYPE_* */
+void m68ki_select_opcode_handlers(unsigned int cpu_type);
+
+/* Install the fused pair handlers generated from the fusion profile */
+int m68ki_fuse_opcode_table(void);
+
 struct m68ki_cpu_core;
 
 extern void (*m68ki_instruction_jump_table[0x10000])(struct m68ki_cpu_core *state); /* opcode handler jump table */
@@ -134,6 +140,7 @@ M68KMAKE_TABLE_HEADER
 /* ======================================================================== */
 
 #include <stdio.h>
+#include "m68kcpu.h"
 #include "m68kops.h"
 
 #define NUM_CPU_TYPES 5
@@ -141,10 +148,16 @@ M68KMAKE_TABLE_HEADER
 void  (*m68ki_instruction_jump_table[0x10000])(m68ki_cpu_core *state); /* opcode handler jump table */
 unsigned char m68ki_cycles[NUM_CPU_TYPES][0x10000]; /* Cycles used by CPU type */
 
+/*
+ * Entry of m68k_opcode_handler_table each opcode uses. The handlers are
+ * compiled once per CPU model (m68kops_<model>.c) and listed in table order,
+ * m68ki_select_opcode_handlers() fills the jump table from them.
+ */
+static unsigned short m68ki_opcode_index[0x10000];
+
 /* This is used to generate the opcode handler jump table */
 typedef struct
 {
-	void (*opcode_handler)(m68ki_cpu_core *state);        /* handler function */
 	unsigned int  mask;                  /* mask on opcode */
 	unsigned int  match;                 /* what to match after masking */
 	unsigned char cycles[NUM_CPU_TYPES]; /* cycles each cpu type takes */
@@ -154,16 +167,19 @@ typedef struct
 /* Opcode handler table */
 static const opcode_handler_struct m68k_opcode_handler_table[] =
 {
-/*   function                      mask    match    000  010  020  040 */
+/* mask    match    000  010  020  040 */
 
 
 
 XXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXXX
 M68KMAKE_TABLE_FOOTER
 
-	{0, 0, 0, {0, 0, 0, 0, 0}}
+	{0, 0, {0, 0, 0, 0, 0}}
 };
 
+/* the model handler sets have m68k_op_illegal after the last table entry */
+#define M68KI_ILLEGAL_INDEX (sizeof(m68k_opcode_handler_table) / sizeof(m68k_opcode_handler_table[0]) - 1)
+
 
 /* Build the opcode handler jump table */
 void m68ki_build_opcode_table(void)
@@ -178,7 +194,7 @@ void m68ki_build_opcode_table(void)
 	for(i = 0; i < 0x10000; i++)
 	{
 		/* default to illegal */
-		m68ki_instruction_jump_table[i] = m68k_op_illegal;
+		m68ki_opcode_index[i] = M68KI_ILLEGAL_INDEX;
 		for(k=0;k<NUM_CPU_TYPES;k++)
 			m68ki_cycles[k][i] = 0;
 	}
@@ -190,7 +206,7 @@ void m68ki_build_opcode_table(void)
 		{
 			if((i & ostruct->mask) == ostruct->match)
 			{
-				m68ki_instruction_jump_table[i] = ostruct->opcode_handler;
+				m68ki_opcode_index[i] = ostruct - m68k_opcode_handler_table;
 				for(k=0;k<NUM_CPU_TYPES;k++)
 					m68ki_cycles[k][i] = ostruct->cycles[k];
 			}
@@ -201,7 +217,7 @@ void m68ki_build_opcode_table(void)
 	{
 		for(i = 0;i <= 0xff;i++)
 		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
+			m68ki_opcode_index[ostruct->match | i] = ostruct - m68k_opcode_handler_table;
 			for(k=0;k<NUM_CPU_TYPES;k++)
 				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
 		}
@@ -214,7 +230,7 @@ void m68ki_build_opcode_table(void)
 			for(j = 0;j < 8;j++)
 			{
 				instr = ostruct->match | (i << 9) | j;
-				m68ki_instruction_jump_table[instr] = ostruct->opcode_handler;
+				m68ki_opcode_index[instr] = ostruct - m68k_opcode_handler_table;
 				for(k=0;k<NUM_CPU_TYPES;k++)
 					m68ki_cycles[k][instr] = ostruct->cycles[k];
 				// For all shift operations with known shift distance (encoded in instruction word)
@@ -236,7 +252,7 @@ void m68ki_build_opcode_table(void)
 	{
 		for(i = 0;i <= 0x0f;i++)
 		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
+			m68ki_opcode_index[ostruct->match | i] = ostruct - m68k_opcode_handler_table;
 			for(k=0;k<NUM_CPU_TYPES;k++)
 				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
 		}
@@ -246,7 +262,7 @@ void m68ki_build_opcode_table(void)
 	{
 		for(i = 0;i <= 0x07;i++)
 		{
-			m68ki_instruction_jump_table[ostruct->match | (i << 9)] = ostruct->opcode_handler;
+			m68ki_opcode_index[ostruct->match | (i << 9)] = ostruct - m68k_opcode_handler_table;
 			for(k=0;k<NUM_CPU_TYPES;k++)
 				m68ki_cycles[k][ostruct->match | (i << 9)] = ostruct->cycles[k];
 		}
@@ -256,7 +272,7 @@ void m68ki_build_opcode_table(void)
 	{
 		for(i = 0;i <= 0x07;i++)
 		{
-			m68ki_instruction_jump_table[ostruct->match | i] = ostruct->opcode_handler;
+			m68ki_opcode_index[ostruct->match | i] = ostruct - m68k_opcode_handler_table;
 			for(k=0;k<NUM_CPU_TYPES;k++)
 				m68ki_cycles[k][ostruct->match | i] = ostruct->cycles[k];
 		}
@@ -264,7 +280,7 @@ void m68ki_build_opcode_table(void)
 	}
 	while(ostruct->mask == 0xffff)
 	{
-		m68ki_instruction_jump_table[ostruct->match] = ostruct->opcode_handler;
+		m68ki_opcode_index[ostruct->match] = ostruct - m68k_opcode_handler_table;
 		for(k=0;k<NUM_CPU_TYPES;k++)
 			m68ki_cycles[k][ostruct->match] = ostruct->cycles[k];
 		ostruct++;
@@ -7039,9 +7055,12 @@ M68KMAKE_OP(movec, 32, rc, .)
 						REG_CACR = REG_DA[(word2 >> 12) & 15] & 0x0f;
 					}
 
-					if (REG_CACR & (M68K_CACR_CI | M68K_CACR_CEI)) {
+					if (REG_CACR & M68K_CACR_CI) {
 						m68ki_ic_clear(state);
 					}
+					else if (REG_CACR & M68K_CACR_CEI) {
+						icache_clear_entry(ADDRESS_68K(REG_CAAR));
+					}
 					return;
 				}
 				m68ki_exception_illegal(state);
@@ -7178,14 +7197,17 @@ M68KMAKE_OP(movem, 16, re, pd)
 	uint register_list = OPER_I_16(state);
 	uint ea = AY;
 	uint count = 0;
+	uint16 words[16];
+	uint n = 16;
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i))
 		{
 			ea -= 2;
-			m68ki_write_16(state, ea, MASK_OUT_ABOVE_16(REG_DA[15-i]));
+			words[--n] = MASK_OUT_ABOVE_16(REG_DA[15-i]);
 			count++;
 		}
+	m68ki_write_words(state, ea, words + n, count);
 	AY = ea;
 
 	USE_CYCLES(count<<CYC_MOVEM_W);
@@ -7198,14 +7220,12 @@ M68KMAKE_OP(movem, 16, re, .)
 	uint register_list = OPER_I_16(state);
 	uint ea = M68KMAKE_GET_EA_AY_16;
 	uint count = 0;
+	uint16 words[16];
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i))
-		{
-			m68ki_write_16(state, ea, MASK_OUT_ABOVE_16(REG_DA[i]));
-			ea += 2;
-			count++;
-		}
+			words[count++] = MASK_OUT_ABOVE_16(REG_DA[i]);
+	m68ki_write_words(state, ea, words, count);
 
 	USE_CYCLES(count<<CYC_MOVEM_W);
 }
@@ -7217,15 +7237,18 @@ M68KMAKE_OP(movem, 32, re, pd)
 	uint register_list = OPER_I_16(state);
 	uint ea = AY;
 	uint count = 0;
+	uint16 words[32];
+	uint n = 32;
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i))
 		{
 			ea -= 4;
-			m68ki_write_16(state, ea+2, REG_DA[15-i] & 0xFFFF );
-			m68ki_write_16(state, ea, (REG_DA[15-i] >> 16) & 0xFFFF );
+			words[--n] = REG_DA[15-i] & 0xFFFF;
+			words[--n] = (REG_DA[15-i] >> 16) & 0xFFFF;
 			count++;
 		}
+	m68ki_write_words(state, ea, words + n, count * 2);
 	AY = ea;
 
 	USE_CYCLES(count<<CYC_MOVEM_L);
@@ -7238,14 +7261,16 @@ M68KMAKE_OP(movem, 32, re, .)
 	uint register_list = OPER_I_16(state);
 	uint ea = M68KMAKE_GET_EA_AY_32;
 	uint count = 0;
+	uint16 words[32];
 
 	for(; i < 16; i++)
 		if(register_list & (1 << i))
 		{
-			m68ki_write_32(state, ea, REG_DA[i]);
-			ea += 4;
+			words[count * 2] = (REG_DA[i] >> 16) & 0xFFFF;
+			words[count * 2 + 1] = REG_DA[i] & 0xFFFF;
 			count++;
 		}
+	m68ki_write_words(state, ea, words, count * 2);
 
 	USE_CYCLES(count<<CYC_MOVEM_L);
 }
@@ -7257,11 +7282,17 @@ M68KMAKE_OP(movem, 16, er, pi)
 	uint register_list = OPER_I_16(state);
 	uint ea = AY;
 	uint count = 0;
+	uint16 words[16];
 
 	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count);
+
+	for(i = 0, count = 0; i < 16; i++)
 		if(register_list & (1 << i))
 		{
-			REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(state, ea)));
+			REG_DA[i] = MAKE_INT_16(words[count]);
 			ea += 2;
 			count++;
 		}
@@ -7315,12 +7346,17 @@ M68KMAKE_OP(movem, 16, er, .)
 	uint register_list = OPER_I_16(state);
 	uint ea = M68KMAKE_GET_EA_AY_16;
 	uint count = 0;
+	uint16 words[16];
 
 	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count);
+
+	for(i = 0, count = 0; i < 16; i++)
 		if(register_list & (1 << i))
 		{
-			REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_16(state, ea)));
-			ea += 2;
+			REG_DA[i] = MAKE_INT_16(words[count]);
 			count++;
 		}
 
@@ -7334,11 +7370,17 @@ M68KMAKE_OP(movem, 32, er, pi)
 	uint register_list = OPER_I_16(state);
 	uint ea = AY;
 	uint count = 0;
+	uint16 words[32];
 
 	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count * 2);
+
+	for(i = 0, count = 0; i < 16; i++)
 		if(register_list & (1 << i))
 		{
-			REG_DA[i] = m68ki_read_32(state, ea);
+			REG_DA[i] = (words[count * 2] << 16) | words[count * 2 + 1];
 			ea += 4;
 			count++;
 		}
@@ -7392,12 +7434,17 @@ M68KMAKE_OP(movem, 32, er, .)
 	uint register_list = OPER_I_16(state);
 	uint ea = M68KMAKE_GET_EA_AY_32;
 	uint count = 0;
+	uint16 words[32];
 
 	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count * 2);
+
+	for(i = 0, count = 0; i < 16; i++)
 		if(register_list & (1 << i))
 		{
-			REG_DA[i] = m68ki_read_32(state, ea);
-			ea += 4;
+			REG_DA[i] = (words[count * 2] << 16) | words[count * 2 + 1];
 			count++;
 		}
 
@@ -9350,14 +9397,17 @@ M68KMAKE_OP(rte, 32, ., .)
 		uint new_sr;
 		uint new_pc;
 		uint format_word;
+		uint16 frame[4];	/* SR, PC and the format word, read in one go */
 
 		m68ki_rte_callback();		   /* auto-disable (see m68kcpu.h) */
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 
 		if(CPU_TYPE_IS_000(CPU_TYPE))
 		{
-			new_sr = m68ki_pull_16(state);
-			new_pc = m68ki_pull_32(state);
+			m68ki_read_words(state, REG_A[7], frame, 3);
+			new_sr = frame[0];
+			new_pc = (frame[1] << 16) | frame[2];
+			REG_A[7] += 6;
 			m68ki_jump(state, new_pc);
 			m68ki_set_sr(state, new_sr);
 
@@ -9369,11 +9419,13 @@ M68KMAKE_OP(rte, 32, ., .)
 
 		if(CPU_TYPE_IS_010(CPU_TYPE))
 		{
-			format_word = m68ki_read_16(state, REG_A[7]+6) >> 12;
+			m68ki_read_words(state, REG_A[7], frame, 4);
+			format_word = frame[3] >> 12;
 			if(format_word == 0)
 			{
-				new_sr = m68ki_pull_16(state);
-				new_pc = m68ki_pull_32(state);
+				new_sr = frame[0];
+				new_pc = (frame[1] << 16) | frame[2];
+				REG_A[7] += 6;
 				m68ki_fake_pull_16(state);	/* format word */
 				m68ki_jump(state, new_pc);
 				m68ki_set_sr(state, new_sr);
@@ -9382,8 +9434,9 @@ M68KMAKE_OP(rte, 32, ., .)
 				return;
 			} else if (format_word == 8) {
 				/* Format 8 stack frame -- 68010 only. 29 word bus/address error */
-				new_sr = m68ki_pull_16(state);
-				new_pc = m68ki_pull_32(state);
+				new_sr = frame[0];
+				new_pc = (frame[1] << 16) | frame[2];
+				REG_A[7] += 6;
 				m68ki_fake_pull_16(state);	/* format word */
 				m68ki_jump(state, new_pc);
 				m68ki_set_sr(state, new_sr);
@@ -9413,12 +9466,14 @@ M68KMAKE_OP(rte, 32, ., .)
 
 		/* Otherwise it's 020 */
 rte_loop:
-		format_word = m68ki_read_16(state, REG_A[7]+6) >> 12;
+		m68ki_read_words(state, REG_A[7], frame, 4);
+		format_word = frame[3] >> 12;
 		switch(format_word)
 		{
 			case 0: /* Normal */
-				new_sr = m68ki_pull_16(state);
-				new_pc = m68ki_pull_32(state);
+				new_sr = frame[0];
+				new_pc = (frame[1] << 16) | frame[2];
+				REG_A[7] += 6;
 				m68ki_fake_pull_16(state);	/* format word */
 				m68ki_jump(state, new_pc);
 				m68ki_set_sr(state, new_sr);
@@ -9426,14 +9481,16 @@ rte_loop:
 				CPU_RUN_MODE = RUN_MODE_NORMAL;
 				return;
 			case 1: /* Throwaway */
-				new_sr = m68ki_pull_16(state);
+				new_sr = frame[0];
+				m68ki_fake_pull_16(state);	/* status register */
 				m68ki_fake_pull_32(state);	/* program counter */
 				m68ki_fake_pull_16(state);	/* format word */
 				m68ki_set_sr_noint(state, new_sr);
 				goto rte_loop;
 			case 2: /* Trap */
-				new_sr = m68ki_pull_16(state);
-				new_pc = m68ki_pull_32(state);
+				new_sr = frame[0];
+				new_pc = (frame[1] << 16) | frame[2];
+				REG_A[7] += 6;
 				m68ki_fake_pull_16(state);	/* format word */
 				m68ki_fake_pull_32(state);	/* address */
 				m68ki_jump(state, new_pc);
@@ -9442,8 +9499,9 @@ rte_loop:
 				CPU_RUN_MODE = RUN_MODE_NORMAL;
 				return;
 			case 7: /* 68040 access error */
-				new_sr = m68ki_pull_16(state);
-				new_pc = m68ki_pull_32(state);
+				new_sr = frame[0];
+				new_pc = (frame[1] << 16) | frame[2];
+				REG_A[7] += 6;
 				m68ki_fake_pull_16(state);   /* $06: format word */
 				m68ki_fake_pull_32(state);   /* $08: effective address */
 				m68ki_fake_pull_16(state);   /* $0c: special status word */
@@ -9467,8 +9525,9 @@ rte_loop:
 				return;
 
 			case 0x0a: /* Bus Error at instruction boundary */
-				new_sr = m68ki_pull_16(state);
-				new_pc = m68ki_pull_32(state);
+				new_sr = frame[0];
+				new_pc = (frame[1] << 16) | frame[2];
+				REG_A[7] += 6;
 				m68ki_fake_pull_16(state);   /* $06: format word */
 				m68ki_fake_pull_16(state);   /* $08: internal register */
 				m68ki_fake_pull_16(state);   /* $0a: special status word */
@@ -9486,8 +9545,9 @@ rte_loop:
 				return;
 
 			case 0x0b: /* Bus Error - Instruction Execution in Progress */
-				new_sr = m68ki_pull_16(state);
-				new_pc = m68ki_pull_32(state);
+				new_sr = frame[0];
+				new_pc = (frame[1] << 16) | frame[2];
+				REG_A[7] += 6;
 				m68ki_fake_pull_16(state);   /* $06: format word */
 				m68ki_fake_pull_16(state);   /* $08: internal register */
 				m68ki_fake_pull_16(state);   /* $0a: special status word */
@@ -186,8 +186,8 @@
 #define M68K_LOG_1010_1111          OPT_OFF
 #define M68K_LOG_FILEHANDLE         some_file_handle
 
-/* cryptodad enabling this causes BERR for 68030 */
-#define M68K_EMULATE_PMMU           OPT_OFF
+/* 68030 PMMU address translation once TOS or MiNT enable it in TC */
+#define M68K_EMULATE_PMMU           OPT_ON
 
 
 /* ----------------------------- COMPATIBILITY ---------------------------- */
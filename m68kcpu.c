@@ -46,6 +46,7 @@ extern void m68ki_build_opcode_table(void);
 
 extern inline void m68ki_ic_clear(struct m68ki_cpu_core *state);
 
+#include <string.h>
 #include "m68kops.h"
 #include "m68kcpu.h"
 
@@ -82,6 +83,9 @@ const char *const m68ki_cpu_names[] =
 /* The CPU core */
 m68ki_cpu_core m68ki_cpu = {0};
 
+/* instruction pairs run by fused handlers */
+uint64_t m68ki_fused_count;
+
 #if M68K_EMULATE_ADDRESS_ERROR
 #ifdef _BSD_SETJMP_H
 sigjmp_buf m68ki_aerr_trap;
@@ -809,12 +813,12 @@ void m68k_set_cpu_type(struct m68ki_cpu_core *state, unsigned int cpu_type)
 			CYC_RESET        = 132;
 			HAS_PMMU         = 0;
 			HAS_FPU          = 0;
-			return;
+			break;
 		case M68K_CPU_TYPE_SCC68070:
 			m68k_set_cpu_type(state, M68K_CPU_TYPE_68010);
 			CPU_ADDRESS_MASK = 0xffffffff;
 			CPU_TYPE         = CPU_TYPE_SCC070;
-			return;
+			break;
 		case M68K_CPU_TYPE_68010:
 			CPU_TYPE         = CPU_TYPE_010;
 			CPU_ADDRESS_MASK = 0x00ffffff;
@@ -832,7 +836,7 @@ void m68k_set_cpu_type(struct m68ki_cpu_core *state, unsigned int cpu_type)
 			CYC_RESET        = 130;
 			HAS_PMMU         = 0;
 			HAS_FPU          = 0;
-			return;
+			break;
 		case M68K_CPU_TYPE_68EC020:
 			CPU_TYPE         = CPU_TYPE_EC020;
 			CPU_ADDRESS_MASK = 0x00ffffff;
@@ -850,7 +854,7 @@ void m68k_set_cpu_type(struct m68ki_cpu_core *state, unsigned int cpu_type)
 			CYC_RESET        = 518;
 			HAS_PMMU         = 0;
 			HAS_FPU          = 0;
-			return;
+			break;
 		case M68K_CPU_TYPE_68020:
 			CPU_TYPE         = CPU_TYPE_020;
 			CPU_ADDRESS_MASK = 0xffffffff;
@@ -869,7 +873,7 @@ void m68k_set_cpu_type(struct m68ki_cpu_core *state, unsigned int cpu_type)
 			HAS_PMMU         = 0;
 			//HAS_FPU          = 0;
 			HAS_FPU          = FPU68020_SELECTED; /* cryptodad */
-			return;
+			break;
 		case M68K_CPU_TYPE_68030:
 			CPU_TYPE         = CPU_TYPE_030;
 			CPU_ADDRESS_MASK = 0xffffffff;
@@ -887,7 +891,7 @@ void m68k_set_cpu_type(struct m68ki_cpu_core *state, unsigned int cpu_type)
 			CYC_RESET        = 518;
 			HAS_PMMU         = 1;
 			HAS_FPU          = 1;
-			return;
+			break;
 		case M68K_CPU_TYPE_68EC030:
 			CPU_TYPE         = CPU_TYPE_EC030;
 			CPU_ADDRESS_MASK = 0xffffffff;
@@ -905,7 +909,7 @@ void m68k_set_cpu_type(struct m68ki_cpu_core *state, unsigned int cpu_type)
 			CYC_RESET        = 518;
 			HAS_PMMU         = 0;		/* EC030 lacks the PMMU and is effectively a die-shrink 68020 */
 			HAS_FPU          = 1;
-			return;
+			break;
 		case M68K_CPU_TYPE_68040:		// TODO: these values are not correct
 			CPU_TYPE         = CPU_TYPE_040;
 			CPU_ADDRESS_MASK = 0xffffffff;
@@ -923,7 +927,7 @@ void m68k_set_cpu_type(struct m68ki_cpu_core *state, unsigned int cpu_type)
 			CYC_RESET        = 518;
 			HAS_PMMU         = 1;
 			HAS_FPU          = 1;
-			return;
+			break;
 		case M68K_CPU_TYPE_68EC040: // Just a 68040 without pmmu apparently...
 			CPU_TYPE         = CPU_TYPE_EC040;
 			CPU_ADDRESS_MASK = 0xffffffff;
@@ -941,7 +945,7 @@ void m68k_set_cpu_type(struct m68ki_cpu_core *state, unsigned int cpu_type)
 			CYC_RESET        = 518;
 			HAS_PMMU         = 0;
 			HAS_FPU          = 0;
-			return;
+			break;
 		case M68K_CPU_TYPE_68LC040:
 			CPU_TYPE         = CPU_TYPE_LC040;
 			CPU_ADDRESS_MASK = 0xffffffff;
@@ -959,8 +963,10 @@ void m68k_set_cpu_type(struct m68ki_cpu_core *state, unsigned int cpu_type)
 			state->cyc_reset        = 518;
 			HAS_PMMU         = 1;
 			HAS_FPU          = 0;
-			return;
+			break;
 	}
+
+	m68ki_select_opcode_handlers(CPU_TYPE);
 }
 
 uint m68k_get_address_mask(m68ki_cpu_core *state) {
@@ -1110,6 +1116,8 @@ void m68k_init(void)
 	if(!emulation_initialized)
 	{
 		m68ki_build_opcode_table();
+		/* the generic handlers unless m68k_set_cpu_type() came first */
+		m68ki_select_opcode_handlers(m68ki_cpu.cpu_type);
 		emulation_initialized = 1;
 	}
 
@@ -1141,6 +1149,7 @@ void m68k_pulse_reset(m68ki_cpu_core *state)
 	state->mmu_tc = 0;
 	state->mmu_tt0 = 0;
 	state->mmu_tt1 = 0;
+	state->mmu_tmp_buserror_occurred = 0;
 
 	/* Clear all stop levels and eat up all remaining cycles */
 	CPU_STOPPED = 0;
@@ -1217,7 +1226,7 @@ inline unsigned int m68k_read_immediate_16(m68ki_cpu_core *state, unsigned int a
 #if M68K_EMULATE_PREFETCH == OPT_ON
 	for (int i = 0; i < state->read_ranges; i++) {
 		if(address >= state->read_addr[i] && address < state->read_upper[i]) {
-			return be16toh(((unsigned short *)(state->read_data[i] + (address - state->read_addr[i])))[0]);
+			return mmap_mem_read_16(state->read_data[i], address - state->read_addr[i]);
 		}
 	}
 #endif
@@ -1228,7 +1237,7 @@ inline unsigned int m68k_read_immediate_32(m68ki_cpu_core *state, unsigned int a
 #if M68K_EMULATE_PREFETCH == OPT_ON
 	for (int i = 0; i < state->read_ranges; i++) {
 		if(address >= state->read_addr[i] && address < state->read_upper[i]) {
-			return be32toh(((unsigned int *)(state->read_data[i] + (address - state->read_addr[i])))[0]);
+			return mmap_mem_read_32(state->read_data[i], address - state->read_addr[i]);
 		}
 	}
 #endif
@@ -1240,7 +1249,7 @@ inline unsigned int m68k_read_immediate_32(m68ki_cpu_core *state, unsigned int a
 inline unsigned int m68k_read_pcrelative_8(m68ki_cpu_core *state, unsigned int address) {
 	for (int i = 0; i < state->read_ranges; i++) {
 		if(address >= state->read_addr[i] && address < state->read_upper[i]) {
-			return state->read_data[i][address - state->read_addr[i]];
+			return mmap_mem_read_8(state->read_data[i], address - state->read_addr[i]);
 		}
 	}
 
@@ -1249,7 +1258,7 @@ inline unsigned int m68k_read_pcrelative_8(m68ki_cpu_core *state, unsigned int a
 inline unsigned int  m68k_read_pcrelative_16(m68ki_cpu_core *state, unsigned int address) {
 	for (int i = 0; i < state->read_ranges; i++) {
 		if(address >= state->read_addr[i] && address < state->read_upper[i]) {
-			return be16toh(((unsigned short *)(state->read_data[i] + (address - state->read_addr[i])))[0]);
+			return mmap_mem_read_16(state->read_data[i], address - state->read_addr[i]);
 		}
 	}
 
@@ -1258,7 +1267,7 @@ inline unsigned int  m68k_read_pcrelative_16(m68ki_cpu_core *state, unsigned int
 inline unsigned int  m68k_read_pcrelative_32(m68ki_cpu_core *state, unsigned int address) {
 	for (int i = 0; i < state->read_ranges; i++) {
 		if(address >= state->read_addr[i] && address < state->read_upper[i]) {
-			return be32toh(((unsigned int *)(state->read_data[i] + (address - state->read_addr[i])))[0]);
+			return mmap_mem_read_32(state->read_data[i], address - state->read_addr[i]);
 		}
 	}
 
@@ -1290,7 +1299,7 @@ inline uint m68ki_read_imm16_addr_slowpath ( m68ki_cpu_core *state, uint32_t pc
 
 			REG_PC += 2;
 
-			return be16toh(((unsigned short *)(state->read_data[i] + (address - state->read_addr[i])))[0]);
+			return mmap_mem_read_16(state->read_data[i], address - state->read_addr[i]);
 		}
 	}
 #endif
@@ -1322,6 +1331,7 @@ inline uint m68ki_read_imm16_addr_slowpath ( m68ki_cpu_core *state, uint32_t pc
 		//state->mmu_tmp_buserror_occurred = g_buserr;
 		//CPU_PREF_ADDR = state->mmu_tmp_buserror_occurred ? ((uint32)~0) : REG_PC;
 		CPU_PREF_ADDR = g_buserr ? ((uint32)~0) : REG_PC;
+		m68ki_pmmu_drop_prefetch_fault(state);
 
 		// ignore bus error on prefetch
 		//state->mmu_tmp_buserror_occurred = 0;
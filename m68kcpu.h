@@ -43,6 +43,9 @@ extern "C" {
 #include <stdio.h>
 #include <stdbool.h>
 #include "gpio/ps_protocol.h"
+#include "memory_mapped.h"
+#include "icache.h"
+#include "profiler.h"
 
 /* cryptodad Aug 2023 - CACHE_ON and T_CACHE_ON are slower if enabled */
 //#define CACHE_ON // cryptodad
@@ -160,10 +163,13 @@ typedef uint32 uint64;
 /* ======================================================================== */
 
 /* MMU constants */
-#define MMU_ATC_ENTRIES 22    // 68851 has 64, 030 has 22
+#define MMU_ATC_ENTRIES 64    // 68851 has 64, 030 has 22 - hashed by page here (m68kmmu.h), so a power of 2
+#define MMU_TLB_ENTRIES 1024  // host side translation cache in front of the ATC, see m68ki_pmmu_translate()
 
-/* instruction cache constants */
-#define M68K_IC_SIZE 128
+/* access size as it goes in the special status word of a bus error frame */
+#define M68K_SZ_LONG 0
+#define M68K_SZ_BYTE 1
+#define M68K_SZ_WORD 2
 
 /* Exception Vectors handled by emulation */
 #define EXCEPTION_RESET                    0
@@ -347,7 +353,12 @@ typedef uint32 uint64;
 /* ------------------------------ CPU Access ------------------------------ */
 
 /* Access the CPU registers */
+#ifdef M68KI_MODEL_CPU_TYPE
+/* opcode handlers compiled for one model (m68kops_<model>.c) - the CPU_TYPE_IS_*() tests fold */
+#define CPU_TYPE         M68KI_MODEL_CPU_TYPE
+#else
 #define CPU_TYPE         state->cpu_type
+#endif
 
 #define REG_DA           state->dar /* easy access to data and address regs */
 #define REG_DA_SAVE      state->dar_save
@@ -1028,6 +1039,8 @@ typedef struct m68ki_cpu_core
 	uint mmu_sr_040;
 	uint mmu_atc_tag[MMU_ATC_ENTRIES], mmu_atc_data[MMU_ATC_ENTRIES];
 	uint mmu_atc_rr;
+	uint mmu_tlb_tag[MMU_TLB_ENTRIES], mmu_tlb_phys[MMU_TLB_ENTRIES];
+	uint mmu_tlb_shift;   /* page size of the TLB entries, log2 */
 	uint mmu_tt0, mmu_tt1;
 	uint mmu_itt0, mmu_itt1, mmu_dtt0, mmu_dtt1;
 	uint mmu_acr0, mmu_acr1, mmu_acr2, mmu_acr3;
@@ -1046,9 +1059,6 @@ typedef struct m68ki_cpu_core
 
 	uint8 mmu_tablewalk;             /* set when MMU walks page tables */
 	uint mmu_last_logical_addr;
-	uint ic_address[M68K_IC_SIZE];   /* instruction cache address data */
-	uint ic_data[M68K_IC_SIZE];      /* instruction cache content data */
-	uint8 ic_valid[M68K_IC_SIZE];     /* instruction cache valid flags */
 
 	const uint8* cyc_instruction;
 	const uint8* cyc_exception;
@@ -1119,74 +1129,114 @@ char* m68ki_disassemble_quick(unsigned int pc, unsigned int cpu_type);
 // clear the instruction cache
 inline void m68ki_ic_clear(m68ki_cpu_core *state)
 {
-	int i;
-	for (i=0; i< M68K_IC_SIZE; i++) {
-		state->ic_address[i] = ~0;
-	}
+	(void)state;
+	icache_flush();
 }
 
 extern uint32 pmmu_translate_addr(m68ki_cpu_core *state, uint32 addr_in, uint16 rw);
 
-// read immediate word using the instruction cache
-
 extern volatile uint32_t g_buserr;
 
+/* TLB tag bits below the page, the rest is the logical page */
+#define M68K_MMU_TLB_READ  0x01
+#define M68K_MMU_TLB_WRITE 0x02
+#define M68K_MMU_TLB_TAG(state, address, fc) (((address) & (~0u << (state)->mmu_tlb_shift)) | ((fc) & 7) << 2)
+#define M68K_MMU_TLB_INDEX(state, address, fc) ((((address) >> (state)->mmu_tlb_shift) ^ (fc)) & (MMU_TLB_ENTRIES - 1))
+
+/*
+ * 68030 PMMU translation. Translations that did not fault are kept in a
+ * direct mapped TLB keyed by function code and page, filled and flushed by
+ * m68kmmu.h, so most accesses skip the ATC and table walk. An entry only
+ * allows the kind of access it was filled by - the first write to a page
+ * still goes through the ATC to set the modified bit. The 68040 MMU always
+ * takes the slow path.
+ */
+static inline uint m68ki_pmmu_translate(m68ki_cpu_core *state, uint address, uint fc, uint rw, uint sz)
+{
+	state->mmu_tmp_fc = fc;
+	state->mmu_tmp_rw = rw;
+	state->mmu_tmp_sz = sz;
+
+	if (!CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+	{
+		uint idx = M68K_MMU_TLB_INDEX(state, address, fc);
+		uint other = rw ? M68K_MMU_TLB_WRITE : M68K_MMU_TLB_READ;
+
+		if ((state->mmu_tlb_tag[idx] & ~other) == (M68K_MMU_TLB_TAG(state, address, fc) | (rw ? M68K_MMU_TLB_READ : M68K_MMU_TLB_WRITE)))
+			return state->mmu_tlb_phys[idx] | (address & ~(~0u << state->mmu_tlb_shift));
+	}
+
+	return pmmu_translate_addr(state, address, rw);
+}
+
+/*
+ * The prefetch of the next word may run into a page the MMU refuses - that
+ * only faults once the CPU actually gets there, so forget it and fetch again.
+ */
+static inline void m68ki_pmmu_drop_prefetch_fault(m68ki_cpu_core *state)
+{
+#if M68K_EMULATE_PMMU
+	if (state->mmu_tmp_buserror_occurred)
+	{
+		state->mmu_tmp_buserror_occurred = 0;
+		g_buserr = 0;
+		CPU_PREF_ADDR = (uint32)~0;
+	}
+#else
+	(void)state;
+#endif
+}
+
+// read immediate word using the instruction cache (icache.h)
+
 static inline uint32 m68ki_ic_readimm16(m68ki_cpu_core *state, uint32 address)
 {
-	if (state->cacr & M68K_CACR_EI)
+	// 68020 and 68030 only - the 68040 has its own cache organisation
+	if ((state->cacr & M68K_CACR_EI) && (CPU_TYPE & (CPU_TYPE_EC020 | CPU_TYPE_020 | CPU_TYPE_EC030 | CPU_TYPE_030)))
 	{
-		// 68020 series I-cache (MC68020 User's Manual, Section 4 - On-Chip Cache Memory)
-		if (CPU_TYPE & (CPU_TYPE_EC020 | CPU_TYPE_020))
+		uint32 bus_address = ADDRESS_68K(address);
+		mmap_page_t *page = mmap_lookup(bus_address);
+
+		// host backed code is as quick to read as the cache
+		if (page->type != MMAP_HOST_RAM && page->type != MMAP_HOST_ROM)
 		{
-			uint32 tag = (address >> 8) | (state->s_flag ? 0x1000000 : 0);
-			int idx = (address >> 2) & 0x3f;    // 1-of-64 select
+			t_icache_line *line = &icache[(bus_address >> 2) & icache_mask];
+			uint32 tag = (bus_address & ~3) | ICACHE_VALID | (state->s_flag ? ICACHE_SUPER : 0);
 
 			// do a cache fill if the line is invalid or the tags don't match
-			if ((!state->ic_valid[idx]) || (state->ic_address[idx] != tag))
+			if (line->tag != tag)
 			{
+				uint32 data;
+
 				// if the cache is frozen, don't update it
 				if (state->cacr & M68K_CACR_FI)
 				{
+					icache_stats.frozen++;
+
 					return m68k_read_immediate_16(state, address);
-					//m68ki_set_fc ( FLAG_S | FUNCTION_CODE_USER_PROGRAM );
-					//return ps_read_16 ( ADDRESS_68K (address) );
 				}
 
-				uint32 data = m68ki_read_32(state, address & ~3);
+				data = m68k_read_immediate_32(state, address & ~3);
 
-				//printf("m68k: doing cache fill at %08x (tag %08x idx %d)\n", address, tag, idx);
-				//state->mmu_tmp_buserror_occurred = g_buserr;
-				// if no buserror occurred, validate the tag
-				//if (!state->mmu_tmp_buserror_occurred)
-				if ( !g_buserr )
-				{
-					state->ic_address[idx] = tag;
-					state->ic_data[idx] = data;
-					state->ic_valid[idx] = 1;
-				}
-				else
+				// if a buserror occurred, leave the line alone
+				if ( g_buserr )
 				{
 					return m68k_read_immediate_16(state, address);
-					//m68ki_set_fc ( FLAG_S | FUNCTION_CODE_USER_PROGRAM );
-					//return ps_read_16 ( ADDRESS_68K (address) );
 				}
-			}
 
-			// at this point, the cache is guaranteed to be valid, either as
-			// a hit or because we just filled it.
-			if (address & 2)
-			{
-				return state->ic_data[idx] & 0xffff;
+				line->tag = tag;
+				line->data = data;
+				icache_stats.misses++;
 			}
+
 			else
-			{
-				return state->ic_data[idx] >> 16;
-			}
+				icache_stats.hits++;
+
+			return (address & 2) ? line->data & 0xffff : line->data >> 16;
 		}
 	}
+
 	return m68k_read_immediate_16(state, address);
-	//m68ki_set_fc ( FLAG_S | FUNCTION_CODE_USER_PROGRAM );
-	//return ps_read_16 ( ADDRESS_68K (address) );
 }
 
 /* Handles all immediate reads, does address error check, function code setting,
@@ -1206,13 +1256,52 @@ static inline uint m68ki_read_imm_16(m68ki_cpu_core *state)
 	if(pc >= cache->lower && pc < cache->upper)
 	{
 		REG_PC += 2;
-		return be16toh(((unsigned short *)(cache->offset + pc))[0]);
+		return mmap_mem_read_16(cache->offset, pc);
 	}
 #endif
 	//return m68ki_read_imm16_addr_slowpath ( state, pc, cache );
 	return m68ki_read_imm16_addr_slowpath ( state, REG_PC );
 }
 
+/* --------------------------- Fused handlers ----------------------------- */
+
+extern uint64_t m68ki_fused_count;
+
+/*
+ * Called by a fused handler (m68kmake, m68kfuse.txt) after its first
+ * instruction: true when m68k_execute_bef () would go straight on to the
+ * next instruction without doing anything in between - no bus error or
+ * posted write to deal with, cycles left once the first is charged - and
+ * that instruction's opcode is already in the prefetch, so peeking at it
+ * costs no bus cycle.
+ */
+static inline int m68ki_fuse_ready(m68ki_cpu_core *state)
+{
+#if M68K_EMULATE_PREFETCH
+	return CPU_PREF_ADDR == REG_PC
+		&& !g_buserr && !ps_posted_berr && !ps_write_pending
+		&& !CPU_STOPPED
+		&& GET_CYCLES() > CYC_INSTRUCTION[REG_IR];
+#else
+	return 0;
+#endif
+}
+
+/* do what m68k_execute_bef () does between two instructions */
+static inline void m68ki_fuse_fetch(m68ki_cpu_core *state)
+{
+	USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+	m68ki_use_data_space();
+
+	REG_PPC = REG_PC;
+	REG_IR = m68ki_read_imm16_addr_slowpath(state, REG_PC);
+
+	if(prof_opcodes)
+		prof_insn(REG_PPC, REG_IR);
+
+	m68ki_fused_count++;
+}
+
 static inline uint m68ki_read_imm_8(m68ki_cpu_core *state)
 {
 	/* map read immediate 8 to read immediate 16 */
@@ -1228,10 +1317,11 @@ static inline uint m68ki_read_imm_32(m68ki_cpu_core *state)
 #endif
 #endif
 	uint32_t address = ADDRESS_68K(REG_PC);
-	for (int i = 0; i < state->read_ranges; i++) {
+	// the ranges are physical addresses
+	for (int i = 0; !PMMU_ENABLED && i < state->read_ranges; i++) {
 		if(address >= state->read_addr[i] && address < state->read_upper[i]) {
 			REG_PC += 4;
-			return be32toh(((unsigned int *)(state->read_data[i] + (address - state->read_addr[i])))[0]);
+			return mmap_mem_read_32(state->read_data[i], address - state->read_addr[i]);
 		}
 	}
 
@@ -1256,12 +1346,19 @@ static inline uint m68ki_read_imm_32(m68ki_cpu_core *state)
 
 	temp_val = MASK_OUT_ABOVE_32((temp_val << 16) | MASK_OUT_ABOVE_16(CPU_PREF_DATA));
 	REG_PC += 2;
+	if (g_buserr)
+	{
+		CPU_PREF_ADDR = (uint32)~0;
+		return temp_val;
+	}
+
 	CPU_PREF_DATA = m68ki_ic_readimm16(state, REG_PC);
 
 	//state->mmu_tmp_buserror_occurred = g_buserr;
 	
 	//CPU_PREF_ADDR = state->mmu_tmp_buserror_occurred ? ((uint32)~0) : REG_PC;
 	CPU_PREF_ADDR = g_buserr ? ((uint32)~0) : REG_PC;
+	m68ki_pmmu_drop_prefetch_fault(state);
 
 	return temp_val;
 #else
@@ -1301,7 +1398,11 @@ static inline uint m68ki_read_8_fc(m68ki_cpu_core *state, uint address, uint fc)
 
 #if M68K_EMULATE_PMMU
 	if (PMMU_ENABLED)
-	    address = pmmu_translate_addr(state,address,1);
+	{
+		address = m68ki_pmmu_translate(state, address, fc, 1, M68K_SZ_BYTE);
+		if (state->mmu_tmp_buserror_occurred)
+			return 0xff;
+	}
 #endif
 	
 #ifdef CACHE_ON  // cryptodad
@@ -1309,14 +1410,14 @@ static inline uint m68ki_read_8_fc(m68ki_cpu_core *state, uint address, uint fc)
 
 	if(cache->offset && address >= cache->lower && address < cache->upper)
 	{
-		return cache->offset[address - cache->lower];
+		return mmap_mem_read_8(cache->offset, address - cache->lower);
 	}
 #endif
 #ifdef T_CACHE_ON
 	for (int i = 0; i < state->read_ranges; i++) {
 		if(address >= state->read_addr[i] && address < state->read_upper[i]) {
 			SET_FC_TRANSLATION_CACHE_VALUES
-			return state->read_data[i][address - state->read_addr[i]];
+			return mmap_mem_read_8(state->read_data[i], address - state->read_addr[i]);
 		}
 	}
 #endif
@@ -1341,7 +1442,12 @@ static inline uint m68ki_read_16_fc ( m68ki_cpu_core *state, uint address, uint
 
 #if M68K_EMULATE_PMMU
 	if (PMMU_ENABLED)
-	    address = pmmu_translate_addr(state,address,1);
+	{
+		address = m68ki_pmmu_translate(state, address, fc, 1, M68K_SZ_WORD);
+		/* a refused opcode fetch runs as a NOP until the bus error is taken */
+		if (state->mmu_tmp_buserror_occurred)
+			return 0x4e71;
+	}
 #endif
 
 #ifdef CACHE_ON  // cryptodad
@@ -1349,14 +1455,14 @@ static inline uint m68ki_read_16_fc ( m68ki_cpu_core *state, uint address, uint
 
 	if(cache->offset && address >= cache->lower && address < cache->upper)
 	{
-		return be16toh(((unsigned short *)(cache->offset + (address - cache->lower)))[0]);
+		return mmap_mem_read_16(cache->offset, address - cache->lower);
 	}
 #endif
 #ifdef T_CACHE_ON
 	for (int i = 0; i < state->read_ranges; i++) {
 		if(address >= state->read_addr[i] && address < state->read_upper[i]) {
 			SET_FC_TRANSLATION_CACHE_VALUES
-			return be16toh(((unsigned short *)(state->read_data[i] + (address - state->read_addr[i])))[0]);
+			return mmap_mem_read_16(state->read_data[i], address - state->read_addr[i]);
 		}
 	}
 #endif
@@ -1389,7 +1495,11 @@ static inline uint m68ki_read_32_fc(m68ki_cpu_core *state, uint address, uint fc
 
 #if M68K_EMULATE_PMMU
 	if (PMMU_ENABLED)
-	    address = pmmu_translate_addr(state,address,1);
+	{
+		address = m68ki_pmmu_translate(state, address, fc, 1, M68K_SZ_LONG);
+		if (state->mmu_tmp_buserror_occurred)
+			return 0x4e714e71;
+	}
 #endif
 	
 #ifdef CACHE_ON  // cryptodad
@@ -1397,14 +1507,14 @@ static inline uint m68ki_read_32_fc(m68ki_cpu_core *state, uint address, uint fc
 
 	if(cache->offset && address >= cache->lower && address < cache->upper)
 	{
-		return be32toh(((unsigned int *)(cache->offset + (address - cache->lower)))[0]);
+		return mmap_mem_read_32(cache->offset, address - cache->lower);
 	}
 #endif
 #ifdef T_CACHE_ON
 	for (int i = 0; i < state->read_ranges; i++) {
 		if(address >= state->read_addr[i] && address < state->read_upper[i]) {
 			SET_FC_TRANSLATION_CACHE_VALUES
-			return be32toh(((unsigned int *)(state->read_data[i] + (address - state->read_addr[i])))[0]);
+			return mmap_mem_read_32(state->read_data[i], address - state->read_addr[i]);
 		}
 	}
 #endif
@@ -1439,7 +1549,11 @@ static inline void m68ki_write_8_fc(m68ki_cpu_core *state, uint address, uint fc
 
 #if M68K_EMULATE_PMMU
 	if (PMMU_ENABLED)
-	    address = pmmu_translate_addr(state,address,0);
+	{
+		address = m68ki_pmmu_translate(state, address, fc, 0, M68K_SZ_BYTE);
+		if (state->mmu_tmp_buserror_occurred)
+			return;
+	}
 #endif
 	
 #ifdef CACHE_ON  // cryptodad
@@ -1447,7 +1561,7 @@ static inline void m68ki_write_8_fc(m68ki_cpu_core *state, uint address, uint fc
 
 	if(cache->offset && address >= cache->lower && address < cache->upper)
 	{
-		cache->offset[address - cache->lower] = (unsigned char)value;
+		mmap_mem_write_8(cache->offset, address - cache->lower, value);
 		return;
 	}
 #endif
@@ -1455,7 +1569,7 @@ static inline void m68ki_write_8_fc(m68ki_cpu_core *state, uint address, uint fc
 	for (int i = 0; i < state->write_ranges; i++) {
 		if(address >= state->write_addr[i] && address < state->write_upper[i]) {
 			SET_FC_WRITE_TRANSLATION_CACHE_VALUES
-			state->write_data[i][address - state->write_addr[i]] = (unsigned char)value;
+			mmap_mem_write_8(state->write_data[i], address - state->write_addr[i], value);
 			return;
 		}
 	}
@@ -1490,7 +1604,11 @@ static inline void m68ki_write_16_fc(m68ki_cpu_core *state, uint address, uint f
 
 #if M68K_EMULATE_PMMU
 	if (PMMU_ENABLED)
-	    address = pmmu_translate_addr(state,address,0);
+	{
+		address = m68ki_pmmu_translate(state, address, fc, 0, M68K_SZ_WORD);
+		if (state->mmu_tmp_buserror_occurred)
+			return;
+	}
 #endif
 	
 #ifdef CACHE_ON  // cryptodad
@@ -1498,7 +1616,7 @@ static inline void m68ki_write_16_fc(m68ki_cpu_core *state, uint address, uint f
 
 	if(cache->offset && address >= cache->lower && address < cache->upper)
 	{
-		((short *)(cache->offset + (address - cache->lower)))[0] = htobe16(value);
+		mmap_mem_write_16(cache->offset, address - cache->lower, value);
 		return;
 	}
 #endif
@@ -1506,7 +1624,7 @@ static inline void m68ki_write_16_fc(m68ki_cpu_core *state, uint address, uint f
 	for (int i = 0; i < state->write_ranges; i++) {
 		if(address >= state->write_addr[i] && address < state->write_upper[i]) {
 			SET_FC_WRITE_TRANSLATION_CACHE_VALUES
-			((short *)(state->write_data[i] + (address - state->write_addr[i])))[0] = htobe16(value);
+			mmap_mem_write_16(state->write_data[i], address - state->write_addr[i], value);
 			return;
 		}
 	}
@@ -1548,7 +1666,11 @@ static inline void m68ki_write_32_fc(m68ki_cpu_core *state, uint address, uint f
 
 #if M68K_EMULATE_PMMU
 	if (PMMU_ENABLED)
-	    address = pmmu_translate_addr(state,address,0);
+	{
+		address = m68ki_pmmu_translate(state, address, fc, 0, M68K_SZ_LONG);
+		if (state->mmu_tmp_buserror_occurred)
+			return;
+	}
 #endif
 	
 #ifdef CACHE_ON // cryptodad
@@ -1556,7 +1678,7 @@ static inline void m68ki_write_32_fc(m68ki_cpu_core *state, uint address, uint f
 
 	if(cache->offset && address >= cache->lower && address < cache->upper)
 	{
-		((int *)(cache->offset + (address - cache->lower)))[0] = htobe32(value);
+		mmap_mem_write_32(cache->offset, address - cache->lower, value);
 		return;
 	}
 #endif
@@ -1564,7 +1686,7 @@ static inline void m68ki_write_32_fc(m68ki_cpu_core *state, uint address, uint f
 	for (int i = 0; i < state->write_ranges; i++) {
 		if(address >= state->write_addr[i] && address < state->write_upper[i]) {
 			SET_FC_WRITE_TRANSLATION_CACHE_VALUES
-			((int *)(state->write_data[i] + (address - state->write_addr[i])))[0] = htobe32(value);
+			mmap_mem_write_32(state->write_data[i], address - state->write_addr[i], value);
 			return;
 		}
 	}
@@ -1598,6 +1720,46 @@ static inline void m68ki_write_32_fc(m68ki_cpu_core *state, uint address, uint f
 	//m68k_write_memory_32( address, value);
 }
 
+/* Runs of data space words - MOVEM register blocks and exception frames.
+ * The memory layer can move them as one burst when they are in ST-RAM.
+ * With the PMMU on they go word by word so a fault lands on the right word.
+ */
+static inline void m68ki_read_words(m68ki_cpu_core *state, uint address, uint16 *words, uint count)
+{
+	uint fc = FLAG_S | m68ki_get_address_space();
+
+	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
+
+#if M68K_EMULATE_PMMU
+	if (PMMU_ENABLED)
+	{
+		for (uint n = 0; n < count; n++)
+			words[n] = m68ki_read_16_fc(state, address + n * 2, fc);
+		return;
+	}
+#endif
+
+	m68k_read_memory_words(ADDRESS_68K(address), words, count);
+}
+
+static inline void m68ki_write_words(m68ki_cpu_core *state, uint address, const uint16 *words, uint count)
+{
+	uint fc = FLAG_S | FUNCTION_CODE_USER_DATA;
+
+	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
+
+#if M68K_EMULATE_PMMU
+	if (PMMU_ENABLED)
+	{
+		for (uint n = 0; n < count; n++)
+			m68ki_write_16_fc(state, address + n * 2, fc, words[n]);
+		return;
+	}
+#endif
+
+	m68k_write_memory_words(ADDRESS_68K(address), words, count);
+}
+
 #if M68K_SIMULATE_PD_WRITES
 /* Special call to simulate undocumented 68k behavior when move.l with a
  * predecrement destination mode is executed.
@@ -1614,7 +1776,11 @@ static inline void m68ki_write_32_pd_fc(uint address, uint fc, uint value)
 
 #if M68K_EMULATE_PMMU
 	if (PMMU_ENABLED)
-	    address = pmmu_translate_addr(state,address,0);
+	{
+		address = m68ki_pmmu_translate(state, address, fc, 0, M68K_SZ_LONG);
+		if (state->mmu_tmp_buserror_occurred)
+			return;
+	}
 #endif
 
 	m68k_write_memory_32_pd(ADDRESS_68K(address), value);
@@ -1860,6 +2026,41 @@ static inline void m68ki_fake_pull_32(m68ki_cpu_core *state)
 	REG_SP = MASK_OUT_ABOVE_32(REG_SP + 4);
 }
 
+/* Exception frames are built here top down with the same push order as the
+ * stack, then written below the SP in one m68ki_write_words ().
+ */
+#define M68KI_FRAME_WORDS 46	/* format $B, the largest we build */
+
+typedef struct
+{
+	uint16 words[M68KI_FRAME_WORDS];
+	uint top;
+} m68ki_frame;
+
+static inline void m68ki_frame_begin(m68ki_frame *frame)
+{
+	frame->top = M68KI_FRAME_WORDS;
+}
+
+static inline void m68ki_frame_push_16(m68ki_frame *frame, uint value)
+{
+	frame->words[--frame->top] = MASK_OUT_ABOVE_16(value);
+}
+
+static inline void m68ki_frame_push_32(m68ki_frame *frame, uint value)
+{
+	m68ki_frame_push_16(frame, value);
+	m68ki_frame_push_16(frame, value >> 16);
+}
+
+static inline void m68ki_frame_write(m68ki_cpu_core *state, m68ki_frame *frame)
+{
+	uint count = M68KI_FRAME_WORDS - frame->top;
+
+	REG_SP = MASK_OUT_ABOVE_32(REG_SP - count * 2);
+	m68ki_write_words(state, REG_SP, frame->words + frame->top, count);
+}
+
 
 /* ----------------------------- Program Flow ----------------------------- */
 
@@ -2017,8 +2218,12 @@ static inline uint m68ki_init_exception(m68ki_cpu_core *state)
 /* 3 word stack frame (68000 only) */
 static inline void m68ki_stack_frame_3word(m68ki_cpu_core *state, uint pc, uint sr)
 {
-	m68ki_push_32(state, pc);
-	m68ki_push_16(state, sr);
+	m68ki_frame frame;
+
+	m68ki_frame_begin(&frame);
+	m68ki_frame_push_32(&frame, pc);
+	m68ki_frame_push_16(&frame, sr);
+	m68ki_frame_write(state, &frame);
 }
 
 /* Format 0 stack frame.
@@ -2026,15 +2231,20 @@ static inline void m68ki_stack_frame_3word(m68ki_cpu_core *state, uint pc, uint
  */
 static inline void m68ki_stack_frame_0000(m68ki_cpu_core *state, uint pc, uint sr, uint vector)
 {
+	m68ki_frame frame;
+
 	/* Stack a 3-word frame if we are 68000 */
 	if(CPU_TYPE == CPU_TYPE_000)
 	{
 		m68ki_stack_frame_3word(state, pc, sr);
 		return;
 	}
-	m68ki_push_16(state, vector << 2);
-	m68ki_push_32(state, pc);
-	m68ki_push_16(state, sr);
+
+	m68ki_frame_begin(&frame);
+	m68ki_frame_push_16(&frame, vector << 2);
+	m68ki_frame_push_32(&frame, pc);
+	m68ki_frame_push_16(&frame, sr);
+	m68ki_frame_write(state, &frame);
 }
 
 /* Format 1 stack frame (68020).
@@ -2042,9 +2252,13 @@ static inline void m68ki_stack_frame_0000(m68ki_cpu_core *state, uint pc, uint s
  */
 static inline void m68ki_stack_frame_0001(m68ki_cpu_core *state, uint pc, uint sr, uint vector)
 {
-	m68ki_push_16(state, 0x1000 | (vector << 2));
-	m68ki_push_32(state, pc);
-	m68ki_push_16(state, sr);
+	m68ki_frame frame;
+
+	m68ki_frame_begin(&frame);
+	m68ki_frame_push_16(&frame, 0x1000 | (vector << 2));
+	m68ki_frame_push_32(&frame, pc);
+	m68ki_frame_push_16(&frame, sr);
+	m68ki_frame_write(state, &frame);
 }
 
 /* Format 2 stack frame.
@@ -2052,10 +2266,14 @@ static inline void m68ki_stack_frame_0001(m68ki_cpu_core *state, uint pc, uint s
  */
 static inline void m68ki_stack_frame_0010(m68ki_cpu_core *state, uint sr, uint vector)
 {
-	m68ki_push_32(state, REG_PPC);
-	m68ki_push_16(state, 0x2000 | (vector << 2));
-	m68ki_push_32(state, REG_PC);
-	m68ki_push_16(state, sr);
+	m68ki_frame frame;
+
+	m68ki_frame_begin(&frame);
+	m68ki_frame_push_32(&frame, REG_PPC);
+	m68ki_frame_push_16(&frame, 0x2000 | (vector << 2));
+	m68ki_frame_push_32(&frame, REG_PC);
+	m68ki_frame_push_16(&frame, sr);
+	m68ki_frame_write(state, &frame);
 }
 
 
@@ -2238,47 +2456,52 @@ static inline void m68ki_stack_frame_1010(m68ki_cpu_core *state, uint sr, uint v
 	int orig_rw = state->mmu_tmp_buserror_rw;    // this gets splatted by the following pushes, so save it now
 	int orig_fc = state->mmu_tmp_buserror_fc;
 	int orig_sz = state->mmu_tmp_buserror_sz;
+	m68ki_frame frame;
+
+	m68ki_frame_begin(&frame);
 
 	/* INTERNAL REGISTER */
-	m68ki_push_16(state, 0);
+	m68ki_frame_push_16(&frame, 0);
 
 	/* INTERNAL REGISTER */
-	m68ki_push_16(state, 0);
+	m68ki_frame_push_16(&frame, 0);
 
 	/* DATA OUTPUT BUFFER (2 words) */
-	m68ki_push_32(state, 0);
+	m68ki_frame_push_32(&frame, 0);
 
 	/* INTERNAL REGISTER */
-	m68ki_push_16(state, 0);
+	m68ki_frame_push_16(&frame, 0);
 
 	/* INTERNAL REGISTER */
-	m68ki_push_16(state, 0);
+	m68ki_frame_push_16(&frame, 0);
 
 	/* DATA CYCLE FAULT ADDRESS (2 words) */
-	m68ki_push_32(state, fault_address);
+	m68ki_frame_push_32(&frame, fault_address);
 
 	/* INSTRUCTION PIPE STAGE B */
-	m68ki_push_16(state, 0);
+	m68ki_frame_push_16(&frame, 0);
 
 	/* INSTRUCTION PIPE STAGE C */
-	m68ki_push_16(state, 0);
+	m68ki_frame_push_16(&frame, 0);
 
 	/* SPECIAL STATUS REGISTER */
 	// set bit for: Rerun Faulted bus Cycle, or run pending prefetch
 	// set FC
-	m68ki_push_16(state, 0x0100 | orig_fc | orig_rw << 6 | orig_sz << 4);
+	m68ki_frame_push_16(&frame, 0x0100 | orig_fc | orig_rw << 6 | orig_sz << 4);
 
 	/* INTERNAL REGISTER */
-	m68ki_push_16(state, 0);
+	m68ki_frame_push_16(&frame, 0);
 
 	/* 1010, VECTOR OFFSET */
-	m68ki_push_16(state, 0xa000 | (vector << 2));
+	m68ki_frame_push_16(&frame, 0xa000 | (vector << 2));
 
 	/* PROGRAM COUNTER */
-	m68ki_push_32(state, pc);
+	m68ki_frame_push_32(&frame, pc);
 
 	/* STATUS REGISTER */
-	m68ki_push_16(state, sr);
+	m68ki_frame_push_16(&frame, sr);
+
+	m68ki_frame_write(state, &frame);
 }
 
 /* Format B stack frame (long bus fault).
@@ -2291,70 +2514,75 @@ static inline void m68ki_stack_frame_1011(m68ki_cpu_core *state, uint sr, uint v
 	int orig_rw = state->mmu_tmp_buserror_rw;    // this gets splatted by the following pushes, so save it now
 	int orig_fc = state->mmu_tmp_buserror_fc;
 	int orig_sz = state->mmu_tmp_buserror_sz;
+	m68ki_frame frame;
+
+	m68ki_frame_begin(&frame);
 
 	/* INTERNAL REGISTERS (18 words) */
-	m68ki_push_32(state, 0);
-	m68ki_push_32(state, 0);
-	m68ki_push_32(state, 0);
-	m68ki_push_32(state, 0);
-	m68ki_push_32(state, 0);
-	m68ki_push_32(state, 0);
-	m68ki_push_32(state, 0);
-	m68ki_push_32(state, 0);
-	m68ki_push_32(state, 0);
+	m68ki_frame_push_32(&frame, 0);
+	m68ki_frame_push_32(&frame, 0);
+	m68ki_frame_push_32(&frame, 0);
+	m68ki_frame_push_32(&frame, 0);
+	m68ki_frame_push_32(&frame, 0);
+	m68ki_frame_push_32(&frame, 0);
+	m68ki_frame_push_32(&frame, 0);
+	m68ki_frame_push_32(&frame, 0);
+	m68ki_frame_push_32(&frame, 0);
 
 	/* VERSION# (4 bits), INTERNAL INFORMATION */
-	m68ki_push_16(state, 0);
+	m68ki_frame_push_16(&frame, 0);
 
 	/* INTERNAL REGISTERS (3 words) */
-	m68ki_push_32(state, 0);
-	m68ki_push_16(state, 0);
+	m68ki_frame_push_32(&frame, 0);
+	m68ki_frame_push_16(&frame, 0);
 
 	/* DATA INTPUT BUFFER (2 words) */
-	m68ki_push_32(state, 0);
+	m68ki_frame_push_32(&frame, 0);
 
 	/* INTERNAL REGISTERS (2 words) */
-	m68ki_push_32(state, 0);
+	m68ki_frame_push_32(&frame, 0);
 
 	/* STAGE B ADDRESS (2 words) */
-	m68ki_push_32(state, 0);
+	m68ki_frame_push_32(&frame, 0);
 
 	/* INTERNAL REGISTER (4 words) */
-	m68ki_push_32(state, 0);
-	m68ki_push_32(state, 0);
+	m68ki_frame_push_32(&frame, 0);
+	m68ki_frame_push_32(&frame, 0);
 
 	/* DATA OUTPUT BUFFER (2 words) */
-	m68ki_push_32(state, 0);
+	m68ki_frame_push_32(&frame, 0);
 
 	/* INTERNAL REGISTER */
-	m68ki_push_16(state, 0);
+	m68ki_frame_push_16(&frame, 0);
 
 	/* INTERNAL REGISTER */
-	m68ki_push_16(state, 0);
+	m68ki_frame_push_16(&frame, 0);
 
 	/* DATA CYCLE FAULT ADDRESS (2 words) */
-	m68ki_push_32(state, fault_address);
+	m68ki_frame_push_32(&frame, fault_address);
 
 	/* INSTRUCTION PIPE STAGE B */
-	m68ki_push_16(state, 0);
+	m68ki_frame_push_16(&frame, 0);
 
 	/* INSTRUCTION PIPE STAGE C */
-	m68ki_push_16(state, 0);
+	m68ki_frame_push_16(&frame, 0);
 
 	/* SPECIAL STATUS REGISTER */
-	m68ki_push_16(state, 0x0100 | orig_fc | (orig_rw << 6) | (orig_sz << 4));
+	m68ki_frame_push_16(&frame, 0x0100 | orig_fc | (orig_rw << 6) | (orig_sz << 4));
 
 	/* INTERNAL REGISTER */
-	m68ki_push_16(state, 0);
+	m68ki_frame_push_16(&frame, 0);
 
 	/* 1011, VECTOR OFFSET */
-	m68ki_push_16(state, 0xb000 | (vector << 2));
+	m68ki_frame_push_16(&frame, 0xb000 | (vector << 2));
 
 	/* PROGRAM COUNTER */
-	m68ki_push_32(state, pc);
+	m68ki_frame_push_32(&frame, pc);
 
 	/* STATUS REGISTER */
-	m68ki_push_16(state, sr);
+	m68ki_frame_push_16(&frame, sr);
+
+	m68ki_frame_write(state, &frame);
 }
 
 /* Type 7 stack frame (access fault).
@@ -2512,6 +2740,18 @@ static inline void m68ki_exception_bus_error(m68ki_cpu_core *state)
 	//}
 
 	uint sr = m68ki_init_exception(state);
+
+#if M68K_EMULATE_PMMU
+	/* the PMMU refused an access - long bus fault frame, RTE restarts the instruction */
+	if (state->mmu_tmp_buserror_occurred)
+	{
+		state->mmu_tmp_buserror_occurred = 0;
+		m68ki_stack_frame_1011(state, sr, EXCEPTION_BUS_ERROR, REG_PPC, state->mmu_tmp_buserror_address);
+		m68ki_jump_vector(state, EXCEPTION_BUS_ERROR);
+		return;
+	}
+#endif
+
 	//m68ki_stack_frame_1000(state, REG_PPC, sr, EXCEPTION_BUS_ERROR); // 68010 only
 	m68ki_stack_frame_buserr(state, sr);
 
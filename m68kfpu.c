@@ -382,6 +382,229 @@ static inline int TEST_CONDITION(m68ki_cpu_core *state, int condition)
 	return r;
 }
 
+/*
+ * Host arithmetic fast path for FADD/FSUB/FMUL/FDIV rounded to single or
+ * double precision (FS*, FD* or the FPCR precision). The host FPU rounds the
+ * same way as softfloat does as long as the operands are normal values (or
+ * zeros) of that precision and so is the result. Everything else -
+ * extended precision, denormals, NaNs, infinities, overflow and underflow,
+ * other rounding modes and enabled exceptions - goes to softfloat.
+ */
+enum
+{
+	FPU_OP_ADD,
+	FPU_OP_SUB,
+	FPU_OP_MUL,
+	FPU_OP_DIV
+};
+
+/* rounding precision of an arithmetic opmode, FS* and FD* override the FPCR */
+static inline int fpu_op_precision(int opmode)
+{
+	if (opmode & 0x40)
+		return (opmode & 0x04) ? 64 : 32;
+
+	return status.floatx80_rounding_precision;
+}
+
+/* FPCR set to round to nearest with no exceptions enabled */
+static inline int fpu_fast_path_allowed(m68ki_cpu_core *state)
+{
+	return (REG_FPCR & 0xff30) == 0 && status.float_rounding_mode == float_round_nearest_even;
+}
+
+/* fx as a host double, 0 if it is not a normal double or a zero */
+static inline int fx80_to_host_double(floatx80 fx, double *out)
+{
+	union { double d; uint64 u; } v;
+	int exp = fx.high & 0x7fff;
+
+	if (exp == 0 && fx.low == 0)
+		v.u = 0;
+	else
+	{
+		exp = exp - 0x3fff + 0x3ff;
+		if (exp < 1 || exp > 0x7fe || !(fx.low >> 63) || (fx.low & 0x7ff))
+			return 0;
+		v.u = ((uint64)exp << 52) | ((fx.low << 1) >> 12);
+	}
+
+	v.u |= (uint64)(fx.high & 0x8000) << 48;
+	*out = v.d;
+	return 1;
+}
+
+/* fx as a host float, 0 if it is not a normal float or a zero */
+static inline int fx80_to_host_float(floatx80 fx, float *out)
+{
+	union { float f; uint32 u; } v;
+	int exp = fx.high & 0x7fff;
+
+	if (exp == 0 && fx.low == 0)
+		v.u = 0;
+	else
+	{
+		exp = exp - 0x3fff + 0x7f;
+		if (exp < 1 || exp > 0xfe || !(fx.low >> 63) || (fx.low & U64(0xffffffffff)))
+			return 0;
+		v.u = ((uint32)exp << 23) | (uint32)((fx.low << 1) >> 41);
+	}
+
+	v.u |= (uint32)(fx.high & 0x8000) << 16;
+	*out = v.f;
+	return 1;
+}
+
+/* a normal double or zero back to extended */
+static inline floatx80 host_double_to_fx80(double in)
+{
+	union { double d; uint64 u; } v;
+	floatx80 fx;
+	int exp;
+
+	v.d = in;
+	exp = (v.u >> 52) & 0x7ff;
+	fx.high = (v.u >> 48) & 0x8000;
+	fx.low = 0;
+	if (exp)
+	{
+		fx.high |= exp - 0x3ff + 0x3fff;
+		fx.low = U64(0x8000000000000000) | ((v.u & DOUBLE_MANTISSA) << 11);
+	}
+
+	return fx;
+}
+
+/* a normal float or zero back to extended */
+static inline floatx80 host_float_to_fx80(float in)
+{
+	union { float f; uint32 u; } v;
+	floatx80 fx;
+	int exp;
+
+	v.f = in;
+	exp = (v.u >> 23) & 0xff;
+	fx.high = (v.u >> 16) & 0x8000;
+	fx.low = 0;
+	if (exp)
+	{
+		fx.high |= exp - 0x7f + 0x3fff;
+		fx.low = U64(0x8000000000000000) | ((uint64)(v.u & 0x7fffff) << 40);
+	}
+
+	return fx;
+}
+
+/*
+ * A zero result is only exact for a zero operand or for add/sub cancelling
+ * out; from a product or quotient of normals it is an underflow softfloat
+ * keeps in the extended exponent range.
+ */
+static inline int fpu_fast_result_ok(int op, int cls, int zero_operand)
+{
+	if (cls == FP_NORMAL)
+		return 1;
+
+	return cls == FP_ZERO && (op == FPU_OP_ADD || op == FPU_OP_SUB || zero_operand);
+}
+
+/* a op b with the host FPU, returns 0 if softfloat has to do it */
+static inline int fpu_fast_arith(int op, int prec, floatx80 a, floatx80 b, floatx80 *res)
+{
+	if (prec == 64)
+	{
+		double da, db, dr;
+
+		if (!fx80_to_host_double(a, &da) || !fx80_to_host_double(b, &db))
+			return 0;
+
+		switch (op)
+		{
+			case FPU_OP_ADD:	dr = da + db;	break;
+			case FPU_OP_SUB:	dr = da - db;	break;
+			case FPU_OP_MUL:	dr = da * db;	break;
+			default:			dr = da / db;	break;
+		}
+
+		if (!fpu_fast_result_ok(op, fpclassify(dr), da == 0 || db == 0))
+			return 0;
+
+		*res = host_double_to_fx80(dr);
+		return 1;
+	}
+
+	if (prec == 32)
+	{
+		float fa, fb, fr;
+
+		if (!fx80_to_host_float(a, &fa) || !fx80_to_host_float(b, &fb))
+			return 0;
+
+		switch (op)
+		{
+			case FPU_OP_ADD:	fr = fa + fb;	break;
+			case FPU_OP_SUB:	fr = fa - fb;	break;
+			case FPU_OP_MUL:	fr = fa * fb;	break;
+			default:			fr = fa / fb;	break;
+		}
+
+		if (!fpu_fast_result_ok(op, fpclassify(fr), fa == 0 || fb == 0))
+			return 0;
+
+		*res = host_float_to_fx80(fr);
+		return 1;
+	}
+
+	return 0;
+}
+
+/* a op b with softfloat, rounded to prec */
+static floatx80 fpu_softfloat_arith(int op, int prec, floatx80 a, floatx80 b)
+{
+	sint8 const saved = status.floatx80_rounding_precision;
+	floatx80 res;
+
+	status.floatx80_rounding_precision = prec;
+	switch (op)
+	{
+		case FPU_OP_ADD:	res = floatx80_add(a, b, &status);	break;
+		case FPU_OP_SUB:	res = floatx80_sub(a, b, &status);	break;
+		case FPU_OP_MUL:	res = floatx80_mul(a, b, &status);	break;
+		default:			res = floatx80_div(a, b, &status);	break;
+	}
+	status.floatx80_rounding_precision = saved;
+
+	return res;
+}
+
+static inline floatx80 fpu_arith(m68ki_cpu_core *state, int op, int opmode, floatx80 a, floatx80 b)
+{
+	int prec = fpu_op_precision(opmode);
+	floatx80 res;
+
+	if (fpu_fast_path_allowed(state) && fpu_fast_arith(op, prec, a, b, &res))
+		return res;
+
+	return fpu_softfloat_arith(op, prec, a, b);
+}
+
+/*
+ * FCMP condition codes for two doubles, the sign and zero-ness of a - b.
+ * Gradual underflow keeps a - b nonzero for a != b and a host overflow to
+ * infinity still has the right sign, so this holds at any precision.
+ */
+static inline int fpu_fast_cmp(floatx80 a, floatx80 b, uint32 *cc)
+{
+	double da, db, dr;
+
+	if (!fx80_to_host_double(a, &da) || !fx80_to_host_double(b, &db))
+		return 0;
+
+	dr = da - db;
+	*cc = (signbit(dr) ? FPCC_N : 0) | (dr == 0 ? FPCC_Z : 0);
+	return 1;
+}
+
 static uint8 READ_EA_8(m68ki_cpu_core *state, int ea)
 {
 	int mode = (ea >> 3) & 0x7;
@@ -1618,7 +1841,7 @@ static void fpgen_rm_reg(m68ki_cpu_core *state, uint16 w2)
 		case 0x60:		// FSDIV
 		case 0x20:		// FDIV
 		{
-			REG_FP[dst] = floatx80_div(REG_FP[dst], source, &status);
+			REG_FP[dst] = fpu_arith(state, FPU_OP_DIV, opmode, REG_FP[dst], source);
 			//FIXME mame doesn't use SET_CONDITION_CODES here
 			SET_CONDITION_CODES(state, REG_FP[dst]); // JFF
 			USE_CYCLES(43);
@@ -1640,7 +1863,7 @@ static void fpgen_rm_reg(m68ki_cpu_core *state, uint16 w2)
 		case 0x62:		// FSADD
 		case 0x22:		// FADD
 		{
-			REG_FP[dst] = floatx80_add(REG_FP[dst], source, &status);
+			REG_FP[dst] = fpu_arith(state, FPU_OP_ADD, opmode, REG_FP[dst], source);
 			SET_CONDITION_CODES(state, REG_FP[dst]);
 			USE_CYCLES(9);
 			break;
@@ -1649,7 +1872,7 @@ static void fpgen_rm_reg(m68ki_cpu_core *state, uint16 w2)
 		case 0x63:		// FSMUL
 		case 0x23:		// FMUL
 		{
-			REG_FP[dst] = floatx80_mul(REG_FP[dst], source, &status);
+			REG_FP[dst] = fpu_arith(state, FPU_OP_MUL, opmode, REG_FP[dst], source);
 			SET_CONDITION_CODES(state, REG_FP[dst]);
 			USE_CYCLES(11);
 			break;
@@ -1697,7 +1920,7 @@ static void fpgen_rm_reg(m68ki_cpu_core *state, uint16 w2)
 		case 0x2e:		// FSUB
 		case 0x2f:		// FSUB
 		{
-			REG_FP[dst] = floatx80_sub(REG_FP[dst], source, &status);
+			REG_FP[dst] = fpu_arith(state, FPU_OP_SUB, opmode, REG_FP[dst], source);
 			SET_CONDITION_CODES(state, REG_FP[dst]);
 			USE_CYCLES(9);
 			break;
@@ -1724,6 +1947,13 @@ static void fpgen_rm_reg(m68ki_cpu_core *state, uint16 w2)
 		case 0x3d:		// FCMP
 		{
 			floatx80 res;
+			uint32 cc;
+			if (fpu_fast_path_allowed(state) && fpu_fast_cmp(REG_FP[dst], source, &cc))
+			{
+				REG_FPSR = (REG_FPSR & ~(FPCC_N|FPCC_Z|FPCC_I|FPCC_NAN)) | cc;
+				USE_CYCLES(7);
+				break;
+			}
 			res = floatx80_sub(REG_FP[dst], source, &status);
 			SET_CONDITION_CODES(state, res);
 			USE_CYCLES(7);
@@ -2409,3 +2639,113 @@ void m68881_ftrap(m68ki_cpu_core *state)
 		}
 	}
 }
+
+/* xorshift64, the conformance check wants the same operands on every run */
+static uint64 fpu_check_random(uint64 *seed)
+{
+	*seed ^= *seed << 13;
+	*seed ^= *seed >> 7;
+	*seed ^= *seed << 17;
+	return *seed;
+}
+
+/*
+ * A random operand of precision prec. Mostly exponents close together so
+ * add/sub round and cancel, sometimes anywhere in the double range so
+ * products and quotients overflow and underflow, and sometimes a zero,
+ * denormal, infinity, NaN or extended-only value the fast path must refuse.
+ */
+static floatx80 fpu_check_operand(uint64 *seed, int prec)
+{
+	uint64 r = fpu_check_random(seed);
+	floatx80 fx;
+
+	fx.high = (r & 1) ? 0x8000 : 0;
+	fx.low = fpu_check_random(seed) | U64(0x8000000000000000);
+
+	switch ((r >> 1) & 15)
+	{
+		case 0:		fx.low = 0;							return fx;	// zero
+		case 1:		fx.low >>= 1;						return fx;	// denormal
+		case 2:		fx.high |= 0x7fff; fx.low = 0;		return fx;	// infinity
+		case 3:		fx.high |= 0x7fff;					return fx;	// NaN
+		case 4:		fx.high |= 0x3fff + (int)((r >> 8) % 2046) - 1022;	break;
+		case 5:		fx.high |= 0x3fff + (int)((r >> 8) % 256) - 126;	break;
+		default:	fx.high |= 0x3fff + (int)((r >> 8) % 32) - 16;		break;
+	}
+
+	// extended-only mantissa bits now and then, otherwise the precision's
+	if (((r >> 5) & 15) != 0)
+		fx.low &= (prec == 32) ? U64(0xffffff0000000000) : U64(0xfffffffffffff800);
+
+	return fx;
+}
+
+/*
+ * Run count random operand pairs through the fast path and softfloat for
+ * FADD/FSUB/FMUL/FDIV in single and double precision and FCMP, and report
+ * every result that differs. Returns the number of mismatches.
+ */
+unsigned int m68k_fpu_check_fast_path(unsigned int count)
+{
+	static m68ki_cpu_core check;
+	static const char *names[] = { "add", "sub", "mul", "div" };
+	m68ki_cpu_core *state = &check;
+	sint8 const saved_mode = status.float_rounding_mode;
+	uint64 seed = U64(0x2545f4914f6cdd1d);
+	unsigned int fast = 0, mismatches = 0;
+	unsigned int i;
+	int op, prec;
+
+	status.float_rounding_mode = float_round_nearest_even;
+
+	for (i = 0; i < count; i++)
+	{
+		for (prec = 32; prec <= 64; prec += 32)
+		{
+			floatx80 a = fpu_check_operand(&seed, prec);
+			floatx80 b = fpu_check_operand(&seed, prec);
+			floatx80 quick, slow;
+			uint32 cc;
+
+			// cancel out to a few bits now and then
+			if ((i & 7) == 0)
+				b.high = (a.high & 0x7fff) | (b.high & 0x8000);
+
+			for (op = FPU_OP_ADD; op <= FPU_OP_DIV; op++)
+			{
+				if (!fpu_fast_arith(op, prec, a, b, &quick))
+					continue;
+
+				fast++;
+				slow = fpu_softfloat_arith(op, prec, a, b);
+				if (quick.high != slow.high || quick.low != slow.low)
+				{
+					if (mismatches++ < 16)
+						printf("[FPU] %s.%c %04x:%016llx, %04x:%016llx: fast %04x:%016llx softfloat %04x:%016llx\n",
+							names[op], prec == 32 ? 's' : 'd',
+							a.high, (unsigned long long)a.low, b.high, (unsigned long long)b.low,
+							quick.high, (unsigned long long)quick.low, slow.high, (unsigned long long)slow.low);
+				}
+			}
+
+			if (fpu_fast_cmp(a, b, &cc))
+			{
+				fast++;
+				SET_CONDITION_CODES(state, floatx80_sub(a, b, &status));
+				if (cc != (REG_FPSR & (FPCC_N|FPCC_Z|FPCC_I|FPCC_NAN)))
+				{
+					if (mismatches++ < 16)
+						printf("[FPU] cmp %04x:%016llx, %04x:%016llx: fast %08x softfloat %08x\n",
+							a.high, (unsigned long long)a.low, b.high, (unsigned long long)b.low,
+							cc, REG_FPSR);
+				}
+			}
+		}
+	}
+
+	status.float_rounding_mode = saved_mode;
+
+	printf("[FPU] %u operand pairs, %u fast path results checked, %u mismatches\n", count * 2, fast, mismatches);
+	return mismatches;
+}
@@ -40,11 +40,22 @@
  * It requires an input file to function (default m68k_in.c), but you can
  * specify your own like so:
  *
- * m68kmake <output path> <input file>
+ * m68kmake <output path> <input file> <fusion profile> <execution profile>
  *
  * where output path is the path where the output files should be placed, and
  * input file is the file to use for input.
  *
+ * The fusion profile (default m68kfuse.txt, optional) lists instruction pairs
+ * to generate fused handlers for, see write_fused_handlers().
+ *
+ * The execution profile (optional) is a file written by the emulator's
+ * --profile switch. Its opcode counts mark handlers hot or cold, see
+ * read_exec_profile().
+ *
+ * The opcode handlers go to m68kops_handlers.h, which is compiled once per
+ * CPU model (m68kops_<model>.c, see g_models) with CPU_TYPE a constant.
+ * m68kops.c holds the opcode table and picks the model's handlers.
+ *
  * If you modify the input file greatly from its released form, you may have
  * to tweak the configuration section a bit since I'm using static allocation
  * to keep things simple.
@@ -88,11 +99,15 @@ static const char g_version[] = "4.60";
 #define EA_ALLOWED_LENGTH                11	/* Max length of ea allowed str */
 #define MAX_OPCODE_INPUT_TABLE_LENGTH  1000	/* Max length of opcode handler tbl */
 #define MAX_OPCODE_OUTPUT_TABLE_LENGTH 3000	/* Max length of opcode handler tbl */
+#define MAX_FUSE_PAIRS                  256	/* Max number of fused instruction pairs */
 
 /* Default filenames */
 #define FILENAME_INPUT      "m68k_in.c"
 #define FILENAME_PROTOTYPE  "m68kops.h"
 #define FILENAME_TABLE      "m68kops.c"
+#define FILENAME_FUSE       "m68kfuse.txt"
+#define FILENAME_HANDLERS   "m68kops_handlers.h"
+#define FILENAME_MODEL      "m68kops_%s.c"
 
 
 /* Identifier sequences recognized by this program */
@@ -217,6 +232,23 @@ typedef struct
 } replace_struct;
 
 
+/* A pair of opcode handlers to fuse, from the fusion profile */
+typedef struct
+{
+	char first[MAX_NAME_LENGTH+9];		/* "m68k_op_" + name */
+	char second[MAX_NAME_LENGTH+9];
+} fuse_struct;
+
+
+/* A CPU model the opcode handlers are compiled for */
+typedef struct
+{
+	char* suffix;    /* m68kops_<suffix>.c, m68ki_handlers_<suffix> */
+	char* cpu_type;  /* what CPU_TYPE is in there, NULL for the runtime value */
+	char* serves;    /* the CPU_TYPE values it is selected for */
+} model_struct;
+
+
 /* Function Prototypes */
 void error_exit(char* fmt, ...);
 void perror_exit(char* fmt, ...);
@@ -233,7 +265,7 @@ int extract_opcode_info(char* src, char* name, int* size, char* spec_proc, char*
 void add_replace_string(replace_struct* replace, char* search_str, char* replace_str);
 void write_body(FILE* filep, body_struct* body, replace_struct* replace);
 void get_base_name(char* base_name, opcode_struct* op);
-void write_function_name(FILE* filep, char* base_name);
+void write_function_name(FILE* filep, char* base_name, opcode_struct* op);
 void add_opcode_output_table_entry(opcode_struct* op, char* name);
 static int DECL_SPEC compare_nof_true_bits(const void* aptr, const void* bptr);
 void print_opcode_output_table(FILE* filep);
@@ -245,6 +277,15 @@ void generate_opcode_cc_variants(FILE* filep, body_struct* body, replace_struct*
 void process_opcode_handlers(FILE* filep);
 void populate_table(void);
 void read_insert(char* insert);
+void read_fuse_profile(void);
+int is_fused_first(char* name);
+void read_exec_profile(void);
+const char* handler_attribute(opcode_struct* op);
+void write_fused_handlers(FILE* filep);
+void write_fuse_table_builder(FILE* filep);
+void write_handler_array(FILE* filep);
+void write_model_files(char* output_path);
+void write_model_selector(FILE* filep);
 
 
 
@@ -255,10 +296,46 @@ void read_insert(char* insert);
 /* Name of the input file */
 char g_input_filename[M68K_MAX_PATH] = FILENAME_INPUT;
 
+/* Name of the fusion profile */
+char g_fuse_filename[M68K_MAX_PATH] = FILENAME_FUSE;
+
+/* Fused instruction pairs */
+fuse_struct g_fuse_table[MAX_FUSE_PAIRS];
+int g_fuse_table_length = 0;
+
+/* Name of the execution profile, empty for none */
+char g_exec_profile_filename[M68K_MAX_PATH] = "";
+
+/* Times each opcode word ran, from the execution profile */
+unsigned long long g_exec_counts[0x10000];
+unsigned long long g_exec_total = 0;
+int g_num_hot = 0;
+int g_num_cold = 0;
+
+/*
+ * CPU models with a handler set of their own. Models that no CPU_TYPE_IS_*()
+ * test tells apart share one, the rest (68008, SCC68070) use the generic
+ * set, which reads the CPU type at runtime like before. The Makefile lists
+ * the same files in MUSASHIGENCFILES.
+ */
+model_struct g_models[] =
+{
+	{"000",   "CPU_TYPE_000",   "CPU_TYPE_000"},
+	{"010",   "CPU_TYPE_010",   "CPU_TYPE_010"},
+	{"ec020", "CPU_TYPE_EC020", "CPU_TYPE_EC020"},
+	{"020",   "CPU_TYPE_020",   "CPU_TYPE_020"},
+	{"030",   "CPU_TYPE_030",   "CPU_TYPE_EC030 | CPU_TYPE_030"},
+	{"040",   "CPU_TYPE_040",   "CPU_TYPE_EC040 | CPU_TYPE_LC040 | CPU_TYPE_040"},
+	{"any",   NULL,             "0"},
+};
+
+#define NUM_MODELS (int)(sizeof(g_models) / sizeof(g_models[0]))
+
 /* File handles */
 FILE* g_input_file = NULL;
 FILE* g_prototype_file = NULL;
 FILE* g_table_file = NULL;
+FILE* g_handler_file = NULL;
 
 int g_num_functions = 0;  /* Number of functions processed */
 int g_num_primitives = 0; /* Number of function primitives read */
@@ -480,6 +557,7 @@ void error_exit(char* fmt, ...)
 
 	if(g_prototype_file) fclose(g_prototype_file);
 	if(g_table_file) fclose(g_table_file);
+	if(g_handler_file) fclose(g_handler_file);
 	if(g_input_file) fclose(g_input_file);
 
 	exit(EXIT_FAILURE);
@@ -496,6 +574,7 @@ void perror_exit(char* fmt, ...)
 
 	if(g_prototype_file) fclose(g_prototype_file);
 	if(g_table_file) fclose(g_table_file);
+	if(g_handler_file) fclose(g_handler_file);
 	if(g_input_file) fclose(g_input_file);
 
 	exit(EXIT_FAILURE);
@@ -783,9 +862,9 @@ void get_base_name(char* base_name, opcode_struct* op)
 }
 
 /* Write the name of an opcode handler function */
-void write_function_name(FILE* filep, char* base_name)
+void write_function_name(FILE* filep, char* base_name, opcode_struct* op)
 {
-	fprintf(filep, "static void %s(m68ki_cpu_core *state)\n", base_name);
+	fprintf(filep, "static %svoid %s(m68ki_cpu_core *state)\n", handler_attribute(op), base_name);
 }
 
 void add_opcode_output_table_entry(opcode_struct* op, char* name)
@@ -830,8 +909,8 @@ void write_table_entry(FILE* filep, opcode_struct* op)
 {
 	int i;
 
-	fprintf(filep, "\t{%-28s, 0x%04x, 0x%04x, {",
-		op->name, op->op_mask, op->op_match);
+	fprintf(filep, "\t{0x%04x, 0x%04x, {",
+		op->op_mask, op->op_match);
 
 	for(i=0;i<NUM_CPUS;i++)
 	{
@@ -840,7 +919,7 @@ void write_table_entry(FILE* filep, opcode_struct* op)
 			fprintf(filep, ", ");
 	}
 
-	fprintf(filep, "}},\n");
+	fprintf(filep, "}}, /* %s */\n", op->name);
 }
 
 /* Fill out an opcode struct with a specific addressing mode of the source opcode struct */
@@ -869,7 +948,7 @@ void generate_opcode_handler(FILE* filep, body_struct* body, replace_struct* rep
 	set_opcode_struct(opinfo, op, ea_mode);
 	get_base_name(str, op);
 	add_opcode_output_table_entry(op, str);
-	write_function_name(filep, str);
+	write_function_name(filep, str, op);
 
 	/* Add any replace strings needed */
 	if(ea_mode != EA_MODE_NONE)
@@ -1213,6 +1292,316 @@ void read_insert(char* insert)
 /* ============================= MAIN FUNCTION ============================ */
 /* ======================================================================== */
 
+/*
+ * Read the fusion profile. Each line names two opcode handlers as generated
+ * above, without the m68k_op_ prefix, optionally followed by how often the
+ * pair was seen:
+ *
+ *     cmp_32_d  bne_8  123456
+ *
+ * A missing profile just means no fused handlers.
+ */
+void read_fuse_profile(void)
+{
+	char line[MAX_LINE_LENGTH+1];
+	char first[MAX_LINE_LENGTH+1];
+	char second[MAX_LINE_LENGTH+1];
+	FILE* filep;
+	int line_number = 0;
+	int i;
+
+	if((filep = fopen(g_fuse_filename, "rt")) == NULL)
+	{
+		printf("No fusion profile %s, not generating fused handlers\n", g_fuse_filename);
+		return;
+	}
+
+	while(fgets(line, sizeof(line), filep) != NULL)
+	{
+		fuse_struct* fuse;
+		int found_first = 0;
+		int found_second = 0;
+
+		line_number++;
+
+		if(strchr(line, '#'))
+			*strchr(line, '#') = 0;
+
+		if(sscanf(line, "%200s %200s", first, second) != 2)
+			continue;
+
+		if(g_fuse_table_length >= MAX_FUSE_PAIRS)
+			error_exit("%s:%d: too many instruction pairs", g_fuse_filename, line_number);
+
+		fuse = g_fuse_table + g_fuse_table_length;
+		if(snprintf(fuse->first, sizeof(fuse->first), "m68k_op_%s", first) >= (int)sizeof(fuse->first))
+			error_exit("%s:%d: opcode handler name too long: %s", g_fuse_filename, line_number, first);
+		if(snprintf(fuse->second, sizeof(fuse->second), "m68k_op_%s", second) >= (int)sizeof(fuse->second))
+			error_exit("%s:%d: opcode handler name too long: %s", g_fuse_filename, line_number, second);
+
+		for(i=0;i<g_opcode_output_table_length;i++)
+		{
+			if(strcmp(g_opcode_output_table[i].name, fuse->first) == 0)
+				found_first = 1;
+			if(strcmp(g_opcode_output_table[i].name, fuse->second) == 0)
+				found_second = 1;
+		}
+		if(!found_first)
+			error_exit("%s:%d: no opcode handler %s", g_fuse_filename, line_number, fuse->first);
+		if(!found_second)
+			error_exit("%s:%d: no opcode handler %s", g_fuse_filename, line_number, fuse->second);
+
+		for(i=0;i<g_fuse_table_length;i++)
+			if(strcmp(g_fuse_table[i].first, fuse->first) == 0 && strcmp(g_fuse_table[i].second, fuse->second) == 0)
+				break;
+		if(i == g_fuse_table_length)
+			g_fuse_table_length++;
+	}
+
+	fclose(filep);
+}
+
+/* Index of the first pair whose first handler is name, -1 if there is none */
+int is_fused_first(char* name)
+{
+	int i;
+
+	for(i=0;i<g_fuse_table_length;i++)
+		if(strcmp(g_fuse_table[i].first, name) == 0)
+			return i;
+	return -1;
+}
+
+/*
+ * Read the opcode counts from an execution profile written by the emulator
+ * (--profile). Only the "op <opcode> <count>" lines are used here, the
+ * others are for people retuning the fusion profile:
+ *
+ *     op 4a80 123456
+ *
+ * Without a profile no handler gets an attribute.
+ */
+void read_exec_profile(void)
+{
+	char line[MAX_LINE_LENGTH+1];
+	unsigned int opcode;
+	unsigned long long count;
+	FILE* filep;
+
+	if(g_exec_profile_filename[0] == 0)
+		return;
+
+	if((filep = fopen(g_exec_profile_filename, "rt")) == NULL)
+		perror_exit("can't open execution profile %s", g_exec_profile_filename);
+
+	while(fgets(line, sizeof(line), filep) != NULL)
+	{
+		if(sscanf(line, "op %x %llu", &opcode, &count) != 2 || opcode > 0xffff)
+			continue;
+		g_exec_counts[opcode] += count;
+		g_exec_total += count;
+	}
+
+	fclose(filep);
+
+	if(g_exec_total == 0)
+		printf("No opcode counts in %s, not marking handlers\n", g_exec_profile_filename);
+}
+
+/*
+ * Function attribute for the handler of op. Handlers running at least 1 in
+ * HOT_SHARE instructions of the profile are hot, those that never ran are
+ * cold. GCC places them in .text.hot and .text.unlikely, which packs the
+ * handlers that matter into as few cache lines and pages as possible.
+ */
+#define HOT_SHARE 2000
+
+const char* handler_attribute(opcode_struct* op)
+{
+	unsigned long long count = 0;
+	int i;
+
+	if(g_exec_total == 0)
+		return "";
+
+	for(i=0;i<0x10000;i++)
+		if((i & op->op_mask) == op->op_match)
+			count += g_exec_counts[i];
+
+	if(count * HOT_SHARE >= g_exec_total)
+	{
+		g_num_hot++;
+		return "__attribute__((hot)) ";
+	}
+	if(count == 0)
+	{
+		g_num_cold++;
+		return "__attribute__((cold)) ";
+	}
+	return "";
+}
+
+/*
+ * Write one fused handler per distinct first handler in the profile. It runs
+ * the first instruction, and when the execute loop would go straight on to
+ * the next one (see m68ki_fuse_ready()) and that is one of the listed second
+ * handlers, fetches and runs it too. The loop then accounts for the second
+ * instruction exactly as if it had dispatched it itself.
+ */
+void write_fused_handlers(FILE* filep)
+{
+	int i;
+	int j;
+
+	if(g_fuse_table_length == 0)
+		return;
+
+	fprintf(filep, "/* ======================================================================== */\n");
+	fprintf(filep, "/* ======================= FUSED INSTRUCTION HANDLERS ===================== */\n");
+	fprintf(filep, "/* ======================================================================== */\n\n");
+	fprintf(filep, "/* generated from %s */\n\n", g_fuse_filename);
+	fprintf(filep, "extern void (*m68ki_instruction_jump_table[0x10000])(m68ki_cpu_core *state);\n\n");
+
+	for(i=0;i<g_fuse_table_length;i++)
+		if(is_fused_first(g_fuse_table[i].first) == i)
+			fprintf(filep, "static void m68k_fuse_%s(m68ki_cpu_core *state);\n", g_fuse_table[i].first + 8);
+	fprintf(filep, "\n");
+
+	for(i=0;i<g_fuse_table_length;i++)
+	{
+		int chained = 0;
+
+		if(is_fused_first(g_fuse_table[i].first) != i)
+			continue;
+
+		fprintf(filep, "static void m68k_fuse_%s(m68ki_cpu_core *state)\n{\n", g_fuse_table[i].first + 8);
+		fprintf(filep, "\tvoid (*next)(m68ki_cpu_core *state);\n\n");
+		fprintf(filep, "\t%s(state);\n\n", g_fuse_table[i].first);
+		fprintf(filep, "\tif(!m68ki_fuse_ready(state))\n\t\treturn;\n\n");
+		fprintf(filep, "\tnext = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];\n\n");
+
+		for(j=i;j<g_fuse_table_length;j++)
+		{
+			if(strcmp(g_fuse_table[j].first, g_fuse_table[i].first) != 0)
+				continue;
+
+			fprintf(filep, "\t%sif(next == %s", chained ? "else " : "", g_fuse_table[j].second);
+			if(is_fused_first(g_fuse_table[j].second) >= 0)
+				fprintf(filep, " || next == m68k_fuse_%s", g_fuse_table[j].second + 8);
+			fprintf(filep, ")\n\t{\n");
+			fprintf(filep, "\t\tm68ki_fuse_fetch(state);\n");
+			fprintf(filep, "\t\t%s(state);\n", g_fuse_table[j].second);
+			fprintf(filep, "\t}\n");
+			chained = 1;
+		}
+		fprintf(filep, "}\n\n\n");
+	}
+}
+
+/* Write the model's m68ki_fuse_opcode_table(), which swaps the fused handlers into the jump table */
+void write_fuse_table_builder(FILE* filep)
+{
+	int i;
+
+	fprintf(filep, "/* Replace handlers with their fused versions, returns how many opcodes now have one */\n");
+	fprintf(filep, "int M68KI_MODEL_NAME(m68ki_fuse_opcode_table)(void)\n{\n");
+	fprintf(filep, "\tint fused = 0;\n");
+
+	if(g_fuse_table_length > 0)
+	{
+		fprintf(filep, "\tint i;\n\n");
+		fprintf(filep, "\tfor(i = 0; i < 0x10000; i++)\n\t{\n");
+		for(i=0;i<g_fuse_table_length;i++)
+		{
+			if(is_fused_first(g_fuse_table[i].first) != i)
+				continue;
+			fprintf(filep, "\t\tif(m68ki_instruction_jump_table[i] == %s)\n", g_fuse_table[i].first);
+			fprintf(filep, "\t\t{\n\t\t\tm68ki_instruction_jump_table[i] = m68k_fuse_%s;\n", g_fuse_table[i].first + 8);
+			fprintf(filep, "\t\t\tfused++;\n\t\t\tcontinue;\n\t\t}\n");
+		}
+		fprintf(filep, "\t}\n");
+	}
+
+	fprintf(filep, "\n\treturn fused;\n}\n\n");
+}
+
+/* Write the model's handlers in opcode table order, followed by the one for illegal opcodes */
+void write_handler_array(FILE* filep)
+{
+	int i;
+
+	fprintf(filep, "/* Handlers in m68k_opcode_handler_table order, m68k_op_illegal last */\n");
+	fprintf(filep, "void (*const M68KI_MODEL_NAME(m68ki_handlers)[])(m68ki_cpu_core *state) =\n{\n");
+	for(i=0;i<g_opcode_output_table_length;i++)
+		fprintf(filep, "\t%s,\n", g_opcode_output_table[i].name);
+	fprintf(filep, "\tm68k_op_illegal\n};\n\n");
+}
+
+/* Write m68kops_<model>.c for every model */
+void write_model_files(char* output_path)
+{
+	char filename[M68K_MAX_PATH*2];
+	FILE* filep;
+	int i;
+
+	for(i=0;i<NUM_MODELS;i++)
+	{
+		sprintf(filename, "%s" FILENAME_MODEL, output_path, g_models[i].suffix);
+		if((filep = fopen(filename, "wt")) == NULL)
+			perror_exit("Unable to create model file (%s)\n", filename);
+
+		fprintf(filep, "/* opcode handlers for %s - generated by m68kmake */\n\n", g_models[i].cpu_type ? g_models[i].serves : "any other CPU model");
+		if(g_models[i].cpu_type)
+			fprintf(filep, "#define M68KI_MODEL_CPU_TYPE %s\n", g_models[i].cpu_type);
+		fprintf(filep, "#define M68KI_MODEL_NAME(name) name##_%s\n\n", g_models[i].suffix);
+		fprintf(filep, "#include \"%s\"\n", FILENAME_HANDLERS);
+		fclose(filep);
+	}
+}
+
+/*
+ * Write m68ki_select_opcode_handlers(), which fills the jump table from the
+ * handler set for a CPU type, and m68ki_fuse_opcode_table() for the set
+ * selected last.
+ */
+void write_model_selector(FILE* filep)
+{
+	int i;
+
+	fprintf(filep, "/* ======================================================================== */\n");
+	fprintf(filep, "/* ========================= CPU MODEL HANDLER SETS ======================= */\n");
+	fprintf(filep, "/* ======================================================================== */\n\n");
+
+	for(i=0;i<NUM_MODELS;i++)
+	{
+		fprintf(filep, "extern void (*const m68ki_handlers_%s[])(m68ki_cpu_core *state);\n", g_models[i].suffix);
+		fprintf(filep, "int m68ki_fuse_opcode_table_%s(void);\n", g_models[i].suffix);
+	}
+
+	fprintf(filep, "\nstatic const struct\n{\n");
+	fprintf(filep, "\tunsigned int cpu_types;\n");
+	fprintf(filep, "\tvoid (*const *handlers)(m68ki_cpu_core *state);\n");
+	fprintf(filep, "\tint (*fuse)(void);\n");
+	fprintf(filep, "} m68ki_models[] =\n{\n");
+	for(i=0;i<NUM_MODELS;i++)
+		fprintf(filep, "\t{%s, m68ki_handlers_%s, m68ki_fuse_opcode_table_%s},\n", g_models[i].serves, g_models[i].suffix, g_models[i].suffix);
+	fprintf(filep, "};\n\n");
+
+	fprintf(filep, "static int m68ki_model = %d;\n\n", NUM_MODELS - 1);
+
+	fprintf(filep, "/* Fill the jump table from the handlers compiled for cpu_type (CPU_TYPE_*) */\n");
+	fprintf(filep, "void m68ki_select_opcode_handlers(unsigned int cpu_type)\n{\n");
+	fprintf(filep, "\tint i;\n\n");
+	fprintf(filep, "\tfor(m68ki_model = 0; m68ki_model < %d; m68ki_model++)\n", NUM_MODELS - 1);
+	fprintf(filep, "\t\tif(m68ki_models[m68ki_model].cpu_types & cpu_type)\n\t\t\tbreak;\n\n");
+	fprintf(filep, "\tfor(i = 0; i < 0x10000; i++)\n");
+	fprintf(filep, "\t\tm68ki_instruction_jump_table[i] = m68ki_models[m68ki_model].handlers[m68ki_opcode_index[i]];\n}\n\n");
+
+	fprintf(filep, "int m68ki_fuse_opcode_table(void)\n{\n");
+	fprintf(filep, "\treturn m68ki_models[m68ki_model].fuse();\n}\n\n");
+}
+
+
 int main(int argc, char **argv)
 {
 	/* File stuff */
@@ -1252,6 +1641,10 @@ int main(int argc, char **argv)
 			strcat(output_path, "/");
 		if(argc > 2)
 			strcpy(g_input_filename, argv[2]);
+		if(argc > 3)
+			strcpy(g_fuse_filename, argv[3]);
+		if(argc > 4)
+			strcpy(g_exec_profile_filename, argv[4]);
 	}
 
 
@@ -1264,9 +1657,15 @@ int main(int argc, char **argv)
 	if((g_table_file = fopen(filename, "wt")) == NULL)
 		perror_exit("Unable to create table file (%s)\n", filename);
 
+	sprintf(filename, "%s%s", output_path, FILENAME_HANDLERS);
+	if((g_handler_file = fopen(filename, "wt")) == NULL)
+		perror_exit("Unable to create handler file (%s)\n", filename);
+
 	if((g_input_file=fopen(g_input_filename, "rt")) == NULL)
 		perror_exit("can't open %s for input", g_input_filename);
 
+	read_exec_profile();
+
 
 	/* Get to the first section of the input file */
 	section_id[0] = 0;
@@ -1351,9 +1750,10 @@ int main(int argc, char **argv)
 			if(ophandler_body_read)
 				error_exit("Duplicate opcode handler section");
 
-			fprintf(g_table_file, "%s\n\n", ophandler_header_insert);
-			process_opcode_handlers(g_table_file);
-			fprintf(g_table_file, "%s\n\n", ophandler_footer_insert);
+			fprintf(g_handler_file, "%s\n\n", ophandler_header_insert);
+			process_opcode_handlers(g_handler_file);
+			read_fuse_profile();
+			write_fused_handlers(g_handler_file);
 
 			ophandler_body_read = 1;
 		}
@@ -1380,6 +1780,13 @@ int main(int argc, char **argv)
 			fprintf(g_table_file, "%s\n\n", table_header_insert);
 			print_opcode_output_table(g_table_file);
 			fprintf(g_table_file, "%s\n\n", table_footer_insert);
+			write_model_selector(g_table_file);
+
+			write_handler_array(g_handler_file);
+			write_fuse_table_builder(g_handler_file);
+			fprintf(g_handler_file, "%s\n\n", ophandler_footer_insert);
+
+			write_model_files(output_path);
 
 			fprintf(g_prototype_file, "%s\n\n", prototype_footer_insert);
 
@@ -1394,9 +1801,13 @@ int main(int argc, char **argv)
 	/* Close all files and exit */
 	fclose(g_prototype_file);
 	fclose(g_table_file);
+	fclose(g_handler_file);
 	fclose(g_input_file);
 
-	printf("Generated %d opcode handlers from %d primitives\n", g_num_functions, g_num_primitives);
+	printf("Generated %d opcode handlers from %d primitives for %d CPU models\n", g_num_functions, g_num_primitives, NUM_MODELS);
+	printf("Generated fused handlers for %d instruction pairs\n", g_fuse_table_length);
+	if(g_exec_total)
+		printf("Marked %d opcode handlers hot and %d cold from %s\n", g_num_hot, g_num_cold, g_exec_profile_filename);
 
 	return 0;
 }
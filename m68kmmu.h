@@ -129,6 +129,44 @@ void pmmu_set_buserror(m68ki_cpu_core *state, uint32 addr_in)
 		state->mmu_tmp_buserror_fc = state->mmu_tmp_fc;
 		state->mmu_tmp_buserror_sz = state->mmu_tmp_sz;
 	}
+
+	// taken by m68ki_exception_bus_error() once the instruction is done
+	g_buserr = 1;
+}
+
+// ATC slot for a page - the ATC is direct mapped, hashed on page and fc
+static inline int pmmu_atc_index(uint32 logical, int fc, int ps)
+{
+	uint32 page = logical >> ps;
+
+	return (page ^ (page >> 6) ^ (fc << 3)) & (MMU_ATC_ENTRIES - 1);
+}
+
+// pmmu_tlb_flush: drop every host side translation (m68ki_pmmu_translate), and pick up the page size
+void pmmu_tlb_flush(m68ki_cpu_core *state)
+{
+	int ps = (state->mmu_tc >> 20) & 0xf;
+
+	memset(state->mmu_tlb_tag, 0, sizeof(state->mmu_tlb_tag));
+	state->mmu_tlb_shift = ps >= 8 ? ps : 12;
+}
+
+// pmmu_tlb_add: remember a translation that did not fault, for the kind of access (rw) it was made for
+static void pmmu_tlb_add(m68ki_cpu_core *state, uint32 logical, uint32 physical, int fc, int rw)
+{
+	uint32 idx = M68K_MMU_TLB_INDEX(state, logical, fc);
+	uint32 tag = M68K_MMU_TLB_TAG(state, logical, fc);
+	uint32 phys = physical & (~0u << state->mmu_tlb_shift);
+	uint32 perm = rw ? M68K_MMU_TLB_READ : M68K_MMU_TLB_WRITE;
+
+	if ((state->mmu_tlb_tag[idx] & ~(M68K_MMU_TLB_READ|M68K_MMU_TLB_WRITE)) == tag && state->mmu_tlb_phys[idx] == phys)
+	{
+		state->mmu_tlb_tag[idx] |= perm;
+		return;
+	}
+
+	state->mmu_tlb_tag[idx] = tag | perm;
+	state->mmu_tlb_phys[idx] = phys;
 }
 
 
@@ -155,39 +193,8 @@ void pmmu_atc_add(m68ki_cpu_core *state, uint32 logical, uint32 physical, int fc
 		atc_data |= M68K_MMU_ATC_MODIFIED;
 	}
 
-	// first see if this is already in the cache
-	for (int i = 0; i < MMU_ATC_ENTRIES; i++)
-	{
-		// if tag bits and function code match, don't add
-		if (state->mmu_atc_tag[i] == atc_tag)
-		{
-			MMULOG(("%s: hit, old %08x new %08x\n", __func__, state->mmu_atc_data[i], atc_data));
-			state->mmu_atc_data[i] = atc_data;
-			return;
-		}
-	}
-
-	// find an open entry
-	int found = -1;
-	for (int i = 0; i < MMU_ATC_ENTRIES; i++)
-	{
-		if (!(state->mmu_atc_tag[i] & M68K_MMU_ATC_VALID))
-		{
-			found = i;
-			break;
-		}
-	}
-
-	// did we find an entry?  steal one by round-robin then
-	if (found == -1)
-	{
-		found = state->mmu_atc_rr++;
-
-		if (state->mmu_atc_rr >= MMU_ATC_ENTRIES)
-		{
-			state->mmu_atc_rr = 0;
-		}
-	}
+	// the page has one slot, whatever is in it makes room
+	int found = pmmu_atc_index(logical, fc, ps);
 
 	// add the entry
 	MMULOG(("ATC[%2d] add: log %08x -> phys %08x (fc=%d) data=%08x\n",
@@ -205,6 +212,7 @@ void pmmu_atc_flush(m68ki_cpu_core *state)
 	for(int i=0;i<MMU_ATC_ENTRIES;i++)
 		state->mmu_atc_tag[i]=0;
 	state->mmu_atc_rr = 0;
+	pmmu_tlb_flush(state);
 }
 
 int fc_from_modes(m68ki_cpu_core *state, uint16 modes);
@@ -217,6 +225,9 @@ void pmmu_atc_flush_fc_ea(m68ki_cpu_core *state, uint16 modes)
 	unsigned int mode = (modes >> 10) & 7;
 	uint32 ea;
 
+	// the TLB is only a copy of the ATC, emptying it all is always right
+	pmmu_tlb_flush(state);
+
 	switch (mode)
 	{
 	case 1: // PFLUSHA
@@ -267,15 +278,10 @@ uint16 pmmu_atc_lookup(m68ki_cpu_core *state, uint32 addr_in, int fc, uint16 rw,
 	MMULOG(("%s: LOOKUP addr_in=%08x, fc=%d, ptest=%d, rw=%d\n", __func__, addr_in, fc, ptest,rw));
 	unsigned int ps = (state->mmu_tc >> 20) & 0xf;
 	uint32 atc_tag = M68K_MMU_ATC_VALID | ((fc & 7) << 24) | ((addr_in >> ps) << (ps - 8));
+	int i = pmmu_atc_index(addr_in, fc, ps);
 
-	for (int i = 0; i < MMU_ATC_ENTRIES; i++)
+	if (state->mmu_atc_tag[i] == atc_tag)
 	{
-
-		if (state->mmu_atc_tag[i] != atc_tag)
-		{
-			continue;
-		}
-		
 		uint32 atc_data = state->mmu_atc_data[i];
 
 		if (!ptest && !rw)
@@ -288,7 +294,7 @@ uint16 pmmu_atc_lookup(m68ki_cpu_core *state, uint32 addr_in, int fc, uint16 rw,
 			if (!(atc_data & M68K_MMU_ATC_MODIFIED))
 			{
 				state->mmu_atc_tag[i] = 0;
-				continue;
+				return 0;
 			}
 		}
 
@@ -897,8 +903,15 @@ uint32 pmmu_translate_addr(m68ki_cpu_core *state, uint32 addr_in, uint16 rw)
 	}
 	else
 	{
+		uint16 faults = state->mmu_tmp_buserror_occurred;
+
 		addr_out = pmmu_translate_addr_with_fc(state, addr_in, state->mmu_tmp_fc, rw, 7, 0, 0);
 		MMULOG(("ADDRIN %08X, ADDROUT %08X\n", addr_in, addr_out));
+
+		if (state->mmu_tmp_buserror_occurred == faults && state->mmu_tmp_fc != 7)
+		{
+			pmmu_tlb_add(state, addr_in, addr_out, state->mmu_tmp_fc, rw);
+		}
 	}
 	return addr_out;
 }
@@ -1196,6 +1209,8 @@ void m68851_pmove(m68ki_cpu_core *state, uint32 ea, uint16 modes)
 		else    // top 3 bits of modes: 010 for this, 011 for status, 000 for transparent translation regs
 		{
 			m68851_pmove_put(state, ea, modes);
+			// FD only spares the ATC - the TLB copies TC's page size and TT0/TT1, so it always goes
+			pmmu_tlb_flush(state);
 			break;
 		}
 	case 3: // MC68030 to/from status reg
@@ -0,0 +1,30 @@
+#ifndef M68KOPS__HEADER
+#define M68KOPS__HEADER
+
+/* ======================================================================== */
+/* ============================ OPCODE HANDLERS =========================== */
+/* ======================================================================== */
+
+
+/* Build the opcode handler table */
+void m68ki_build_opcode_table(void);
+
+/* Fill the jump table with the handlers compiled for a CPU_TYPE_* */
+void m68ki_select_opcode_handlers(unsigned int cpu_type);
+
+/* Install the fused pair handlers generated from the fusion profile */
+int m68ki_fuse_opcode_table(void);
+
+struct m68ki_cpu_core;
+
+extern void (*m68ki_instruction_jump_table[0x10000])(struct m68ki_cpu_core *state); /* opcode handler jump table */
+extern unsigned char m68ki_cycles[][0x10000];
+
+
+/* ======================================================================== */
+/* ============================== END OF FILE ============================= */
+/* ======================================================================== */
+
+#endif /* M68KOPS__HEADER */
+
+
@@ -0,0 +1,6 @@
+/* opcode handlers for CPU_TYPE_000 - generated by m68kmake */
+
+#define M68KI_MODEL_CPU_TYPE CPU_TYPE_000
+#define M68KI_MODEL_NAME(name) name##_000
+
+#include "m68kops_handlers.h"
@@ -0,0 +1,6 @@
+/* opcode handlers for CPU_TYPE_010 - generated by m68kmake */
+
+#define M68KI_MODEL_CPU_TYPE CPU_TYPE_010
+#define M68KI_MODEL_NAME(name) name##_010
+
+#include "m68kops_handlers.h"
@@ -0,0 +1,6 @@
+/* opcode handlers for CPU_TYPE_EC030 | CPU_TYPE_030 - generated by m68kmake */
+
+#define M68KI_MODEL_CPU_TYPE CPU_TYPE_030
+#define M68KI_MODEL_NAME(name) name##_030
+
+#include "m68kops_handlers.h"
@@ -0,0 +1,6 @@
+/* opcode handlers for CPU_TYPE_EC040 | CPU_TYPE_LC040 | CPU_TYPE_040 - generated by m68kmake */
+
+#define M68KI_MODEL_CPU_TYPE CPU_TYPE_040
+#define M68KI_MODEL_NAME(name) name##_040
+
+#include "m68kops_handlers.h"
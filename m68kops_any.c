@@ -0,0 +1,5 @@
+/* opcode handlers for any other CPU model - generated by m68kmake */
+
+#define M68KI_MODEL_NAME(name) name##_any
+
+#include "m68kops_handlers.h"
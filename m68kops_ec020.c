@@ -0,0 +1,6 @@
+/* opcode handlers for CPU_TYPE_EC020 - generated by m68kmake */
+
+#define M68KI_MODEL_CPU_TYPE CPU_TYPE_EC020
+#define M68KI_MODEL_NAME(name) name##_ec020
+
+#include "m68kops_handlers.h"
@@ -0,0 +1,37837 @@
+#include <stdio.h>
+#include "m68kcpu.h"
+extern void m68040_fpu_op0(m68ki_cpu_core *state);
+extern void m68040_fpu_op1(m68ki_cpu_core *state);
+extern void m68851_mmu_ops(m68ki_cpu_core *state);
+extern void m68881_ftrap(m68ki_cpu_core *state);
+
+/* ======================================================================== */
+/* ========================= INSTRUCTION HANDLERS ========================= */
+/* ======================================================================== */
+
+
+static void m68k_op_1010(m68ki_cpu_core *state)
+{
+	m68ki_exception_1010(state);
+}
+
+
+static void m68k_op_1111(m68ki_cpu_core *state)
+{
+	m68ki_exception_1111(state);
+}
+
+
+static void m68k_op_040fpu0_32(m68ki_cpu_core *state)
+{
+//	printf("FPU 040fpu0 HAS_FPU=%d\n",!!HAS_FPU);
+	if(HAS_FPU)
+	{
+		m68040_fpu_op0(state);
+		return;
+	}
+	m68ki_exception_1111(state);
+}
+
+
+static void m68k_op_040fpu1_32(m68ki_cpu_core *state)
+{
+//	printf("FPU 040fpu1 HAS_FPU=%d\n",!!HAS_FPU);
+	if(HAS_FPU)
+	{
+		m68040_fpu_op1(state);
+		return;
+	}
+	m68ki_exception_1111(state);
+}
+
+
+static void m68k_op_abcd_8_rr(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = DY;
+	uint dst = *r_dst;
+	uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
+	uint corf = 0;
+
+	if(res > 9)
+		corf = 6;
+	res += HIGH_NIBBLE(src) + HIGH_NIBBLE(dst);
+	FLAG_V = ~res; /* Undefined V behavior */
+	res += corf;
+	FLAG_X = FLAG_C = (res > 0x9f) << 8;
+	if(FLAG_C)
+		res -= 0xa0;
+
+	FLAG_V &= res; /* Undefined V behavior part II */
+	FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+}
+
+
+static void m68k_op_abcd_8_mm_ax7(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_8(state);
+	uint ea  = EA_A7_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
+	uint corf = 0;
+
+	if(res > 9)
+		corf = 6;
+	res += HIGH_NIBBLE(src) + HIGH_NIBBLE(dst);
+	FLAG_V = ~res; /* Undefined V behavior */
+	res += corf;
+	FLAG_X = FLAG_C = (res > 0x9f) << 8;
+	if(FLAG_C)
+		res -= 0xa0;
+
+	FLAG_V &= res; /* Undefined V behavior part II */
+	FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_abcd_8_mm_ay7(m68ki_cpu_core *state)
+{
+	uint src = OPER_A7_PD_8(state);
+	uint ea  = EA_AX_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
+	uint corf = 0;
+
+	if(res > 9)
+		corf = 6;
+	res += HIGH_NIBBLE(src) + HIGH_NIBBLE(dst);
+	FLAG_V = ~res; /* Undefined V behavior */
+	res += corf;
+	FLAG_X = FLAG_C = (res > 0x9f) << 8;
+	if(FLAG_C)
+		res -= 0xa0;
+
+	FLAG_V &= res; /* Undefined V behavior part II */
+	FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_abcd_8_mm_axy7(m68ki_cpu_core *state)
+{
+	uint src = OPER_A7_PD_8(state);
+	uint ea  = EA_A7_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
+	uint corf = 0;
+
+	if(res > 9)
+		corf = 6;
+	res += HIGH_NIBBLE(src) + HIGH_NIBBLE(dst);
+	FLAG_V = ~res; /* Undefined V behavior */
+	res += corf;
+	FLAG_X = FLAG_C = (res > 0x9f) << 8;
+	if(FLAG_C)
+		res -= 0xa0;
+
+	FLAG_V &= res; /* Undefined V behavior part II */
+	FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_abcd_8_mm(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_8(state);
+	uint ea  = EA_AX_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = LOW_NIBBLE(src) + LOW_NIBBLE(dst) + XFLAG_AS_1();
+	uint corf = 0;
+
+	if(res > 9)
+		corf = 6;
+	res += HIGH_NIBBLE(src) + HIGH_NIBBLE(dst);
+	FLAG_V = ~res; /* Undefined V behavior */
+	res  += corf;
+	FLAG_X = FLAG_C = (res > 0x9f) << 8;
+	if(FLAG_C)
+		res -= 0xa0;
+
+	FLAG_V &= res; /* Undefined V behavior part II */
+	FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_add_8_er_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = MASK_OUT_ABOVE_8(DY);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_8_er_ai(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_AI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_8_er_pi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_PI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_8_er_pi7(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_A7_PI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_8_er_pd(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_PD_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_8_er_pd7(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_A7_PD_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_8_er_di(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_DI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_8_er_ix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_IX_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_8_er_aw(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AW_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_8_er_al(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AL_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_8_er_pcdi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_PCDI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_8_er_pcix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_PCIX_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_8_er_i(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_I_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_16_er_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = MASK_OUT_ABOVE_16(DY);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_16_er_a(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = MASK_OUT_ABOVE_16(AY);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_16_er_ai(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_AI_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_16_er_pi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_PI_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_16_er_pd(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_PD_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_16_er_di(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_DI_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_16_er_ix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_IX_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_16_er_aw(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AW_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_16_er_al(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AL_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_16_er_pcdi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_PCDI_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_16_er_pcix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_PCIX_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_16_er_i(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_I_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_add_32_er_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = DY;
+	uint dst = *r_dst;
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_add_32_er_a(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = AY;
+	uint dst = *r_dst;
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_add_32_er_ai(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_AI_32(state);
+	uint dst = *r_dst;
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_add_32_er_pi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_PI_32(state);
+	uint dst = *r_dst;
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_add_32_er_pd(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_PD_32(state);
+	uint dst = *r_dst;
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_add_32_er_di(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_DI_32(state);
+	uint dst = *r_dst;
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_add_32_er_ix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_IX_32(state);
+	uint dst = *r_dst;
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_add_32_er_aw(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AW_32(state);
+	uint dst = *r_dst;
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_add_32_er_al(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AL_32(state);
+	uint dst = *r_dst;
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_add_32_er_pcdi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_PCDI_32(state);
+	uint dst = *r_dst;
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_add_32_er_pcix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_PCIX_32(state);
+	uint dst = *r_dst;
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_add_32_er_i(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_I_32(state);
+	uint dst = *r_dst;
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_add_8_re_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_8_re_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_8_re_pi7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PI_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_8_re_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_8_re_pd7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PD_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_8_re_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_8_re_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_8_re_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_8_re_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_16_re_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint src = MASK_OUT_ABOVE_16(DX);
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_16_re_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint src = MASK_OUT_ABOVE_16(DX);
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_16_re_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint src = MASK_OUT_ABOVE_16(DX);
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_16_re_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint src = MASK_OUT_ABOVE_16(DX);
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_16_re_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint src = MASK_OUT_ABOVE_16(DX);
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_16_re_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint src = MASK_OUT_ABOVE_16(DX);
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_16_re_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint src = MASK_OUT_ABOVE_16(DX);
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_32_re_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_32();
+	uint src = DX;
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_32_re_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_32();
+	uint src = DX;
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_32_re_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_32();
+	uint src = DX;
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_32_re_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_32();
+	uint src = DX;
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_32_re_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_32();
+	uint src = DX;
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_32_re_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_32();
+	uint src = DX;
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_add_32_re_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_32();
+	uint src = DX;
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_adda_16_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(DY));
+}
+
+
+static void m68k_op_adda_16_a(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + MAKE_INT_16(AY));
+}
+
+
+static void m68k_op_adda_16_ai(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_AY_AI_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_16_pi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_AY_PI_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_16_pd(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_AY_PD_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_16_di(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_AY_DI_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_16_ix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_AY_IX_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_16_aw(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_AW_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_16_al(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_AL_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_16_pcdi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_PCDI_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_16_pcix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_PCIX_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_16_i(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_I_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_32_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + DY);
+}
+
+
+static void m68k_op_adda_32_a(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + AY);
+}
+
+
+static void m68k_op_adda_32_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_AI_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_32_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PI_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_32_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_32_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_DI_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_32_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_IX_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_32_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_AW_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_32_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_AL_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_32_pcdi(m68ki_cpu_core *state)
+{
+	uint src = OPER_PCDI_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_32_pcix(m68ki_cpu_core *state)
+{
+	uint src = OPER_PCIX_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_adda_32_i(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + src);
+}
+
+
+static void m68k_op_addi_8_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint src = OPER_I_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_addi_8_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_AI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_8_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_PI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_8_pi7(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_A7_PI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_8_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_8_pd7(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_A7_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_8_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_DI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_8_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_IX_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_8_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AW_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_8_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AL_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_16_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint src = OPER_I_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_addi_16_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_AI_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_16_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_PI_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_16_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_PD_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_16_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_DI_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_16_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_IX_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_16_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AW_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_16_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AL_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_32_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint src = OPER_I_32(state);
+	uint dst = *r_dst;
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_addi_32_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_AI_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_32_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_PI_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_32_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_PD_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_32_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_DI_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_32_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_IX_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_32_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AW_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addi_32_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AL_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_8_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_addq_8_ai(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_AI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_8_pi(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_PI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_8_pi7(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_A7_PI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_8_pd(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_8_pd7(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_A7_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_8_di(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_DI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_8_ix(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_IX_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_8_aw(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AW_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_8_al(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AL_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_16_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_addq_16_a(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AY;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + (((REG_IR >> 9) - 1) & 7) + 1);
+}
+
+
+static void m68k_op_addq_16_ai(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_AI_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_16_pi(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_PI_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_16_pd(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_PD_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_16_di(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_DI_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_16_ix(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_IX_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_16_aw(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AW_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_16_al(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AL_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_32_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint dst = *r_dst;
+	uint res = src + dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_addq_32_a(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AY;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst + (((REG_IR >> 9) - 1) & 7) + 1);
+}
+
+
+static void m68k_op_addq_32_ai(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_AI_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_32_pi(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_PI_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_32_pd(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_PD_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_32_di(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_DI_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_32_ix(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_IX_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_32_aw(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AW_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addq_32_al(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AL_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst;
+
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_addx_8_rr(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = MASK_OUT_ABOVE_8(DY);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src + dst + XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+}
+
+
+static void m68k_op_addx_16_rr(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = MASK_OUT_ABOVE_16(DY);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src + dst + XFLAG_AS_1();
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+
+	res = MASK_OUT_ABOVE_16(res);
+	FLAG_Z |= res;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+}
+
+
+static void m68k_op_addx_32_rr(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = DY;
+	uint dst = *r_dst;
+	uint res = src + dst + XFLAG_AS_1();
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+
+	res = MASK_OUT_ABOVE_32(res);
+	FLAG_Z |= res;
+
+	*r_dst = res;
+}
+
+
+static void m68k_op_addx_8_mm_ax7(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_8(state);
+	uint ea  = EA_A7_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst + XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_addx_8_mm_ay7(m68ki_cpu_core *state)
+{
+	uint src = OPER_A7_PD_8(state);
+	uint ea  = EA_AX_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst + XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_addx_8_mm_axy7(m68ki_cpu_core *state)
+{
+	uint src = OPER_A7_PD_8(state);
+	uint ea  = EA_A7_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst + XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_addx_8_mm(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_8(state);
+	uint ea  = EA_AX_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = src + dst + XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_V = VFLAG_ADD_8(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_addx_16_mm(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_16(state);
+	uint ea  = EA_AX_PD_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = src + dst + XFLAG_AS_1();
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_V = VFLAG_ADD_16(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+
+	res = MASK_OUT_ABOVE_16(res);
+	FLAG_Z |= res;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_addx_32_mm(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_32(state);
+	uint ea  = EA_AX_PD_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = src + dst + XFLAG_AS_1();
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_ADD_32(src, dst, res);
+	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+
+	res = MASK_OUT_ABOVE_32(res);
+	FLAG_Z |= res;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_and_8_er_d(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (DY | 0xffffff00));
+
+	FLAG_N = NFLAG_8(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_8_er_ai(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_AI_8(state) | 0xffffff00));
+
+	FLAG_N = NFLAG_8(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_8_er_pi(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_PI_8(state) | 0xffffff00));
+
+	FLAG_N = NFLAG_8(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_8_er_pi7(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_A7_PI_8(state) | 0xffffff00));
+
+	FLAG_N = NFLAG_8(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_8_er_pd(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_PD_8(state) | 0xffffff00));
+
+	FLAG_N = NFLAG_8(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_8_er_pd7(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_A7_PD_8(state) | 0xffffff00));
+
+	FLAG_N = NFLAG_8(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_8_er_di(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_DI_8(state) | 0xffffff00));
+
+	FLAG_N = NFLAG_8(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_8_er_ix(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_IX_8(state) | 0xffffff00));
+
+	FLAG_N = NFLAG_8(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_8_er_aw(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AW_8(state) | 0xffffff00));
+
+	FLAG_N = NFLAG_8(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_8_er_al(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AL_8(state) | 0xffffff00));
+
+	FLAG_N = NFLAG_8(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_8_er_pcdi(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_PCDI_8(state) | 0xffffff00));
+
+	FLAG_N = NFLAG_8(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_8_er_pcix(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_PCIX_8(state) | 0xffffff00));
+
+	FLAG_N = NFLAG_8(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_8_er_i(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_I_8(state) | 0xffffff00));
+
+	FLAG_N = NFLAG_8(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_16_er_d(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (DY | 0xffff0000));
+
+	FLAG_N = NFLAG_16(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_16_er_ai(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_AI_16(state) | 0xffff0000));
+
+	FLAG_N = NFLAG_16(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_16_er_pi(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_PI_16(state) | 0xffff0000));
+
+	FLAG_N = NFLAG_16(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_16_er_pd(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_PD_16(state) | 0xffff0000));
+
+	FLAG_N = NFLAG_16(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_16_er_di(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_DI_16(state) | 0xffff0000));
+
+	FLAG_N = NFLAG_16(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_16_er_ix(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_IX_16(state) | 0xffff0000));
+
+	FLAG_N = NFLAG_16(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_16_er_aw(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AW_16(state) | 0xffff0000));
+
+	FLAG_N = NFLAG_16(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_16_er_al(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AL_16(state) | 0xffff0000));
+
+	FLAG_N = NFLAG_16(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_16_er_pcdi(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_PCDI_16(state) | 0xffff0000));
+
+	FLAG_N = NFLAG_16(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_16_er_pcix(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_PCIX_16(state) | 0xffff0000));
+
+	FLAG_N = NFLAG_16(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_16_er_i(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_I_16(state) | 0xffff0000));
+
+	FLAG_N = NFLAG_16(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_32_er_d(m68ki_cpu_core *state)
+{
+	FLAG_Z = DX &= DY;
+
+	FLAG_N = NFLAG_32(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_32_er_ai(m68ki_cpu_core *state)
+{
+	FLAG_Z = DX &= OPER_AY_AI_32(state);
+
+	FLAG_N = NFLAG_32(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_32_er_pi(m68ki_cpu_core *state)
+{
+	FLAG_Z = DX &= OPER_AY_PI_32(state);
+
+	FLAG_N = NFLAG_32(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_32_er_pd(m68ki_cpu_core *state)
+{
+	FLAG_Z = DX &= OPER_AY_PD_32(state);
+
+	FLAG_N = NFLAG_32(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_32_er_di(m68ki_cpu_core *state)
+{
+	FLAG_Z = DX &= OPER_AY_DI_32(state);
+
+	FLAG_N = NFLAG_32(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_32_er_ix(m68ki_cpu_core *state)
+{
+	FLAG_Z = DX &= OPER_AY_IX_32(state);
+
+	FLAG_N = NFLAG_32(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_32_er_aw(m68ki_cpu_core *state)
+{
+	FLAG_Z = DX &= OPER_AW_32(state);
+
+	FLAG_N = NFLAG_32(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_32_er_al(m68ki_cpu_core *state)
+{
+	FLAG_Z = DX &= OPER_AL_32(state);
+
+	FLAG_N = NFLAG_32(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_32_er_pcdi(m68ki_cpu_core *state)
+{
+	FLAG_Z = DX &= OPER_PCDI_32(state);
+
+	FLAG_N = NFLAG_32(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_32_er_pcix(m68ki_cpu_core *state)
+{
+	FLAG_Z = DX &= OPER_PCIX_32(state);
+
+	FLAG_N = NFLAG_32(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_32_er_i(m68ki_cpu_core *state)
+{
+	FLAG_Z = DX &= OPER_I_32(state);
+
+	FLAG_N = NFLAG_32(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_and_8_re_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_8();
+	uint res = DX & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_8_re_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_8();
+	uint res = DX & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_8_re_pi7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PI_8();
+	uint res = DX & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_8_re_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_8();
+	uint res = DX & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_8_re_pd7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PD_8();
+	uint res = DX & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_8_re_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_8();
+	uint res = DX & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_8_re_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_8();
+	uint res = DX & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_8_re_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_8();
+	uint res = DX & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_8_re_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_8();
+	uint res = DX & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_16_re_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint res = DX & m68ki_read_16(state, ea);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_16_re_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint res = DX & m68ki_read_16(state, ea);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_16_re_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint res = DX & m68ki_read_16(state, ea);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_16_re_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint res = DX & m68ki_read_16(state, ea);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_16_re_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint res = DX & m68ki_read_16(state, ea);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_16_re_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint res = DX & m68ki_read_16(state, ea);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_16_re_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint res = DX & m68ki_read_16(state, ea);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_and_32_re_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_32();
+	uint res = DX & m68ki_read_32(state, ea);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_and_32_re_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_32();
+	uint res = DX & m68ki_read_32(state, ea);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_and_32_re_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_32();
+	uint res = DX & m68ki_read_32(state, ea);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_and_32_re_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_32();
+	uint res = DX & m68ki_read_32(state, ea);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_and_32_re_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_32();
+	uint res = DX & m68ki_read_32(state, ea);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_and_32_re_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_32();
+	uint res = DX & m68ki_read_32(state, ea);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_and_32_re_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_32();
+	uint res = DX & m68ki_read_32(state, ea);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_andi_8_d(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_8(DY &= (OPER_I_8(state) | 0xffffff00));
+
+	FLAG_N = NFLAG_8(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_andi_8_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_AI_8();
+	uint res = src & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_andi_8_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_PI_8();
+	uint res = src & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_andi_8_pi7(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_A7_PI_8();
+	uint res = src & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_andi_8_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_PD_8();
+	uint res = src & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_andi_8_pd7(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_A7_PD_8();
+	uint res = src & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_andi_8_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_DI_8();
+	uint res = src & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_andi_8_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_IX_8();
+	uint res = src & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_andi_8_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AW_8();
+	uint res = src & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_andi_8_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AL_8();
+	uint res = src & m68ki_read_8(state, ea);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_andi_16_d(m68ki_cpu_core *state)
+{
+	FLAG_Z = MASK_OUT_ABOVE_16(DY &= (OPER_I_16(state) | 0xffff0000));
+
+	FLAG_N = NFLAG_16(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_andi_16_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_AI_16();
+	uint res = src & m68ki_read_16(state, ea);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_andi_16_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_PI_16();
+	uint res = src & m68ki_read_16(state, ea);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_andi_16_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_PD_16();
+	uint res = src & m68ki_read_16(state, ea);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_andi_16_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_DI_16();
+	uint res = src & m68ki_read_16(state, ea);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_andi_16_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_IX_16();
+	uint res = src & m68ki_read_16(state, ea);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_andi_16_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AW_16();
+	uint res = src & m68ki_read_16(state, ea);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_andi_16_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AL_16();
+	uint res = src & m68ki_read_16(state, ea);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_andi_32_d(m68ki_cpu_core *state)
+{
+	FLAG_Z = DY &= (OPER_I_32(state));
+
+	FLAG_N = NFLAG_32(FLAG_Z);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_andi_32_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_AI_32();
+	uint res = src & m68ki_read_32(state, ea);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_andi_32_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_PI_32();
+	uint res = src & m68ki_read_32(state, ea);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_andi_32_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_PD_32();
+	uint res = src & m68ki_read_32(state, ea);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_andi_32_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_DI_32();
+	uint res = src & m68ki_read_32(state, ea);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_andi_32_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_IX_32();
+	uint res = src & m68ki_read_32(state, ea);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_andi_32_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AW_32();
+	uint res = src & m68ki_read_32(state, ea);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_andi_32_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AL_32();
+	uint res = src & m68ki_read_32(state, ea);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_andi_16_toc(m68ki_cpu_core *state)
+{
+	m68ki_set_ccr(state, m68ki_get_ccr(state) & OPER_I_8(state));
+}
+
+
+static void m68k_op_andi_16_tos(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint src = OPER_I_16(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_set_sr(state, m68ki_get_sr() & src);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_asr_8_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src >> shift;
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	if(GET_MSB_8(src))
+		res |= m68ki_shift_8_table[shift];
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_X = FLAG_C = src << (9-shift);
+}
+
+
+static void m68k_op_asr_16_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src >> shift;
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	if(GET_MSB_16(src))
+		res |= m68ki_shift_16_table[shift];
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_X = FLAG_C = src << (9-shift);
+}
+
+
+static void m68k_op_asr_32_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = *r_dst;
+	uint res = src >> shift;
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	if(GET_MSB_32(src))
+		res |= m68ki_shift_32_table[shift];
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_X = FLAG_C = src << (9-shift);
+}
+
+
+static void m68k_op_asr_8_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = DX & 0x3f;
+	uint src = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src >> shift;
+
+	if(shift != 0)
+	{
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+		if(shift < 8)
+		{
+			if(GET_MSB_8(src))
+				res |= m68ki_shift_8_table[shift];
+
+			*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+			FLAG_X = FLAG_C = src << (9-shift);
+			FLAG_N = NFLAG_8(res);
+			FLAG_Z = res;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		if(GET_MSB_8(src))
+		{
+			*r_dst |= 0xff;
+			FLAG_C = CFLAG_SET;
+			FLAG_X = XFLAG_SET;
+			FLAG_N = NFLAG_SET;
+			FLAG_Z = ZFLAG_CLEAR;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		*r_dst &= 0xffffff00;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_X = XFLAG_CLEAR;
+		FLAG_N = NFLAG_CLEAR;
+		FLAG_Z = ZFLAG_SET;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_8(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_asr_16_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = DX & 0x3f;
+	uint src = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src >> shift;
+
+	if(shift != 0)
+	{
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+		if(shift < 16)
+		{
+			if(GET_MSB_16(src))
+				res |= m68ki_shift_16_table[shift];
+
+			*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+			FLAG_C = FLAG_X = (src >> (shift - 1))<<8;
+			FLAG_N = NFLAG_16(res);
+			FLAG_Z = res;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		if(GET_MSB_16(src))
+		{
+			*r_dst |= 0xffff;
+			FLAG_C = CFLAG_SET;
+			FLAG_X = XFLAG_SET;
+			FLAG_N = NFLAG_SET;
+			FLAG_Z = ZFLAG_CLEAR;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		*r_dst &= 0xffff0000;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_X = XFLAG_CLEAR;
+		FLAG_N = NFLAG_CLEAR;
+		FLAG_Z = ZFLAG_SET;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_16(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_asr_32_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = DX & 0x3f;
+	uint src = *r_dst;
+	uint res = src >> shift;
+
+	if(shift != 0)
+	{
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+		if(shift < 32)
+		{
+			if(GET_MSB_32(src))
+				res |= m68ki_shift_32_table[shift];
+
+			*r_dst = res;
+
+			FLAG_C = FLAG_X = (src >> (shift - 1))<<8;
+			FLAG_N = NFLAG_32(res);
+			FLAG_Z = res;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		if(GET_MSB_32(src))
+		{
+			*r_dst = 0xffffffff;
+			FLAG_C = CFLAG_SET;
+			FLAG_X = XFLAG_SET;
+			FLAG_N = NFLAG_SET;
+			FLAG_Z = ZFLAG_CLEAR;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		*r_dst = 0;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_X = XFLAG_CLEAR;
+		FLAG_N = NFLAG_CLEAR;
+		FLAG_Z = ZFLAG_SET;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_32(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_asr_16_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = src >> 1;
+
+	if(GET_MSB_16(src))
+		res |= 0x8000;
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = FLAG_X = src << 8;
+}
+
+
+static void m68k_op_asr_16_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = src >> 1;
+
+	if(GET_MSB_16(src))
+		res |= 0x8000;
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = FLAG_X = src << 8;
+}
+
+
+static void m68k_op_asr_16_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = src >> 1;
+
+	if(GET_MSB_16(src))
+		res |= 0x8000;
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = FLAG_X = src << 8;
+}
+
+
+static void m68k_op_asr_16_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = src >> 1;
+
+	if(GET_MSB_16(src))
+		res |= 0x8000;
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = FLAG_X = src << 8;
+}
+
+
+static void m68k_op_asr_16_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = src >> 1;
+
+	if(GET_MSB_16(src))
+		res |= 0x8000;
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = FLAG_X = src << 8;
+}
+
+
+static void m68k_op_asr_16_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = src >> 1;
+
+	if(GET_MSB_16(src))
+		res |= 0x8000;
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = FLAG_X = src << 8;
+}
+
+
+static void m68k_op_asr_16_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = src >> 1;
+
+	if(GET_MSB_16(src))
+		res |= 0x8000;
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = FLAG_X = src << 8;
+}
+
+
+static void m68k_op_asl_8_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = MASK_OUT_ABOVE_8(src << shift);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_X = FLAG_C = src << shift;
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	src &= m68ki_shift_8_table[shift + 1];
+	FLAG_V = (!(src == 0 || (src == m68ki_shift_8_table[shift + 1] && shift < 8)))<<7;
+}
+
+
+static void m68k_op_asl_16_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = MASK_OUT_ABOVE_16(src << shift);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> (8-shift);
+	src &= m68ki_shift_16_table[shift + 1];
+	FLAG_V = (!(src == 0 || src == m68ki_shift_16_table[shift + 1]))<<7;
+}
+
+
+static void m68k_op_asl_32_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = *r_dst;
+	uint res = MASK_OUT_ABOVE_32(src << shift);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> (24-shift);
+	src &= m68ki_shift_32_table[shift + 1];
+	FLAG_V = (!(src == 0 || src == m68ki_shift_32_table[shift + 1]))<<7;
+}
+
+
+static void m68k_op_asl_8_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = DX & 0x3f;
+	uint src = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = MASK_OUT_ABOVE_8(src << shift);
+
+	if(shift != 0)
+	{
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+		if(shift < 8)
+		{
+			*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+			FLAG_X = FLAG_C = src << shift;
+			FLAG_N = NFLAG_8(res);
+			FLAG_Z = res;
+			src &= m68ki_shift_8_table[shift + 1];
+			FLAG_V = (!(src == 0 || src == m68ki_shift_8_table[shift + 1]))<<7;
+			return;
+		}
+
+		*r_dst &= 0xffffff00;
+		FLAG_X = FLAG_C = ((shift == 8 ? src & 1 : 0))<<8;
+		FLAG_N = NFLAG_CLEAR;
+		FLAG_Z = ZFLAG_SET;
+		FLAG_V = (!(src == 0))<<7;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_8(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_asl_16_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = DX & 0x3f;
+	uint src = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = MASK_OUT_ABOVE_16(src << shift);
+
+	if(shift != 0)
+	{
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+		if(shift < 16)
+		{
+			*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+			FLAG_X = FLAG_C = (src << shift) >> 8;
+			FLAG_N = NFLAG_16(res);
+			FLAG_Z = res;
+			src &= m68ki_shift_16_table[shift + 1];
+			FLAG_V = (!(src == 0 || src == m68ki_shift_16_table[shift + 1]))<<7;
+			return;
+		}
+
+		*r_dst &= 0xffff0000;
+		FLAG_X = FLAG_C = ((shift == 16 ? src & 1 : 0))<<8;
+		FLAG_N = NFLAG_CLEAR;
+		FLAG_Z = ZFLAG_SET;
+		FLAG_V = (!(src == 0))<<7;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_16(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_asl_32_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = DX & 0x3f;
+	uint src = *r_dst;
+	uint res = MASK_OUT_ABOVE_32(src << shift);
+
+	if(shift != 0)
+	{
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+		if(shift < 32)
+		{
+			*r_dst = res;
+			FLAG_X = FLAG_C = (src >> (32 - shift)) << 8;
+			FLAG_N = NFLAG_32(res);
+			FLAG_Z = res;
+			src &= m68ki_shift_32_table[shift + 1];
+			FLAG_V = (!(src == 0 || src == m68ki_shift_32_table[shift + 1]))<<7;
+			return;
+		}
+
+		*r_dst = 0;
+		FLAG_X = FLAG_C = ((shift == 32 ? src & 1 : 0))<<8;
+		FLAG_N = NFLAG_CLEAR;
+		FLAG_Z = ZFLAG_SET;
+		FLAG_V = (!(src == 0))<<7;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_32(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_asl_16_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(src << 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> 7;
+	src &= 0xc000;
+	FLAG_V = (!(src == 0 || src == 0xc000))<<7;
+}
+
+
+static void m68k_op_asl_16_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(src << 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> 7;
+	src &= 0xc000;
+	FLAG_V = (!(src == 0 || src == 0xc000))<<7;
+}
+
+
+static void m68k_op_asl_16_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(src << 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> 7;
+	src &= 0xc000;
+	FLAG_V = (!(src == 0 || src == 0xc000))<<7;
+}
+
+
+static void m68k_op_asl_16_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(src << 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> 7;
+	src &= 0xc000;
+	FLAG_V = (!(src == 0 || src == 0xc000))<<7;
+}
+
+
+static void m68k_op_asl_16_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(src << 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> 7;
+	src &= 0xc000;
+	FLAG_V = (!(src == 0 || src == 0xc000))<<7;
+}
+
+
+static void m68k_op_asl_16_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(src << 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> 7;
+	src &= 0xc000;
+	FLAG_V = (!(src == 0 || src == 0xc000))<<7;
+}
+
+
+static void m68k_op_asl_16_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(src << 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> 7;
+	src &= 0xc000;
+	FLAG_V = (!(src == 0 || src == 0xc000))<<7;
+}
+
+
+static void m68k_op_bhi_8(m68ki_cpu_core *state)
+{
+	if(COND_HI())
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+		return;
+	}
+	USE_CYCLES(CYC_BCC_NOTAKE_B);
+}
+
+
+static void m68k_op_bls_8(m68ki_cpu_core *state)
+{
+	if(COND_LS())
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+		return;
+	}
+	USE_CYCLES(CYC_BCC_NOTAKE_B);
+}
+
+
+static void m68k_op_bcc_8(m68ki_cpu_core *state)
+{
+	if(COND_CC())
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+		return;
+	}
+	USE_CYCLES(CYC_BCC_NOTAKE_B);
+}
+
+
+static void m68k_op_bcs_8(m68ki_cpu_core *state)
+{
+	if(COND_CS())
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+		return;
+	}
+	USE_CYCLES(CYC_BCC_NOTAKE_B);
+}
+
+
+static void m68k_op_bne_8(m68ki_cpu_core *state)
+{
+	if(COND_NE())
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+		return;
+	}
+	USE_CYCLES(CYC_BCC_NOTAKE_B);
+}
+
+
+static void m68k_op_beq_8(m68ki_cpu_core *state)
+{
+	if(COND_EQ())
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+		return;
+	}
+	USE_CYCLES(CYC_BCC_NOTAKE_B);
+}
+
+
+static void m68k_op_bvc_8(m68ki_cpu_core *state)
+{
+	if(COND_VC())
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+		return;
+	}
+	USE_CYCLES(CYC_BCC_NOTAKE_B);
+}
+
+
+static void m68k_op_bvs_8(m68ki_cpu_core *state)
+{
+	if(COND_VS())
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+		return;
+	}
+	USE_CYCLES(CYC_BCC_NOTAKE_B);
+}
+
+
+static void m68k_op_bpl_8(m68ki_cpu_core *state)
+{
+	if(COND_PL())
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+		return;
+	}
+	USE_CYCLES(CYC_BCC_NOTAKE_B);
+}
+
+
+static void m68k_op_bmi_8(m68ki_cpu_core *state)
+{
+	if(COND_MI())
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+		return;
+	}
+	USE_CYCLES(CYC_BCC_NOTAKE_B);
+}
+
+
+static void m68k_op_bge_8(m68ki_cpu_core *state)
+{
+	if(COND_GE())
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+		return;
+	}
+	USE_CYCLES(CYC_BCC_NOTAKE_B);
+}
+
+
+static void m68k_op_blt_8(m68ki_cpu_core *state)
+{
+	if(COND_LT())
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+		return;
+	}
+	USE_CYCLES(CYC_BCC_NOTAKE_B);
+}
+
+
+static void m68k_op_bgt_8(m68ki_cpu_core *state)
+{
+	if(COND_GT())
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+		return;
+	}
+	USE_CYCLES(CYC_BCC_NOTAKE_B);
+}
+
+
+static void m68k_op_ble_8(m68ki_cpu_core *state)
+{
+	if(COND_LE())
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+		return;
+	}
+	USE_CYCLES(CYC_BCC_NOTAKE_B);
+}
+
+
+static void m68k_op_bhi_16(m68ki_cpu_core *state)
+{
+	if(COND_HI())
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_BCC_NOTAKE_W);
+}
+
+
+static void m68k_op_bls_16(m68ki_cpu_core *state)
+{
+	if(COND_LS())
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_BCC_NOTAKE_W);
+}
+
+
+static void m68k_op_bcc_16(m68ki_cpu_core *state)
+{
+	if(COND_CC())
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_BCC_NOTAKE_W);
+}
+
+
+static void m68k_op_bcs_16(m68ki_cpu_core *state)
+{
+	if(COND_CS())
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_BCC_NOTAKE_W);
+}
+
+
+static void m68k_op_bne_16(m68ki_cpu_core *state)
+{
+	if(COND_NE())
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_BCC_NOTAKE_W);
+}
+
+
+static void m68k_op_beq_16(m68ki_cpu_core *state)
+{
+	if(COND_EQ())
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_BCC_NOTAKE_W);
+}
+
+
+static void m68k_op_bvc_16(m68ki_cpu_core *state)
+{
+	if(COND_VC())
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_BCC_NOTAKE_W);
+}
+
+
+static void m68k_op_bvs_16(m68ki_cpu_core *state)
+{
+	if(COND_VS())
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_BCC_NOTAKE_W);
+}
+
+
+static void m68k_op_bpl_16(m68ki_cpu_core *state)
+{
+	if(COND_PL())
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_BCC_NOTAKE_W);
+}
+
+
+static void m68k_op_bmi_16(m68ki_cpu_core *state)
+{
+	if(COND_MI())
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_BCC_NOTAKE_W);
+}
+
+
+static void m68k_op_bge_16(m68ki_cpu_core *state)
+{
+	if(COND_GE())
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_BCC_NOTAKE_W);
+}
+
+
+static void m68k_op_blt_16(m68ki_cpu_core *state)
+{
+	if(COND_LT())
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_BCC_NOTAKE_W);
+}
+
+
+static void m68k_op_bgt_16(m68ki_cpu_core *state)
+{
+	if(COND_GT())
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_BCC_NOTAKE_W);
+}
+
+
+static void m68k_op_ble_16(m68ki_cpu_core *state)
+{
+	if(COND_LE())
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_BCC_NOTAKE_W);
+}
+
+
+static void m68k_op_bhi_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_HI())
+		{
+			uint offset = OPER_I_32(state);
+			REG_PC -= 4;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_32(state, offset);
+			return;
+		}
+		REG_PC += 4;
+		return;
+	}
+	else
+	{
+		if(COND_HI())
+		{
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+			return;
+		}
+		USE_CYCLES(CYC_BCC_NOTAKE_B);
+	}
+}
+
+
+static void m68k_op_bls_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_LS())
+		{
+			uint offset = OPER_I_32(state);
+			REG_PC -= 4;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_32(state, offset);
+			return;
+		}
+		REG_PC += 4;
+		return;
+	}
+	else
+	{
+		if(COND_LS())
+		{
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+			return;
+		}
+		USE_CYCLES(CYC_BCC_NOTAKE_B);
+	}
+}
+
+
+static void m68k_op_bcc_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_CC())
+		{
+			uint offset = OPER_I_32(state);
+			REG_PC -= 4;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_32(state, offset);
+			return;
+		}
+		REG_PC += 4;
+		return;
+	}
+	else
+	{
+		if(COND_CC())
+		{
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+			return;
+		}
+		USE_CYCLES(CYC_BCC_NOTAKE_B);
+	}
+}
+
+
+static void m68k_op_bcs_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_CS())
+		{
+			uint offset = OPER_I_32(state);
+			REG_PC -= 4;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_32(state, offset);
+			return;
+		}
+		REG_PC += 4;
+		return;
+	}
+	else
+	{
+		if(COND_CS())
+		{
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+			return;
+		}
+		USE_CYCLES(CYC_BCC_NOTAKE_B);
+	}
+}
+
+
+static void m68k_op_bne_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_NE())
+		{
+			uint offset = OPER_I_32(state);
+			REG_PC -= 4;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_32(state, offset);
+			return;
+		}
+		REG_PC += 4;
+		return;
+	}
+	else
+	{
+		if(COND_NE())
+		{
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+			return;
+		}
+		USE_CYCLES(CYC_BCC_NOTAKE_B);
+	}
+}
+
+
+static void m68k_op_beq_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_EQ())
+		{
+			uint offset = OPER_I_32(state);
+			REG_PC -= 4;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_32(state, offset);
+			return;
+		}
+		REG_PC += 4;
+		return;
+	}
+	else
+	{
+		if(COND_EQ())
+		{
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+			return;
+		}
+		USE_CYCLES(CYC_BCC_NOTAKE_B);
+	}
+}
+
+
+static void m68k_op_bvc_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_VC())
+		{
+			uint offset = OPER_I_32(state);
+			REG_PC -= 4;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_32(state, offset);
+			return;
+		}
+		REG_PC += 4;
+		return;
+	}
+	else
+	{
+		if(COND_VC())
+		{
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+			return;
+		}
+		USE_CYCLES(CYC_BCC_NOTAKE_B);
+	}
+}
+
+
+static void m68k_op_bvs_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_VS())
+		{
+			uint offset = OPER_I_32(state);
+			REG_PC -= 4;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_32(state, offset);
+			return;
+		}
+		REG_PC += 4;
+		return;
+	}
+	else
+	{
+		if(COND_VS())
+		{
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+			return;
+		}
+		USE_CYCLES(CYC_BCC_NOTAKE_B);
+	}
+}
+
+
+static void m68k_op_bpl_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_PL())
+		{
+			uint offset = OPER_I_32(state);
+			REG_PC -= 4;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_32(state, offset);
+			return;
+		}
+		REG_PC += 4;
+		return;
+	}
+	else
+	{
+		if(COND_PL())
+		{
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+			return;
+		}
+		USE_CYCLES(CYC_BCC_NOTAKE_B);
+	}
+}
+
+
+static void m68k_op_bmi_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_MI())
+		{
+			uint offset = OPER_I_32(state);
+			REG_PC -= 4;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_32(state, offset);
+			return;
+		}
+		REG_PC += 4;
+		return;
+	}
+	else
+	{
+		if(COND_MI())
+		{
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+			return;
+		}
+		USE_CYCLES(CYC_BCC_NOTAKE_B);
+	}
+}
+
+
+static void m68k_op_bge_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_GE())
+		{
+			uint offset = OPER_I_32(state);
+			REG_PC -= 4;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_32(state, offset);
+			return;
+		}
+		REG_PC += 4;
+		return;
+	}
+	else
+	{
+		if(COND_GE())
+		{
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+			return;
+		}
+		USE_CYCLES(CYC_BCC_NOTAKE_B);
+	}
+}
+
+
+static void m68k_op_blt_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_LT())
+		{
+			uint offset = OPER_I_32(state);
+			REG_PC -= 4;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_32(state, offset);
+			return;
+		}
+		REG_PC += 4;
+		return;
+	}
+	else
+	{
+		if(COND_LT())
+		{
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+			return;
+		}
+		USE_CYCLES(CYC_BCC_NOTAKE_B);
+	}
+}
+
+
+static void m68k_op_bgt_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_GT())
+		{
+			uint offset = OPER_I_32(state);
+			REG_PC -= 4;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_32(state, offset);
+			return;
+		}
+		REG_PC += 4;
+		return;
+	}
+	else
+	{
+		if(COND_GT())
+		{
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+			return;
+		}
+		USE_CYCLES(CYC_BCC_NOTAKE_B);
+	}
+}
+
+
+static void m68k_op_ble_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_LE())
+		{
+			uint offset = OPER_I_32(state);
+			REG_PC -= 4;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_32(state, offset);
+			return;
+		}
+		REG_PC += 4;
+		return;
+	}
+	else
+	{
+		if(COND_LE())
+		{
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+			return;
+		}
+		USE_CYCLES(CYC_BCC_NOTAKE_B);
+	}
+}
+
+
+static void m68k_op_bchg_32_r_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint mask = 1 << (DX & 0x1f);
+
+	FLAG_Z = *r_dst & mask;
+	*r_dst ^= mask;
+}
+
+
+static void m68k_op_bchg_8_r_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_r_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_r_pi7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_r_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_r_pd7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PD_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_r_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_r_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_r_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_r_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_32_s_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint mask = 1 << (OPER_I_8(state) & 0x1f);
+
+	FLAG_Z = *r_dst & mask;
+	*r_dst ^= mask;
+}
+
+
+static void m68k_op_bchg_8_s_ai(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_AI_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_s_pi(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_PI_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_s_pi7(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_A7_PI_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_s_pd(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_PD_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_s_pd7(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_A7_PD_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_s_di(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_DI_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_s_ix(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_IX_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_s_aw(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AW_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bchg_8_s_al(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AL_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src ^ mask);
+}
+
+
+static void m68k_op_bclr_32_r_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint mask = 1 << (DX & 0x1f);
+
+	FLAG_Z = *r_dst & mask;
+	*r_dst &= ~mask;
+}
+
+
+static void m68k_op_bclr_8_r_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_r_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_r_pi7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_r_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_r_pd7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PD_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_r_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_r_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_r_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_r_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_32_s_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint mask = 1 << (OPER_I_8(state) & 0x1f);
+
+	FLAG_Z = *r_dst & mask;
+	*r_dst &= ~mask;
+}
+
+
+static void m68k_op_bclr_8_s_ai(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_AI_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_s_pi(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_PI_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_s_pi7(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_A7_PI_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_s_pd(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_PD_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_s_pd7(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_A7_PD_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_s_di(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_DI_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_s_ix(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_IX_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_s_aw(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AW_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bclr_8_s_al(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AL_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src & ~mask);
+}
+
+
+static void m68k_op_bfchg_32_d(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint offset = (word2>>6)&31;
+		uint width = word2;
+		uint* data = &DY;
+		uint64 mask;
+
+
+		if(BIT_B(word2))
+			offset = REG_D[offset&7];
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		offset &= 31;
+		width = ((width-1) & 31) + 1;
+
+		mask = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask = ROR_32(mask, offset);
+
+		FLAG_N = NFLAG_32(*data<<offset);
+		FLAG_Z = *data & mask;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		*data ^= mask;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfchg_32_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_AI_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long ^ mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte ^ mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfchg_32_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_DI_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long ^ mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte ^ mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfchg_32_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_IX_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long ^ mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte ^ mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfchg_32_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AW_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long ^ mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte ^ mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfchg_32_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AL_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long ^ mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte ^ mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfclr_32_d(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint offset = (word2>>6)&31;
+		uint width = word2;
+		uint* data = &DY;
+		uint64 mask;
+
+
+		if(BIT_B(word2))
+			offset = REG_D[offset&7];
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+
+		offset &= 31;
+		width = ((width-1) & 31) + 1;
+
+
+		mask = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask = ROR_32(mask, offset);
+
+		FLAG_N = NFLAG_32(*data<<offset);
+		FLAG_Z = *data & mask;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		*data &= ~mask;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfclr_32_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_AI_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long & ~mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte & ~mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfclr_32_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_DI_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long & ~mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte & ~mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfclr_32_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_IX_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long & ~mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte & ~mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfclr_32_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AW_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long & ~mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte & ~mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfclr_32_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AL_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long & ~mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base) << (8-offset);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte & ~mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfexts_32_d(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint offset = (word2>>6)&31;
+		uint width = word2;
+		uint64 data = DY;
+
+
+		if(BIT_B(word2))
+			offset = REG_D[offset&7];
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		offset &= 31;
+		width = ((width-1) & 31) + 1;
+
+		data = ROL_32(data, offset);
+		FLAG_N = NFLAG_32(data);
+		data = MAKE_INT_32(data) >> (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2>>12)&7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfexts_32_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint data;
+		uint ea = EA_AY_AI_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2))  {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+		data = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+			(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+
+		data = MASK_OUT_ABOVE_32(data<<offset);
+
+		if((offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  = MAKE_INT_32(data) >> (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2 >> 12) & 7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfexts_32_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint data;
+		uint ea = EA_AY_DI_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2))  {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+		data = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+			(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+
+		data = MASK_OUT_ABOVE_32(data<<offset);
+
+		if((offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  = MAKE_INT_32(data) >> (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2 >> 12) & 7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfexts_32_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint data;
+		uint ea = EA_AY_IX_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2))  {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+		data = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+			(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+
+		data = MASK_OUT_ABOVE_32(data<<offset);
+
+		if((offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  = MAKE_INT_32(data) >> (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2 >> 12) & 7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfexts_32_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint data;
+		uint ea = EA_AW_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2))  {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+		data = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+			(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+
+		data = MASK_OUT_ABOVE_32(data<<offset);
+
+		if((offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  = MAKE_INT_32(data) >> (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2 >> 12) & 7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfexts_32_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint data;
+		uint ea = EA_AL_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2))  {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+		data = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+			(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+
+		data = MASK_OUT_ABOVE_32(data<<offset);
+
+		if((offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  = MAKE_INT_32(data) >> (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2 >> 12) & 7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfexts_32_pcdi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint data;
+		uint ea = EA_PCDI_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2))  {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+		data = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+			(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+
+		data = MASK_OUT_ABOVE_32(data<<offset);
+
+		if((offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  = MAKE_INT_32(data) >> (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2 >> 12) & 7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfexts_32_pcix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint data;
+		uint ea = EA_PCIX_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2))  {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+		data = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+			(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+
+		data = MASK_OUT_ABOVE_32(data<<offset);
+
+		if((offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  = MAKE_INT_32(data) >> (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2 >> 12) & 7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfextu_32_d(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint offset = (word2>>6)&31;
+		uint width = word2;
+		uint64 data = DY;
+
+
+		if(BIT_B(word2))
+			offset = REG_D[offset&7];
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		offset &= 31;
+		width = ((width-1) & 31) + 1;
+
+		data = ROL_32(data, offset);
+		FLAG_N = NFLAG_32(data);
+		data >>= 32 - width;
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2>>12)&7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfextu_32_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint data;
+		uint ea = EA_AY_AI_8();
+
+
+		if(BIT_B(word2))
+		offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2)) {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+	data = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+			(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		data = MASK_OUT_ABOVE_32(data<<offset);
+
+		if((offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  >>= (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2 >> 12) & 7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfextu_32_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint data;
+		uint ea = EA_AY_DI_8();
+
+
+		if(BIT_B(word2))
+		offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2)) {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+	data = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+			(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		data = MASK_OUT_ABOVE_32(data<<offset);
+
+		if((offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  >>= (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2 >> 12) & 7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfextu_32_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint data;
+		uint ea = EA_AY_IX_8();
+
+
+		if(BIT_B(word2))
+		offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2)) {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+	data = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+			(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		data = MASK_OUT_ABOVE_32(data<<offset);
+
+		if((offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  >>= (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2 >> 12) & 7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfextu_32_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint data;
+		uint ea = EA_AW_8();
+
+
+		if(BIT_B(word2))
+		offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2)) {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+	data = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+			(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		data = MASK_OUT_ABOVE_32(data<<offset);
+
+		if((offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  >>= (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2 >> 12) & 7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfextu_32_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint data;
+		uint ea = EA_AL_8();
+
+
+		if(BIT_B(word2))
+		offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2)) {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+	data = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+			(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		data = MASK_OUT_ABOVE_32(data<<offset);
+
+		if((offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  >>= (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2 >> 12) & 7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfextu_32_pcdi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint data;
+		uint ea = EA_PCDI_8();
+
+
+		if(BIT_B(word2))
+		offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2)) {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+	data = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+			(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		data = MASK_OUT_ABOVE_32(data<<offset);
+
+		if((offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  >>= (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2 >> 12) & 7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfextu_32_pcix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint data;
+		uint ea = EA_PCIX_8();
+
+
+		if(BIT_B(word2))
+		offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2)) {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+	data = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+			(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		data = MASK_OUT_ABOVE_32(data<<offset);
+
+		if((offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  >>= (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		REG_D[(word2 >> 12) & 7] = data;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfffo_32_d(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint offset = (word2>>6)&31;
+		uint width = word2;
+		uint64 data = DY;
+		uint bit;
+
+
+		if(BIT_B(word2))
+			offset = REG_D[offset&7];
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		offset &= 31;
+		width = ((width-1) & 31) + 1;
+
+		data = ROL_32(data, offset);
+		FLAG_N = NFLAG_32(data);
+		data >>= 32 - width;
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+			offset++;
+
+		REG_D[(word2>>12)&7] = offset;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfffo_32_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		sint local_offset;
+		uint width = word2;
+		uint data;
+		uint bit;
+		uint ea = EA_AY_AI_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		local_offset = offset % 8;
+		if(local_offset < 0)
+		{
+			local_offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		data = (offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		data = MASK_OUT_ABOVE_32(data<<local_offset);
+
+		if((local_offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << local_offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  >>= (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+			offset++;
+
+		REG_D[(word2>>12)&7] = offset;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfffo_32_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		sint local_offset;
+		uint width = word2;
+		uint data;
+		uint bit;
+		uint ea = EA_AY_DI_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		local_offset = offset % 8;
+		if(local_offset < 0)
+		{
+			local_offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		data = (offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		data = MASK_OUT_ABOVE_32(data<<local_offset);
+
+		if((local_offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << local_offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  >>= (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+			offset++;
+
+		REG_D[(word2>>12)&7] = offset;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfffo_32_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		sint local_offset;
+		uint width = word2;
+		uint data;
+		uint bit;
+		uint ea = EA_AY_IX_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		local_offset = offset % 8;
+		if(local_offset < 0)
+		{
+			local_offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		data = (offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		data = MASK_OUT_ABOVE_32(data<<local_offset);
+
+		if((local_offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << local_offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  >>= (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+			offset++;
+
+		REG_D[(word2>>12)&7] = offset;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfffo_32_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		sint local_offset;
+		uint width = word2;
+		uint data;
+		uint bit;
+		uint ea = EA_AW_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		local_offset = offset % 8;
+		if(local_offset < 0)
+		{
+			local_offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		data = (offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		data = MASK_OUT_ABOVE_32(data<<local_offset);
+
+		if((local_offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << local_offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  >>= (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+			offset++;
+
+		REG_D[(word2>>12)&7] = offset;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfffo_32_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		sint local_offset;
+		uint width = word2;
+		uint data;
+		uint bit;
+		uint ea = EA_AL_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		local_offset = offset % 8;
+		if(local_offset < 0)
+		{
+			local_offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		data = (offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		data = MASK_OUT_ABOVE_32(data<<local_offset);
+
+		if((local_offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << local_offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  >>= (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+			offset++;
+
+		REG_D[(word2>>12)&7] = offset;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfffo_32_pcdi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		sint local_offset;
+		uint width = word2;
+		uint data;
+		uint bit;
+		uint ea = EA_PCDI_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		local_offset = offset % 8;
+		if(local_offset < 0)
+		{
+			local_offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		data = (offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		data = MASK_OUT_ABOVE_32(data<<local_offset);
+
+		if((local_offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << local_offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  >>= (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+			offset++;
+
+		REG_D[(word2>>12)&7] = offset;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfffo_32_pcix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		sint local_offset;
+		uint width = word2;
+		uint data;
+		uint bit;
+		uint ea = EA_PCIX_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		local_offset = offset % 8;
+		if(local_offset < 0)
+		{
+			local_offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+		data = (offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		data = MASK_OUT_ABOVE_32(data<<local_offset);
+
+		if((local_offset+width) > 32)
+			data |= (m68ki_read_8(state, ea+4) << local_offset) >> 8;
+
+		FLAG_N = NFLAG_32(data);
+		data  >>= (32 - width);
+
+		FLAG_Z = data;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		for(bit = 1<<(width-1);bit && !(data & bit);bit>>= 1)
+			offset++;
+
+		REG_D[(word2>>12)&7] = offset;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfins_32_d(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint offset = (word2>>6)&31;
+		uint width = word2;
+		uint* data = &DY;
+		uint64 mask;
+		uint64 insert = REG_D[(word2>>12)&7];
+
+
+		if(BIT_B(word2))
+			offset = REG_D[offset&7];
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+
+		offset &= 31;
+		width = ((width-1) & 31) + 1;
+
+
+		mask = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask = ROR_32(mask, offset);
+
+		insert = MASK_OUT_ABOVE_32(insert << (32 - width));
+		FLAG_N = NFLAG_32(insert);
+		FLAG_Z = insert;
+		insert = ROR_32(insert, offset);
+
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		*data &= ~mask;
+		*data |= insert;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfins_32_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint insert_base = REG_D[(word2>>12)&7];
+		uint insert_long;
+		uint insert_byte;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_AI_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2)) {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		insert_base = MASK_OUT_ABOVE_32(insert_base << (32 - width));
+		FLAG_N = NFLAG_32(insert_base);
+		FLAG_Z = insert_base;
+		insert_long = insert_base >> offset;
+
+		data_long = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+				(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		if((width + offset) < 8) {
+			m68ki_write_8(state, ea, ((data_long & ~mask_long) | insert_long) >> 24);
+		} else if((width + offset) < 16) {
+			m68ki_write_16(state, ea, ((data_long & ~mask_long) | insert_long) >> 16);
+		} else {
+			m68ki_write_32(state, ea, (data_long & ~mask_long) | insert_long);
+		}
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			insert_byte = MASK_OUT_ABOVE_8(insert_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, (data_byte & ~mask_byte) | insert_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfins_32_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint insert_base = REG_D[(word2>>12)&7];
+		uint insert_long;
+		uint insert_byte;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_DI_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2)) {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		insert_base = MASK_OUT_ABOVE_32(insert_base << (32 - width));
+		FLAG_N = NFLAG_32(insert_base);
+		FLAG_Z = insert_base;
+		insert_long = insert_base >> offset;
+
+		data_long = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+				(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		if((width + offset) < 8) {
+			m68ki_write_8(state, ea, ((data_long & ~mask_long) | insert_long) >> 24);
+		} else if((width + offset) < 16) {
+			m68ki_write_16(state, ea, ((data_long & ~mask_long) | insert_long) >> 16);
+		} else {
+			m68ki_write_32(state, ea, (data_long & ~mask_long) | insert_long);
+		}
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			insert_byte = MASK_OUT_ABOVE_8(insert_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, (data_byte & ~mask_byte) | insert_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfins_32_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint insert_base = REG_D[(word2>>12)&7];
+		uint insert_long;
+		uint insert_byte;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_IX_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2)) {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		insert_base = MASK_OUT_ABOVE_32(insert_base << (32 - width));
+		FLAG_N = NFLAG_32(insert_base);
+		FLAG_Z = insert_base;
+		insert_long = insert_base >> offset;
+
+		data_long = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+				(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		if((width + offset) < 8) {
+			m68ki_write_8(state, ea, ((data_long & ~mask_long) | insert_long) >> 24);
+		} else if((width + offset) < 16) {
+			m68ki_write_16(state, ea, ((data_long & ~mask_long) | insert_long) >> 16);
+		} else {
+			m68ki_write_32(state, ea, (data_long & ~mask_long) | insert_long);
+		}
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			insert_byte = MASK_OUT_ABOVE_8(insert_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, (data_byte & ~mask_byte) | insert_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfins_32_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint insert_base = REG_D[(word2>>12)&7];
+		uint insert_long;
+		uint insert_byte;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AW_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2)) {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		insert_base = MASK_OUT_ABOVE_32(insert_base << (32 - width));
+		FLAG_N = NFLAG_32(insert_base);
+		FLAG_Z = insert_base;
+		insert_long = insert_base >> offset;
+
+		data_long = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+				(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		if((width + offset) < 8) {
+			m68ki_write_8(state, ea, ((data_long & ~mask_long) | insert_long) >> 24);
+		} else if((width + offset) < 16) {
+			m68ki_write_16(state, ea, ((data_long & ~mask_long) | insert_long) >> 16);
+		} else {
+			m68ki_write_32(state, ea, (data_long & ~mask_long) | insert_long);
+		}
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			insert_byte = MASK_OUT_ABOVE_8(insert_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, (data_byte & ~mask_byte) | insert_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfins_32_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint insert_base = REG_D[(word2>>12)&7];
+		uint insert_long;
+		uint insert_byte;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AL_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		if(BIT_B(word2)) {
+			/* Offset is signed so we have to use ugly math =( */
+			ea += offset / 8;
+			offset %= 8;
+			if(offset < 0)
+			{
+				offset += 8;
+				ea--;
+			}
+		}
+		width = ((width-1) & 31) + 1;
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		insert_base = MASK_OUT_ABOVE_32(insert_base << (32 - width));
+		FLAG_N = NFLAG_32(insert_base);
+		FLAG_Z = insert_base;
+		insert_long = insert_base >> offset;
+
+		data_long = (offset+width) < 8 ? (m68ki_read_8(state, ea) << 24) :
+				(offset+width) < 16 ? (m68ki_read_16(state, ea) << 16) : m68ki_read_32(state, ea);
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		if((width + offset) < 8) {
+			m68ki_write_8(state, ea, ((data_long & ~mask_long) | insert_long) >> 24);
+		} else if((width + offset) < 16) {
+			m68ki_write_16(state, ea, ((data_long & ~mask_long) | insert_long) >> 16);
+		} else {
+			m68ki_write_32(state, ea, (data_long & ~mask_long) | insert_long);
+		}
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			insert_byte = MASK_OUT_ABOVE_8(insert_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, (data_byte & ~mask_byte) | insert_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfset_32_d(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint offset = (word2>>6)&31;
+		uint width = word2;
+		uint* data = &DY;
+		uint64 mask;
+
+
+		if(BIT_B(word2))
+			offset = REG_D[offset&7];
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+
+		offset &= 31;
+		width = ((width-1) & 31) + 1;
+
+
+		mask = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask = ROR_32(mask, offset);
+
+		FLAG_N = NFLAG_32(*data<<offset);
+		FLAG_Z = *data & mask;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		*data |= mask;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfset_32_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_AI_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long | mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte | mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfset_32_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_DI_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long | mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte | mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfset_32_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_IX_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long | mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte | mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfset_32_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AW_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long | mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte | mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bfset_32_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AL_8();
+
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = NFLAG_32(data_long << offset);
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		m68ki_write_32(state, ea, data_long | mask_long);
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+			m68ki_write_8(state, ea+4, data_byte | mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bftst_32_d(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint offset = (word2>>6)&31;
+		uint width = word2;
+		uint* data = &DY;
+		uint64 mask;
+
+
+		if(BIT_B(word2))
+			offset = REG_D[offset&7];
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+
+		offset &= 31;
+		width = ((width-1) & 31) + 1;
+
+
+		mask = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask = ROR_32(mask, offset);
+
+		FLAG_N = NFLAG_32(*data<<offset);
+		FLAG_Z = *data & mask;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bftst_32_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_AI_8();
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bftst_32_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_DI_8();
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bftst_32_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AY_IX_8();
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bftst_32_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AW_8();
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bftst_32_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_AL_8();
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bftst_32_pcdi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_PCDI_8();
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bftst_32_pcix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint offset = (word2>>6)&31;
+		uint width = word2;
+		uint mask_base;
+		uint data_long;
+		uint mask_long;
+		uint data_byte = 0;
+		uint mask_byte = 0;
+		uint ea = EA_PCIX_8();
+
+		if(BIT_B(word2))
+			offset = MAKE_INT_32(REG_D[offset&7]);
+		if(BIT_5(word2))
+			width = REG_D[width&7];
+
+		/* Offset is signed so we have to use ugly math =( */
+		ea += offset / 8;
+		offset %= 8;
+		if(offset < 0)
+		{
+			offset += 8;
+			ea--;
+		}
+		width = ((width-1) & 31) + 1;
+
+
+		mask_base = MASK_OUT_ABOVE_32(0xffffffff << (32 - width));
+		mask_long = mask_base >> offset;
+
+		data_long = m68ki_read_32(state, ea);
+		FLAG_N = ((data_long & (0x80000000 >> offset))<<offset)>>24;
+		FLAG_Z = data_long & mask_long;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+
+		if((width + offset) > 32)
+		{
+			mask_byte = MASK_OUT_ABOVE_8(mask_base);
+			data_byte = m68ki_read_8(state, ea+4);
+			FLAG_Z |= (data_byte & mask_byte);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bkpt(m68ki_cpu_core *state)
+{
+// TODO: review this...
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		m68ki_bkpt_ack(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE) ? REG_IR & 7 : 0);	/* auto-disable (see m68kcpu.h) */
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_bra_8(m68ki_cpu_core *state)
+{
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+	m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+// TODO: review this...
+//	if(REG_PC == REG_PPC)
+//		USE_ALL_CYCLES();
+}
+
+
+static void m68k_op_bra_16(m68ki_cpu_core *state)
+{
+	uint offset = OPER_I_16(state);
+	REG_PC -= 2;
+	m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+	m68ki_branch_16(state, offset);
+// TODO: review this...
+//	if(REG_PC == REG_PPC)
+//		USE_ALL_CYCLES();
+}
+
+
+static void m68k_op_bra_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint offset = OPER_I_32(state);
+		REG_PC -= 4;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_32(state, offset);
+// TODO: review this...
+//		if(REG_PC == REG_PPC)
+//			USE_ALL_CYCLES();
+		return;
+	}
+	else
+	{
+// TODO: review this...
+		m68ki_exception_illegal(state);
+//		m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+//		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+//		if(REG_PC == REG_PPC)
+//			USE_ALL_CYCLES();
+	}
+}
+
+
+static void m68k_op_bset_32_r_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint mask = 1 << (DX & 0x1f);
+
+	FLAG_Z = *r_dst & mask;
+	*r_dst |= mask;
+}
+
+
+static void m68k_op_bset_8_r_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_r_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_r_pi7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_r_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_r_pd7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PD_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_r_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_r_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_r_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_r_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_8();
+	uint src = m68ki_read_8(state, ea);
+	uint mask = 1 << (DX & 7);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_32_s_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint mask = 1 << (OPER_I_8(state) & 0x1f);
+
+	FLAG_Z = *r_dst & mask;
+	*r_dst |= mask;
+}
+
+
+static void m68k_op_bset_8_s_ai(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_AI_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_s_pi(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_PI_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_s_pi7(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_A7_PI_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_s_pd(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_PD_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_s_pd7(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_A7_PD_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_s_di(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_DI_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_s_ix(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AY_IX_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_s_aw(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AW_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bset_8_s_al(m68ki_cpu_core *state)
+{
+	uint mask = 1 << (OPER_I_8(state) & 7);
+	uint ea = EA_AL_8();
+	uint src = m68ki_read_8(state, ea);
+
+	FLAG_Z = src & mask;
+	m68ki_write_8(state, ea, src | mask);
+}
+
+
+static void m68k_op_bsr_8(m68ki_cpu_core *state)
+{
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+	m68ki_push_32(state, REG_PC);
+	m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+}
+
+
+static void m68k_op_bsr_16(m68ki_cpu_core *state)
+{
+	uint offset = OPER_I_16(state);
+	m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+	m68ki_push_32(state, REG_PC);
+	REG_PC -= 2;
+	m68ki_branch_16(state, offset);
+}
+
+
+static void m68k_op_bsr_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint offset = OPER_I_32(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_push_32(state, REG_PC);
+		REG_PC -= 4;
+		m68ki_branch_32(state, offset);
+		return;
+	}
+	else
+	{
+// TODO: review this...
+		m68ki_exception_illegal(state);
+//		m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+//		m68ki_push_32(state, REG_PC);
+//		m68ki_branch_8(state, MASK_OUT_ABOVE_8(REG_IR));
+	}
+}
+
+
+static void m68k_op_btst_32_r_d(m68ki_cpu_core *state)
+{
+	FLAG_Z = DY & (1 << (DX & 0x1f));
+}
+
+
+static void m68k_op_btst_8_r_ai(m68ki_cpu_core *state)
+{
+	FLAG_Z = OPER_AY_AI_8(state) & (1 << (DX & 7));
+}
+
+
+static void m68k_op_btst_8_r_pi(m68ki_cpu_core *state)
+{
+	FLAG_Z = OPER_AY_PI_8(state) & (1 << (DX & 7));
+}
+
+
+static void m68k_op_btst_8_r_pi7(m68ki_cpu_core *state)
+{
+	FLAG_Z = OPER_A7_PI_8(state) & (1 << (DX & 7));
+}
+
+
+static void m68k_op_btst_8_r_pd(m68ki_cpu_core *state)
+{
+	FLAG_Z = OPER_AY_PD_8(state) & (1 << (DX & 7));
+}
+
+
+static void m68k_op_btst_8_r_pd7(m68ki_cpu_core *state)
+{
+	FLAG_Z = OPER_A7_PD_8(state) & (1 << (DX & 7));
+}
+
+
+static void m68k_op_btst_8_r_di(m68ki_cpu_core *state)
+{
+	FLAG_Z = OPER_AY_DI_8(state) & (1 << (DX & 7));
+}
+
+
+static void m68k_op_btst_8_r_ix(m68ki_cpu_core *state)
+{
+	FLAG_Z = OPER_AY_IX_8(state) & (1 << (DX & 7));
+}
+
+
+static void m68k_op_btst_8_r_aw(m68ki_cpu_core *state)
+{
+	FLAG_Z = OPER_AW_8(state) & (1 << (DX & 7));
+}
+
+
+static void m68k_op_btst_8_r_al(m68ki_cpu_core *state)
+{
+	FLAG_Z = OPER_AL_8(state) & (1 << (DX & 7));
+}
+
+
+static void m68k_op_btst_8_r_pcdi(m68ki_cpu_core *state)
+{
+	FLAG_Z = OPER_PCDI_8(state) & (1 << (DX & 7));
+}
+
+
+static void m68k_op_btst_8_r_pcix(m68ki_cpu_core *state)
+{
+	FLAG_Z = OPER_PCIX_8(state) & (1 << (DX & 7));
+}
+
+
+static void m68k_op_btst_8_r_i(m68ki_cpu_core *state)
+{
+	FLAG_Z = OPER_I_8(state) & (1 << (DX & 7));
+}
+
+
+static void m68k_op_btst_32_s_d(m68ki_cpu_core *state)
+{
+	FLAG_Z = DY & (1 << (OPER_I_8(state) & 0x1f));
+}
+
+
+static void m68k_op_btst_8_s_ai(m68ki_cpu_core *state)
+{
+	uint bit = OPER_I_8(state) & 7;
+
+	FLAG_Z = OPER_AY_AI_8(state) & (1 << bit);
+}
+
+
+static void m68k_op_btst_8_s_pi(m68ki_cpu_core *state)
+{
+	uint bit = OPER_I_8(state) & 7;
+
+	FLAG_Z = OPER_AY_PI_8(state) & (1 << bit);
+}
+
+
+static void m68k_op_btst_8_s_pi7(m68ki_cpu_core *state)
+{
+	uint bit = OPER_I_8(state) & 7;
+
+	FLAG_Z = OPER_A7_PI_8(state) & (1 << bit);
+}
+
+
+static void m68k_op_btst_8_s_pd(m68ki_cpu_core *state)
+{
+	uint bit = OPER_I_8(state) & 7;
+
+	FLAG_Z = OPER_AY_PD_8(state) & (1 << bit);
+}
+
+
+static void m68k_op_btst_8_s_pd7(m68ki_cpu_core *state)
+{
+	uint bit = OPER_I_8(state) & 7;
+
+	FLAG_Z = OPER_A7_PD_8(state) & (1 << bit);
+}
+
+
+static void m68k_op_btst_8_s_di(m68ki_cpu_core *state)
+{
+	uint bit = OPER_I_8(state) & 7;
+
+	FLAG_Z = OPER_AY_DI_8(state) & (1 << bit);
+}
+
+
+static void m68k_op_btst_8_s_ix(m68ki_cpu_core *state)
+{
+	uint bit = OPER_I_8(state) & 7;
+
+	FLAG_Z = OPER_AY_IX_8(state) & (1 << bit);
+}
+
+
+static void m68k_op_btst_8_s_aw(m68ki_cpu_core *state)
+{
+	uint bit = OPER_I_8(state) & 7;
+
+	FLAG_Z = OPER_AW_8(state) & (1 << bit);
+}
+
+
+static void m68k_op_btst_8_s_al(m68ki_cpu_core *state)
+{
+	uint bit = OPER_I_8(state) & 7;
+
+	FLAG_Z = OPER_AL_8(state) & (1 << bit);
+}
+
+
+static void m68k_op_btst_8_s_pcdi(m68ki_cpu_core *state)
+{
+	uint bit = OPER_I_8(state) & 7;
+
+	FLAG_Z = OPER_PCDI_8(state) & (1 << bit);
+}
+
+
+static void m68k_op_btst_8_s_pcix(m68ki_cpu_core *state)
+{
+	uint bit = OPER_I_8(state) & 7;
+
+	FLAG_Z = OPER_PCIX_8(state) & (1 << bit);
+}
+
+
+static void m68k_op_callm_32_ai(m68ki_cpu_core *state)
+{
+	/* note: watch out for pcrelative modes */
+	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+	{
+		uint ea = EA_AY_AI_32();
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		REG_PC += 2;
+(void)ea;	/* just to avoid an 'unused variable' warning */
+		M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+					 m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+					 m68ki_disassemble_quick(ADDRESS_68K(REG_PC - 2),CPU_TYPE)));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_callm_32_di(m68ki_cpu_core *state)
+{
+	/* note: watch out for pcrelative modes */
+	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+	{
+		uint ea = EA_AY_DI_32();
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		REG_PC += 2;
+(void)ea;	/* just to avoid an 'unused variable' warning */
+		M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+					 m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+					 m68ki_disassemble_quick(ADDRESS_68K(REG_PC - 2),CPU_TYPE)));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_callm_32_ix(m68ki_cpu_core *state)
+{
+	/* note: watch out for pcrelative modes */
+	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+	{
+		uint ea = EA_AY_IX_32();
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		REG_PC += 2;
+(void)ea;	/* just to avoid an 'unused variable' warning */
+		M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+					 m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+					 m68ki_disassemble_quick(ADDRESS_68K(REG_PC - 2),CPU_TYPE)));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_callm_32_aw(m68ki_cpu_core *state)
+{
+	/* note: watch out for pcrelative modes */
+	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+	{
+		uint ea = EA_AW_32();
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		REG_PC += 2;
+(void)ea;	/* just to avoid an 'unused variable' warning */
+		M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+					 m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+					 m68ki_disassemble_quick(ADDRESS_68K(REG_PC - 2),CPU_TYPE)));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_callm_32_al(m68ki_cpu_core *state)
+{
+	/* note: watch out for pcrelative modes */
+	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+	{
+		uint ea = EA_AL_32();
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		REG_PC += 2;
+(void)ea;	/* just to avoid an 'unused variable' warning */
+		M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+					 m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+					 m68ki_disassemble_quick(ADDRESS_68K(REG_PC - 2),CPU_TYPE)));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_callm_32_pcdi(m68ki_cpu_core *state)
+{
+	/* note: watch out for pcrelative modes */
+	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+	{
+		uint ea = EA_PCDI_32();
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		REG_PC += 2;
+(void)ea;	/* just to avoid an 'unused variable' warning */
+		M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+					 m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+					 m68ki_disassemble_quick(ADDRESS_68K(REG_PC - 2),CPU_TYPE)));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_callm_32_pcix(m68ki_cpu_core *state)
+{
+	/* note: watch out for pcrelative modes */
+	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+	{
+		uint ea = EA_PCIX_32();
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		REG_PC += 2;
+(void)ea;	/* just to avoid an 'unused variable' warning */
+		M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+					 m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+					 m68ki_disassemble_quick(ADDRESS_68K(REG_PC - 2),CPU_TYPE)));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_8_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_AI_8();
+		uint dest = m68ki_read_8(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = MASK_OUT_ABOVE_8(res);
+		FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+		FLAG_C = CFLAG_8(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_8(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_8_pi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_PI_8();
+		uint dest = m68ki_read_8(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = MASK_OUT_ABOVE_8(res);
+		FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+		FLAG_C = CFLAG_8(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_8(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_8_pi7(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_A7_PI_8();
+		uint dest = m68ki_read_8(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = MASK_OUT_ABOVE_8(res);
+		FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+		FLAG_C = CFLAG_8(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_8(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_8_pd(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_PD_8();
+		uint dest = m68ki_read_8(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = MASK_OUT_ABOVE_8(res);
+		FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+		FLAG_C = CFLAG_8(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_8(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_8_pd7(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_A7_PD_8();
+		uint dest = m68ki_read_8(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = MASK_OUT_ABOVE_8(res);
+		FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+		FLAG_C = CFLAG_8(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_8(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_8_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_DI_8();
+		uint dest = m68ki_read_8(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = MASK_OUT_ABOVE_8(res);
+		FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+		FLAG_C = CFLAG_8(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_8(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_8_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_IX_8();
+		uint dest = m68ki_read_8(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = MASK_OUT_ABOVE_8(res);
+		FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+		FLAG_C = CFLAG_8(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_8(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_8_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AW_8();
+		uint dest = m68ki_read_8(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = MASK_OUT_ABOVE_8(res);
+		FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+		FLAG_C = CFLAG_8(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_8(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_8_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AL_8();
+		uint dest = m68ki_read_8(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_8(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = MASK_OUT_ABOVE_8(res);
+		FLAG_V = VFLAG_SUB_8(*compare, dest, res);
+		FLAG_C = CFLAG_8(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_8(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_16_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_AI_16();
+		uint dest = m68ki_read_16(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_16(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = MASK_OUT_ABOVE_16(res);
+		FLAG_V = VFLAG_SUB_16(*compare, dest, res);
+		FLAG_C = CFLAG_16(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_16(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_16(state, ea, MASK_OUT_ABOVE_16(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_16_pi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_PI_16();
+		uint dest = m68ki_read_16(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_16(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = MASK_OUT_ABOVE_16(res);
+		FLAG_V = VFLAG_SUB_16(*compare, dest, res);
+		FLAG_C = CFLAG_16(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_16(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_16(state, ea, MASK_OUT_ABOVE_16(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_16_pd(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_PD_16();
+		uint dest = m68ki_read_16(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_16(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = MASK_OUT_ABOVE_16(res);
+		FLAG_V = VFLAG_SUB_16(*compare, dest, res);
+		FLAG_C = CFLAG_16(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_16(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_16(state, ea, MASK_OUT_ABOVE_16(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_16_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_DI_16();
+		uint dest = m68ki_read_16(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_16(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = MASK_OUT_ABOVE_16(res);
+		FLAG_V = VFLAG_SUB_16(*compare, dest, res);
+		FLAG_C = CFLAG_16(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_16(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_16(state, ea, MASK_OUT_ABOVE_16(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_16_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_IX_16();
+		uint dest = m68ki_read_16(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_16(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = MASK_OUT_ABOVE_16(res);
+		FLAG_V = VFLAG_SUB_16(*compare, dest, res);
+		FLAG_C = CFLAG_16(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_16(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_16(state, ea, MASK_OUT_ABOVE_16(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_16_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AW_16();
+		uint dest = m68ki_read_16(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_16(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = MASK_OUT_ABOVE_16(res);
+		FLAG_V = VFLAG_SUB_16(*compare, dest, res);
+		FLAG_C = CFLAG_16(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_16(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_16(state, ea, MASK_OUT_ABOVE_16(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_16_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AL_16();
+		uint dest = m68ki_read_16(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - MASK_OUT_ABOVE_16(*compare);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = MASK_OUT_ABOVE_16(res);
+		FLAG_V = VFLAG_SUB_16(*compare, dest, res);
+		FLAG_C = CFLAG_16(res);
+
+		if(COND_NE())
+			*compare = MASK_OUT_BELOW_16(*compare) | dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_16(state, ea, MASK_OUT_ABOVE_16(REG_D[(word2 >> 6) & 7]));
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_32_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_AI_32();
+		uint dest = m68ki_read_32(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - *compare;
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = MASK_OUT_ABOVE_32(res);
+		FLAG_V = VFLAG_SUB_32(*compare, dest, res);
+		FLAG_C = CFLAG_SUB_32(*compare, dest, res);
+
+		if(COND_NE())
+			*compare = dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_32(state, ea, REG_D[(word2 >> 6) & 7]);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_32_pi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_PI_32();
+		uint dest = m68ki_read_32(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - *compare;
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = MASK_OUT_ABOVE_32(res);
+		FLAG_V = VFLAG_SUB_32(*compare, dest, res);
+		FLAG_C = CFLAG_SUB_32(*compare, dest, res);
+
+		if(COND_NE())
+			*compare = dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_32(state, ea, REG_D[(word2 >> 6) & 7]);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_32_pd(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_PD_32();
+		uint dest = m68ki_read_32(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - *compare;
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = MASK_OUT_ABOVE_32(res);
+		FLAG_V = VFLAG_SUB_32(*compare, dest, res);
+		FLAG_C = CFLAG_SUB_32(*compare, dest, res);
+
+		if(COND_NE())
+			*compare = dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_32(state, ea, REG_D[(word2 >> 6) & 7]);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_32_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_DI_32();
+		uint dest = m68ki_read_32(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - *compare;
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = MASK_OUT_ABOVE_32(res);
+		FLAG_V = VFLAG_SUB_32(*compare, dest, res);
+		FLAG_C = CFLAG_SUB_32(*compare, dest, res);
+
+		if(COND_NE())
+			*compare = dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_32(state, ea, REG_D[(word2 >> 6) & 7]);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_32_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AY_IX_32();
+		uint dest = m68ki_read_32(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - *compare;
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = MASK_OUT_ABOVE_32(res);
+		FLAG_V = VFLAG_SUB_32(*compare, dest, res);
+		FLAG_C = CFLAG_SUB_32(*compare, dest, res);
+
+		if(COND_NE())
+			*compare = dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_32(state, ea, REG_D[(word2 >> 6) & 7]);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_32_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AW_32();
+		uint dest = m68ki_read_32(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - *compare;
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = MASK_OUT_ABOVE_32(res);
+		FLAG_V = VFLAG_SUB_32(*compare, dest, res);
+		FLAG_C = CFLAG_SUB_32(*compare, dest, res);
+
+		if(COND_NE())
+			*compare = dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_32(state, ea, REG_D[(word2 >> 6) & 7]);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas_32_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint ea = EA_AL_32();
+		uint dest = m68ki_read_32(state, ea);
+		uint* compare = &REG_D[word2 & 7];
+		uint res = dest - *compare;
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = MASK_OUT_ABOVE_32(res);
+		FLAG_V = VFLAG_SUB_32(*compare, dest, res);
+		FLAG_C = CFLAG_SUB_32(*compare, dest, res);
+
+		if(COND_NE())
+			*compare = dest;
+		else
+		{
+			USE_CYCLES(3);
+			m68ki_write_32(state, ea, REG_D[(word2 >> 6) & 7]);
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas2_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_32(state);
+		uint* compare1 = &REG_D[(word2 >> 16) & 7];
+		uint ea1 = REG_DA[(word2 >> 28) & 15];
+		uint dest1 = m68ki_read_16(state, ea1);
+		uint res1 = dest1 - MASK_OUT_ABOVE_16(*compare1);
+		uint* compare2 = &REG_D[word2 & 7];
+		uint ea2 = REG_DA[(word2 >> 12) & 15];
+		uint dest2 = m68ki_read_16(state, ea2);
+		uint res2;
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_16(res1);
+		FLAG_Z = MASK_OUT_ABOVE_16(res1);
+		FLAG_V = VFLAG_SUB_16(*compare1, dest1, res1);
+		FLAG_C = CFLAG_16(res1);
+
+		if(COND_EQ())
+		{
+			res2 = dest2 - MASK_OUT_ABOVE_16(*compare2);
+
+			FLAG_N = NFLAG_16(res2);
+			FLAG_Z = MASK_OUT_ABOVE_16(res2);
+			FLAG_V = VFLAG_SUB_16(*compare2, dest2, res2);
+			FLAG_C = CFLAG_16(res2);
+
+			if(COND_EQ())
+			{
+				USE_CYCLES(3);
+				m68ki_write_16(state, ea1, REG_D[(word2 >> 22) & 7]);
+				m68ki_write_16(state, ea2, REG_D[(word2 >> 6) & 7]);
+				return;
+			}
+		}
+		*compare1 = BIT_1F(word2) ? (uint)MAKE_INT_16(dest1) : MASK_OUT_BELOW_16(*compare1) | dest1;
+		*compare2 = BIT_F(word2) ? (uint)MAKE_INT_16(dest2) : MASK_OUT_BELOW_16(*compare2) | dest2;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cas2_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_32(state);
+		uint* compare1 = &REG_D[(word2 >> 16) & 7];
+		uint ea1 = REG_DA[(word2 >> 28) & 15];
+		uint dest1 = m68ki_read_32(state, ea1);
+		uint res1 = dest1 - *compare1;
+		uint* compare2 = &REG_D[word2 & 7];
+		uint ea2 = REG_DA[(word2 >> 12) & 15];
+		uint dest2 = m68ki_read_32(state, ea2);
+		uint res2;
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		FLAG_N = NFLAG_32(res1);
+		FLAG_Z = MASK_OUT_ABOVE_32(res1);
+		FLAG_V = VFLAG_SUB_32(*compare1, dest1, res1);
+		FLAG_C = CFLAG_SUB_32(*compare1, dest1, res1);
+
+		if(COND_EQ())
+		{
+			res2 = dest2 - *compare2;
+
+			FLAG_N = NFLAG_32(res2);
+			FLAG_Z = MASK_OUT_ABOVE_32(res2);
+			FLAG_V = VFLAG_SUB_32(*compare2, dest2, res2);
+			FLAG_C = CFLAG_SUB_32(*compare2, dest2, res2);
+
+			if(COND_EQ())
+			{
+				USE_CYCLES(3);
+				m68ki_write_32(state, ea1, REG_D[(word2 >> 22) & 7]);
+				m68ki_write_32(state, ea2, REG_D[(word2 >> 6) & 7]);
+				return;
+			}
+		}
+		*compare1 = dest1;
+		*compare2 = dest2;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk_16_d(m68ki_cpu_core *state)
+{
+	sint src = MAKE_INT_16(DX);
+	sint bound = MAKE_INT_16(DY);
+
+	FLAG_Z = ZFLAG_16(src); /* Undocumented */
+	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+	FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+	if(src >= 0 && src <= bound)
+	{
+		return;
+	}
+	FLAG_N = (src < 0)<<7;
+	m68ki_exception_trap(state, EXCEPTION_CHK);
+}
+
+
+static void m68k_op_chk_16_ai(m68ki_cpu_core *state)
+{
+	sint src = MAKE_INT_16(DX);
+	sint bound = MAKE_INT_16(OPER_AY_AI_16(state));
+
+	FLAG_Z = ZFLAG_16(src); /* Undocumented */
+	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+	FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+	if(src >= 0 && src <= bound)
+	{
+		return;
+	}
+	FLAG_N = (src < 0)<<7;
+	m68ki_exception_trap(state, EXCEPTION_CHK);
+}
+
+
+static void m68k_op_chk_16_pi(m68ki_cpu_core *state)
+{
+	sint src = MAKE_INT_16(DX);
+	sint bound = MAKE_INT_16(OPER_AY_PI_16(state));
+
+	FLAG_Z = ZFLAG_16(src); /* Undocumented */
+	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+	FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+	if(src >= 0 && src <= bound)
+	{
+		return;
+	}
+	FLAG_N = (src < 0)<<7;
+	m68ki_exception_trap(state, EXCEPTION_CHK);
+}
+
+
+static void m68k_op_chk_16_pd(m68ki_cpu_core *state)
+{
+	sint src = MAKE_INT_16(DX);
+	sint bound = MAKE_INT_16(OPER_AY_PD_16(state));
+
+	FLAG_Z = ZFLAG_16(src); /* Undocumented */
+	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+	FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+	if(src >= 0 && src <= bound)
+	{
+		return;
+	}
+	FLAG_N = (src < 0)<<7;
+	m68ki_exception_trap(state, EXCEPTION_CHK);
+}
+
+
+static void m68k_op_chk_16_di(m68ki_cpu_core *state)
+{
+	sint src = MAKE_INT_16(DX);
+	sint bound = MAKE_INT_16(OPER_AY_DI_16(state));
+
+	FLAG_Z = ZFLAG_16(src); /* Undocumented */
+	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+	FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+	if(src >= 0 && src <= bound)
+	{
+		return;
+	}
+	FLAG_N = (src < 0)<<7;
+	m68ki_exception_trap(state, EXCEPTION_CHK);
+}
+
+
+static void m68k_op_chk_16_ix(m68ki_cpu_core *state)
+{
+	sint src = MAKE_INT_16(DX);
+	sint bound = MAKE_INT_16(OPER_AY_IX_16(state));
+
+	FLAG_Z = ZFLAG_16(src); /* Undocumented */
+	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+	FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+	if(src >= 0 && src <= bound)
+	{
+		return;
+	}
+	FLAG_N = (src < 0)<<7;
+	m68ki_exception_trap(state, EXCEPTION_CHK);
+}
+
+
+static void m68k_op_chk_16_aw(m68ki_cpu_core *state)
+{
+	sint src = MAKE_INT_16(DX);
+	sint bound = MAKE_INT_16(OPER_AW_16(state));
+
+	FLAG_Z = ZFLAG_16(src); /* Undocumented */
+	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+	FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+	if(src >= 0 && src <= bound)
+	{
+		return;
+	}
+	FLAG_N = (src < 0)<<7;
+	m68ki_exception_trap(state, EXCEPTION_CHK);
+}
+
+
+static void m68k_op_chk_16_al(m68ki_cpu_core *state)
+{
+	sint src = MAKE_INT_16(DX);
+	sint bound = MAKE_INT_16(OPER_AL_16(state));
+
+	FLAG_Z = ZFLAG_16(src); /* Undocumented */
+	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+	FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+	if(src >= 0 && src <= bound)
+	{
+		return;
+	}
+	FLAG_N = (src < 0)<<7;
+	m68ki_exception_trap(state, EXCEPTION_CHK);
+}
+
+
+static void m68k_op_chk_16_pcdi(m68ki_cpu_core *state)
+{
+	sint src = MAKE_INT_16(DX);
+	sint bound = MAKE_INT_16(OPER_PCDI_16(state));
+
+	FLAG_Z = ZFLAG_16(src); /* Undocumented */
+	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+	FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+	if(src >= 0 && src <= bound)
+	{
+		return;
+	}
+	FLAG_N = (src < 0)<<7;
+	m68ki_exception_trap(state, EXCEPTION_CHK);
+}
+
+
+static void m68k_op_chk_16_pcix(m68ki_cpu_core *state)
+{
+	sint src = MAKE_INT_16(DX);
+	sint bound = MAKE_INT_16(OPER_PCIX_16(state));
+
+	FLAG_Z = ZFLAG_16(src); /* Undocumented */
+	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+	FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+	if(src >= 0 && src <= bound)
+	{
+		return;
+	}
+	FLAG_N = (src < 0)<<7;
+	m68ki_exception_trap(state, EXCEPTION_CHK);
+}
+
+
+static void m68k_op_chk_16_i(m68ki_cpu_core *state)
+{
+	sint src = MAKE_INT_16(DX);
+	sint bound = MAKE_INT_16(OPER_I_16(state));
+
+	FLAG_Z = ZFLAG_16(src); /* Undocumented */
+	FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+	FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+	if(src >= 0 && src <= bound)
+	{
+		return;
+	}
+	FLAG_N = (src < 0)<<7;
+	m68ki_exception_trap(state, EXCEPTION_CHK);
+}
+
+
+static void m68k_op_chk_32_d(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		sint src = MAKE_INT_32(DX);
+		sint bound = MAKE_INT_32(DY);
+
+		FLAG_Z = ZFLAG_32(src); /* Undocumented */
+		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+		FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+		if(src >= 0 && src <= bound)
+		{
+			return;
+		}
+		FLAG_N = (src < 0)<<7;
+		m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk_32_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		sint src = MAKE_INT_32(DX);
+		sint bound = MAKE_INT_32(OPER_AY_AI_32(state));
+
+		FLAG_Z = ZFLAG_32(src); /* Undocumented */
+		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+		FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+		if(src >= 0 && src <= bound)
+		{
+			return;
+		}
+		FLAG_N = (src < 0)<<7;
+		m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk_32_pi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		sint src = MAKE_INT_32(DX);
+		sint bound = MAKE_INT_32(OPER_AY_PI_32(state));
+
+		FLAG_Z = ZFLAG_32(src); /* Undocumented */
+		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+		FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+		if(src >= 0 && src <= bound)
+		{
+			return;
+		}
+		FLAG_N = (src < 0)<<7;
+		m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk_32_pd(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		sint src = MAKE_INT_32(DX);
+		sint bound = MAKE_INT_32(OPER_AY_PD_32(state));
+
+		FLAG_Z = ZFLAG_32(src); /* Undocumented */
+		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+		FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+		if(src >= 0 && src <= bound)
+		{
+			return;
+		}
+		FLAG_N = (src < 0)<<7;
+		m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk_32_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		sint src = MAKE_INT_32(DX);
+		sint bound = MAKE_INT_32(OPER_AY_DI_32(state));
+
+		FLAG_Z = ZFLAG_32(src); /* Undocumented */
+		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+		FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+		if(src >= 0 && src <= bound)
+		{
+			return;
+		}
+		FLAG_N = (src < 0)<<7;
+		m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk_32_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		sint src = MAKE_INT_32(DX);
+		sint bound = MAKE_INT_32(OPER_AY_IX_32(state));
+
+		FLAG_Z = ZFLAG_32(src); /* Undocumented */
+		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+		FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+		if(src >= 0 && src <= bound)
+		{
+			return;
+		}
+		FLAG_N = (src < 0)<<7;
+		m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk_32_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		sint src = MAKE_INT_32(DX);
+		sint bound = MAKE_INT_32(OPER_AW_32(state));
+
+		FLAG_Z = ZFLAG_32(src); /* Undocumented */
+		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+		FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+		if(src >= 0 && src <= bound)
+		{
+			return;
+		}
+		FLAG_N = (src < 0)<<7;
+		m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk_32_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		sint src = MAKE_INT_32(DX);
+		sint bound = MAKE_INT_32(OPER_AL_32(state));
+
+		FLAG_Z = ZFLAG_32(src); /* Undocumented */
+		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+		FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+		if(src >= 0 && src <= bound)
+		{
+			return;
+		}
+		FLAG_N = (src < 0)<<7;
+		m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk_32_pcdi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		sint src = MAKE_INT_32(DX);
+		sint bound = MAKE_INT_32(OPER_PCDI_32(state));
+
+		FLAG_Z = ZFLAG_32(src); /* Undocumented */
+		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+		FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+		if(src >= 0 && src <= bound)
+		{
+			return;
+		}
+		FLAG_N = (src < 0)<<7;
+		m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk_32_pcix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		sint src = MAKE_INT_32(DX);
+		sint bound = MAKE_INT_32(OPER_PCIX_32(state));
+
+		FLAG_Z = ZFLAG_32(src); /* Undocumented */
+		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+		FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+		if(src >= 0 && src <= bound)
+		{
+			return;
+		}
+		FLAG_N = (src < 0)<<7;
+		m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk_32_i(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		sint src = MAKE_INT_32(DX);
+		sint bound = MAKE_INT_32(OPER_I_32(state));
+
+		FLAG_Z = ZFLAG_32(src); /* Undocumented */
+		FLAG_V = VFLAG_CLEAR;   /* Undocumented */
+		FLAG_C = CFLAG_CLEAR;   /* Undocumented */
+
+		if(src >= 0 && src <= bound)
+		{
+			return;
+		}
+		FLAG_N = (src < 0)<<7;
+		m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_8_pcdi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint compare = REG_DA[(word2 >> 12) & 15];
+		if(!BIT_F(word2))
+			compare &= 0xff;
+
+		uint ea = EA_PCDI_8();
+		sint lower_bound = m68ki_read_pcrel_8(state, ea);
+		sint upper_bound = m68ki_read_pcrel_8(state, ea + 1);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x80) {
+			lower_bound = (int32)(int8)lower_bound;
+			upper_bound = (int32)(int8)upper_bound;
+
+			if(!BIT_F(word2))
+				compare = (int32)(int8)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+
+
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_8_pcix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint compare = REG_DA[(word2 >> 12) & 15];
+		if(!BIT_F(word2))
+			compare &= 0xff;
+
+		uint ea = EA_PCIX_8();
+		sint lower_bound = m68ki_read_pcrel_8(state, ea);
+		sint upper_bound = m68ki_read_pcrel_8(state, ea + 1);
+
+		if (lower_bound & 0x80) {
+			lower_bound = (int32)(int8)lower_bound;
+			upper_bound = (int32)(int8)upper_bound;
+
+			if(!BIT_F(word2))
+				compare = (int32)(int8)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_8_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint compare = REG_DA[(word2 >> 12) & 15];
+		if(!BIT_F(word2))
+			compare &= 0xff;
+
+		uint ea = EA_AY_AI_8();
+		sint lower_bound = (int8)m68ki_read_8(state, ea);
+		sint upper_bound = (int8)m68ki_read_8(state, ea + 1);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x80) {
+			lower_bound = (int32)(int8)lower_bound;
+			upper_bound = (int32)(int8)upper_bound;
+
+			if(!BIT_F(word2))
+				compare = (int32)(int8)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_8_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint compare = REG_DA[(word2 >> 12) & 15];
+		if(!BIT_F(word2))
+			compare &= 0xff;
+
+		uint ea = EA_AY_DI_8();
+		sint lower_bound = (int8)m68ki_read_8(state, ea);
+		sint upper_bound = (int8)m68ki_read_8(state, ea + 1);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x80) {
+			lower_bound = (int32)(int8)lower_bound;
+			upper_bound = (int32)(int8)upper_bound;
+
+			if(!BIT_F(word2))
+				compare = (int32)(int8)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_8_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint compare = REG_DA[(word2 >> 12) & 15];
+		if(!BIT_F(word2))
+			compare &= 0xff;
+
+		uint ea = EA_AY_IX_8();
+		sint lower_bound = (int8)m68ki_read_8(state, ea);
+		sint upper_bound = (int8)m68ki_read_8(state, ea + 1);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x80) {
+			lower_bound = (int32)(int8)lower_bound;
+			upper_bound = (int32)(int8)upper_bound;
+
+			if(!BIT_F(word2))
+				compare = (int32)(int8)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_8_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint compare = REG_DA[(word2 >> 12) & 15];
+		if(!BIT_F(word2))
+			compare &= 0xff;
+
+		uint ea = EA_AW_8();
+		sint lower_bound = (int8)m68ki_read_8(state, ea);
+		sint upper_bound = (int8)m68ki_read_8(state, ea + 1);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x80) {
+			lower_bound = (int32)(int8)lower_bound;
+			upper_bound = (int32)(int8)upper_bound;
+
+			if(!BIT_F(word2))
+				compare = (int32)(int8)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_8_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint compare = REG_DA[(word2 >> 12) & 15];
+		if(!BIT_F(word2))
+			compare &= 0xff;
+
+		uint ea = EA_AL_8();
+		sint lower_bound = (int8)m68ki_read_8(state, ea);
+		sint upper_bound = (int8)m68ki_read_8(state, ea + 1);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x80) {
+			lower_bound = (int32)(int8)lower_bound;
+			upper_bound = (int32)(int8)upper_bound;
+
+			if(!BIT_F(word2))
+				compare = (int32)(int8)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_16_pcdi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint compare = REG_DA[(word2 >> 12) & 15];
+		if(!BIT_F(word2))
+			compare &= 0xffff;
+
+		uint ea = EA_PCDI_16();
+		sint lower_bound = (int16)m68ki_read_pcrel_16(state, ea);
+		sint upper_bound = (int16)m68ki_read_pcrel_16(state, ea + 2);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x8000) {
+			lower_bound = (int32)(int16)lower_bound;
+			upper_bound = (int32)(int16)upper_bound;
+
+			if(!BIT_F(word2))
+				compare = (int32)(int16)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_16_pcix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint compare = REG_DA[(word2 >> 12) & 15];
+		if(!BIT_F(word2))
+			compare &= 0xffff;
+
+		uint ea = EA_PCIX_16();
+		sint lower_bound = (int16)m68ki_read_pcrel_16(state, ea);
+		sint upper_bound = (int16)m68ki_read_pcrel_16(state, ea + 2);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x8000) {
+			lower_bound = (int32)(int16)lower_bound;
+			upper_bound = (int32)(int16)upper_bound;
+
+			if(!BIT_F(word2))
+				compare = (int32)(int16)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_16_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint compare = REG_DA[(word2 >> 12) & 15];
+		if(!BIT_F(word2))
+			compare &= 0xffff;
+
+		uint ea = EA_AY_AI_16();
+		sint lower_bound = (int16)m68ki_read_16(state, ea);
+		sint upper_bound = (int16)m68ki_read_16(state, ea + 2);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x8000) {
+			lower_bound = (int32)(int16)lower_bound;
+			upper_bound = (int32)(int16)upper_bound;
+
+			if(!BIT_F(word2))
+				compare = (int32)(int16)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_16_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint compare = REG_DA[(word2 >> 12) & 15];
+		if(!BIT_F(word2))
+			compare &= 0xffff;
+
+		uint ea = EA_AY_DI_16();
+		sint lower_bound = (int16)m68ki_read_16(state, ea);
+		sint upper_bound = (int16)m68ki_read_16(state, ea + 2);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x8000) {
+			lower_bound = (int32)(int16)lower_bound;
+			upper_bound = (int32)(int16)upper_bound;
+
+			if(!BIT_F(word2))
+				compare = (int32)(int16)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_16_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint compare = REG_DA[(word2 >> 12) & 15];
+		if(!BIT_F(word2))
+			compare &= 0xffff;
+
+		uint ea = EA_AY_IX_16();
+		sint lower_bound = (int16)m68ki_read_16(state, ea);
+		sint upper_bound = (int16)m68ki_read_16(state, ea + 2);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x8000) {
+			lower_bound = (int32)(int16)lower_bound;
+			upper_bound = (int32)(int16)upper_bound;
+
+			if(!BIT_F(word2))
+				compare = (int32)(int16)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_16_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint compare = REG_DA[(word2 >> 12) & 15];
+		if(!BIT_F(word2))
+			compare &= 0xffff;
+
+		uint ea = EA_AW_16();
+		sint lower_bound = (int16)m68ki_read_16(state, ea);
+		sint upper_bound = (int16)m68ki_read_16(state, ea + 2);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x8000) {
+			lower_bound = (int32)(int16)lower_bound;
+			upper_bound = (int32)(int16)upper_bound;
+
+			if(!BIT_F(word2))
+				compare = (int32)(int16)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_16_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		sint compare = REG_DA[(word2 >> 12) & 15];
+		if(!BIT_F(word2))
+			compare &= 0xffff;
+
+		uint ea = EA_AL_16();
+		sint lower_bound = (int16)m68ki_read_16(state, ea);
+		sint upper_bound = (int16)m68ki_read_16(state, ea + 2);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x8000) {
+			lower_bound = (int32)(int16)lower_bound;
+			upper_bound = (int32)(int16)upper_bound;
+
+			if(!BIT_F(word2))
+				compare = (int32)(int16)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_32_pcdi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint32 word2 = OPER_I_16(state);
+		sint64 compare = REG_DA[(word2 >> 12) & 15];
+		uint32 ea = EA_PCDI_32();
+		sint64 lower_bound = m68ki_read_pcrel_32(state, ea);
+		sint64 upper_bound = m68ki_read_pcrel_32(state, ea + 4);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x80000000) {
+			lower_bound = (int64)(int32)lower_bound;
+			upper_bound = (int64)(int32)upper_bound;
+			compare = (int64)(int32)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_32_pcix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint32 word2 = OPER_I_16(state);
+		sint64 compare = REG_DA[(word2 >> 12) & 15];
+		uint32 ea = EA_PCIX_32();
+		sint64 lower_bound = m68ki_read_32(state, ea);
+		sint64 upper_bound = m68ki_read_32(state, ea + 4);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x80000000) {
+			lower_bound = (int64)(int32)lower_bound;
+			upper_bound = (int64)(int32)upper_bound;
+			compare = (int64)(int32)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_32_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint32 word2 = OPER_I_16(state);
+		sint64 compare = REG_DA[(word2 >> 12) & 15];
+		uint32 ea = EA_AY_AI_32();
+		sint64 lower_bound = m68ki_read_32(state, ea);
+		sint64 upper_bound = m68ki_read_32(state, ea + 4);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x80000000) {
+			lower_bound = (int64)(int32)lower_bound;
+			upper_bound = (int64)(int32)upper_bound;
+			compare = (int64)(int32)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_32_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint32 word2 = OPER_I_16(state);
+		sint64 compare = REG_DA[(word2 >> 12) & 15];
+		uint32 ea = EA_AY_DI_32();
+		sint64 lower_bound = m68ki_read_32(state, ea);
+		sint64 upper_bound = m68ki_read_32(state, ea + 4);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x80000000) {
+			lower_bound = (int64)(int32)lower_bound;
+			upper_bound = (int64)(int32)upper_bound;
+			compare = (int64)(int32)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_32_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint32 word2 = OPER_I_16(state);
+		sint64 compare = REG_DA[(word2 >> 12) & 15];
+		uint32 ea = EA_AY_IX_32();
+		sint64 lower_bound = m68ki_read_32(state, ea);
+		sint64 upper_bound = m68ki_read_32(state, ea + 4);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x80000000) {
+			lower_bound = (int64)(int32)lower_bound;
+			upper_bound = (int64)(int32)upper_bound;
+			compare = (int64)(int32)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_32_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint32 word2 = OPER_I_16(state);
+		sint64 compare = REG_DA[(word2 >> 12) & 15];
+		uint32 ea = EA_AW_32();
+		sint64 lower_bound = m68ki_read_32(state, ea);
+		sint64 upper_bound = m68ki_read_32(state, ea + 4);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x80000000) {
+			lower_bound = (int64)(int32)lower_bound;
+			upper_bound = (int64)(int32)upper_bound;
+			compare = (int64)(int32)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_chk2cmp2_32_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint32 word2 = OPER_I_16(state);
+		sint64 compare = REG_DA[(word2 >> 12) & 15];
+		uint32 ea = EA_AL_32();
+		sint64 lower_bound = m68ki_read_32(state, ea);
+		sint64 upper_bound = m68ki_read_32(state, ea + 4);
+
+		// for signed compare, the arithmetically smaller value is the lower bound
+		if (lower_bound & 0x80000000) {
+			lower_bound = (int64)(int32)lower_bound;
+			upper_bound = (int64)(int32)upper_bound;
+			compare = (int64)(int32)compare;
+		}
+
+		FLAG_C = (compare >= lower_bound && compare <= upper_bound) ? CFLAG_CLEAR : CFLAG_SET;
+		FLAG_Z = ((upper_bound == compare) || (lower_bound == compare)) ? 0 : 1;
+
+		if(COND_CS() && BIT_B(word2))
+				m68ki_exception_trap(state, EXCEPTION_CHK);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_clr_8_d(m68ki_cpu_core *state)
+{
+	DY &= 0xffffff00;
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_8_ai(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_AI_8();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_8(state, ea);   /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_8(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_8_pi(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_PI_8();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_8(state, ea);   /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_8(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_8_pi7(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_A7_PI_8();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_8(state, ea);   /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_8(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_8_pd(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_PD_8();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_8(state, ea);   /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_8(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_8_pd7(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_A7_PD_8();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_8(state, ea);   /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_8(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_8_di(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_DI_8();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_8(state, ea);   /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_8(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_8_ix(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_IX_8();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_8(state, ea);   /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_8(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_8_aw(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AW_8();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_8(state, ea);   /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_8(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_8_al(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AL_8();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_8(state, ea);   /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_8(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_16_d(m68ki_cpu_core *state)
+{
+	DY &= 0xffff0000;
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_16_ai(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_AI_16();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_16(state, ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_16(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_16_pi(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_PI_16();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_16(state, ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_16(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_16_pd(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_PD_16();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_16(state, ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_16(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_16_di(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_DI_16();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_16(state, ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_16(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_16_ix(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_IX_16();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_16(state, ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_16(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_16_aw(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AW_16();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_16(state, ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_16(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_16_al(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AL_16();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_16(state, ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_16(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_32_d(m68ki_cpu_core *state)
+{
+	DY = 0;
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_32_ai(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_AI_32();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_32(state, ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_32(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_32_pi(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_PI_32();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_32(state, ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_32(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_32_pd(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_PD_32();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_32(state, ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_32(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_32_di(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_DI_32();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_32(state, ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_32(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_32_ix(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AY_IX_32();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_32(state, ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_32(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_32_aw(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AW_32();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_32(state, ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_32(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_clr_32_al(m68ki_cpu_core *state)
+{
+	uint32 ea = EA_AL_32();
+
+	if(CPU_TYPE_IS_000(CPU_TYPE))
+		m68ki_read_32(state, ea);  /* the 68000 does a dummy read, the value is discarded */
+	m68ki_write_32(state, ea, 0);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_Z = ZFLAG_SET;
+}
+
+
+static void m68k_op_cmp_8_d(m68ki_cpu_core *state)
+{
+	uint src = MASK_OUT_ABOVE_8(DY);
+	uint dst = MASK_OUT_ABOVE_8(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmp_8_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_AI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmp_8_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmp_8_pi7(m68ki_cpu_core *state)
+{
+	uint src = OPER_A7_PI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmp_8_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_8(state);
+	uint dst = MASK_OUT_ABOVE_8(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmp_8_pd7(m68ki_cpu_core *state)
+{
+	uint src = OPER_A7_PD_8(state);
+	uint dst = MASK_OUT_ABOVE_8(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmp_8_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_DI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmp_8_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_IX_8(state);
+	uint dst = MASK_OUT_ABOVE_8(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmp_8_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_AW_8(state);
+	uint dst = MASK_OUT_ABOVE_8(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmp_8_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_AL_8(state);
+	uint dst = MASK_OUT_ABOVE_8(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmp_8_pcdi(m68ki_cpu_core *state)
+{
+	uint src = OPER_PCDI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmp_8_pcix(m68ki_cpu_core *state)
+{
+	uint src = OPER_PCIX_8(state);
+	uint dst = MASK_OUT_ABOVE_8(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmp_8_i(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint dst = MASK_OUT_ABOVE_8(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmp_16_d(m68ki_cpu_core *state)
+{
+	uint src = MASK_OUT_ABOVE_16(DY);
+	uint dst = MASK_OUT_ABOVE_16(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmp_16_a(m68ki_cpu_core *state)
+{
+	uint src = MASK_OUT_ABOVE_16(AY);
+	uint dst = MASK_OUT_ABOVE_16(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmp_16_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_AI_16(state);
+	uint dst = MASK_OUT_ABOVE_16(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmp_16_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PI_16(state);
+	uint dst = MASK_OUT_ABOVE_16(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmp_16_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_16(state);
+	uint dst = MASK_OUT_ABOVE_16(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmp_16_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_DI_16(state);
+	uint dst = MASK_OUT_ABOVE_16(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmp_16_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_IX_16(state);
+	uint dst = MASK_OUT_ABOVE_16(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmp_16_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_AW_16(state);
+	uint dst = MASK_OUT_ABOVE_16(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmp_16_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_AL_16(state);
+	uint dst = MASK_OUT_ABOVE_16(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmp_16_pcdi(m68ki_cpu_core *state)
+{
+	uint src = OPER_PCDI_16(state);
+	uint dst = MASK_OUT_ABOVE_16(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmp_16_pcix(m68ki_cpu_core *state)
+{
+	uint src = OPER_PCIX_16(state);
+	uint dst = MASK_OUT_ABOVE_16(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmp_16_i(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint dst = MASK_OUT_ABOVE_16(DX);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmp_32_d(m68ki_cpu_core *state)
+{
+	uint src = DY;
+	uint dst = DX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmp_32_a(m68ki_cpu_core *state)
+{
+	uint src = AY;
+	uint dst = DX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmp_32_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_AI_32(state);
+	uint dst = DX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmp_32_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PI_32(state);
+	uint dst = DX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmp_32_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_32(state);
+	uint dst = DX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmp_32_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_DI_32(state);
+	uint dst = DX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmp_32_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_IX_32(state);
+	uint dst = DX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmp_32_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_AW_32(state);
+	uint dst = DX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmp_32_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_AL_32(state);
+	uint dst = DX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmp_32_pcdi(m68ki_cpu_core *state)
+{
+	uint src = OPER_PCDI_32(state);
+	uint dst = DX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmp_32_pcix(m68ki_cpu_core *state)
+{
+	uint src = OPER_PCIX_32(state);
+	uint dst = DX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmp_32_i(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint dst = DX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_16_d(m68ki_cpu_core *state)
+{
+	uint src = MAKE_INT_16(DY);
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_16_a(m68ki_cpu_core *state)
+{
+	uint src = MAKE_INT_16(AY);
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_16_ai(m68ki_cpu_core *state)
+{
+	uint src = MAKE_INT_16(OPER_AY_AI_16(state));
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_16_pi(m68ki_cpu_core *state)
+{
+	uint src = MAKE_INT_16(OPER_AY_PI_16(state));
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_16_pd(m68ki_cpu_core *state)
+{
+	uint src = MAKE_INT_16(OPER_AY_PD_16(state));
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_16_di(m68ki_cpu_core *state)
+{
+	uint src = MAKE_INT_16(OPER_AY_DI_16(state));
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_16_ix(m68ki_cpu_core *state)
+{
+	uint src = MAKE_INT_16(OPER_AY_IX_16(state));
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_16_aw(m68ki_cpu_core *state)
+{
+	uint src = MAKE_INT_16(OPER_AW_16(state));
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_16_al(m68ki_cpu_core *state)
+{
+	uint src = MAKE_INT_16(OPER_AL_16(state));
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_16_pcdi(m68ki_cpu_core *state)
+{
+	uint src = MAKE_INT_16(OPER_PCDI_16(state));
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_16_pcix(m68ki_cpu_core *state)
+{
+	uint src = MAKE_INT_16(OPER_PCIX_16(state));
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_16_i(m68ki_cpu_core *state)
+{
+	uint src = MAKE_INT_16(OPER_I_16(state));
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_32_d(m68ki_cpu_core *state)
+{
+	uint src = DY;
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_32_a(m68ki_cpu_core *state)
+{
+	uint src = AY;
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_32_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_AI_32(state);
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_32_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PI_32(state);
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_32_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_32(state);
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_32_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_DI_32(state);
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_32_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_IX_32(state);
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_32_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_AW_32(state);
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_32_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_AL_32(state);
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_32_pcdi(m68ki_cpu_core *state)
+{
+	uint src = OPER_PCDI_32(state);
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_32_pcix(m68ki_cpu_core *state)
+{
+	uint src = OPER_PCIX_32(state);
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpa_32_i(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint dst = AX;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpi_8_d(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint dst = MASK_OUT_ABOVE_8(DY);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmpi_8_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint dst = OPER_AY_AI_8(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmpi_8_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint dst = OPER_AY_PI_8(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmpi_8_pi7(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint dst = OPER_A7_PI_8(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmpi_8_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint dst = OPER_AY_PD_8(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmpi_8_pd7(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint dst = OPER_A7_PD_8(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmpi_8_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint dst = OPER_AY_DI_8(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmpi_8_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint dst = OPER_AY_IX_8(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmpi_8_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint dst = OPER_AW_8(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmpi_8_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint dst = OPER_AL_8(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmpi_8_pcdi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint src = OPER_I_8(state);
+		uint dst = OPER_PCDI_8(state);
+		uint res = dst - src;
+
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = MASK_OUT_ABOVE_8(res);
+		FLAG_V = VFLAG_SUB_8(src, dst, res);
+		FLAG_C = CFLAG_8(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cmpi_8_pcix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint src = OPER_I_8(state);
+		uint dst = OPER_PCIX_8(state);
+		uint res = dst - src;
+
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = MASK_OUT_ABOVE_8(res);
+		FLAG_V = VFLAG_SUB_8(src, dst, res);
+		FLAG_C = CFLAG_8(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cmpi_16_d(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint dst = MASK_OUT_ABOVE_16(DY);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmpi_16_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint dst = OPER_AY_AI_16(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmpi_16_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint dst = OPER_AY_PI_16(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmpi_16_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint dst = OPER_AY_PD_16(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmpi_16_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint dst = OPER_AY_DI_16(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmpi_16_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint dst = OPER_AY_IX_16(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmpi_16_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint dst = OPER_AW_16(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmpi_16_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint dst = OPER_AL_16(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmpi_16_pcdi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint src = OPER_I_16(state);
+		uint dst = OPER_PCDI_16(state);
+		uint res = dst - src;
+
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = MASK_OUT_ABOVE_16(res);
+		FLAG_V = VFLAG_SUB_16(src, dst, res);
+		FLAG_C = CFLAG_16(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cmpi_16_pcix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint src = OPER_I_16(state);
+		uint dst = OPER_PCIX_16(state);
+		uint res = dst - src;
+
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = MASK_OUT_ABOVE_16(res);
+		FLAG_V = VFLAG_SUB_16(src, dst, res);
+		FLAG_C = CFLAG_16(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cmpi_32_d(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint dst = DY;
+	uint res = dst - src;
+
+	m68ki_cmpild_callback(src, REG_IR & 7);		   /* auto-disable (see m68kcpu.h) */
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpi_32_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint dst = OPER_AY_AI_32(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpi_32_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint dst = OPER_AY_PI_32(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpi_32_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint dst = OPER_AY_PD_32(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpi_32_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint dst = OPER_AY_DI_32(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpi_32_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint dst = OPER_AY_IX_32(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpi_32_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint dst = OPER_AW_32(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpi_32_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint dst = OPER_AL_32(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cmpi_32_pcdi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint src = OPER_I_32(state);
+		uint dst = OPER_PCDI_32(state);
+		uint res = dst - src;
+
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = MASK_OUT_ABOVE_32(res);
+		FLAG_V = VFLAG_SUB_32(src, dst, res);
+		FLAG_C = CFLAG_SUB_32(src, dst, res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cmpi_32_pcix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint src = OPER_I_32(state);
+		uint dst = OPER_PCIX_32(state);
+		uint res = dst - src;
+
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = MASK_OUT_ABOVE_32(res);
+		FLAG_V = VFLAG_SUB_32(src, dst, res);
+		FLAG_C = CFLAG_SUB_32(src, dst, res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_cmpm_8_ax7(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PI_8(state);
+	uint dst = OPER_A7_PI_8(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmpm_8_ay7(m68ki_cpu_core *state)
+{
+	uint src = OPER_A7_PI_8(state);
+	uint dst = OPER_AX_PI_8(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmpm_8_axy7(m68ki_cpu_core *state)
+{
+	uint src = OPER_A7_PI_8(state);
+	uint dst = OPER_A7_PI_8(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmpm_8(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PI_8(state);
+	uint dst = OPER_AX_PI_8(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_C = CFLAG_8(res);
+}
+
+
+static void m68k_op_cmpm_16(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PI_16(state);
+	uint dst = OPER_AX_PI_16(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_C = CFLAG_16(res);
+}
+
+
+static void m68k_op_cmpm_32(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PI_32(state);
+	uint dst = OPER_AX_PI_32(state);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_C = CFLAG_SUB_32(src, dst, res);
+}
+
+
+static void m68k_op_cpbcc_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+					 m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+					 m68ki_disassemble_quick(ADDRESS_68K(REG_PC - 2),CPU_TYPE)));
+		return;
+	}
+	m68ki_exception_1111(state);
+}
+
+
+static void m68k_op_cpdbcc_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+					 m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+					 m68ki_disassemble_quick(ADDRESS_68K(REG_PC - 2),CPU_TYPE)));
+		return;
+	}
+	m68ki_exception_1111(state);
+}
+
+
+static void m68k_op_cpgen_32(m68ki_cpu_core *state)
+{
+// TODO: what's the condition?
+//	if(HAS_FPU || HAS_PMMU)
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+					 m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+					 m68ki_disassemble_quick(ADDRESS_68K(REG_PC - 2),CPU_TYPE)));
+		return;
+	}
+	m68ki_exception_1111(state);
+}
+
+
+static void m68k_op_cpscc_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+					 m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+					 m68ki_disassemble_quick(ADDRESS_68K(REG_PC - 2),CPU_TYPE)));
+		return;
+	}
+	m68ki_exception_1111(state);
+}
+
+
+static void m68k_op_cptrapcc_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+					 m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+					 m68ki_disassemble_quick(ADDRESS_68K(REG_PC - 2),CPU_TYPE)));
+        // JFF: unsupported, but at least if the trap doesn't occur, app should still work, so at least PC increase is correct
+        REG_PC += 4;
+		return;
+	}
+	m68ki_exception_1111(state);
+}
+
+
+static void m68k_op_ftrapcc_32(m68ki_cpu_core *state)
+{
+	if(HAS_FPU)
+	{
+		m68881_ftrap(state);
+	} else {
+		m68ki_exception_1111(state);
+	}
+}
+
+
+static void m68k_op_dbt_16(m68ki_cpu_core *state)
+{
+	REG_PC += 2;
+}
+
+
+static void m68k_op_dbf_16(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+	if(res != 0xffff)
+	{
+		uint offset = OPER_I_16(state);
+		REG_PC -= 2;
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_branch_16(state, offset);
+		USE_CYCLES(CYC_DBCC_F_NOEXP);
+		return;
+	}
+	REG_PC += 2;
+	USE_CYCLES(CYC_DBCC_F_EXP);
+}
+
+
+static void m68k_op_dbhi_16(m68ki_cpu_core *state)
+{
+	if(COND_NOT_HI())
+	{
+		uint* r_dst = &DY;
+		uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		if(res != 0xffff)
+		{
+			uint offset = OPER_I_16(state);
+			REG_PC -= 2;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_16(state, offset);
+			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			return;
+		}
+		REG_PC += 2;
+		USE_CYCLES(CYC_DBCC_F_EXP);
+		return;
+	}
+	REG_PC += 2;
+}
+
+
+static void m68k_op_dbls_16(m68ki_cpu_core *state)
+{
+	if(COND_NOT_LS())
+	{
+		uint* r_dst = &DY;
+		uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		if(res != 0xffff)
+		{
+			uint offset = OPER_I_16(state);
+			REG_PC -= 2;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_16(state, offset);
+			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			return;
+		}
+		REG_PC += 2;
+		USE_CYCLES(CYC_DBCC_F_EXP);
+		return;
+	}
+	REG_PC += 2;
+}
+
+
+static void m68k_op_dbcc_16(m68ki_cpu_core *state)
+{
+	if(COND_NOT_CC())
+	{
+		uint* r_dst = &DY;
+		uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		if(res != 0xffff)
+		{
+			uint offset = OPER_I_16(state);
+			REG_PC -= 2;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_16(state, offset);
+			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			return;
+		}
+		REG_PC += 2;
+		USE_CYCLES(CYC_DBCC_F_EXP);
+		return;
+	}
+	REG_PC += 2;
+}
+
+
+static void m68k_op_dbcs_16(m68ki_cpu_core *state)
+{
+	if(COND_NOT_CS())
+	{
+		uint* r_dst = &DY;
+		uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		if(res != 0xffff)
+		{
+			uint offset = OPER_I_16(state);
+			REG_PC -= 2;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_16(state, offset);
+			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			return;
+		}
+		REG_PC += 2;
+		USE_CYCLES(CYC_DBCC_F_EXP);
+		return;
+	}
+	REG_PC += 2;
+}
+
+
+static void m68k_op_dbne_16(m68ki_cpu_core *state)
+{
+	if(COND_NOT_NE())
+	{
+		uint* r_dst = &DY;
+		uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		if(res != 0xffff)
+		{
+			uint offset = OPER_I_16(state);
+			REG_PC -= 2;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_16(state, offset);
+			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			return;
+		}
+		REG_PC += 2;
+		USE_CYCLES(CYC_DBCC_F_EXP);
+		return;
+	}
+	REG_PC += 2;
+}
+
+
+static void m68k_op_dbeq_16(m68ki_cpu_core *state)
+{
+	if(COND_NOT_EQ())
+	{
+		uint* r_dst = &DY;
+		uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		if(res != 0xffff)
+		{
+			uint offset = OPER_I_16(state);
+			REG_PC -= 2;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_16(state, offset);
+			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			return;
+		}
+		REG_PC += 2;
+		USE_CYCLES(CYC_DBCC_F_EXP);
+		return;
+	}
+	REG_PC += 2;
+}
+
+
+static void m68k_op_dbvc_16(m68ki_cpu_core *state)
+{
+	if(COND_NOT_VC())
+	{
+		uint* r_dst = &DY;
+		uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		if(res != 0xffff)
+		{
+			uint offset = OPER_I_16(state);
+			REG_PC -= 2;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_16(state, offset);
+			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			return;
+		}
+		REG_PC += 2;
+		USE_CYCLES(CYC_DBCC_F_EXP);
+		return;
+	}
+	REG_PC += 2;
+}
+
+
+static void m68k_op_dbvs_16(m68ki_cpu_core *state)
+{
+	if(COND_NOT_VS())
+	{
+		uint* r_dst = &DY;
+		uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		if(res != 0xffff)
+		{
+			uint offset = OPER_I_16(state);
+			REG_PC -= 2;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_16(state, offset);
+			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			return;
+		}
+		REG_PC += 2;
+		USE_CYCLES(CYC_DBCC_F_EXP);
+		return;
+	}
+	REG_PC += 2;
+}
+
+
+static void m68k_op_dbpl_16(m68ki_cpu_core *state)
+{
+	if(COND_NOT_PL())
+	{
+		uint* r_dst = &DY;
+		uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		if(res != 0xffff)
+		{
+			uint offset = OPER_I_16(state);
+			REG_PC -= 2;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_16(state, offset);
+			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			return;
+		}
+		REG_PC += 2;
+		USE_CYCLES(CYC_DBCC_F_EXP);
+		return;
+	}
+	REG_PC += 2;
+}
+
+
+static void m68k_op_dbmi_16(m68ki_cpu_core *state)
+{
+	if(COND_NOT_MI())
+	{
+		uint* r_dst = &DY;
+		uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		if(res != 0xffff)
+		{
+			uint offset = OPER_I_16(state);
+			REG_PC -= 2;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_16(state, offset);
+			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			return;
+		}
+		REG_PC += 2;
+		USE_CYCLES(CYC_DBCC_F_EXP);
+		return;
+	}
+	REG_PC += 2;
+}
+
+
+static void m68k_op_dbge_16(m68ki_cpu_core *state)
+{
+	if(COND_NOT_GE())
+	{
+		uint* r_dst = &DY;
+		uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		if(res != 0xffff)
+		{
+			uint offset = OPER_I_16(state);
+			REG_PC -= 2;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_16(state, offset);
+			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			return;
+		}
+		REG_PC += 2;
+		USE_CYCLES(CYC_DBCC_F_EXP);
+		return;
+	}
+	REG_PC += 2;
+}
+
+
+static void m68k_op_dblt_16(m68ki_cpu_core *state)
+{
+	if(COND_NOT_LT())
+	{
+		uint* r_dst = &DY;
+		uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		if(res != 0xffff)
+		{
+			uint offset = OPER_I_16(state);
+			REG_PC -= 2;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_16(state, offset);
+			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			return;
+		}
+		REG_PC += 2;
+		USE_CYCLES(CYC_DBCC_F_EXP);
+		return;
+	}
+	REG_PC += 2;
+}
+
+
+static void m68k_op_dbgt_16(m68ki_cpu_core *state)
+{
+	if(COND_NOT_GT())
+	{
+		uint* r_dst = &DY;
+		uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		if(res != 0xffff)
+		{
+			uint offset = OPER_I_16(state);
+			REG_PC -= 2;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_16(state, offset);
+			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			return;
+		}
+		REG_PC += 2;
+		USE_CYCLES(CYC_DBCC_F_EXP);
+		return;
+	}
+	REG_PC += 2;
+}
+
+
+static void m68k_op_dble_16(m68ki_cpu_core *state)
+{
+	if(COND_NOT_LE())
+	{
+		uint* r_dst = &DY;
+		uint res = MASK_OUT_ABOVE_16(*r_dst - 1);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		if(res != 0xffff)
+		{
+			uint offset = OPER_I_16(state);
+			REG_PC -= 2;
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			m68ki_branch_16(state, offset);
+			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			return;
+		}
+		REG_PC += 2;
+		USE_CYCLES(CYC_DBCC_F_EXP);
+		return;
+	}
+	REG_PC += 2;
+}
+
+
+static void m68k_op_divs_16_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	sint src = MAKE_INT_16(DY);
+	sint quotient;
+	sint remainder;
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		if((uint32)*r_dst == 0x80000000 && src == -1)
+		{
+			FLAG_Z = 0;
+			FLAG_N = NFLAG_CLEAR;
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = 0;
+			return;
+		}
+
+		quotient = MAKE_INT_32(*r_dst) / src;
+		remainder = MAKE_INT_32(*r_dst) % src;
+
+		if(quotient == MAKE_INT_16(quotient))
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divs_16_ai(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	sint src = MAKE_INT_16(OPER_AY_AI_16(state));
+	sint quotient;
+	sint remainder;
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		if((uint32)*r_dst == 0x80000000 && src == -1)
+		{
+			FLAG_Z = 0;
+			FLAG_N = NFLAG_CLEAR;
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = 0;
+			return;
+		}
+
+		quotient = MAKE_INT_32(*r_dst) / src;
+		remainder = MAKE_INT_32(*r_dst) % src;
+
+		if(quotient == MAKE_INT_16(quotient))
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divs_16_pi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	sint src = MAKE_INT_16(OPER_AY_PI_16(state));
+	sint quotient;
+	sint remainder;
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		if((uint32)*r_dst == 0x80000000 && src == -1)
+		{
+			FLAG_Z = 0;
+			FLAG_N = NFLAG_CLEAR;
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = 0;
+			return;
+		}
+
+		quotient = MAKE_INT_32(*r_dst) / src;
+		remainder = MAKE_INT_32(*r_dst) % src;
+
+		if(quotient == MAKE_INT_16(quotient))
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divs_16_pd(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	sint src = MAKE_INT_16(OPER_AY_PD_16(state));
+	sint quotient;
+	sint remainder;
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		if((uint32)*r_dst == 0x80000000 && src == -1)
+		{
+			FLAG_Z = 0;
+			FLAG_N = NFLAG_CLEAR;
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = 0;
+			return;
+		}
+
+		quotient = MAKE_INT_32(*r_dst) / src;
+		remainder = MAKE_INT_32(*r_dst) % src;
+
+		if(quotient == MAKE_INT_16(quotient))
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divs_16_di(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	sint src = MAKE_INT_16(OPER_AY_DI_16(state));
+	sint quotient;
+	sint remainder;
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		if((uint32)*r_dst == 0x80000000 && src == -1)
+		{
+			FLAG_Z = 0;
+			FLAG_N = NFLAG_CLEAR;
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = 0;
+			return;
+		}
+
+		quotient = MAKE_INT_32(*r_dst) / src;
+		remainder = MAKE_INT_32(*r_dst) % src;
+
+		if(quotient == MAKE_INT_16(quotient))
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divs_16_ix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	sint src = MAKE_INT_16(OPER_AY_IX_16(state));
+	sint quotient;
+	sint remainder;
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		if((uint32)*r_dst == 0x80000000 && src == -1)
+		{
+			FLAG_Z = 0;
+			FLAG_N = NFLAG_CLEAR;
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = 0;
+			return;
+		}
+
+		quotient = MAKE_INT_32(*r_dst) / src;
+		remainder = MAKE_INT_32(*r_dst) % src;
+
+		if(quotient == MAKE_INT_16(quotient))
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divs_16_aw(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	sint src = MAKE_INT_16(OPER_AW_16(state));
+	sint quotient;
+	sint remainder;
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		if((uint32)*r_dst == 0x80000000 && src == -1)
+		{
+			FLAG_Z = 0;
+			FLAG_N = NFLAG_CLEAR;
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = 0;
+			return;
+		}
+
+		quotient = MAKE_INT_32(*r_dst) / src;
+		remainder = MAKE_INT_32(*r_dst) % src;
+
+		if(quotient == MAKE_INT_16(quotient))
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divs_16_al(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	sint src = MAKE_INT_16(OPER_AL_16(state));
+	sint quotient;
+	sint remainder;
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		if((uint32)*r_dst == 0x80000000 && src == -1)
+		{
+			FLAG_Z = 0;
+			FLAG_N = NFLAG_CLEAR;
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = 0;
+			return;
+		}
+
+		quotient = MAKE_INT_32(*r_dst) / src;
+		remainder = MAKE_INT_32(*r_dst) % src;
+
+		if(quotient == MAKE_INT_16(quotient))
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divs_16_pcdi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	sint src = MAKE_INT_16(OPER_PCDI_16(state));
+	sint quotient;
+	sint remainder;
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		if((uint32)*r_dst == 0x80000000 && src == -1)
+		{
+			FLAG_Z = 0;
+			FLAG_N = NFLAG_CLEAR;
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = 0;
+			return;
+		}
+
+		quotient = MAKE_INT_32(*r_dst) / src;
+		remainder = MAKE_INT_32(*r_dst) % src;
+
+		if(quotient == MAKE_INT_16(quotient))
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divs_16_pcix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	sint src = MAKE_INT_16(OPER_PCIX_16(state));
+	sint quotient;
+	sint remainder;
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		if((uint32)*r_dst == 0x80000000 && src == -1)
+		{
+			FLAG_Z = 0;
+			FLAG_N = NFLAG_CLEAR;
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = 0;
+			return;
+		}
+
+		quotient = MAKE_INT_32(*r_dst) / src;
+		remainder = MAKE_INT_32(*r_dst) % src;
+
+		if(quotient == MAKE_INT_16(quotient))
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divs_16_i(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	sint src = MAKE_INT_16(OPER_I_16(state));
+	sint quotient;
+	sint remainder;
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		if((uint32)*r_dst == 0x80000000 && src == -1)
+		{
+			FLAG_Z = 0;
+			FLAG_N = NFLAG_CLEAR;
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = 0;
+			return;
+		}
+
+		quotient = MAKE_INT_32(*r_dst) / src;
+		remainder = MAKE_INT_32(*r_dst) % src;
+
+		if(quotient == MAKE_INT_16(quotient))
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divu_16_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = MASK_OUT_ABOVE_16(DY);
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		uint quotient = *r_dst / src;
+		uint remainder = *r_dst % src;
+
+		if(quotient < 0x10000)
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divu_16_ai(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_AI_16(state);
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		uint quotient = *r_dst / src;
+		uint remainder = *r_dst % src;
+
+		if(quotient < 0x10000)
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divu_16_pi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_PI_16(state);
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		uint quotient = *r_dst / src;
+		uint remainder = *r_dst % src;
+
+		if(quotient < 0x10000)
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divu_16_pd(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_PD_16(state);
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		uint quotient = *r_dst / src;
+		uint remainder = *r_dst % src;
+
+		if(quotient < 0x10000)
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divu_16_di(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_DI_16(state);
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		uint quotient = *r_dst / src;
+		uint remainder = *r_dst % src;
+
+		if(quotient < 0x10000)
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divu_16_ix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_IX_16(state);
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		uint quotient = *r_dst / src;
+		uint remainder = *r_dst % src;
+
+		if(quotient < 0x10000)
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divu_16_aw(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AW_16(state);
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		uint quotient = *r_dst / src;
+		uint remainder = *r_dst % src;
+
+		if(quotient < 0x10000)
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divu_16_al(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AL_16(state);
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		uint quotient = *r_dst / src;
+		uint remainder = *r_dst % src;
+
+		if(quotient < 0x10000)
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divu_16_pcdi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_PCDI_16(state);
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		uint quotient = *r_dst / src;
+		uint remainder = *r_dst % src;
+
+		if(quotient < 0x10000)
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divu_16_pcix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_PCIX_16(state);
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		uint quotient = *r_dst / src;
+		uint remainder = *r_dst % src;
+
+		if(quotient < 0x10000)
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divu_16_i(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_I_16(state);
+
+	if(src != 0)
+	{
+		FLAG_C = CFLAG_CLEAR;
+		uint quotient = *r_dst / src;
+		uint remainder = *r_dst % src;
+
+		if(quotient < 0x10000)
+		{
+			FLAG_Z = quotient;
+			FLAG_N = NFLAG_16(quotient);
+			FLAG_V = VFLAG_CLEAR;
+			*r_dst = MASK_OUT_ABOVE_32(MASK_OUT_ABOVE_16(quotient) | (remainder << 16));
+			return;
+		}
+		FLAG_V = VFLAG_SET;
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+}
+
+
+static void m68k_op_divl_32_d(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 divisor   = DY;
+		uint64 dividend  = 0;
+		uint64 quotient  = 0;
+		uint64 remainder = 0;
+
+		if(divisor != 0)
+		{
+			if(BIT_A(word2))	/* 64 bit */
+			{
+				dividend = REG_D[word2 & 7];
+				dividend <<= 32;
+				dividend |= REG_D[(word2 >> 12) & 7];
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+					if((sint64)quotient != (sint64)((sint32)quotient))
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					if(quotient > 0xffffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					remainder = dividend % divisor;
+				}
+			}
+			else	/* 32 bit */
+			{
+				dividend = REG_D[(word2 >> 12) & 7];
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					remainder = dividend % divisor;
+				}
+			}
+
+			REG_D[word2 & 7] = remainder;
+			REG_D[(word2 >> 12) & 7] = quotient;
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint divisor = DY;
+		uint dividend_hi = REG_D[word2 & 7];
+		uint dividend_lo = REG_D[(word2 >> 12) & 7];
+		uint quotient = 0;
+		uint remainder = 0;
+		uint dividend_neg = 0;
+		uint divisor_neg = 0;
+		sint i;
+		uint overflow;
+
+		if(divisor != 0)
+		{
+			/* quad / long : long quotient, long remainder */
+			if(BIT_A(word2))
+			{
+				if(BIT_B(word2))	   /* signed */
+				{
+					/* special case in signed divide */
+					if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+					{
+						REG_D[word2 & 7] = 0;
+						REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+						FLAG_N = NFLAG_SET;
+						FLAG_Z = ZFLAG_CLEAR;
+						FLAG_V = VFLAG_CLEAR;
+						FLAG_C = CFLAG_CLEAR;
+						return;
+					}
+					if(GET_MSB_32(dividend_hi))
+					{
+						dividend_neg = 1;
+						dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+						dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+					}
+					if(GET_MSB_32(divisor))
+					{
+						divisor_neg = 1;
+						divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+					}
+				}
+
+				/* if the upper long is greater than the divisor, we're overflowing. */
+				if(dividend_hi >= divisor)
+				{
+					FLAG_V = VFLAG_SET;
+					return;
+				}
+
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+					if(remainder >= divisor)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					overflow = GET_MSB_32(remainder);
+					remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+					if(remainder >= divisor || overflow)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					if(quotient > 0x7fffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					if(dividend_neg)
+					{
+						remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+					}
+					if(divisor_neg)
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+				}
+
+				REG_D[word2 & 7] = remainder;
+				REG_D[(word2 >> 12) & 7] = quotient;
+
+				FLAG_N = NFLAG_32(quotient);
+				FLAG_Z = quotient;
+				FLAG_V = VFLAG_CLEAR;
+				FLAG_C = CFLAG_CLEAR;
+				return;
+			}
+
+			/* long / long: long quotient, maybe long remainder */
+			if(BIT_B(word2))	   /* signed */
+			{
+				/* Special case in divide */
+				if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+				{
+					FLAG_N = NFLAG_SET;
+					FLAG_Z = ZFLAG_CLEAR;
+					FLAG_V = VFLAG_CLEAR;
+					FLAG_C = CFLAG_CLEAR;
+					REG_D[(word2 >> 12) & 7] = 0x80000000;
+					REG_D[word2 & 7] = 0;
+					return;
+				}
+				REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+			}
+			else
+			{
+				REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+			}
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_divl_32_ai(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 divisor = OPER_AY_AI_32(state);
+		uint64 dividend  = 0;
+		uint64 quotient  = 0;
+		uint64 remainder = 0;
+
+		if(divisor != 0)
+		{
+			if(BIT_A(word2))	/* 64 bit */
+			{
+				dividend = REG_D[word2 & 7];
+				dividend <<= 32;
+				dividend |= REG_D[(word2 >> 12) & 7];
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+					if((sint64)quotient != (sint64)((sint32)quotient))
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					if(quotient > 0xffffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					remainder = dividend % divisor;
+				}
+			}
+			else	/* 32 bit */
+			{
+				dividend = REG_D[(word2 >> 12) & 7];
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					remainder = dividend % divisor;
+				}
+			}
+
+			REG_D[word2 & 7] = remainder;
+			REG_D[(word2 >> 12) & 7] = quotient;
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint divisor = OPER_AY_AI_32(state);
+		uint dividend_hi = REG_D[word2 & 7];
+		uint dividend_lo = REG_D[(word2 >> 12) & 7];
+		uint quotient = 0;
+		uint remainder = 0;
+		uint dividend_neg = 0;
+		uint divisor_neg = 0;
+		sint i;
+		uint overflow;
+
+		if(divisor != 0)
+		{
+			/* quad / long : long quotient, long remainder */
+			if(BIT_A(word2))
+			{
+				if(BIT_B(word2))	   /* signed */
+				{
+					/* special case in signed divide */
+					if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+					{
+						REG_D[word2 & 7] = 0;
+						REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+						FLAG_N = NFLAG_SET;
+						FLAG_Z = ZFLAG_CLEAR;
+						FLAG_V = VFLAG_CLEAR;
+						FLAG_C = CFLAG_CLEAR;
+						return;
+					}
+					if(GET_MSB_32(dividend_hi))
+					{
+						dividend_neg = 1;
+						dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+						dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+					}
+					if(GET_MSB_32(divisor))
+					{
+						divisor_neg = 1;
+						divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+					}
+				}
+
+				/* if the upper long is greater than the divisor, we're overflowing. */
+				if(dividend_hi >= divisor)
+				{
+					FLAG_V = VFLAG_SET;
+					return;
+				}
+
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+					if(remainder >= divisor)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					overflow = GET_MSB_32(remainder);
+					remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+					if(remainder >= divisor || overflow)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					if(quotient > 0x7fffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					if(dividend_neg)
+					{
+						remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+					}
+					if(divisor_neg)
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+				}
+
+				REG_D[word2 & 7] = remainder;
+				REG_D[(word2 >> 12) & 7] = quotient;
+
+				FLAG_N = NFLAG_32(quotient);
+				FLAG_Z = quotient;
+				FLAG_V = VFLAG_CLEAR;
+				FLAG_C = CFLAG_CLEAR;
+				return;
+			}
+
+			/* long / long: long quotient, maybe long remainder */
+			if(BIT_B(word2))	   /* signed */
+			{
+				/* Special case in divide */
+				if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+				{
+					FLAG_N = NFLAG_SET;
+					FLAG_Z = ZFLAG_CLEAR;
+					FLAG_V = VFLAG_CLEAR;
+					FLAG_C = CFLAG_CLEAR;
+					REG_D[(word2 >> 12) & 7] = 0x80000000;
+					REG_D[word2 & 7] = 0;
+					return;
+				}
+				REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+			}
+			else
+			{
+				REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+			}
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_divl_32_pi(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 divisor = OPER_AY_PI_32(state);
+		uint64 dividend  = 0;
+		uint64 quotient  = 0;
+		uint64 remainder = 0;
+
+		if(divisor != 0)
+		{
+			if(BIT_A(word2))	/* 64 bit */
+			{
+				dividend = REG_D[word2 & 7];
+				dividend <<= 32;
+				dividend |= REG_D[(word2 >> 12) & 7];
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+					if((sint64)quotient != (sint64)((sint32)quotient))
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					if(quotient > 0xffffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					remainder = dividend % divisor;
+				}
+			}
+			else	/* 32 bit */
+			{
+				dividend = REG_D[(word2 >> 12) & 7];
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					remainder = dividend % divisor;
+				}
+			}
+
+			REG_D[word2 & 7] = remainder;
+			REG_D[(word2 >> 12) & 7] = quotient;
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint divisor = OPER_AY_PI_32(state);
+		uint dividend_hi = REG_D[word2 & 7];
+		uint dividend_lo = REG_D[(word2 >> 12) & 7];
+		uint quotient = 0;
+		uint remainder = 0;
+		uint dividend_neg = 0;
+		uint divisor_neg = 0;
+		sint i;
+		uint overflow;
+
+		if(divisor != 0)
+		{
+			/* quad / long : long quotient, long remainder */
+			if(BIT_A(word2))
+			{
+				if(BIT_B(word2))	   /* signed */
+				{
+					/* special case in signed divide */
+					if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+					{
+						REG_D[word2 & 7] = 0;
+						REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+						FLAG_N = NFLAG_SET;
+						FLAG_Z = ZFLAG_CLEAR;
+						FLAG_V = VFLAG_CLEAR;
+						FLAG_C = CFLAG_CLEAR;
+						return;
+					}
+					if(GET_MSB_32(dividend_hi))
+					{
+						dividend_neg = 1;
+						dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+						dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+					}
+					if(GET_MSB_32(divisor))
+					{
+						divisor_neg = 1;
+						divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+					}
+				}
+
+				/* if the upper long is greater than the divisor, we're overflowing. */
+				if(dividend_hi >= divisor)
+				{
+					FLAG_V = VFLAG_SET;
+					return;
+				}
+
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+					if(remainder >= divisor)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					overflow = GET_MSB_32(remainder);
+					remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+					if(remainder >= divisor || overflow)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					if(quotient > 0x7fffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					if(dividend_neg)
+					{
+						remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+					}
+					if(divisor_neg)
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+				}
+
+				REG_D[word2 & 7] = remainder;
+				REG_D[(word2 >> 12) & 7] = quotient;
+
+				FLAG_N = NFLAG_32(quotient);
+				FLAG_Z = quotient;
+				FLAG_V = VFLAG_CLEAR;
+				FLAG_C = CFLAG_CLEAR;
+				return;
+			}
+
+			/* long / long: long quotient, maybe long remainder */
+			if(BIT_B(word2))	   /* signed */
+			{
+				/* Special case in divide */
+				if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+				{
+					FLAG_N = NFLAG_SET;
+					FLAG_Z = ZFLAG_CLEAR;
+					FLAG_V = VFLAG_CLEAR;
+					FLAG_C = CFLAG_CLEAR;
+					REG_D[(word2 >> 12) & 7] = 0x80000000;
+					REG_D[word2 & 7] = 0;
+					return;
+				}
+				REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+			}
+			else
+			{
+				REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+			}
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_divl_32_pd(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 divisor = OPER_AY_PD_32(state);
+		uint64 dividend  = 0;
+		uint64 quotient  = 0;
+		uint64 remainder = 0;
+
+		if(divisor != 0)
+		{
+			if(BIT_A(word2))	/* 64 bit */
+			{
+				dividend = REG_D[word2 & 7];
+				dividend <<= 32;
+				dividend |= REG_D[(word2 >> 12) & 7];
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+					if((sint64)quotient != (sint64)((sint32)quotient))
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					if(quotient > 0xffffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					remainder = dividend % divisor;
+				}
+			}
+			else	/* 32 bit */
+			{
+				dividend = REG_D[(word2 >> 12) & 7];
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					remainder = dividend % divisor;
+				}
+			}
+
+			REG_D[word2 & 7] = remainder;
+			REG_D[(word2 >> 12) & 7] = quotient;
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint divisor = OPER_AY_PD_32(state);
+		uint dividend_hi = REG_D[word2 & 7];
+		uint dividend_lo = REG_D[(word2 >> 12) & 7];
+		uint quotient = 0;
+		uint remainder = 0;
+		uint dividend_neg = 0;
+		uint divisor_neg = 0;
+		sint i;
+		uint overflow;
+
+		if(divisor != 0)
+		{
+			/* quad / long : long quotient, long remainder */
+			if(BIT_A(word2))
+			{
+				if(BIT_B(word2))	   /* signed */
+				{
+					/* special case in signed divide */
+					if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+					{
+						REG_D[word2 & 7] = 0;
+						REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+						FLAG_N = NFLAG_SET;
+						FLAG_Z = ZFLAG_CLEAR;
+						FLAG_V = VFLAG_CLEAR;
+						FLAG_C = CFLAG_CLEAR;
+						return;
+					}
+					if(GET_MSB_32(dividend_hi))
+					{
+						dividend_neg = 1;
+						dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+						dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+					}
+					if(GET_MSB_32(divisor))
+					{
+						divisor_neg = 1;
+						divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+					}
+				}
+
+				/* if the upper long is greater than the divisor, we're overflowing. */
+				if(dividend_hi >= divisor)
+				{
+					FLAG_V = VFLAG_SET;
+					return;
+				}
+
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+					if(remainder >= divisor)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					overflow = GET_MSB_32(remainder);
+					remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+					if(remainder >= divisor || overflow)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					if(quotient > 0x7fffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					if(dividend_neg)
+					{
+						remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+					}
+					if(divisor_neg)
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+				}
+
+				REG_D[word2 & 7] = remainder;
+				REG_D[(word2 >> 12) & 7] = quotient;
+
+				FLAG_N = NFLAG_32(quotient);
+				FLAG_Z = quotient;
+				FLAG_V = VFLAG_CLEAR;
+				FLAG_C = CFLAG_CLEAR;
+				return;
+			}
+
+			/* long / long: long quotient, maybe long remainder */
+			if(BIT_B(word2))	   /* signed */
+			{
+				/* Special case in divide */
+				if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+				{
+					FLAG_N = NFLAG_SET;
+					FLAG_Z = ZFLAG_CLEAR;
+					FLAG_V = VFLAG_CLEAR;
+					FLAG_C = CFLAG_CLEAR;
+					REG_D[(word2 >> 12) & 7] = 0x80000000;
+					REG_D[word2 & 7] = 0;
+					return;
+				}
+				REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+			}
+			else
+			{
+				REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+			}
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_divl_32_di(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 divisor = OPER_AY_DI_32(state);
+		uint64 dividend  = 0;
+		uint64 quotient  = 0;
+		uint64 remainder = 0;
+
+		if(divisor != 0)
+		{
+			if(BIT_A(word2))	/* 64 bit */
+			{
+				dividend = REG_D[word2 & 7];
+				dividend <<= 32;
+				dividend |= REG_D[(word2 >> 12) & 7];
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+					if((sint64)quotient != (sint64)((sint32)quotient))
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					if(quotient > 0xffffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					remainder = dividend % divisor;
+				}
+			}
+			else	/* 32 bit */
+			{
+				dividend = REG_D[(word2 >> 12) & 7];
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					remainder = dividend % divisor;
+				}
+			}
+
+			REG_D[word2 & 7] = remainder;
+			REG_D[(word2 >> 12) & 7] = quotient;
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint divisor = OPER_AY_DI_32(state);
+		uint dividend_hi = REG_D[word2 & 7];
+		uint dividend_lo = REG_D[(word2 >> 12) & 7];
+		uint quotient = 0;
+		uint remainder = 0;
+		uint dividend_neg = 0;
+		uint divisor_neg = 0;
+		sint i;
+		uint overflow;
+
+		if(divisor != 0)
+		{
+			/* quad / long : long quotient, long remainder */
+			if(BIT_A(word2))
+			{
+				if(BIT_B(word2))	   /* signed */
+				{
+					/* special case in signed divide */
+					if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+					{
+						REG_D[word2 & 7] = 0;
+						REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+						FLAG_N = NFLAG_SET;
+						FLAG_Z = ZFLAG_CLEAR;
+						FLAG_V = VFLAG_CLEAR;
+						FLAG_C = CFLAG_CLEAR;
+						return;
+					}
+					if(GET_MSB_32(dividend_hi))
+					{
+						dividend_neg = 1;
+						dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+						dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+					}
+					if(GET_MSB_32(divisor))
+					{
+						divisor_neg = 1;
+						divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+					}
+				}
+
+				/* if the upper long is greater than the divisor, we're overflowing. */
+				if(dividend_hi >= divisor)
+				{
+					FLAG_V = VFLAG_SET;
+					return;
+				}
+
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+					if(remainder >= divisor)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					overflow = GET_MSB_32(remainder);
+					remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+					if(remainder >= divisor || overflow)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					if(quotient > 0x7fffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					if(dividend_neg)
+					{
+						remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+					}
+					if(divisor_neg)
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+				}
+
+				REG_D[word2 & 7] = remainder;
+				REG_D[(word2 >> 12) & 7] = quotient;
+
+				FLAG_N = NFLAG_32(quotient);
+				FLAG_Z = quotient;
+				FLAG_V = VFLAG_CLEAR;
+				FLAG_C = CFLAG_CLEAR;
+				return;
+			}
+
+			/* long / long: long quotient, maybe long remainder */
+			if(BIT_B(word2))	   /* signed */
+			{
+				/* Special case in divide */
+				if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+				{
+					FLAG_N = NFLAG_SET;
+					FLAG_Z = ZFLAG_CLEAR;
+					FLAG_V = VFLAG_CLEAR;
+					FLAG_C = CFLAG_CLEAR;
+					REG_D[(word2 >> 12) & 7] = 0x80000000;
+					REG_D[word2 & 7] = 0;
+					return;
+				}
+				REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+			}
+			else
+			{
+				REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+			}
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_divl_32_ix(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 divisor = OPER_AY_IX_32(state);
+		uint64 dividend  = 0;
+		uint64 quotient  = 0;
+		uint64 remainder = 0;
+
+		if(divisor != 0)
+		{
+			if(BIT_A(word2))	/* 64 bit */
+			{
+				dividend = REG_D[word2 & 7];
+				dividend <<= 32;
+				dividend |= REG_D[(word2 >> 12) & 7];
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+					if((sint64)quotient != (sint64)((sint32)quotient))
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					if(quotient > 0xffffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					remainder = dividend % divisor;
+				}
+			}
+			else	/* 32 bit */
+			{
+				dividend = REG_D[(word2 >> 12) & 7];
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					remainder = dividend % divisor;
+				}
+			}
+
+			REG_D[word2 & 7] = remainder;
+			REG_D[(word2 >> 12) & 7] = quotient;
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint divisor = OPER_AY_IX_32(state);
+		uint dividend_hi = REG_D[word2 & 7];
+		uint dividend_lo = REG_D[(word2 >> 12) & 7];
+		uint quotient = 0;
+		uint remainder = 0;
+		uint dividend_neg = 0;
+		uint divisor_neg = 0;
+		sint i;
+		uint overflow;
+
+		if(divisor != 0)
+		{
+			/* quad / long : long quotient, long remainder */
+			if(BIT_A(word2))
+			{
+				if(BIT_B(word2))	   /* signed */
+				{
+					/* special case in signed divide */
+					if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+					{
+						REG_D[word2 & 7] = 0;
+						REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+						FLAG_N = NFLAG_SET;
+						FLAG_Z = ZFLAG_CLEAR;
+						FLAG_V = VFLAG_CLEAR;
+						FLAG_C = CFLAG_CLEAR;
+						return;
+					}
+					if(GET_MSB_32(dividend_hi))
+					{
+						dividend_neg = 1;
+						dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+						dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+					}
+					if(GET_MSB_32(divisor))
+					{
+						divisor_neg = 1;
+						divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+					}
+				}
+
+				/* if the upper long is greater than the divisor, we're overflowing. */
+				if(dividend_hi >= divisor)
+				{
+					FLAG_V = VFLAG_SET;
+					return;
+				}
+
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+					if(remainder >= divisor)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					overflow = GET_MSB_32(remainder);
+					remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+					if(remainder >= divisor || overflow)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					if(quotient > 0x7fffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					if(dividend_neg)
+					{
+						remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+					}
+					if(divisor_neg)
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+				}
+
+				REG_D[word2 & 7] = remainder;
+				REG_D[(word2 >> 12) & 7] = quotient;
+
+				FLAG_N = NFLAG_32(quotient);
+				FLAG_Z = quotient;
+				FLAG_V = VFLAG_CLEAR;
+				FLAG_C = CFLAG_CLEAR;
+				return;
+			}
+
+			/* long / long: long quotient, maybe long remainder */
+			if(BIT_B(word2))	   /* signed */
+			{
+				/* Special case in divide */
+				if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+				{
+					FLAG_N = NFLAG_SET;
+					FLAG_Z = ZFLAG_CLEAR;
+					FLAG_V = VFLAG_CLEAR;
+					FLAG_C = CFLAG_CLEAR;
+					REG_D[(word2 >> 12) & 7] = 0x80000000;
+					REG_D[word2 & 7] = 0;
+					return;
+				}
+				REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+			}
+			else
+			{
+				REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+			}
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_divl_32_aw(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 divisor = OPER_AW_32(state);
+		uint64 dividend  = 0;
+		uint64 quotient  = 0;
+		uint64 remainder = 0;
+
+		if(divisor != 0)
+		{
+			if(BIT_A(word2))	/* 64 bit */
+			{
+				dividend = REG_D[word2 & 7];
+				dividend <<= 32;
+				dividend |= REG_D[(word2 >> 12) & 7];
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+					if((sint64)quotient != (sint64)((sint32)quotient))
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					if(quotient > 0xffffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					remainder = dividend % divisor;
+				}
+			}
+			else	/* 32 bit */
+			{
+				dividend = REG_D[(word2 >> 12) & 7];
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					remainder = dividend % divisor;
+				}
+			}
+
+			REG_D[word2 & 7] = remainder;
+			REG_D[(word2 >> 12) & 7] = quotient;
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint divisor = OPER_AW_32(state);
+		uint dividend_hi = REG_D[word2 & 7];
+		uint dividend_lo = REG_D[(word2 >> 12) & 7];
+		uint quotient = 0;
+		uint remainder = 0;
+		uint dividend_neg = 0;
+		uint divisor_neg = 0;
+		sint i;
+		uint overflow;
+
+		if(divisor != 0)
+		{
+			/* quad / long : long quotient, long remainder */
+			if(BIT_A(word2))
+			{
+				if(BIT_B(word2))	   /* signed */
+				{
+					/* special case in signed divide */
+					if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+					{
+						REG_D[word2 & 7] = 0;
+						REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+						FLAG_N = NFLAG_SET;
+						FLAG_Z = ZFLAG_CLEAR;
+						FLAG_V = VFLAG_CLEAR;
+						FLAG_C = CFLAG_CLEAR;
+						return;
+					}
+					if(GET_MSB_32(dividend_hi))
+					{
+						dividend_neg = 1;
+						dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+						dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+					}
+					if(GET_MSB_32(divisor))
+					{
+						divisor_neg = 1;
+						divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+					}
+				}
+
+				/* if the upper long is greater than the divisor, we're overflowing. */
+				if(dividend_hi >= divisor)
+				{
+					FLAG_V = VFLAG_SET;
+					return;
+				}
+
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+					if(remainder >= divisor)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					overflow = GET_MSB_32(remainder);
+					remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+					if(remainder >= divisor || overflow)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					if(quotient > 0x7fffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					if(dividend_neg)
+					{
+						remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+					}
+					if(divisor_neg)
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+				}
+
+				REG_D[word2 & 7] = remainder;
+				REG_D[(word2 >> 12) & 7] = quotient;
+
+				FLAG_N = NFLAG_32(quotient);
+				FLAG_Z = quotient;
+				FLAG_V = VFLAG_CLEAR;
+				FLAG_C = CFLAG_CLEAR;
+				return;
+			}
+
+			/* long / long: long quotient, maybe long remainder */
+			if(BIT_B(word2))	   /* signed */
+			{
+				/* Special case in divide */
+				if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+				{
+					FLAG_N = NFLAG_SET;
+					FLAG_Z = ZFLAG_CLEAR;
+					FLAG_V = VFLAG_CLEAR;
+					FLAG_C = CFLAG_CLEAR;
+					REG_D[(word2 >> 12) & 7] = 0x80000000;
+					REG_D[word2 & 7] = 0;
+					return;
+				}
+				REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+			}
+			else
+			{
+				REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+			}
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_divl_32_al(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 divisor = OPER_AL_32(state);
+		uint64 dividend  = 0;
+		uint64 quotient  = 0;
+		uint64 remainder = 0;
+
+		if(divisor != 0)
+		{
+			if(BIT_A(word2))	/* 64 bit */
+			{
+				dividend = REG_D[word2 & 7];
+				dividend <<= 32;
+				dividend |= REG_D[(word2 >> 12) & 7];
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+					if((sint64)quotient != (sint64)((sint32)quotient))
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					if(quotient > 0xffffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					remainder = dividend % divisor;
+				}
+			}
+			else	/* 32 bit */
+			{
+				dividend = REG_D[(word2 >> 12) & 7];
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					remainder = dividend % divisor;
+				}
+			}
+
+			REG_D[word2 & 7] = remainder;
+			REG_D[(word2 >> 12) & 7] = quotient;
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint divisor = OPER_AL_32(state);
+		uint dividend_hi = REG_D[word2 & 7];
+		uint dividend_lo = REG_D[(word2 >> 12) & 7];
+		uint quotient = 0;
+		uint remainder = 0;
+		uint dividend_neg = 0;
+		uint divisor_neg = 0;
+		sint i;
+		uint overflow;
+
+		if(divisor != 0)
+		{
+			/* quad / long : long quotient, long remainder */
+			if(BIT_A(word2))
+			{
+				if(BIT_B(word2))	   /* signed */
+				{
+					/* special case in signed divide */
+					if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+					{
+						REG_D[word2 & 7] = 0;
+						REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+						FLAG_N = NFLAG_SET;
+						FLAG_Z = ZFLAG_CLEAR;
+						FLAG_V = VFLAG_CLEAR;
+						FLAG_C = CFLAG_CLEAR;
+						return;
+					}
+					if(GET_MSB_32(dividend_hi))
+					{
+						dividend_neg = 1;
+						dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+						dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+					}
+					if(GET_MSB_32(divisor))
+					{
+						divisor_neg = 1;
+						divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+					}
+				}
+
+				/* if the upper long is greater than the divisor, we're overflowing. */
+				if(dividend_hi >= divisor)
+				{
+					FLAG_V = VFLAG_SET;
+					return;
+				}
+
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+					if(remainder >= divisor)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					overflow = GET_MSB_32(remainder);
+					remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+					if(remainder >= divisor || overflow)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					if(quotient > 0x7fffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					if(dividend_neg)
+					{
+						remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+					}
+					if(divisor_neg)
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+				}
+
+				REG_D[word2 & 7] = remainder;
+				REG_D[(word2 >> 12) & 7] = quotient;
+
+				FLAG_N = NFLAG_32(quotient);
+				FLAG_Z = quotient;
+				FLAG_V = VFLAG_CLEAR;
+				FLAG_C = CFLAG_CLEAR;
+				return;
+			}
+
+			/* long / long: long quotient, maybe long remainder */
+			if(BIT_B(word2))	   /* signed */
+			{
+				/* Special case in divide */
+				if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+				{
+					FLAG_N = NFLAG_SET;
+					FLAG_Z = ZFLAG_CLEAR;
+					FLAG_V = VFLAG_CLEAR;
+					FLAG_C = CFLAG_CLEAR;
+					REG_D[(word2 >> 12) & 7] = 0x80000000;
+					REG_D[word2 & 7] = 0;
+					return;
+				}
+				REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+			}
+			else
+			{
+				REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+			}
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_divl_32_pcdi(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 divisor = OPER_PCDI_32(state);
+		uint64 dividend  = 0;
+		uint64 quotient  = 0;
+		uint64 remainder = 0;
+
+		if(divisor != 0)
+		{
+			if(BIT_A(word2))	/* 64 bit */
+			{
+				dividend = REG_D[word2 & 7];
+				dividend <<= 32;
+				dividend |= REG_D[(word2 >> 12) & 7];
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+					if((sint64)quotient != (sint64)((sint32)quotient))
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					if(quotient > 0xffffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					remainder = dividend % divisor;
+				}
+			}
+			else	/* 32 bit */
+			{
+				dividend = REG_D[(word2 >> 12) & 7];
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					remainder = dividend % divisor;
+				}
+			}
+
+			REG_D[word2 & 7] = remainder;
+			REG_D[(word2 >> 12) & 7] = quotient;
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint divisor = OPER_PCDI_32(state);
+		uint dividend_hi = REG_D[word2 & 7];
+		uint dividend_lo = REG_D[(word2 >> 12) & 7];
+		uint quotient = 0;
+		uint remainder = 0;
+		uint dividend_neg = 0;
+		uint divisor_neg = 0;
+		sint i;
+		uint overflow;
+
+		if(divisor != 0)
+		{
+			/* quad / long : long quotient, long remainder */
+			if(BIT_A(word2))
+			{
+				if(BIT_B(word2))	   /* signed */
+				{
+					/* special case in signed divide */
+					if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+					{
+						REG_D[word2 & 7] = 0;
+						REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+						FLAG_N = NFLAG_SET;
+						FLAG_Z = ZFLAG_CLEAR;
+						FLAG_V = VFLAG_CLEAR;
+						FLAG_C = CFLAG_CLEAR;
+						return;
+					}
+					if(GET_MSB_32(dividend_hi))
+					{
+						dividend_neg = 1;
+						dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+						dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+					}
+					if(GET_MSB_32(divisor))
+					{
+						divisor_neg = 1;
+						divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+					}
+				}
+
+				/* if the upper long is greater than the divisor, we're overflowing. */
+				if(dividend_hi >= divisor)
+				{
+					FLAG_V = VFLAG_SET;
+					return;
+				}
+
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+					if(remainder >= divisor)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					overflow = GET_MSB_32(remainder);
+					remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+					if(remainder >= divisor || overflow)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					if(quotient > 0x7fffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					if(dividend_neg)
+					{
+						remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+					}
+					if(divisor_neg)
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+				}
+
+				REG_D[word2 & 7] = remainder;
+				REG_D[(word2 >> 12) & 7] = quotient;
+
+				FLAG_N = NFLAG_32(quotient);
+				FLAG_Z = quotient;
+				FLAG_V = VFLAG_CLEAR;
+				FLAG_C = CFLAG_CLEAR;
+				return;
+			}
+
+			/* long / long: long quotient, maybe long remainder */
+			if(BIT_B(word2))	   /* signed */
+			{
+				/* Special case in divide */
+				if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+				{
+					FLAG_N = NFLAG_SET;
+					FLAG_Z = ZFLAG_CLEAR;
+					FLAG_V = VFLAG_CLEAR;
+					FLAG_C = CFLAG_CLEAR;
+					REG_D[(word2 >> 12) & 7] = 0x80000000;
+					REG_D[word2 & 7] = 0;
+					return;
+				}
+				REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+			}
+			else
+			{
+				REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+			}
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_divl_32_pcix(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 divisor = OPER_PCIX_32(state);
+		uint64 dividend  = 0;
+		uint64 quotient  = 0;
+		uint64 remainder = 0;
+
+		if(divisor != 0)
+		{
+			if(BIT_A(word2))	/* 64 bit */
+			{
+				dividend = REG_D[word2 & 7];
+				dividend <<= 32;
+				dividend |= REG_D[(word2 >> 12) & 7];
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+					if((sint64)quotient != (sint64)((sint32)quotient))
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					if(quotient > 0xffffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					remainder = dividend % divisor;
+				}
+			}
+			else	/* 32 bit */
+			{
+				dividend = REG_D[(word2 >> 12) & 7];
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					remainder = dividend % divisor;
+				}
+			}
+
+			REG_D[word2 & 7] = remainder;
+			REG_D[(word2 >> 12) & 7] = quotient;
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint divisor = OPER_PCIX_32(state);
+		uint dividend_hi = REG_D[word2 & 7];
+		uint dividend_lo = REG_D[(word2 >> 12) & 7];
+		uint quotient = 0;
+		uint remainder = 0;
+		uint dividend_neg = 0;
+		uint divisor_neg = 0;
+		sint i;
+		uint overflow;
+
+		if(divisor != 0)
+		{
+			/* quad / long : long quotient, long remainder */
+			if(BIT_A(word2))
+			{
+				if(BIT_B(word2))	   /* signed */
+				{
+					/* special case in signed divide */
+					if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+					{
+						REG_D[word2 & 7] = 0;
+						REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+						FLAG_N = NFLAG_SET;
+						FLAG_Z = ZFLAG_CLEAR;
+						FLAG_V = VFLAG_CLEAR;
+						FLAG_C = CFLAG_CLEAR;
+						return;
+					}
+					if(GET_MSB_32(dividend_hi))
+					{
+						dividend_neg = 1;
+						dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+						dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+					}
+					if(GET_MSB_32(divisor))
+					{
+						divisor_neg = 1;
+						divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+					}
+				}
+
+				/* if the upper long is greater than the divisor, we're overflowing. */
+				if(dividend_hi >= divisor)
+				{
+					FLAG_V = VFLAG_SET;
+					return;
+				}
+
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+					if(remainder >= divisor)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					overflow = GET_MSB_32(remainder);
+					remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+					if(remainder >= divisor || overflow)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					if(quotient > 0x7fffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					if(dividend_neg)
+					{
+						remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+					}
+					if(divisor_neg)
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+				}
+
+				REG_D[word2 & 7] = remainder;
+				REG_D[(word2 >> 12) & 7] = quotient;
+
+				FLAG_N = NFLAG_32(quotient);
+				FLAG_Z = quotient;
+				FLAG_V = VFLAG_CLEAR;
+				FLAG_C = CFLAG_CLEAR;
+				return;
+			}
+
+			/* long / long: long quotient, maybe long remainder */
+			if(BIT_B(word2))	   /* signed */
+			{
+				/* Special case in divide */
+				if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+				{
+					FLAG_N = NFLAG_SET;
+					FLAG_Z = ZFLAG_CLEAR;
+					FLAG_V = VFLAG_CLEAR;
+					FLAG_C = CFLAG_CLEAR;
+					REG_D[(word2 >> 12) & 7] = 0x80000000;
+					REG_D[word2 & 7] = 0;
+					return;
+				}
+				REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+			}
+			else
+			{
+				REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+			}
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_divl_32_i(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 divisor = OPER_I_32(state);
+		uint64 dividend  = 0;
+		uint64 quotient  = 0;
+		uint64 remainder = 0;
+
+		if(divisor != 0)
+		{
+			if(BIT_A(word2))	/* 64 bit */
+			{
+				dividend = REG_D[word2 & 7];
+				dividend <<= 32;
+				dividend |= REG_D[(word2 >> 12) & 7];
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)dividend / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)dividend % (sint64)((sint32)divisor));
+					if((sint64)quotient != (sint64)((sint32)quotient))
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					if(quotient > 0xffffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					remainder = dividend % divisor;
+				}
+			}
+			else	/* 32 bit */
+			{
+				dividend = REG_D[(word2 >> 12) & 7];
+				if(BIT_B(word2))	   /* signed */
+				{
+					quotient  = (uint64)((sint64)((sint32)dividend) / (sint64)((sint32)divisor));
+					remainder = (uint64)((sint64)((sint32)dividend) % (sint64)((sint32)divisor));
+				}
+				else					/* unsigned */
+				{
+					quotient = dividend / divisor;
+					remainder = dividend % divisor;
+				}
+			}
+
+			REG_D[word2 & 7] = remainder;
+			REG_D[(word2 >> 12) & 7] = quotient;
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint divisor = OPER_I_32(state);
+		uint dividend_hi = REG_D[word2 & 7];
+		uint dividend_lo = REG_D[(word2 >> 12) & 7];
+		uint quotient = 0;
+		uint remainder = 0;
+		uint dividend_neg = 0;
+		uint divisor_neg = 0;
+		sint i;
+		uint overflow;
+
+		if(divisor != 0)
+		{
+			/* quad / long : long quotient, long remainder */
+			if(BIT_A(word2))
+			{
+				if(BIT_B(word2))	   /* signed */
+				{
+					/* special case in signed divide */
+					if(dividend_hi == 0 && dividend_lo == 0x80000000 && divisor == 0xffffffff)
+					{
+						REG_D[word2 & 7] = 0;
+						REG_D[(word2 >> 12) & 7] = 0x80000000;
+
+						FLAG_N = NFLAG_SET;
+						FLAG_Z = ZFLAG_CLEAR;
+						FLAG_V = VFLAG_CLEAR;
+						FLAG_C = CFLAG_CLEAR;
+						return;
+					}
+					if(GET_MSB_32(dividend_hi))
+					{
+						dividend_neg = 1;
+						dividend_hi = (uint)MASK_OUT_ABOVE_32((-(sint)dividend_hi) - (dividend_lo != 0));
+						dividend_lo = (uint)MASK_OUT_ABOVE_32(-(sint)dividend_lo);
+					}
+					if(GET_MSB_32(divisor))
+					{
+						divisor_neg = 1;
+						divisor = (uint)MASK_OUT_ABOVE_32(-(sint)divisor);
+
+					}
+				}
+
+				/* if the upper long is greater than the divisor, we're overflowing. */
+				if(dividend_hi >= divisor)
+				{
+					FLAG_V = VFLAG_SET;
+					return;
+				}
+
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					remainder = (remainder << 1) + ((dividend_hi >> i) & 1);
+					if(remainder >= divisor)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+				for(i = 31; i >= 0; i--)
+				{
+					quotient <<= 1;
+					overflow = GET_MSB_32(remainder);
+					remainder = (remainder << 1) + ((dividend_lo >> i) & 1);
+					if(remainder >= divisor || overflow)
+					{
+						remainder -= divisor;
+						quotient++;
+					}
+				}
+
+				if(BIT_B(word2))	   /* signed */
+				{
+					if(quotient > 0x7fffffff)
+					{
+						FLAG_V = VFLAG_SET;
+						return;
+					}
+					if(dividend_neg)
+					{
+						remainder = (uint)MASK_OUT_ABOVE_32(-(sint)remainder);
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+					}
+					if(divisor_neg)
+						quotient = (uint)MASK_OUT_ABOVE_32(-(sint)quotient);
+				}
+
+				REG_D[word2 & 7] = remainder;
+				REG_D[(word2 >> 12) & 7] = quotient;
+
+				FLAG_N = NFLAG_32(quotient);
+				FLAG_Z = quotient;
+				FLAG_V = VFLAG_CLEAR;
+				FLAG_C = CFLAG_CLEAR;
+				return;
+			}
+
+			/* long / long: long quotient, maybe long remainder */
+			if(BIT_B(word2))	   /* signed */
+			{
+				/* Special case in divide */
+				if(dividend_lo == 0x80000000 && divisor == 0xffffffff)
+				{
+					FLAG_N = NFLAG_SET;
+					FLAG_Z = ZFLAG_CLEAR;
+					FLAG_V = VFLAG_CLEAR;
+					FLAG_C = CFLAG_CLEAR;
+					REG_D[(word2 >> 12) & 7] = 0x80000000;
+					REG_D[word2 & 7] = 0;
+					return;
+				}
+				REG_D[word2 & 7] = MAKE_INT_32(dividend_lo) % MAKE_INT_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MAKE_INT_32(dividend_lo) / MAKE_INT_32(divisor);
+			}
+			else
+			{
+				REG_D[word2 & 7] = MASK_OUT_ABOVE_32(dividend_lo) % MASK_OUT_ABOVE_32(divisor);
+				quotient = REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(dividend_lo) / MASK_OUT_ABOVE_32(divisor);
+			}
+
+			FLAG_N = NFLAG_32(quotient);
+			FLAG_Z = quotient;
+			FLAG_V = VFLAG_CLEAR;
+			FLAG_C = CFLAG_CLEAR;
+			return;
+		}
+		m68ki_exception_trap(state, EXCEPTION_ZERO_DIVIDE);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_eor_8_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8(DY ^= MASK_OUT_ABOVE_8(DX));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_8_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_8();
+	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_8_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_8();
+	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_8_pi7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PI_8();
+	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_8_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_8();
+	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_8_pd7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PD_8();
+	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_8_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_8();
+	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_8_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_8();
+	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_8_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_8();
+	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_8_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_8();
+	uint res = MASK_OUT_ABOVE_8(DX ^ m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_16_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(DY ^= MASK_OUT_ABOVE_16(DX));
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_16_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_16_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_16_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_16_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_16_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_16_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_16_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint res = MASK_OUT_ABOVE_16(DX ^ m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_32_d(m68ki_cpu_core *state)
+{
+	uint res = DY ^= DX;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_32_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_32();
+	uint res = DX ^ m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_32_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_32();
+	uint res = DX ^ m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_32_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_32();
+	uint res = DX ^ m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_32_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_32();
+	uint res = DX ^ m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_32_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_32();
+	uint res = DX ^ m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_32_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_32();
+	uint res = DX ^ m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eor_32_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_32();
+	uint res = DX ^ m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_8_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8(DY ^= OPER_I_8(state));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_8_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_AI_8();
+	uint res = src ^ m68ki_read_8(state, ea);
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_8_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_PI_8();
+	uint res = src ^ m68ki_read_8(state, ea);
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_8_pi7(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_A7_PI_8();
+	uint res = src ^ m68ki_read_8(state, ea);
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_8_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_PD_8();
+	uint res = src ^ m68ki_read_8(state, ea);
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_8_pd7(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_A7_PD_8();
+	uint res = src ^ m68ki_read_8(state, ea);
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_8_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_DI_8();
+	uint res = src ^ m68ki_read_8(state, ea);
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_8_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_IX_8();
+	uint res = src ^ m68ki_read_8(state, ea);
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_8_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AW_8();
+	uint res = src ^ m68ki_read_8(state, ea);
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_8_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AL_8();
+	uint res = src ^ m68ki_read_8(state, ea);
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_16_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(DY ^= OPER_I_16(state));
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_16_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_AI_16();
+	uint res = src ^ m68ki_read_16(state, ea);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_16_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_PI_16();
+	uint res = src ^ m68ki_read_16(state, ea);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_16_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_PD_16();
+	uint res = src ^ m68ki_read_16(state, ea);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_16_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_DI_16();
+	uint res = src ^ m68ki_read_16(state, ea);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_16_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_IX_16();
+	uint res = src ^ m68ki_read_16(state, ea);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_16_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AW_16();
+	uint res = src ^ m68ki_read_16(state, ea);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_16_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AL_16();
+	uint res = src ^ m68ki_read_16(state, ea);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_32_d(m68ki_cpu_core *state)
+{
+	uint res = DY ^= OPER_I_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_32_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_AI_32();
+	uint res = src ^ m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_32_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_PI_32();
+	uint res = src ^ m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_32_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_PD_32();
+	uint res = src ^ m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_32_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_DI_32();
+	uint res = src ^ m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_32_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_IX_32();
+	uint res = src ^ m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_32_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AW_32();
+	uint res = src ^ m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_32_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AL_32();
+	uint res = src ^ m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_eori_16_toc(m68ki_cpu_core *state)
+{
+	m68ki_set_ccr(state, m68ki_get_ccr(state) ^ OPER_I_8(state));
+}
+
+
+static void m68k_op_eori_16_tos(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint src = OPER_I_16(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_set_sr(state, m68ki_get_sr() ^ src);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_exg_32_dd(m68ki_cpu_core *state)
+{
+	uint* reg_a = &DX;
+	uint* reg_b = &DY;
+	uint tmp = *reg_a;
+	*reg_a = *reg_b;
+	*reg_b = tmp;
+}
+
+
+static void m68k_op_exg_32_aa(m68ki_cpu_core *state)
+{
+	uint* reg_a = &AX;
+	uint* reg_b = &AY;
+	uint tmp = *reg_a;
+	*reg_a = *reg_b;
+	*reg_b = tmp;
+}
+
+
+static void m68k_op_exg_32_da(m68ki_cpu_core *state)
+{
+	uint* reg_a = &DX;
+	uint* reg_b = &AY;
+	uint tmp = *reg_a;
+	*reg_a = *reg_b;
+	*reg_b = tmp;
+}
+
+
+static void m68k_op_ext_16(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | MASK_OUT_ABOVE_8(*r_dst) | (GET_MSB_8(*r_dst) ? 0xff00 : 0);
+
+	FLAG_N = NFLAG_16(*r_dst);
+	FLAG_Z = MASK_OUT_ABOVE_16(*r_dst);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_ext_32(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+
+	*r_dst = MASK_OUT_ABOVE_16(*r_dst) | (GET_MSB_16(*r_dst) ? 0xffff0000 : 0);
+
+	FLAG_N = NFLAG_32(*r_dst);
+	FLAG_Z = *r_dst;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_extb_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint* r_dst = &DY;
+
+		*r_dst = MASK_OUT_ABOVE_8(*r_dst) | (GET_MSB_8(*r_dst) ? 0xffffff00 : 0);
+
+		FLAG_N = NFLAG_32(*r_dst);
+		FLAG_Z = *r_dst;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_illegal(m68ki_cpu_core *state)
+{
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_jmp_32_ai(m68ki_cpu_core *state)
+{
+	m68ki_jump(state, EA_AY_AI_32());
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+}
+
+
+static void m68k_op_jmp_32_di(m68ki_cpu_core *state)
+{
+	m68ki_jump(state, EA_AY_DI_32());
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+}
+
+
+static void m68k_op_jmp_32_ix(m68ki_cpu_core *state)
+{
+	m68ki_jump(state, EA_AY_IX_32());
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+}
+
+
+static void m68k_op_jmp_32_aw(m68ki_cpu_core *state)
+{
+	m68ki_jump(state, EA_AW_32());
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+}
+
+
+static void m68k_op_jmp_32_al(m68ki_cpu_core *state)
+{
+	m68ki_jump(state, EA_AL_32());
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+}
+
+
+static void m68k_op_jmp_32_pcdi(m68ki_cpu_core *state)
+{
+	m68ki_jump(state, EA_PCDI_32());
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+}
+
+
+static void m68k_op_jmp_32_pcix(m68ki_cpu_core *state)
+{
+	m68ki_jump(state, EA_PCIX_32());
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+}
+
+
+static void m68k_op_jsr_32_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_32();
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+	m68ki_push_32(state, REG_PC);
+	m68ki_jump(state, ea);
+}
+
+
+static void m68k_op_jsr_32_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_32();
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+	m68ki_push_32(state, REG_PC);
+	m68ki_jump(state, ea);
+}
+
+
+static void m68k_op_jsr_32_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_32();
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+	m68ki_push_32(state, REG_PC);
+	m68ki_jump(state, ea);
+}
+
+
+static void m68k_op_jsr_32_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_32();
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+	m68ki_push_32(state, REG_PC);
+	m68ki_jump(state, ea);
+}
+
+
+static void m68k_op_jsr_32_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_32();
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+	m68ki_push_32(state, REG_PC);
+	m68ki_jump(state, ea);
+}
+
+
+static void m68k_op_jsr_32_pcdi(m68ki_cpu_core *state)
+{
+	uint ea = EA_PCDI_32();
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+	m68ki_push_32(state, REG_PC);
+	m68ki_jump(state, ea);
+}
+
+
+static void m68k_op_jsr_32_pcix(m68ki_cpu_core *state)
+{
+	uint ea = EA_PCIX_32();
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+	m68ki_push_32(state, REG_PC);
+	m68ki_jump(state, ea);
+}
+
+
+static void m68k_op_lea_32_ai(m68ki_cpu_core *state)
+{
+	AX = EA_AY_AI_32();
+}
+
+
+static void m68k_op_lea_32_di(m68ki_cpu_core *state)
+{
+	AX = EA_AY_DI_32();
+}
+
+
+static void m68k_op_lea_32_ix(m68ki_cpu_core *state)
+{
+	AX = EA_AY_IX_32();
+}
+
+
+static void m68k_op_lea_32_aw(m68ki_cpu_core *state)
+{
+	AX = EA_AW_32();
+}
+
+
+static void m68k_op_lea_32_al(m68ki_cpu_core *state)
+{
+	AX = EA_AL_32();
+}
+
+
+static void m68k_op_lea_32_pcdi(m68ki_cpu_core *state)
+{
+	AX = EA_PCDI_32();
+}
+
+
+static void m68k_op_lea_32_pcix(m68ki_cpu_core *state)
+{
+	AX = EA_PCIX_32();
+}
+
+
+static void m68k_op_link_16_a7(m68ki_cpu_core *state)
+{
+	REG_A[7] -= 4;
+	m68ki_write_32(state, REG_A[7], REG_A[7]);
+	REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + MAKE_INT_16(OPER_I_16(state)));
+}
+
+
+static void m68k_op_link_16(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AY;
+
+	m68ki_push_32(state, *r_dst);
+	*r_dst = REG_A[7];
+	REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + MAKE_INT_16(OPER_I_16(state)));
+}
+
+
+static void m68k_op_link_32_a7(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		REG_A[7] -= 4;
+		m68ki_write_32(state, REG_A[7], REG_A[7]);
+		REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + OPER_I_32(state));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_link_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint* r_dst = &AY;
+
+		m68ki_push_32(state, *r_dst);
+		*r_dst = REG_A[7];
+		REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + OPER_I_32(state));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_lsr_8_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src >> shift;
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src << (9-shift);
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsr_16_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src >> shift;
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src << (9-shift);
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsr_32_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = *r_dst;
+	uint res = src >> shift;
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src << (9-shift);
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsr_8_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = DX & 0x3f;
+	uint src = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = src >> shift;
+
+	if(shift != 0)
+	{
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+		if(shift <= 8)
+		{
+			*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+			FLAG_X = FLAG_C = src << (9-shift);
+			FLAG_N = NFLAG_CLEAR;
+			FLAG_Z = res;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		*r_dst &= 0xffffff00;
+		FLAG_X = XFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_N = NFLAG_CLEAR;
+		FLAG_Z = ZFLAG_SET;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_8(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsr_16_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = DX & 0x3f;
+	uint src = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = src >> shift;
+
+	if(shift != 0)
+	{
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+		if(shift <= 16)
+		{
+			*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+			FLAG_C = FLAG_X = (src >> (shift - 1))<<8;
+			FLAG_N = NFLAG_CLEAR;
+			FLAG_Z = res;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		*r_dst &= 0xffff0000;
+		FLAG_X = XFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_N = NFLAG_CLEAR;
+		FLAG_Z = ZFLAG_SET;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_16(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsr_32_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = DX & 0x3f;
+	uint src = *r_dst;
+	uint res = src >> shift;
+
+	if(shift != 0)
+	{
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+		if(shift < 32)
+		{
+			*r_dst = res;
+			FLAG_C = FLAG_X = (src >> (shift - 1))<<8;
+			FLAG_N = NFLAG_CLEAR;
+			FLAG_Z = res;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		*r_dst = 0;
+		FLAG_X = FLAG_C = (shift == 32 ? GET_MSB_32(src)>>23 : 0);
+		FLAG_N = NFLAG_CLEAR;
+		FLAG_Z = ZFLAG_SET;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_32(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsr_16_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = src >> 1;
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_Z = res;
+	FLAG_C = FLAG_X = src << 8;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsr_16_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = src >> 1;
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_Z = res;
+	FLAG_C = FLAG_X = src << 8;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsr_16_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = src >> 1;
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_Z = res;
+	FLAG_C = FLAG_X = src << 8;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsr_16_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = src >> 1;
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_Z = res;
+	FLAG_C = FLAG_X = src << 8;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsr_16_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = src >> 1;
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_Z = res;
+	FLAG_C = FLAG_X = src << 8;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsr_16_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = src >> 1;
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_Z = res;
+	FLAG_C = FLAG_X = src << 8;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsr_16_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = src >> 1;
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_CLEAR;
+	FLAG_Z = res;
+	FLAG_C = FLAG_X = src << 8;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsl_8_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = MASK_OUT_ABOVE_8(src << shift);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src << shift;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsl_16_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = MASK_OUT_ABOVE_16(src << shift);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> (8-shift);
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsl_32_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = *r_dst;
+	uint res = MASK_OUT_ABOVE_32(src << shift);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> (24-shift);
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsl_8_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = DX & 0x3f;
+	uint src = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = MASK_OUT_ABOVE_8(src << shift);
+
+	if(shift != 0)
+	{
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+		if(shift <= 8)
+		{
+			*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+			FLAG_X = FLAG_C = src << shift;
+			FLAG_N = NFLAG_8(res);
+			FLAG_Z = res;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		*r_dst &= 0xffffff00;
+		FLAG_X = XFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_N = NFLAG_CLEAR;
+		FLAG_Z = ZFLAG_SET;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_8(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsl_16_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = DX & 0x3f;
+	uint src = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = MASK_OUT_ABOVE_16(src << shift);
+
+	if(shift != 0)
+	{
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+		if(shift <= 16)
+		{
+			*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+			FLAG_X = FLAG_C = (src << shift) >> 8;
+			FLAG_N = NFLAG_16(res);
+			FLAG_Z = res;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		*r_dst &= 0xffff0000;
+		FLAG_X = XFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_N = NFLAG_CLEAR;
+		FLAG_Z = ZFLAG_SET;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_16(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsl_32_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = DX & 0x3f;
+	uint src = *r_dst;
+	uint res = MASK_OUT_ABOVE_32(src << shift);
+
+	if(shift != 0)
+	{
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+		if(shift < 32)
+		{
+			*r_dst = res;
+			FLAG_X = FLAG_C = (src >> (32 - shift)) << 8;
+			FLAG_N = NFLAG_32(res);
+			FLAG_Z = res;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		*r_dst = 0;
+		FLAG_X = FLAG_C = ((shift == 32 ? src & 1 : 0))<<8;
+		FLAG_N = NFLAG_CLEAR;
+		FLAG_Z = ZFLAG_SET;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_32(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsl_16_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(src << 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> 7;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsl_16_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(src << 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> 7;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsl_16_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(src << 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> 7;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsl_16_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(src << 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> 7;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsl_16_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(src << 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> 7;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsl_16_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(src << 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> 7;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_lsl_16_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(src << 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_X = FLAG_C = src >> 7;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_d_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8(DY);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_d_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_8(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_d_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_8(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_d_pi7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PI_8(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_d_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_8(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_d_pd7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PD_8(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_d_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_8(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_d_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_8(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_d_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_8(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_d_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_8(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_d_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_8(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_d_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_8(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_d_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_8(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ai_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8(DY);
+	uint ea = EA_AX_AI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ai_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_8(state);
+	uint ea = EA_AX_AI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ai_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_8(state);
+	uint ea = EA_AX_AI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ai_pi7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PI_8(state);
+	uint ea = EA_AX_AI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ai_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_8(state);
+	uint ea = EA_AX_AI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ai_pd7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PD_8(state);
+	uint ea = EA_AX_AI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ai_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_8(state);
+	uint ea = EA_AX_AI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ai_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_8(state);
+	uint ea = EA_AX_AI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ai_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_8(state);
+	uint ea = EA_AX_AI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ai_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_8(state);
+	uint ea = EA_AX_AI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ai_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_8(state);
+	uint ea = EA_AX_AI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ai_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_8(state);
+	uint ea = EA_AX_AI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ai_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_8(state);
+	uint ea = EA_AX_AI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi7_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8(DY);
+	uint ea = EA_A7_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8(DY);
+	uint ea = EA_AX_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi7_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_8(state);
+	uint ea = EA_A7_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi7_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_8(state);
+	uint ea = EA_A7_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi7_pi7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PI_8(state);
+	uint ea = EA_A7_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi7_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_8(state);
+	uint ea = EA_A7_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi7_pd7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PD_8(state);
+	uint ea = EA_A7_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi7_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_8(state);
+	uint ea = EA_A7_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi7_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_8(state);
+	uint ea = EA_A7_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi7_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_8(state);
+	uint ea = EA_A7_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi7_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_8(state);
+	uint ea = EA_A7_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi7_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_8(state);
+	uint ea = EA_A7_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi7_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_8(state);
+	uint ea = EA_A7_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi7_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_8(state);
+	uint ea = EA_A7_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_8(state);
+	uint ea = EA_AX_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_8(state);
+	uint ea = EA_AX_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi_pi7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PI_8(state);
+	uint ea = EA_AX_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_8(state);
+	uint ea = EA_AX_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi_pd7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PD_8(state);
+	uint ea = EA_AX_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_8(state);
+	uint ea = EA_AX_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_8(state);
+	uint ea = EA_AX_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_8(state);
+	uint ea = EA_AX_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_8(state);
+	uint ea = EA_AX_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_8(state);
+	uint ea = EA_AX_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_8(state);
+	uint ea = EA_AX_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pi_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_8(state);
+	uint ea = EA_AX_PI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd7_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8(DY);
+	uint ea = EA_A7_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8(DY);
+	uint ea = EA_AX_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd7_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_8(state);
+	uint ea = EA_A7_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd7_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_8(state);
+	uint ea = EA_A7_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd7_pi7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PI_8(state);
+	uint ea = EA_A7_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd7_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_8(state);
+	uint ea = EA_A7_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd7_pd7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PD_8(state);
+	uint ea = EA_A7_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd7_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_8(state);
+	uint ea = EA_A7_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd7_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_8(state);
+	uint ea = EA_A7_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd7_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_8(state);
+	uint ea = EA_A7_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd7_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_8(state);
+	uint ea = EA_A7_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd7_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_8(state);
+	uint ea = EA_A7_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd7_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_8(state);
+	uint ea = EA_A7_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd7_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_8(state);
+	uint ea = EA_A7_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_8(state);
+	uint ea = EA_AX_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_8(state);
+	uint ea = EA_AX_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd_pi7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PI_8(state);
+	uint ea = EA_AX_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_8(state);
+	uint ea = EA_AX_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd_pd7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PD_8(state);
+	uint ea = EA_AX_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_8(state);
+	uint ea = EA_AX_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_8(state);
+	uint ea = EA_AX_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_8(state);
+	uint ea = EA_AX_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_8(state);
+	uint ea = EA_AX_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_8(state);
+	uint ea = EA_AX_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_8(state);
+	uint ea = EA_AX_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_pd_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_8(state);
+	uint ea = EA_AX_PD_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_di_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8(DY);
+	uint ea = EA_AX_DI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_di_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_8(state);
+	uint ea = EA_AX_DI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_di_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_8(state);
+	uint ea = EA_AX_DI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_di_pi7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PI_8(state);
+	uint ea = EA_AX_DI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_di_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_8(state);
+	uint ea = EA_AX_DI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_di_pd7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PD_8(state);
+	uint ea = EA_AX_DI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_di_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_8(state);
+	uint ea = EA_AX_DI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_di_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_8(state);
+	uint ea = EA_AX_DI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_di_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_8(state);
+	uint ea = EA_AX_DI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_di_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_8(state);
+	uint ea = EA_AX_DI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_di_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_8(state);
+	uint ea = EA_AX_DI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_di_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_8(state);
+	uint ea = EA_AX_DI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_di_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_8(state);
+	uint ea = EA_AX_DI_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ix_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8(DY);
+	uint ea = EA_AX_IX_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ix_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_8(state);
+	uint ea = EA_AX_IX_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ix_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_8(state);
+	uint ea = EA_AX_IX_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ix_pi7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PI_8(state);
+	uint ea = EA_AX_IX_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ix_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_8(state);
+	uint ea = EA_AX_IX_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ix_pd7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PD_8(state);
+	uint ea = EA_AX_IX_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ix_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_8(state);
+	uint ea = EA_AX_IX_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ix_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_8(state);
+	uint ea = EA_AX_IX_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ix_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_8(state);
+	uint ea = EA_AX_IX_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ix_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_8(state);
+	uint ea = EA_AX_IX_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ix_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_8(state);
+	uint ea = EA_AX_IX_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ix_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_8(state);
+	uint ea = EA_AX_IX_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_ix_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_8(state);
+	uint ea = EA_AX_IX_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_aw_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8(DY);
+	uint ea = EA_AW_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_aw_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_8(state);
+	uint ea = EA_AW_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_aw_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_8(state);
+	uint ea = EA_AW_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_aw_pi7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PI_8(state);
+	uint ea = EA_AW_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_aw_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_8(state);
+	uint ea = EA_AW_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_aw_pd7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PD_8(state);
+	uint ea = EA_AW_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_aw_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_8(state);
+	uint ea = EA_AW_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_aw_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_8(state);
+	uint ea = EA_AW_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_aw_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_8(state);
+	uint ea = EA_AW_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_aw_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_8(state);
+	uint ea = EA_AW_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_aw_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_8(state);
+	uint ea = EA_AW_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_aw_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_8(state);
+	uint ea = EA_AW_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_aw_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_8(state);
+	uint ea = EA_AW_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_al_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8(DY);
+	uint ea = EA_AL_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_al_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_8(state);
+	uint ea = EA_AL_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_al_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_8(state);
+	uint ea = EA_AL_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_al_pi7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PI_8(state);
+	uint ea = EA_AL_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_al_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_8(state);
+	uint ea = EA_AL_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_al_pd7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PD_8(state);
+	uint ea = EA_AL_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_al_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_8(state);
+	uint ea = EA_AL_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_al_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_8(state);
+	uint ea = EA_AL_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_al_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_8(state);
+	uint ea = EA_AL_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_al_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_8(state);
+	uint ea = EA_AL_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_al_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_8(state);
+	uint ea = EA_AL_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_al_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_8(state);
+	uint ea = EA_AL_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_8_al_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_8(state);
+	uint ea = EA_AL_8();
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_d_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(DY);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_d_a(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(AY);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_d_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_16(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_d_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_16(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_d_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_16(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_d_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_16(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_d_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_16(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_d_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_16(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_d_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_16(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_d_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_16(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_d_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_16(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_d_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_16(state);
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ai_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(DY);
+	uint ea = EA_AX_AI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ai_a(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(AY);
+	uint ea = EA_AX_AI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ai_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_16(state);
+	uint ea = EA_AX_AI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ai_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_16(state);
+	uint ea = EA_AX_AI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ai_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_16(state);
+	uint ea = EA_AX_AI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ai_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_16(state);
+	uint ea = EA_AX_AI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ai_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_16(state);
+	uint ea = EA_AX_AI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ai_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_16(state);
+	uint ea = EA_AX_AI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ai_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_16(state);
+	uint ea = EA_AX_AI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ai_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_16(state);
+	uint ea = EA_AX_AI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ai_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_16(state);
+	uint ea = EA_AX_AI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ai_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_16(state);
+	uint ea = EA_AX_AI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pi_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(DY);
+	uint ea = EA_AX_PI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pi_a(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(AY);
+	uint ea = EA_AX_PI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pi_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_16(state);
+	uint ea = EA_AX_PI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pi_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_16(state);
+	uint ea = EA_AX_PI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pi_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_16(state);
+	uint ea = EA_AX_PI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pi_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_16(state);
+	uint ea = EA_AX_PI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pi_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_16(state);
+	uint ea = EA_AX_PI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pi_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_16(state);
+	uint ea = EA_AX_PI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pi_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_16(state);
+	uint ea = EA_AX_PI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pi_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_16(state);
+	uint ea = EA_AX_PI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pi_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_16(state);
+	uint ea = EA_AX_PI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pi_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_16(state);
+	uint ea = EA_AX_PI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pd_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(DY);
+	uint ea = EA_AX_PD_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pd_a(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(AY);
+	uint ea = EA_AX_PD_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pd_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_16(state);
+	uint ea = EA_AX_PD_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pd_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_16(state);
+	uint ea = EA_AX_PD_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pd_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_16(state);
+	uint ea = EA_AX_PD_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pd_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_16(state);
+	uint ea = EA_AX_PD_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pd_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_16(state);
+	uint ea = EA_AX_PD_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pd_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_16(state);
+	uint ea = EA_AX_PD_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pd_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_16(state);
+	uint ea = EA_AX_PD_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pd_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_16(state);
+	uint ea = EA_AX_PD_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pd_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_16(state);
+	uint ea = EA_AX_PD_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_pd_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_16(state);
+	uint ea = EA_AX_PD_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_di_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(DY);
+	uint ea = EA_AX_DI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_di_a(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(AY);
+	uint ea = EA_AX_DI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_di_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_16(state);
+	uint ea = EA_AX_DI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_di_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_16(state);
+	uint ea = EA_AX_DI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_di_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_16(state);
+	uint ea = EA_AX_DI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_di_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_16(state);
+	uint ea = EA_AX_DI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_di_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_16(state);
+	uint ea = EA_AX_DI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_di_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_16(state);
+	uint ea = EA_AX_DI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_di_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_16(state);
+	uint ea = EA_AX_DI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_di_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_16(state);
+	uint ea = EA_AX_DI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_di_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_16(state);
+	uint ea = EA_AX_DI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_di_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_16(state);
+	uint ea = EA_AX_DI_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ix_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(DY);
+	uint ea = EA_AX_IX_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ix_a(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(AY);
+	uint ea = EA_AX_IX_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ix_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_16(state);
+	uint ea = EA_AX_IX_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ix_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_16(state);
+	uint ea = EA_AX_IX_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ix_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_16(state);
+	uint ea = EA_AX_IX_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ix_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_16(state);
+	uint ea = EA_AX_IX_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ix_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_16(state);
+	uint ea = EA_AX_IX_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ix_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_16(state);
+	uint ea = EA_AX_IX_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ix_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_16(state);
+	uint ea = EA_AX_IX_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ix_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_16(state);
+	uint ea = EA_AX_IX_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ix_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_16(state);
+	uint ea = EA_AX_IX_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_ix_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_16(state);
+	uint ea = EA_AX_IX_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_aw_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(DY);
+	uint ea = EA_AW_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_aw_a(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(AY);
+	uint ea = EA_AW_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_aw_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_16(state);
+	uint ea = EA_AW_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_aw_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_16(state);
+	uint ea = EA_AW_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_aw_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_16(state);
+	uint ea = EA_AW_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_aw_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_16(state);
+	uint ea = EA_AW_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_aw_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_16(state);
+	uint ea = EA_AW_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_aw_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_16(state);
+	uint ea = EA_AW_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_aw_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_16(state);
+	uint ea = EA_AW_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_aw_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_16(state);
+	uint ea = EA_AW_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_aw_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_16(state);
+	uint ea = EA_AW_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_aw_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_16(state);
+	uint ea = EA_AW_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_al_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(DY);
+	uint ea = EA_AL_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_al_a(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(AY);
+	uint ea = EA_AL_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_al_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_16(state);
+	uint ea = EA_AL_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_al_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_16(state);
+	uint ea = EA_AL_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_al_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_16(state);
+	uint ea = EA_AL_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_al_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_16(state);
+	uint ea = EA_AL_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_al_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_16(state);
+	uint ea = EA_AL_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_al_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_16(state);
+	uint ea = EA_AL_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_al_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_16(state);
+	uint ea = EA_AL_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_al_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_16(state);
+	uint ea = EA_AL_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_al_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_16(state);
+	uint ea = EA_AL_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_16_al_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_16(state);
+	uint ea = EA_AL_16();
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_d_d(m68ki_cpu_core *state)
+{
+	uint res = DY;
+	uint* r_dst = &DX;
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_d_a(m68ki_cpu_core *state)
+{
+	uint res = AY;
+	uint* r_dst = &DX;
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_d_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_32(state);
+	uint* r_dst = &DX;
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_d_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_32(state);
+	uint* r_dst = &DX;
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_d_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_32(state);
+	uint* r_dst = &DX;
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_d_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_32(state);
+	uint* r_dst = &DX;
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_d_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_32(state);
+	uint* r_dst = &DX;
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_d_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_32(state);
+	uint* r_dst = &DX;
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_d_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_32(state);
+	uint* r_dst = &DX;
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_d_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_32(state);
+	uint* r_dst = &DX;
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_d_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_32(state);
+	uint* r_dst = &DX;
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_d_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_32(state);
+	uint* r_dst = &DX;
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ai_d(m68ki_cpu_core *state)
+{
+	uint res = DY;
+	uint ea = EA_AX_AI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ai_a(m68ki_cpu_core *state)
+{
+	uint res = AY;
+	uint ea = EA_AX_AI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ai_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_32(state);
+	uint ea = EA_AX_AI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ai_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_32(state);
+	uint ea = EA_AX_AI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ai_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_32(state);
+	uint ea = EA_AX_AI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ai_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_32(state);
+	uint ea = EA_AX_AI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ai_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_32(state);
+	uint ea = EA_AX_AI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ai_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_32(state);
+	uint ea = EA_AX_AI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ai_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_32(state);
+	uint ea = EA_AX_AI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ai_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_32(state);
+	uint ea = EA_AX_AI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ai_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_32(state);
+	uint ea = EA_AX_AI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ai_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_32(state);
+	uint ea = EA_AX_AI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pi_d(m68ki_cpu_core *state)
+{
+	uint res = DY;
+	uint ea = EA_AX_PI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pi_a(m68ki_cpu_core *state)
+{
+	uint res = AY;
+	uint ea = EA_AX_PI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pi_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_32(state);
+	uint ea = EA_AX_PI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pi_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_32(state);
+	uint ea = EA_AX_PI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pi_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_32(state);
+	uint ea = EA_AX_PI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pi_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_32(state);
+	uint ea = EA_AX_PI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pi_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_32(state);
+	uint ea = EA_AX_PI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pi_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_32(state);
+	uint ea = EA_AX_PI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pi_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_32(state);
+	uint ea = EA_AX_PI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pi_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_32(state);
+	uint ea = EA_AX_PI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pi_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_32(state);
+	uint ea = EA_AX_PI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pi_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_32(state);
+	uint ea = EA_AX_PI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pd_d(m68ki_cpu_core *state)
+{
+	uint res = DY;
+	uint ea = EA_AX_PD_32();
+
+	m68ki_write_16(state, ea+2, res & 0xFFFF );
+	m68ki_write_16(state, ea, (res >> 16) & 0xFFFF );
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pd_a(m68ki_cpu_core *state)
+{
+	uint res = AY;
+	uint ea = EA_AX_PD_32();
+
+	m68ki_write_16(state, ea+2, res & 0xFFFF );
+	m68ki_write_16(state, ea, (res >> 16) & 0xFFFF );
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pd_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_32(state);
+	uint ea = EA_AX_PD_32();
+
+	m68ki_write_16(state, ea+2, res & 0xFFFF );
+	m68ki_write_16(state, ea, (res >> 16) & 0xFFFF );
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pd_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_32(state);
+	uint ea = EA_AX_PD_32();
+
+	m68ki_write_16(state, ea+2, res & 0xFFFF );
+	m68ki_write_16(state, ea, (res >> 16) & 0xFFFF );
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pd_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_32(state);
+	uint ea = EA_AX_PD_32();
+
+	m68ki_write_16(state, ea+2, res & 0xFFFF );
+	m68ki_write_16(state, ea, (res >> 16) & 0xFFFF );
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pd_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_32(state);
+	uint ea = EA_AX_PD_32();
+
+	m68ki_write_16(state, ea+2, res & 0xFFFF );
+	m68ki_write_16(state, ea, (res >> 16) & 0xFFFF );
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pd_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_32(state);
+	uint ea = EA_AX_PD_32();
+
+	m68ki_write_16(state, ea+2, res & 0xFFFF );
+	m68ki_write_16(state, ea, (res >> 16) & 0xFFFF );
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pd_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_32(state);
+	uint ea = EA_AX_PD_32();
+
+	m68ki_write_16(state, ea+2, res & 0xFFFF );
+	m68ki_write_16(state, ea, (res >> 16) & 0xFFFF );
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pd_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_32(state);
+	uint ea = EA_AX_PD_32();
+
+	m68ki_write_16(state, ea+2, res & 0xFFFF );
+	m68ki_write_16(state, ea, (res >> 16) & 0xFFFF );
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pd_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_32(state);
+	uint ea = EA_AX_PD_32();
+
+	m68ki_write_16(state, ea+2, res & 0xFFFF );
+	m68ki_write_16(state, ea, (res >> 16) & 0xFFFF );
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pd_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_32(state);
+	uint ea = EA_AX_PD_32();
+
+	m68ki_write_16(state, ea+2, res & 0xFFFF );
+	m68ki_write_16(state, ea, (res >> 16) & 0xFFFF );
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_pd_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_32(state);
+	uint ea = EA_AX_PD_32();
+
+	m68ki_write_16(state, ea+2, res & 0xFFFF );
+	m68ki_write_16(state, ea, (res >> 16) & 0xFFFF );
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_di_d(m68ki_cpu_core *state)
+{
+	uint res = DY;
+	uint ea = EA_AX_DI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_di_a(m68ki_cpu_core *state)
+{
+	uint res = AY;
+	uint ea = EA_AX_DI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_di_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_32(state);
+	uint ea = EA_AX_DI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_di_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_32(state);
+	uint ea = EA_AX_DI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_di_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_32(state);
+	uint ea = EA_AX_DI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_di_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_32(state);
+	uint ea = EA_AX_DI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_di_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_32(state);
+	uint ea = EA_AX_DI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_di_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_32(state);
+	uint ea = EA_AX_DI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_di_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_32(state);
+	uint ea = EA_AX_DI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_di_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_32(state);
+	uint ea = EA_AX_DI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_di_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_32(state);
+	uint ea = EA_AX_DI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_di_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_32(state);
+	uint ea = EA_AX_DI_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ix_d(m68ki_cpu_core *state)
+{
+	uint res = DY;
+	uint ea = EA_AX_IX_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ix_a(m68ki_cpu_core *state)
+{
+	uint res = AY;
+	uint ea = EA_AX_IX_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ix_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_32(state);
+	uint ea = EA_AX_IX_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ix_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_32(state);
+	uint ea = EA_AX_IX_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ix_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_32(state);
+	uint ea = EA_AX_IX_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ix_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_32(state);
+	uint ea = EA_AX_IX_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ix_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_32(state);
+	uint ea = EA_AX_IX_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ix_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_32(state);
+	uint ea = EA_AX_IX_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ix_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_32(state);
+	uint ea = EA_AX_IX_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ix_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_32(state);
+	uint ea = EA_AX_IX_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ix_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_32(state);
+	uint ea = EA_AX_IX_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_ix_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_32(state);
+	uint ea = EA_AX_IX_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_aw_d(m68ki_cpu_core *state)
+{
+	uint res = DY;
+	uint ea = EA_AW_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_aw_a(m68ki_cpu_core *state)
+{
+	uint res = AY;
+	uint ea = EA_AW_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_aw_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_32(state);
+	uint ea = EA_AW_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_aw_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_32(state);
+	uint ea = EA_AW_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_aw_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_32(state);
+	uint ea = EA_AW_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_aw_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_32(state);
+	uint ea = EA_AW_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_aw_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_32(state);
+	uint ea = EA_AW_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_aw_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_32(state);
+	uint ea = EA_AW_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_aw_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_32(state);
+	uint ea = EA_AW_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_aw_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_32(state);
+	uint ea = EA_AW_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_aw_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_32(state);
+	uint ea = EA_AW_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_aw_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_32(state);
+	uint ea = EA_AW_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_al_d(m68ki_cpu_core *state)
+{
+	uint res = DY;
+	uint ea = EA_AL_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_al_a(m68ki_cpu_core *state)
+{
+	uint res = AY;
+	uint ea = EA_AL_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_al_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_32(state);
+	uint ea = EA_AL_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_al_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_32(state);
+	uint ea = EA_AL_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_al_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_32(state);
+	uint ea = EA_AL_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_al_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_32(state);
+	uint ea = EA_AL_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_al_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_32(state);
+	uint ea = EA_AL_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_al_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_32(state);
+	uint ea = EA_AL_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_al_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_32(state);
+	uint ea = EA_AL_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_al_pcdi(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCDI_32(state);
+	uint ea = EA_AL_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_al_pcix(m68ki_cpu_core *state)
+{
+	uint res = OPER_PCIX_32(state);
+	uint ea = EA_AL_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move_32_al_i(m68ki_cpu_core *state)
+{
+	uint res = OPER_I_32(state);
+	uint ea = EA_AL_32();
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_movea_16_d(m68ki_cpu_core *state)
+{
+	AX = MAKE_INT_16(DY);
+}
+
+
+static void m68k_op_movea_16_a(m68ki_cpu_core *state)
+{
+	AX = MAKE_INT_16(AY);
+}
+
+
+static void m68k_op_movea_16_ai(m68ki_cpu_core *state)
+{
+	AX = MAKE_INT_16(OPER_AY_AI_16(state));
+}
+
+
+static void m68k_op_movea_16_pi(m68ki_cpu_core *state)
+{
+	AX = MAKE_INT_16(OPER_AY_PI_16(state));
+}
+
+
+static void m68k_op_movea_16_pd(m68ki_cpu_core *state)
+{
+	AX = MAKE_INT_16(OPER_AY_PD_16(state));
+}
+
+
+static void m68k_op_movea_16_di(m68ki_cpu_core *state)
+{
+	AX = MAKE_INT_16(OPER_AY_DI_16(state));
+}
+
+
+static void m68k_op_movea_16_ix(m68ki_cpu_core *state)
+{
+	AX = MAKE_INT_16(OPER_AY_IX_16(state));
+}
+
+
+static void m68k_op_movea_16_aw(m68ki_cpu_core *state)
+{
+	AX = MAKE_INT_16(OPER_AW_16(state));
+}
+
+
+static void m68k_op_movea_16_al(m68ki_cpu_core *state)
+{
+	AX = MAKE_INT_16(OPER_AL_16(state));
+}
+
+
+static void m68k_op_movea_16_pcdi(m68ki_cpu_core *state)
+{
+	AX = MAKE_INT_16(OPER_PCDI_16(state));
+}
+
+
+static void m68k_op_movea_16_pcix(m68ki_cpu_core *state)
+{
+	AX = MAKE_INT_16(OPER_PCIX_16(state));
+}
+
+
+static void m68k_op_movea_16_i(m68ki_cpu_core *state)
+{
+	AX = MAKE_INT_16(OPER_I_16(state));
+}
+
+
+static void m68k_op_movea_32_d(m68ki_cpu_core *state)
+{
+	AX = DY;
+}
+
+
+static void m68k_op_movea_32_a(m68ki_cpu_core *state)
+{
+	AX = AY;
+}
+
+
+static void m68k_op_movea_32_ai(m68ki_cpu_core *state)
+{
+	AX = OPER_AY_AI_32(state);
+}
+
+
+static void m68k_op_movea_32_pi(m68ki_cpu_core *state)
+{
+	AX = OPER_AY_PI_32(state);
+}
+
+
+static void m68k_op_movea_32_pd(m68ki_cpu_core *state)
+{
+	AX = OPER_AY_PD_32(state);
+}
+
+
+static void m68k_op_movea_32_di(m68ki_cpu_core *state)
+{
+	AX = OPER_AY_DI_32(state);
+}
+
+
+static void m68k_op_movea_32_ix(m68ki_cpu_core *state)
+{
+	AX = OPER_AY_IX_32(state);
+}
+
+
+static void m68k_op_movea_32_aw(m68ki_cpu_core *state)
+{
+	AX = OPER_AW_32(state);
+}
+
+
+static void m68k_op_movea_32_al(m68ki_cpu_core *state)
+{
+	AX = OPER_AL_32(state);
+}
+
+
+static void m68k_op_movea_32_pcdi(m68ki_cpu_core *state)
+{
+	AX = OPER_PCDI_32(state);
+}
+
+
+static void m68k_op_movea_32_pcix(m68ki_cpu_core *state)
+{
+	AX = OPER_PCIX_32(state);
+}
+
+
+static void m68k_op_movea_32_i(m68ki_cpu_core *state)
+{
+	AX = OPER_I_32(state);
+}
+
+
+static void m68k_op_move_16_frc_d(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		DY = MASK_OUT_BELOW_16(DY) | m68ki_get_ccr(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_move_16_frc_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		m68ki_write_16(state, EA_AY_AI_16(), m68ki_get_ccr(state));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_move_16_frc_pi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		m68ki_write_16(state, EA_AY_PI_16(), m68ki_get_ccr(state));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_move_16_frc_pd(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		m68ki_write_16(state, EA_AY_PD_16(), m68ki_get_ccr(state));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_move_16_frc_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		m68ki_write_16(state, EA_AY_DI_16(), m68ki_get_ccr(state));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_move_16_frc_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		m68ki_write_16(state, EA_AY_IX_16(), m68ki_get_ccr(state));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_move_16_frc_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		m68ki_write_16(state, EA_AW_16(), m68ki_get_ccr(state));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_move_16_frc_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		m68ki_write_16(state, EA_AL_16(), m68ki_get_ccr(state));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_move_16_toc_d(m68ki_cpu_core *state)
+{
+	m68ki_set_ccr(state, DY);
+}
+
+
+static void m68k_op_move_16_toc_ai(m68ki_cpu_core *state)
+{
+	m68ki_set_ccr(state, OPER_AY_AI_16(state));
+}
+
+
+static void m68k_op_move_16_toc_pi(m68ki_cpu_core *state)
+{
+	m68ki_set_ccr(state, OPER_AY_PI_16(state));
+}
+
+
+static void m68k_op_move_16_toc_pd(m68ki_cpu_core *state)
+{
+	m68ki_set_ccr(state, OPER_AY_PD_16(state));
+}
+
+
+static void m68k_op_move_16_toc_di(m68ki_cpu_core *state)
+{
+	m68ki_set_ccr(state, OPER_AY_DI_16(state));
+}
+
+
+static void m68k_op_move_16_toc_ix(m68ki_cpu_core *state)
+{
+	m68ki_set_ccr(state, OPER_AY_IX_16(state));
+}
+
+
+static void m68k_op_move_16_toc_aw(m68ki_cpu_core *state)
+{
+	m68ki_set_ccr(state, OPER_AW_16(state));
+}
+
+
+static void m68k_op_move_16_toc_al(m68ki_cpu_core *state)
+{
+	m68ki_set_ccr(state, OPER_AL_16(state));
+}
+
+
+static void m68k_op_move_16_toc_pcdi(m68ki_cpu_core *state)
+{
+	m68ki_set_ccr(state, OPER_PCDI_16(state));
+}
+
+
+static void m68k_op_move_16_toc_pcix(m68ki_cpu_core *state)
+{
+	m68ki_set_ccr(state, OPER_PCIX_16(state));
+}
+
+
+static void m68k_op_move_16_toc_i(m68ki_cpu_core *state)
+{
+	m68ki_set_ccr(state, OPER_I_16(state));
+}
+
+
+static void m68k_op_move_16_frs_d(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+	{
+		DY = MASK_OUT_BELOW_16(DY) | m68ki_get_sr();
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_frs_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+	{
+		uint ea = EA_AY_AI_16();
+		m68ki_write_16(state, ea, m68ki_get_sr());
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_frs_pi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+	{
+		uint ea = EA_AY_PI_16();
+		m68ki_write_16(state, ea, m68ki_get_sr());
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_frs_pd(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+	{
+		uint ea = EA_AY_PD_16();
+		m68ki_write_16(state, ea, m68ki_get_sr());
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_frs_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+	{
+		uint ea = EA_AY_DI_16();
+		m68ki_write_16(state, ea, m68ki_get_sr());
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_frs_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+	{
+		uint ea = EA_AY_IX_16();
+		m68ki_write_16(state, ea, m68ki_get_sr());
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_frs_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+	{
+		uint ea = EA_AW_16();
+		m68ki_write_16(state, ea, m68ki_get_sr());
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_frs_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
+	{
+		uint ea = EA_AL_16();
+		m68ki_write_16(state, ea, m68ki_get_sr());
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_tos_d(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		m68ki_set_sr(state, DY);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_tos_ai(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint new_sr = OPER_AY_AI_16(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_set_sr(state, new_sr);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_tos_pi(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint new_sr = OPER_AY_PI_16(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_set_sr(state, new_sr);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_tos_pd(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint new_sr = OPER_AY_PD_16(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_set_sr(state, new_sr);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_tos_di(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint new_sr = OPER_AY_DI_16(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_set_sr(state, new_sr);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_tos_ix(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint new_sr = OPER_AY_IX_16(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_set_sr(state, new_sr);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_tos_aw(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint new_sr = OPER_AW_16(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_set_sr(state, new_sr);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_tos_al(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint new_sr = OPER_AL_16(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_set_sr(state, new_sr);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_tos_pcdi(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint new_sr = OPER_PCDI_16(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_set_sr(state, new_sr);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_tos_pcix(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint new_sr = OPER_PCIX_16(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_set_sr(state, new_sr);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_16_tos_i(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint new_sr = OPER_I_16(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_set_sr(state, new_sr);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_32_fru(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		AY = REG_USP;
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_move_32_tou(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		REG_USP = AY;
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_movec_32_cr(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+
+			m68ki_trace_t0();		   /* auto-disable (see m68kcpu.h) */
+			switch (word2 & 0xfff)
+			{
+			case 0x000:			   /* SFC */
+				REG_DA[(word2 >> 12) & 15] = REG_SFC;
+				return;
+			case 0x001:			   /* DFC */
+				REG_DA[(word2 >> 12) & 15] = REG_DFC;
+				return;
+			case 0x002:			   /* CACR */
+				if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+				{
+					REG_DA[(word2 >> 12) & 15] = REG_CACR;
+					return;
+				}
+				return;
+			case 0x800:			   /* USP */
+				REG_DA[(word2 >> 12) & 15] = REG_USP;
+				return;
+			case 0x801:			   /* VBR */
+				REG_DA[(word2 >> 12) & 15] = REG_VBR;
+				return;
+			case 0x802:			   /* CAAR */
+				if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+				{
+					REG_DA[(word2 >> 12) & 15] = REG_CAAR;
+					return;
+				}
+				m68ki_exception_illegal(state);
+				break;
+			case 0x803:			   /* MSP */
+				if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+				{
+					REG_DA[(word2 >> 12) & 15] = FLAG_M ? REG_SP : REG_MSP;
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x804:			   /* ISP */
+				if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+				{
+					REG_DA[(word2 >> 12) & 15] = FLAG_M ? REG_ISP : REG_SP;
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x003:				/* TC */
+				if(CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					REG_DA[(word2 >> 12) & 15] = state->mmu_tc;
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x004:				/* ITT0 */
+				if(CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					REG_DA[(word2 >> 12) & 15] = state->mmu_itt0;
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x005:				/* ITT1 */
+				if(CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					REG_DA[(word2 >> 12) & 15] = state->mmu_itt1;
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x006:				/* DTT0 */
+				if(CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					REG_DA[(word2 >> 12) & 15] = state->mmu_dtt0;
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x007:				/* DTT1 */
+				if(CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					REG_DA[(word2 >> 12) & 15] = state->mmu_dtt1;
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x805:				/* MMUSR */
+				if(CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					REG_DA[(word2 >> 12) & 15] = state->mmu_sr_040;
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x806:				/* URP */
+				if(CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					REG_DA[(word2 >> 12) & 15] = state->mmu_urp_aptr;
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x807:				/* SRP */
+				if(CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					REG_DA[(word2 >> 12) & 15] = state->mmu_srp_aptr;
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			default:
+				m68ki_exception_illegal(state);
+				return;
+			}
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_movec_32_rc(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+
+			m68ki_trace_t0();		   /* auto-disable (see m68kcpu.h) */
+			switch (word2 & 0xfff)
+			{
+			case 0x000:			   /* SFC */
+				REG_SFC = REG_DA[(word2 >> 12) & 15] & 7;
+				return;
+			case 0x001:			   /* DFC */
+				REG_DFC = REG_DA[(word2 >> 12) & 15] & 7;
+				return;
+			case 0x002:			   /* CACR */
+				/* Only EC020 and later have CACR */
+				if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+				{
+					/* 68030 can write all bits except 5-7, 040 can write all */
+					if (CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+					{
+						REG_CACR = REG_DA[(word2 >> 12) & 15] & 0xfffffffe;  // Old I cache bit not working on 040
+					}
+					else if (CPU_TYPE_IS_030_PLUS(CPU_TYPE))
+					{
+						REG_CACR = REG_DA[(word2 >> 12) & 15] & 0xff1f;
+					}
+					else
+					{
+						REG_CACR = REG_DA[(word2 >> 12) & 15] & 0x0f;
+					}
+
+					if (REG_CACR & M68K_CACR_CI) {
+						m68ki_ic_clear(state);
+					}
+					else if (REG_CACR & M68K_CACR_CEI) {
+						icache_clear_entry(ADDRESS_68K(REG_CAAR));
+					}
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x800:			   /* USP */
+				REG_USP = REG_DA[(word2 >> 12) & 15];
+				return;
+			case 0x801:			   /* VBR */
+				REG_VBR = REG_DA[(word2 >> 12) & 15];
+				return;
+			case 0x802:			   /* CAAR */
+				if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+				{
+					REG_CAAR = REG_DA[(word2 >> 12) & 15];
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x803:			   /* MSP */
+				if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+				{
+					/* we are in supervisor mode so just check for M flag */
+					if(!FLAG_M)
+					{
+						REG_MSP = REG_DA[(word2 >> 12) & 15];
+						return;
+					}
+					REG_SP = REG_DA[(word2 >> 12) & 15];
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x804:			   /* ISP */
+				if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+				{
+					if(!FLAG_M)
+					{
+						REG_SP = REG_DA[(word2 >> 12) & 15];
+						return;
+					}
+					REG_ISP = REG_DA[(word2 >> 12) & 15];
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x003:			/* TC */
+				if (CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					state->mmu_tc = REG_DA[(word2 >> 12) & 15];
+
+					if (state->mmu_tc & 0x8000)
+					{
+						state->pmmu_enabled = 1;
+					}
+					else
+					{
+						state->pmmu_enabled = 0;
+					}
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x004:			/* ITT0 */
+				if (CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					state->mmu_itt0 = REG_DA[(word2 >> 12) & 15];
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x005:			/* ITT1 */
+				if (CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					state->mmu_itt1 = REG_DA[(word2 >> 12) & 15];
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x006:			/* DTT0 */
+				if (CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					state->mmu_dtt0 = REG_DA[(word2 >> 12) & 15];
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x007:			/* DTT1 */
+				if (CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					state->mmu_dtt1 = REG_DA[(word2 >> 12) & 15];
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x805:			/* MMUSR */
+				if (CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					state->mmu_sr_040 = REG_DA[(word2 >> 12) & 15];
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x806:			/* URP */
+				if (CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					state->mmu_urp_aptr = REG_DA[(word2 >> 12) & 15];
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			case 0x807:			/* SRP */
+				if (CPU_TYPE_IS_040_PLUS(CPU_TYPE))
+				{
+					state->mmu_srp_aptr = REG_DA[(word2 >> 12) & 15];
+					return;
+				}
+				m68ki_exception_illegal(state);
+				return;
+			default:
+				m68ki_exception_illegal(state);
+				return;
+			}
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_movem_16_re_pd(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = AY;
+	uint count = 0;
+	uint16 words[16];
+	uint n = 16;
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			ea -= 2;
+			words[--n] = MASK_OUT_ABOVE_16(REG_DA[15-i]);
+			count++;
+		}
+	m68ki_write_words(state, ea, words + n, count);
+	AY = ea;
+
+	USE_CYCLES(count<<CYC_MOVEM_W);
+}
+
+
+static void m68k_op_movem_16_re_ai(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AY_AI_16();
+	uint count = 0;
+	uint16 words[16];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			words[count++] = MASK_OUT_ABOVE_16(REG_DA[i]);
+	m68ki_write_words(state, ea, words, count);
+
+	USE_CYCLES(count<<CYC_MOVEM_W);
+}
+
+
+static void m68k_op_movem_16_re_di(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AY_DI_16();
+	uint count = 0;
+	uint16 words[16];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			words[count++] = MASK_OUT_ABOVE_16(REG_DA[i]);
+	m68ki_write_words(state, ea, words, count);
+
+	USE_CYCLES(count<<CYC_MOVEM_W);
+}
+
+
+static void m68k_op_movem_16_re_ix(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AY_IX_16();
+	uint count = 0;
+	uint16 words[16];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			words[count++] = MASK_OUT_ABOVE_16(REG_DA[i]);
+	m68ki_write_words(state, ea, words, count);
+
+	USE_CYCLES(count<<CYC_MOVEM_W);
+}
+
+
+static void m68k_op_movem_16_re_aw(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AW_16();
+	uint count = 0;
+	uint16 words[16];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			words[count++] = MASK_OUT_ABOVE_16(REG_DA[i]);
+	m68ki_write_words(state, ea, words, count);
+
+	USE_CYCLES(count<<CYC_MOVEM_W);
+}
+
+
+static void m68k_op_movem_16_re_al(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AL_16();
+	uint count = 0;
+	uint16 words[16];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			words[count++] = MASK_OUT_ABOVE_16(REG_DA[i]);
+	m68ki_write_words(state, ea, words, count);
+
+	USE_CYCLES(count<<CYC_MOVEM_W);
+}
+
+
+static void m68k_op_movem_32_re_pd(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = AY;
+	uint count = 0;
+	uint16 words[32];
+	uint n = 32;
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			ea -= 4;
+			words[--n] = REG_DA[15-i] & 0xFFFF;
+			words[--n] = (REG_DA[15-i] >> 16) & 0xFFFF;
+			count++;
+		}
+	m68ki_write_words(state, ea, words + n, count * 2);
+	AY = ea;
+
+	USE_CYCLES(count<<CYC_MOVEM_L);
+}
+
+
+static void m68k_op_movem_32_re_ai(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AY_AI_32();
+	uint count = 0;
+	uint16 words[32];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			words[count * 2] = (REG_DA[i] >> 16) & 0xFFFF;
+			words[count * 2 + 1] = REG_DA[i] & 0xFFFF;
+			count++;
+		}
+	m68ki_write_words(state, ea, words, count * 2);
+
+	USE_CYCLES(count<<CYC_MOVEM_L);
+}
+
+
+static void m68k_op_movem_32_re_di(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AY_DI_32();
+	uint count = 0;
+	uint16 words[32];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			words[count * 2] = (REG_DA[i] >> 16) & 0xFFFF;
+			words[count * 2 + 1] = REG_DA[i] & 0xFFFF;
+			count++;
+		}
+	m68ki_write_words(state, ea, words, count * 2);
+
+	USE_CYCLES(count<<CYC_MOVEM_L);
+}
+
+
+static void m68k_op_movem_32_re_ix(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AY_IX_32();
+	uint count = 0;
+	uint16 words[32];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			words[count * 2] = (REG_DA[i] >> 16) & 0xFFFF;
+			words[count * 2 + 1] = REG_DA[i] & 0xFFFF;
+			count++;
+		}
+	m68ki_write_words(state, ea, words, count * 2);
+
+	USE_CYCLES(count<<CYC_MOVEM_L);
+}
+
+
+static void m68k_op_movem_32_re_aw(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AW_32();
+	uint count = 0;
+	uint16 words[32];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			words[count * 2] = (REG_DA[i] >> 16) & 0xFFFF;
+			words[count * 2 + 1] = REG_DA[i] & 0xFFFF;
+			count++;
+		}
+	m68ki_write_words(state, ea, words, count * 2);
+
+	USE_CYCLES(count<<CYC_MOVEM_L);
+}
+
+
+static void m68k_op_movem_32_re_al(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AL_32();
+	uint count = 0;
+	uint16 words[32];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			words[count * 2] = (REG_DA[i] >> 16) & 0xFFFF;
+			words[count * 2 + 1] = REG_DA[i] & 0xFFFF;
+			count++;
+		}
+	m68ki_write_words(state, ea, words, count * 2);
+
+	USE_CYCLES(count<<CYC_MOVEM_L);
+}
+
+
+static void m68k_op_movem_16_er_pi(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = AY;
+	uint count = 0;
+	uint16 words[16];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count);
+
+	for(i = 0, count = 0; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = MAKE_INT_16(words[count]);
+			ea += 2;
+			count++;
+		}
+	AY = ea;
+
+	USE_CYCLES(count<<CYC_MOVEM_W);
+}
+
+
+static void m68k_op_movem_16_er_pcdi(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_PCDI_16();
+	uint count = 0;
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_pcrel_16(state, ea)));
+			ea += 2;
+			count++;
+		}
+
+	USE_CYCLES(count<<CYC_MOVEM_W);
+}
+
+
+static void m68k_op_movem_16_er_pcix(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_PCIX_16();
+	uint count = 0;
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = MAKE_INT_16(MASK_OUT_ABOVE_16(m68ki_read_pcrel_16(state, ea)));
+			ea += 2;
+			count++;
+		}
+
+	USE_CYCLES(count<<CYC_MOVEM_W);
+}
+
+
+static void m68k_op_movem_16_er_ai(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AY_AI_16();
+	uint count = 0;
+	uint16 words[16];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count);
+
+	for(i = 0, count = 0; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = MAKE_INT_16(words[count]);
+			count++;
+		}
+
+	USE_CYCLES(count<<CYC_MOVEM_W);
+}
+
+
+static void m68k_op_movem_16_er_di(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AY_DI_16();
+	uint count = 0;
+	uint16 words[16];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count);
+
+	for(i = 0, count = 0; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = MAKE_INT_16(words[count]);
+			count++;
+		}
+
+	USE_CYCLES(count<<CYC_MOVEM_W);
+}
+
+
+static void m68k_op_movem_16_er_ix(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AY_IX_16();
+	uint count = 0;
+	uint16 words[16];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count);
+
+	for(i = 0, count = 0; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = MAKE_INT_16(words[count]);
+			count++;
+		}
+
+	USE_CYCLES(count<<CYC_MOVEM_W);
+}
+
+
+static void m68k_op_movem_16_er_aw(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AW_16();
+	uint count = 0;
+	uint16 words[16];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count);
+
+	for(i = 0, count = 0; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = MAKE_INT_16(words[count]);
+			count++;
+		}
+
+	USE_CYCLES(count<<CYC_MOVEM_W);
+}
+
+
+static void m68k_op_movem_16_er_al(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AL_16();
+	uint count = 0;
+	uint16 words[16];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count);
+
+	for(i = 0, count = 0; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = MAKE_INT_16(words[count]);
+			count++;
+		}
+
+	USE_CYCLES(count<<CYC_MOVEM_W);
+}
+
+
+static void m68k_op_movem_32_er_pi(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = AY;
+	uint count = 0;
+	uint16 words[32];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count * 2);
+
+	for(i = 0, count = 0; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = (words[count * 2] << 16) | words[count * 2 + 1];
+			ea += 4;
+			count++;
+		}
+	AY = ea;
+
+	USE_CYCLES(count<<CYC_MOVEM_L);
+}
+
+
+static void m68k_op_movem_32_er_pcdi(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_PCDI_32();
+	uint count = 0;
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = m68ki_read_pcrel_32(state, ea);
+			ea += 4;
+			count++;
+		}
+
+	USE_CYCLES(count<<CYC_MOVEM_L);
+}
+
+
+static void m68k_op_movem_32_er_pcix(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_PCIX_32();
+	uint count = 0;
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = m68ki_read_pcrel_32(state, ea);
+			ea += 4;
+			count++;
+		}
+
+	USE_CYCLES(count<<CYC_MOVEM_L);
+}
+
+
+static void m68k_op_movem_32_er_ai(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AY_AI_32();
+	uint count = 0;
+	uint16 words[32];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count * 2);
+
+	for(i = 0, count = 0; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = (words[count * 2] << 16) | words[count * 2 + 1];
+			count++;
+		}
+
+	USE_CYCLES(count<<CYC_MOVEM_L);
+}
+
+
+static void m68k_op_movem_32_er_di(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AY_DI_32();
+	uint count = 0;
+	uint16 words[32];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count * 2);
+
+	for(i = 0, count = 0; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = (words[count * 2] << 16) | words[count * 2 + 1];
+			count++;
+		}
+
+	USE_CYCLES(count<<CYC_MOVEM_L);
+}
+
+
+static void m68k_op_movem_32_er_ix(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AY_IX_32();
+	uint count = 0;
+	uint16 words[32];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count * 2);
+
+	for(i = 0, count = 0; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = (words[count * 2] << 16) | words[count * 2 + 1];
+			count++;
+		}
+
+	USE_CYCLES(count<<CYC_MOVEM_L);
+}
+
+
+static void m68k_op_movem_32_er_aw(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AW_32();
+	uint count = 0;
+	uint16 words[32];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count * 2);
+
+	for(i = 0, count = 0; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = (words[count * 2] << 16) | words[count * 2 + 1];
+			count++;
+		}
+
+	USE_CYCLES(count<<CYC_MOVEM_L);
+}
+
+
+static void m68k_op_movem_32_er_al(m68ki_cpu_core *state)
+{
+	uint i = 0;
+	uint register_list = OPER_I_16(state);
+	uint ea = EA_AL_32();
+	uint count = 0;
+	uint16 words[32];
+
+	for(; i < 16; i++)
+		if(register_list & (1 << i))
+			count++;
+	m68ki_read_words(state, ea, words, count * 2);
+
+	for(i = 0, count = 0; i < 16; i++)
+		if(register_list & (1 << i))
+		{
+			REG_DA[i] = (words[count * 2] << 16) | words[count * 2 + 1];
+			count++;
+		}
+
+	USE_CYCLES(count<<CYC_MOVEM_L);
+}
+
+
+static void m68k_op_movep_16_re(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint src = DX;
+
+	m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(src >> 8));
+	m68ki_write_8(state, ea += 2, MASK_OUT_ABOVE_8(src));
+}
+
+
+static void m68k_op_movep_32_re(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_32();
+	uint src = DX;
+
+	m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(src >> 24));
+	m68ki_write_8(state, ea += 2, MASK_OUT_ABOVE_8(src >> 16));
+	m68ki_write_8(state, ea += 2, MASK_OUT_ABOVE_8(src >> 8));
+	m68ki_write_8(state, ea += 2, MASK_OUT_ABOVE_8(src));
+}
+
+
+static void m68k_op_movep_16_er(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint* r_dst = &DX;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | ((m68ki_read_8(state, ea) << 8) + m68ki_read_8(state, ea + 2));
+}
+
+
+static void m68k_op_movep_32_er(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_32();
+
+	DX = (m68ki_read_8(state, ea) << 24) + (m68ki_read_8(state, ea + 2) << 16)
+		+ (m68ki_read_8(state, ea + 4) << 8) + m68ki_read_8(state, ea + 6);
+}
+
+
+static void m68k_op_moves_8_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_AI_8();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_8_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_8_pi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_PI_8();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_8_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_8_pi7(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_A7_PI_8();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_8_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_8_pd(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_PD_8();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_8_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_8_pd7(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_A7_PD_8();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_8_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_8_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_DI_8();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_8_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_8_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_IX_8();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_8_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_8_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AW_8();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_8_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_8_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AL_8();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_8_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_8(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_8(m68ki_read_8_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_8(REG_D[(word2 >> 12) & 7]) | m68ki_read_8_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_16_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_AI_16();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_16_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_16_pi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_PI_16();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_16_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_16_pd(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_PD_16();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_16_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_16_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_DI_16();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_16_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_16_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_IX_16();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_16_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_16_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AW_16();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_16_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_16_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AL_16();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_16_fc(state, ea, REG_DFC, MASK_OUT_ABOVE_16(REG_DA[(word2 >> 12) & 15]));
+				return;
+			}
+			if(BIT_F(word2))		   /* Memory to address register */
+			{
+				REG_A[(word2 >> 12) & 7] = MAKE_INT_16(m68ki_read_16_fc(state, ea, REG_SFC));
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to data register */
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_BELOW_16(REG_D[(word2 >> 12) & 7]) | m68ki_read_16_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_32_ai(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_AI_32();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_32_fc(state, ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to register */
+			REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_32_pi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_PI_32();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_32_fc(state, ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to register */
+			REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_32_pd(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_PD_32();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_32_fc(state, ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to register */
+			REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_32_di(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_DI_32();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_32_fc(state, ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to register */
+			REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_32_ix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AY_IX_32();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_32_fc(state, ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to register */
+			REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_32_aw(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AW_32();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_32_fc(state, ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to register */
+			REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moves_32_al(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		if(FLAG_S)
+		{
+			uint word2 = OPER_I_16(state);
+			uint ea = EA_AL_32();
+
+			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+			if(BIT_B(word2))		   /* Register to memory */
+			{
+				m68ki_write_32_fc(state, ea, REG_DFC, REG_DA[(word2 >> 12) & 15]);
+				if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+					USE_CYCLES(2);
+				return;
+			}
+			/* Memory to register */
+			REG_DA[(word2 >> 12) & 15] = m68ki_read_32_fc(state, ea, REG_SFC);
+			if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+				USE_CYCLES(2);
+			return;
+		}
+		m68ki_exception_privilege_violation(state);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_moveq_32(m68ki_cpu_core *state)
+{
+	uint res = DX = MAKE_INT_8(MASK_OUT_ABOVE_8(REG_IR));
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_move16_32(m68ki_cpu_core *state)
+{
+	uint16 w2 = OPER_I_16(state);
+	int ax = REG_IR & 7;
+	int ay = (w2 >> 12) & 7;
+
+	m68ki_write_32(state, REG_A[ay],    m68ki_read_32(state, REG_A[ax]));
+	m68ki_write_32(state, REG_A[ay]+4,  m68ki_read_32(state, REG_A[ax]+4));
+	m68ki_write_32(state, REG_A[ay]+8,  m68ki_read_32(state, REG_A[ax]+8));
+	m68ki_write_32(state, REG_A[ay]+12, m68ki_read_32(state, REG_A[ax]+12));
+
+	REG_A[ax] += 16;
+	REG_A[ay] += 16;
+}
+
+
+static void m68k_op_muls_16_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(DY) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_muls_16_ai(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_AI_16(state)) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_muls_16_pi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_PI_16(state)) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_muls_16_pd(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_PD_16(state)) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_muls_16_di(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_DI_16(state)) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_muls_16_ix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AY_IX_16(state)) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_muls_16_aw(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AW_16(state)) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_muls_16_al(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_AL_16(state)) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_muls_16_pcdi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_PCDI_16(state)) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_muls_16_pcix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_PCIX_16(state)) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_muls_16_i(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = MASK_OUT_ABOVE_32(MAKE_INT_16(OPER_I_16(state)) * MAKE_INT_16(MASK_OUT_ABOVE_16(*r_dst)));
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_mulu_16_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = MASK_OUT_ABOVE_16(DY) * MASK_OUT_ABOVE_16(*r_dst);
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_mulu_16_ai(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = OPER_AY_AI_16(state) * MASK_OUT_ABOVE_16(*r_dst);
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_mulu_16_pi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = OPER_AY_PI_16(state) * MASK_OUT_ABOVE_16(*r_dst);
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_mulu_16_pd(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = OPER_AY_PD_16(state) * MASK_OUT_ABOVE_16(*r_dst);
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_mulu_16_di(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = OPER_AY_DI_16(state) * MASK_OUT_ABOVE_16(*r_dst);
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_mulu_16_ix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = OPER_AY_IX_16(state) * MASK_OUT_ABOVE_16(*r_dst);
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_mulu_16_aw(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = OPER_AW_16(state) * MASK_OUT_ABOVE_16(*r_dst);
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_mulu_16_al(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = OPER_AL_16(state) * MASK_OUT_ABOVE_16(*r_dst);
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_mulu_16_pcdi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = OPER_PCDI_16(state) * MASK_OUT_ABOVE_16(*r_dst);
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_mulu_16_pcix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = OPER_PCIX_16(state) * MASK_OUT_ABOVE_16(*r_dst);
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_mulu_16_i(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint res = OPER_I_16(state) * MASK_OUT_ABOVE_16(*r_dst);
+
+	*r_dst = res;
+
+	FLAG_Z = res;
+	FLAG_N = NFLAG_32(res);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_mull_32_d(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 src = DY;
+		uint64 dst = REG_D[(word2 >> 12) & 7];
+		uint64 res;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+			if(!BIT_A(word2))
+			{
+				FLAG_Z = MASK_OUT_ABOVE_32(res);
+				FLAG_N = NFLAG_32(res);
+				FLAG_V = ((sint64)res != (sint32)res)<<7;
+				REG_D[(word2 >> 12) & 7] = FLAG_Z;
+				return;
+			}
+			FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+			FLAG_N = NFLAG_64(res);
+			FLAG_V = VFLAG_CLEAR;
+			REG_D[word2 & 7] = (res >> 32);
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+			return;
+		}
+
+		res = src * dst;
+		if(!BIT_A(word2))
+		{
+			FLAG_Z = MASK_OUT_ABOVE_32(res);
+			FLAG_N = NFLAG_32(res);
+			FLAG_V = (res > 0xffffffff)<<7;
+			REG_D[(word2 >> 12) & 7] = FLAG_Z;
+			return;
+		}
+		FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+		FLAG_N = NFLAG_64(res);
+		FLAG_V = VFLAG_CLEAR;
+		REG_D[word2 & 7] = (res >> 32);
+		REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint src = DY;
+		uint dst = REG_D[(word2 >> 12) & 7];
+		uint neg = GET_MSB_32(src ^ dst);
+		uint src1;
+		uint src2;
+		uint dst1;
+		uint dst2;
+		uint r1;
+		uint r2;
+		uint r3;
+		uint r4;
+		uint lo;
+		uint hi;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			if(GET_MSB_32(src))
+				src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+			if(GET_MSB_32(dst))
+				dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+		}
+
+		src1 = MASK_OUT_ABOVE_16(src);
+		src2 = src>>16;
+		dst1 = MASK_OUT_ABOVE_16(dst);
+		dst2 = dst>>16;
+
+
+		r1 = src1 * dst1;
+		r2 = src1 * dst2;
+		r3 = src2 * dst1;
+		r4 = src2 * dst2;
+
+		lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+		hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+		if(BIT_B(word2) && neg)
+		{
+			hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+			lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+		}
+
+		if(BIT_A(word2))
+		{
+			REG_D[word2 & 7] = hi;
+			REG_D[(word2 >> 12) & 7] = lo;
+			FLAG_N = NFLAG_32(hi);
+			FLAG_Z = hi | lo;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		REG_D[(word2 >> 12) & 7] = lo;
+		FLAG_N = NFLAG_32(lo);
+		FLAG_Z = lo;
+		if(BIT_B(word2))
+			FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+		else
+			FLAG_V = (hi != 0) << 7;
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_mull_32_ai(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 src = OPER_AY_AI_32(state);
+		uint64 dst = REG_D[(word2 >> 12) & 7];
+		uint64 res;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+			if(!BIT_A(word2))
+			{
+				FLAG_Z = MASK_OUT_ABOVE_32(res);
+				FLAG_N = NFLAG_32(res);
+				FLAG_V = ((sint64)res != (sint32)res)<<7;
+				REG_D[(word2 >> 12) & 7] = FLAG_Z;
+				return;
+			}
+			FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+			FLAG_N = NFLAG_64(res);
+			FLAG_V = VFLAG_CLEAR;
+			REG_D[word2 & 7] = (res >> 32);
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+			return;
+		}
+
+		res = src * dst;
+		if(!BIT_A(word2))
+		{
+			FLAG_Z = MASK_OUT_ABOVE_32(res);
+			FLAG_N = NFLAG_32(res);
+			FLAG_V = (res > 0xffffffff)<<7;
+			REG_D[(word2 >> 12) & 7] = FLAG_Z;
+			return;
+		}
+		FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+		FLAG_N = NFLAG_64(res);
+		FLAG_V = VFLAG_CLEAR;
+		REG_D[word2 & 7] = (res >> 32);
+		REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint src = OPER_AY_AI_32(state);
+		uint dst = REG_D[(word2 >> 12) & 7];
+		uint neg = GET_MSB_32(src ^ dst);
+		uint src1;
+		uint src2;
+		uint dst1;
+		uint dst2;
+		uint r1;
+		uint r2;
+		uint r3;
+		uint r4;
+		uint lo;
+		uint hi;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			if(GET_MSB_32(src))
+				src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+			if(GET_MSB_32(dst))
+				dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+		}
+
+		src1 = MASK_OUT_ABOVE_16(src);
+		src2 = src>>16;
+		dst1 = MASK_OUT_ABOVE_16(dst);
+		dst2 = dst>>16;
+
+
+		r1 = src1 * dst1;
+		r2 = src1 * dst2;
+		r3 = src2 * dst1;
+		r4 = src2 * dst2;
+
+		lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+		hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+		if(BIT_B(word2) && neg)
+		{
+			hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+			lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+		}
+
+		if(BIT_A(word2))
+		{
+			REG_D[word2 & 7] = hi;
+			REG_D[(word2 >> 12) & 7] = lo;
+			FLAG_N = NFLAG_32(hi);
+			FLAG_Z = hi | lo;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		REG_D[(word2 >> 12) & 7] = lo;
+		FLAG_N = NFLAG_32(lo);
+		FLAG_Z = lo;
+		if(BIT_B(word2))
+			FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+		else
+			FLAG_V = (hi != 0) << 7;
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_mull_32_pi(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 src = OPER_AY_PI_32(state);
+		uint64 dst = REG_D[(word2 >> 12) & 7];
+		uint64 res;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+			if(!BIT_A(word2))
+			{
+				FLAG_Z = MASK_OUT_ABOVE_32(res);
+				FLAG_N = NFLAG_32(res);
+				FLAG_V = ((sint64)res != (sint32)res)<<7;
+				REG_D[(word2 >> 12) & 7] = FLAG_Z;
+				return;
+			}
+			FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+			FLAG_N = NFLAG_64(res);
+			FLAG_V = VFLAG_CLEAR;
+			REG_D[word2 & 7] = (res >> 32);
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+			return;
+		}
+
+		res = src * dst;
+		if(!BIT_A(word2))
+		{
+			FLAG_Z = MASK_OUT_ABOVE_32(res);
+			FLAG_N = NFLAG_32(res);
+			FLAG_V = (res > 0xffffffff)<<7;
+			REG_D[(word2 >> 12) & 7] = FLAG_Z;
+			return;
+		}
+		FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+		FLAG_N = NFLAG_64(res);
+		FLAG_V = VFLAG_CLEAR;
+		REG_D[word2 & 7] = (res >> 32);
+		REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint src = OPER_AY_PI_32(state);
+		uint dst = REG_D[(word2 >> 12) & 7];
+		uint neg = GET_MSB_32(src ^ dst);
+		uint src1;
+		uint src2;
+		uint dst1;
+		uint dst2;
+		uint r1;
+		uint r2;
+		uint r3;
+		uint r4;
+		uint lo;
+		uint hi;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			if(GET_MSB_32(src))
+				src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+			if(GET_MSB_32(dst))
+				dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+		}
+
+		src1 = MASK_OUT_ABOVE_16(src);
+		src2 = src>>16;
+		dst1 = MASK_OUT_ABOVE_16(dst);
+		dst2 = dst>>16;
+
+
+		r1 = src1 * dst1;
+		r2 = src1 * dst2;
+		r3 = src2 * dst1;
+		r4 = src2 * dst2;
+
+		lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+		hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+		if(BIT_B(word2) && neg)
+		{
+			hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+			lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+		}
+
+		if(BIT_A(word2))
+		{
+			REG_D[word2 & 7] = hi;
+			REG_D[(word2 >> 12) & 7] = lo;
+			FLAG_N = NFLAG_32(hi);
+			FLAG_Z = hi | lo;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		REG_D[(word2 >> 12) & 7] = lo;
+		FLAG_N = NFLAG_32(lo);
+		FLAG_Z = lo;
+		if(BIT_B(word2))
+			FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+		else
+			FLAG_V = (hi != 0) << 7;
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_mull_32_pd(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 src = OPER_AY_PD_32(state);
+		uint64 dst = REG_D[(word2 >> 12) & 7];
+		uint64 res;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+			if(!BIT_A(word2))
+			{
+				FLAG_Z = MASK_OUT_ABOVE_32(res);
+				FLAG_N = NFLAG_32(res);
+				FLAG_V = ((sint64)res != (sint32)res)<<7;
+				REG_D[(word2 >> 12) & 7] = FLAG_Z;
+				return;
+			}
+			FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+			FLAG_N = NFLAG_64(res);
+			FLAG_V = VFLAG_CLEAR;
+			REG_D[word2 & 7] = (res >> 32);
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+			return;
+		}
+
+		res = src * dst;
+		if(!BIT_A(word2))
+		{
+			FLAG_Z = MASK_OUT_ABOVE_32(res);
+			FLAG_N = NFLAG_32(res);
+			FLAG_V = (res > 0xffffffff)<<7;
+			REG_D[(word2 >> 12) & 7] = FLAG_Z;
+			return;
+		}
+		FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+		FLAG_N = NFLAG_64(res);
+		FLAG_V = VFLAG_CLEAR;
+		REG_D[word2 & 7] = (res >> 32);
+		REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint src = OPER_AY_PD_32(state);
+		uint dst = REG_D[(word2 >> 12) & 7];
+		uint neg = GET_MSB_32(src ^ dst);
+		uint src1;
+		uint src2;
+		uint dst1;
+		uint dst2;
+		uint r1;
+		uint r2;
+		uint r3;
+		uint r4;
+		uint lo;
+		uint hi;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			if(GET_MSB_32(src))
+				src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+			if(GET_MSB_32(dst))
+				dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+		}
+
+		src1 = MASK_OUT_ABOVE_16(src);
+		src2 = src>>16;
+		dst1 = MASK_OUT_ABOVE_16(dst);
+		dst2 = dst>>16;
+
+
+		r1 = src1 * dst1;
+		r2 = src1 * dst2;
+		r3 = src2 * dst1;
+		r4 = src2 * dst2;
+
+		lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+		hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+		if(BIT_B(word2) && neg)
+		{
+			hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+			lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+		}
+
+		if(BIT_A(word2))
+		{
+			REG_D[word2 & 7] = hi;
+			REG_D[(word2 >> 12) & 7] = lo;
+			FLAG_N = NFLAG_32(hi);
+			FLAG_Z = hi | lo;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		REG_D[(word2 >> 12) & 7] = lo;
+		FLAG_N = NFLAG_32(lo);
+		FLAG_Z = lo;
+		if(BIT_B(word2))
+			FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+		else
+			FLAG_V = (hi != 0) << 7;
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_mull_32_di(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 src = OPER_AY_DI_32(state);
+		uint64 dst = REG_D[(word2 >> 12) & 7];
+		uint64 res;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+			if(!BIT_A(word2))
+			{
+				FLAG_Z = MASK_OUT_ABOVE_32(res);
+				FLAG_N = NFLAG_32(res);
+				FLAG_V = ((sint64)res != (sint32)res)<<7;
+				REG_D[(word2 >> 12) & 7] = FLAG_Z;
+				return;
+			}
+			FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+			FLAG_N = NFLAG_64(res);
+			FLAG_V = VFLAG_CLEAR;
+			REG_D[word2 & 7] = (res >> 32);
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+			return;
+		}
+
+		res = src * dst;
+		if(!BIT_A(word2))
+		{
+			FLAG_Z = MASK_OUT_ABOVE_32(res);
+			FLAG_N = NFLAG_32(res);
+			FLAG_V = (res > 0xffffffff)<<7;
+			REG_D[(word2 >> 12) & 7] = FLAG_Z;
+			return;
+		}
+		FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+		FLAG_N = NFLAG_64(res);
+		FLAG_V = VFLAG_CLEAR;
+		REG_D[word2 & 7] = (res >> 32);
+		REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint src = OPER_AY_DI_32(state);
+		uint dst = REG_D[(word2 >> 12) & 7];
+		uint neg = GET_MSB_32(src ^ dst);
+		uint src1;
+		uint src2;
+		uint dst1;
+		uint dst2;
+		uint r1;
+		uint r2;
+		uint r3;
+		uint r4;
+		uint lo;
+		uint hi;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			if(GET_MSB_32(src))
+				src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+			if(GET_MSB_32(dst))
+				dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+		}
+
+		src1 = MASK_OUT_ABOVE_16(src);
+		src2 = src>>16;
+		dst1 = MASK_OUT_ABOVE_16(dst);
+		dst2 = dst>>16;
+
+
+		r1 = src1 * dst1;
+		r2 = src1 * dst2;
+		r3 = src2 * dst1;
+		r4 = src2 * dst2;
+
+		lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+		hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+		if(BIT_B(word2) && neg)
+		{
+			hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+			lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+		}
+
+		if(BIT_A(word2))
+		{
+			REG_D[word2 & 7] = hi;
+			REG_D[(word2 >> 12) & 7] = lo;
+			FLAG_N = NFLAG_32(hi);
+			FLAG_Z = hi | lo;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		REG_D[(word2 >> 12) & 7] = lo;
+		FLAG_N = NFLAG_32(lo);
+		FLAG_Z = lo;
+		if(BIT_B(word2))
+			FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+		else
+			FLAG_V = (hi != 0) << 7;
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_mull_32_ix(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 src = OPER_AY_IX_32(state);
+		uint64 dst = REG_D[(word2 >> 12) & 7];
+		uint64 res;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+			if(!BIT_A(word2))
+			{
+				FLAG_Z = MASK_OUT_ABOVE_32(res);
+				FLAG_N = NFLAG_32(res);
+				FLAG_V = ((sint64)res != (sint32)res)<<7;
+				REG_D[(word2 >> 12) & 7] = FLAG_Z;
+				return;
+			}
+			FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+			FLAG_N = NFLAG_64(res);
+			FLAG_V = VFLAG_CLEAR;
+			REG_D[word2 & 7] = (res >> 32);
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+			return;
+		}
+
+		res = src * dst;
+		if(!BIT_A(word2))
+		{
+			FLAG_Z = MASK_OUT_ABOVE_32(res);
+			FLAG_N = NFLAG_32(res);
+			FLAG_V = (res > 0xffffffff)<<7;
+			REG_D[(word2 >> 12) & 7] = FLAG_Z;
+			return;
+		}
+		FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+		FLAG_N = NFLAG_64(res);
+		FLAG_V = VFLAG_CLEAR;
+		REG_D[word2 & 7] = (res >> 32);
+		REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint src = OPER_AY_IX_32(state);
+		uint dst = REG_D[(word2 >> 12) & 7];
+		uint neg = GET_MSB_32(src ^ dst);
+		uint src1;
+		uint src2;
+		uint dst1;
+		uint dst2;
+		uint r1;
+		uint r2;
+		uint r3;
+		uint r4;
+		uint lo;
+		uint hi;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			if(GET_MSB_32(src))
+				src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+			if(GET_MSB_32(dst))
+				dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+		}
+
+		src1 = MASK_OUT_ABOVE_16(src);
+		src2 = src>>16;
+		dst1 = MASK_OUT_ABOVE_16(dst);
+		dst2 = dst>>16;
+
+
+		r1 = src1 * dst1;
+		r2 = src1 * dst2;
+		r3 = src2 * dst1;
+		r4 = src2 * dst2;
+
+		lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+		hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+		if(BIT_B(word2) && neg)
+		{
+			hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+			lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+		}
+
+		if(BIT_A(word2))
+		{
+			REG_D[word2 & 7] = hi;
+			REG_D[(word2 >> 12) & 7] = lo;
+			FLAG_N = NFLAG_32(hi);
+			FLAG_Z = hi | lo;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		REG_D[(word2 >> 12) & 7] = lo;
+		FLAG_N = NFLAG_32(lo);
+		FLAG_Z = lo;
+		if(BIT_B(word2))
+			FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+		else
+			FLAG_V = (hi != 0) << 7;
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_mull_32_aw(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 src = OPER_AW_32(state);
+		uint64 dst = REG_D[(word2 >> 12) & 7];
+		uint64 res;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+			if(!BIT_A(word2))
+			{
+				FLAG_Z = MASK_OUT_ABOVE_32(res);
+				FLAG_N = NFLAG_32(res);
+				FLAG_V = ((sint64)res != (sint32)res)<<7;
+				REG_D[(word2 >> 12) & 7] = FLAG_Z;
+				return;
+			}
+			FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+			FLAG_N = NFLAG_64(res);
+			FLAG_V = VFLAG_CLEAR;
+			REG_D[word2 & 7] = (res >> 32);
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+			return;
+		}
+
+		res = src * dst;
+		if(!BIT_A(word2))
+		{
+			FLAG_Z = MASK_OUT_ABOVE_32(res);
+			FLAG_N = NFLAG_32(res);
+			FLAG_V = (res > 0xffffffff)<<7;
+			REG_D[(word2 >> 12) & 7] = FLAG_Z;
+			return;
+		}
+		FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+		FLAG_N = NFLAG_64(res);
+		FLAG_V = VFLAG_CLEAR;
+		REG_D[word2 & 7] = (res >> 32);
+		REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint src = OPER_AW_32(state);
+		uint dst = REG_D[(word2 >> 12) & 7];
+		uint neg = GET_MSB_32(src ^ dst);
+		uint src1;
+		uint src2;
+		uint dst1;
+		uint dst2;
+		uint r1;
+		uint r2;
+		uint r3;
+		uint r4;
+		uint lo;
+		uint hi;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			if(GET_MSB_32(src))
+				src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+			if(GET_MSB_32(dst))
+				dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+		}
+
+		src1 = MASK_OUT_ABOVE_16(src);
+		src2 = src>>16;
+		dst1 = MASK_OUT_ABOVE_16(dst);
+		dst2 = dst>>16;
+
+
+		r1 = src1 * dst1;
+		r2 = src1 * dst2;
+		r3 = src2 * dst1;
+		r4 = src2 * dst2;
+
+		lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+		hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+		if(BIT_B(word2) && neg)
+		{
+			hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+			lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+		}
+
+		if(BIT_A(word2))
+		{
+			REG_D[word2 & 7] = hi;
+			REG_D[(word2 >> 12) & 7] = lo;
+			FLAG_N = NFLAG_32(hi);
+			FLAG_Z = hi | lo;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		REG_D[(word2 >> 12) & 7] = lo;
+		FLAG_N = NFLAG_32(lo);
+		FLAG_Z = lo;
+		if(BIT_B(word2))
+			FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+		else
+			FLAG_V = (hi != 0) << 7;
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_mull_32_al(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 src = OPER_AL_32(state);
+		uint64 dst = REG_D[(word2 >> 12) & 7];
+		uint64 res;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+			if(!BIT_A(word2))
+			{
+				FLAG_Z = MASK_OUT_ABOVE_32(res);
+				FLAG_N = NFLAG_32(res);
+				FLAG_V = ((sint64)res != (sint32)res)<<7;
+				REG_D[(word2 >> 12) & 7] = FLAG_Z;
+				return;
+			}
+			FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+			FLAG_N = NFLAG_64(res);
+			FLAG_V = VFLAG_CLEAR;
+			REG_D[word2 & 7] = (res >> 32);
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+			return;
+		}
+
+		res = src * dst;
+		if(!BIT_A(word2))
+		{
+			FLAG_Z = MASK_OUT_ABOVE_32(res);
+			FLAG_N = NFLAG_32(res);
+			FLAG_V = (res > 0xffffffff)<<7;
+			REG_D[(word2 >> 12) & 7] = FLAG_Z;
+			return;
+		}
+		FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+		FLAG_N = NFLAG_64(res);
+		FLAG_V = VFLAG_CLEAR;
+		REG_D[word2 & 7] = (res >> 32);
+		REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint src = OPER_AL_32(state);
+		uint dst = REG_D[(word2 >> 12) & 7];
+		uint neg = GET_MSB_32(src ^ dst);
+		uint src1;
+		uint src2;
+		uint dst1;
+		uint dst2;
+		uint r1;
+		uint r2;
+		uint r3;
+		uint r4;
+		uint lo;
+		uint hi;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			if(GET_MSB_32(src))
+				src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+			if(GET_MSB_32(dst))
+				dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+		}
+
+		src1 = MASK_OUT_ABOVE_16(src);
+		src2 = src>>16;
+		dst1 = MASK_OUT_ABOVE_16(dst);
+		dst2 = dst>>16;
+
+
+		r1 = src1 * dst1;
+		r2 = src1 * dst2;
+		r3 = src2 * dst1;
+		r4 = src2 * dst2;
+
+		lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+		hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+		if(BIT_B(word2) && neg)
+		{
+			hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+			lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+		}
+
+		if(BIT_A(word2))
+		{
+			REG_D[word2 & 7] = hi;
+			REG_D[(word2 >> 12) & 7] = lo;
+			FLAG_N = NFLAG_32(hi);
+			FLAG_Z = hi | lo;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		REG_D[(word2 >> 12) & 7] = lo;
+		FLAG_N = NFLAG_32(lo);
+		FLAG_Z = lo;
+		if(BIT_B(word2))
+			FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+		else
+			FLAG_V = (hi != 0) << 7;
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_mull_32_pcdi(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 src = OPER_PCDI_32(state);
+		uint64 dst = REG_D[(word2 >> 12) & 7];
+		uint64 res;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+			if(!BIT_A(word2))
+			{
+				FLAG_Z = MASK_OUT_ABOVE_32(res);
+				FLAG_N = NFLAG_32(res);
+				FLAG_V = ((sint64)res != (sint32)res)<<7;
+				REG_D[(word2 >> 12) & 7] = FLAG_Z;
+				return;
+			}
+			FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+			FLAG_N = NFLAG_64(res);
+			FLAG_V = VFLAG_CLEAR;
+			REG_D[word2 & 7] = (res >> 32);
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+			return;
+		}
+
+		res = src * dst;
+		if(!BIT_A(word2))
+		{
+			FLAG_Z = MASK_OUT_ABOVE_32(res);
+			FLAG_N = NFLAG_32(res);
+			FLAG_V = (res > 0xffffffff)<<7;
+			REG_D[(word2 >> 12) & 7] = FLAG_Z;
+			return;
+		}
+		FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+		FLAG_N = NFLAG_64(res);
+		FLAG_V = VFLAG_CLEAR;
+		REG_D[word2 & 7] = (res >> 32);
+		REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint src = OPER_PCDI_32(state);
+		uint dst = REG_D[(word2 >> 12) & 7];
+		uint neg = GET_MSB_32(src ^ dst);
+		uint src1;
+		uint src2;
+		uint dst1;
+		uint dst2;
+		uint r1;
+		uint r2;
+		uint r3;
+		uint r4;
+		uint lo;
+		uint hi;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			if(GET_MSB_32(src))
+				src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+			if(GET_MSB_32(dst))
+				dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+		}
+
+		src1 = MASK_OUT_ABOVE_16(src);
+		src2 = src>>16;
+		dst1 = MASK_OUT_ABOVE_16(dst);
+		dst2 = dst>>16;
+
+
+		r1 = src1 * dst1;
+		r2 = src1 * dst2;
+		r3 = src2 * dst1;
+		r4 = src2 * dst2;
+
+		lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+		hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+		if(BIT_B(word2) && neg)
+		{
+			hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+			lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+		}
+
+		if(BIT_A(word2))
+		{
+			REG_D[word2 & 7] = hi;
+			REG_D[(word2 >> 12) & 7] = lo;
+			FLAG_N = NFLAG_32(hi);
+			FLAG_Z = hi | lo;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		REG_D[(word2 >> 12) & 7] = lo;
+		FLAG_N = NFLAG_32(lo);
+		FLAG_Z = lo;
+		if(BIT_B(word2))
+			FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+		else
+			FLAG_V = (hi != 0) << 7;
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_mull_32_pcix(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 src = OPER_PCIX_32(state);
+		uint64 dst = REG_D[(word2 >> 12) & 7];
+		uint64 res;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+			if(!BIT_A(word2))
+			{
+				FLAG_Z = MASK_OUT_ABOVE_32(res);
+				FLAG_N = NFLAG_32(res);
+				FLAG_V = ((sint64)res != (sint32)res)<<7;
+				REG_D[(word2 >> 12) & 7] = FLAG_Z;
+				return;
+			}
+			FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+			FLAG_N = NFLAG_64(res);
+			FLAG_V = VFLAG_CLEAR;
+			REG_D[word2 & 7] = (res >> 32);
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+			return;
+		}
+
+		res = src * dst;
+		if(!BIT_A(word2))
+		{
+			FLAG_Z = MASK_OUT_ABOVE_32(res);
+			FLAG_N = NFLAG_32(res);
+			FLAG_V = (res > 0xffffffff)<<7;
+			REG_D[(word2 >> 12) & 7] = FLAG_Z;
+			return;
+		}
+		FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+		FLAG_N = NFLAG_64(res);
+		FLAG_V = VFLAG_CLEAR;
+		REG_D[word2 & 7] = (res >> 32);
+		REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint src = OPER_PCIX_32(state);
+		uint dst = REG_D[(word2 >> 12) & 7];
+		uint neg = GET_MSB_32(src ^ dst);
+		uint src1;
+		uint src2;
+		uint dst1;
+		uint dst2;
+		uint r1;
+		uint r2;
+		uint r3;
+		uint r4;
+		uint lo;
+		uint hi;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			if(GET_MSB_32(src))
+				src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+			if(GET_MSB_32(dst))
+				dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+		}
+
+		src1 = MASK_OUT_ABOVE_16(src);
+		src2 = src>>16;
+		dst1 = MASK_OUT_ABOVE_16(dst);
+		dst2 = dst>>16;
+
+
+		r1 = src1 * dst1;
+		r2 = src1 * dst2;
+		r3 = src2 * dst1;
+		r4 = src2 * dst2;
+
+		lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+		hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+		if(BIT_B(word2) && neg)
+		{
+			hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+			lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+		}
+
+		if(BIT_A(word2))
+		{
+			REG_D[word2 & 7] = hi;
+			REG_D[(word2 >> 12) & 7] = lo;
+			FLAG_N = NFLAG_32(hi);
+			FLAG_Z = hi | lo;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		REG_D[(word2 >> 12) & 7] = lo;
+		FLAG_N = NFLAG_32(lo);
+		FLAG_Z = lo;
+		if(BIT_B(word2))
+			FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+		else
+			FLAG_V = (hi != 0) << 7;
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_mull_32_i(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint64 src = OPER_I_32(state);
+		uint64 dst = REG_D[(word2 >> 12) & 7];
+		uint64 res;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			res = (sint64)((sint32)src) * (sint64)((sint32)dst);
+			if(!BIT_A(word2))
+			{
+				FLAG_Z = MASK_OUT_ABOVE_32(res);
+				FLAG_N = NFLAG_32(res);
+				FLAG_V = ((sint64)res != (sint32)res)<<7;
+				REG_D[(word2 >> 12) & 7] = FLAG_Z;
+				return;
+			}
+			FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+			FLAG_N = NFLAG_64(res);
+			FLAG_V = VFLAG_CLEAR;
+			REG_D[word2 & 7] = (res >> 32);
+			REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+			return;
+		}
+
+		res = src * dst;
+		if(!BIT_A(word2))
+		{
+			FLAG_Z = MASK_OUT_ABOVE_32(res);
+			FLAG_N = NFLAG_32(res);
+			FLAG_V = (res > 0xffffffff)<<7;
+			REG_D[(word2 >> 12) & 7] = FLAG_Z;
+			return;
+		}
+		FLAG_Z = MASK_OUT_ABOVE_32(res) | (res>>32);
+		FLAG_N = NFLAG_64(res);
+		FLAG_V = VFLAG_CLEAR;
+		REG_D[word2 & 7] = (res >> 32);
+		REG_D[(word2 >> 12) & 7] = MASK_OUT_ABOVE_32(res);
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#else
+
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint word2 = OPER_I_16(state);
+		uint src = OPER_I_32(state);
+		uint dst = REG_D[(word2 >> 12) & 7];
+		uint neg = GET_MSB_32(src ^ dst);
+		uint src1;
+		uint src2;
+		uint dst1;
+		uint dst2;
+		uint r1;
+		uint r2;
+		uint r3;
+		uint r4;
+		uint lo;
+		uint hi;
+
+		FLAG_C = CFLAG_CLEAR;
+
+		if(BIT_B(word2))			   /* signed */
+		{
+			if(GET_MSB_32(src))
+				src = (uint)MASK_OUT_ABOVE_32(-(sint)src);
+			if(GET_MSB_32(dst))
+				dst = (uint)MASK_OUT_ABOVE_32(-(sint)dst);
+		}
+
+		src1 = MASK_OUT_ABOVE_16(src);
+		src2 = src>>16;
+		dst1 = MASK_OUT_ABOVE_16(dst);
+		dst2 = dst>>16;
+
+
+		r1 = src1 * dst1;
+		r2 = src1 * dst2;
+		r3 = src2 * dst1;
+		r4 = src2 * dst2;
+
+		lo = r1 + (MASK_OUT_ABOVE_16(r2)<<16) + (MASK_OUT_ABOVE_16(r3)<<16);
+		hi = r4 + (r2>>16) + (r3>>16) + (((r1>>16) + MASK_OUT_ABOVE_16(r2) + MASK_OUT_ABOVE_16(r3)) >> 16);
+
+		if(BIT_B(word2) && neg)
+		{
+			hi = (uint)MASK_OUT_ABOVE_32((-(sint)hi) - (lo != 0));
+			lo = (uint)MASK_OUT_ABOVE_32(-(sint)lo);
+		}
+
+		if(BIT_A(word2))
+		{
+			REG_D[word2 & 7] = hi;
+			REG_D[(word2 >> 12) & 7] = lo;
+			FLAG_N = NFLAG_32(hi);
+			FLAG_Z = hi | lo;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+
+		REG_D[(word2 >> 12) & 7] = lo;
+		FLAG_N = NFLAG_32(lo);
+		FLAG_Z = lo;
+		if(BIT_B(word2))
+			FLAG_V = (!((GET_MSB_32(lo) && hi == 0xffffffff) || (!GET_MSB_32(lo) && !hi)))<<7;
+		else
+			FLAG_V = (hi != 0) << 7;
+		return;
+	}
+	m68ki_exception_illegal(state);
+
+#endif
+}
+
+
+static void m68k_op_nbcd_8_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = - dst - XFLAG_AS_1();
+
+	if(res != 0)
+	{
+		FLAG_V = res; /* Undefined V behavior */
+
+		if(((res|dst) & 0x0f) == 0)
+			res = (res & 0xf0) + 6;
+
+		res = MASK_OUT_ABOVE_8(res + 0x9a);
+
+		FLAG_V &= ~res; /* Undefined V behavior part II */
+
+		*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+		FLAG_Z |= res;
+		FLAG_C = CFLAG_SET;
+		FLAG_X = XFLAG_SET;
+	}
+	else
+	{
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_X = XFLAG_CLEAR;
+	}
+	FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+}
+
+
+static void m68k_op_nbcd_8_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = - dst - XFLAG_AS_1();
+
+	if(res != 0)
+	{
+		FLAG_V = res; /* Undefined V behavior */
+
+		if(((res|dst) & 0x0f) == 0)
+			res = (res & 0xf0) + 6;
+
+		res = MASK_OUT_ABOVE_8(res + 0x9a);
+
+		FLAG_V &= ~res; /* Undefined V behavior part II */
+
+		m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(res));
+
+		FLAG_Z |= res;
+		FLAG_C = CFLAG_SET;
+		FLAG_X = XFLAG_SET;
+	}
+	else
+	{
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_X = XFLAG_CLEAR;
+	}
+	FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+}
+
+
+static void m68k_op_nbcd_8_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = - dst - XFLAG_AS_1();
+
+	if(res != 0)
+	{
+		FLAG_V = res; /* Undefined V behavior */
+
+		if(((res|dst) & 0x0f) == 0)
+			res = (res & 0xf0) + 6;
+
+		res = MASK_OUT_ABOVE_8(res + 0x9a);
+
+		FLAG_V &= ~res; /* Undefined V behavior part II */
+
+		m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(res));
+
+		FLAG_Z |= res;
+		FLAG_C = CFLAG_SET;
+		FLAG_X = XFLAG_SET;
+	}
+	else
+	{
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_X = XFLAG_CLEAR;
+	}
+	FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+}
+
+
+static void m68k_op_nbcd_8_pi7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = - dst - XFLAG_AS_1();
+
+	if(res != 0)
+	{
+		FLAG_V = res; /* Undefined V behavior */
+
+		if(((res|dst) & 0x0f) == 0)
+			res = (res & 0xf0) + 6;
+
+		res = MASK_OUT_ABOVE_8(res + 0x9a);
+
+		FLAG_V &= ~res; /* Undefined V behavior part II */
+
+		m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(res));
+
+		FLAG_Z |= res;
+		FLAG_C = CFLAG_SET;
+		FLAG_X = XFLAG_SET;
+	}
+	else
+	{
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_X = XFLAG_CLEAR;
+	}
+	FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+}
+
+
+static void m68k_op_nbcd_8_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = - dst - XFLAG_AS_1();
+
+	if(res != 0)
+	{
+		FLAG_V = res; /* Undefined V behavior */
+
+		if(((res|dst) & 0x0f) == 0)
+			res = (res & 0xf0) + 6;
+
+		res = MASK_OUT_ABOVE_8(res + 0x9a);
+
+		FLAG_V &= ~res; /* Undefined V behavior part II */
+
+		m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(res));
+
+		FLAG_Z |= res;
+		FLAG_C = CFLAG_SET;
+		FLAG_X = XFLAG_SET;
+	}
+	else
+	{
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_X = XFLAG_CLEAR;
+	}
+	FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+}
+
+
+static void m68k_op_nbcd_8_pd7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = - dst - XFLAG_AS_1();
+
+	if(res != 0)
+	{
+		FLAG_V = res; /* Undefined V behavior */
+
+		if(((res|dst) & 0x0f) == 0)
+			res = (res & 0xf0) + 6;
+
+		res = MASK_OUT_ABOVE_8(res + 0x9a);
+
+		FLAG_V &= ~res; /* Undefined V behavior part II */
+
+		m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(res));
+
+		FLAG_Z |= res;
+		FLAG_C = CFLAG_SET;
+		FLAG_X = XFLAG_SET;
+	}
+	else
+	{
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_X = XFLAG_CLEAR;
+	}
+	FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+}
+
+
+static void m68k_op_nbcd_8_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = - dst - XFLAG_AS_1();
+
+	if(res != 0)
+	{
+		FLAG_V = res; /* Undefined V behavior */
+
+		if(((res|dst) & 0x0f) == 0)
+			res = (res & 0xf0) + 6;
+
+		res = MASK_OUT_ABOVE_8(res + 0x9a);
+
+		FLAG_V &= ~res; /* Undefined V behavior part II */
+
+		m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(res));
+
+		FLAG_Z |= res;
+		FLAG_C = CFLAG_SET;
+		FLAG_X = XFLAG_SET;
+	}
+	else
+	{
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_X = XFLAG_CLEAR;
+	}
+	FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+}
+
+
+static void m68k_op_nbcd_8_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = - dst - XFLAG_AS_1();
+
+	if(res != 0)
+	{
+		FLAG_V = res; /* Undefined V behavior */
+
+		if(((res|dst) & 0x0f) == 0)
+			res = (res & 0xf0) + 6;
+
+		res = MASK_OUT_ABOVE_8(res + 0x9a);
+
+		FLAG_V &= ~res; /* Undefined V behavior part II */
+
+		m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(res));
+
+		FLAG_Z |= res;
+		FLAG_C = CFLAG_SET;
+		FLAG_X = XFLAG_SET;
+	}
+	else
+	{
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_X = XFLAG_CLEAR;
+	}
+	FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+}
+
+
+static void m68k_op_nbcd_8_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = - dst - XFLAG_AS_1();
+
+	if(res != 0)
+	{
+		FLAG_V = res; /* Undefined V behavior */
+
+		if(((res|dst) & 0x0f) == 0)
+			res = (res & 0xf0) + 6;
+
+		res = MASK_OUT_ABOVE_8(res + 0x9a);
+
+		FLAG_V &= ~res; /* Undefined V behavior part II */
+
+		m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(res));
+
+		FLAG_Z |= res;
+		FLAG_C = CFLAG_SET;
+		FLAG_X = XFLAG_SET;
+	}
+	else
+	{
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_X = XFLAG_CLEAR;
+	}
+	FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+}
+
+
+static void m68k_op_nbcd_8_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = - dst - XFLAG_AS_1();
+
+	if(res != 0)
+	{
+		FLAG_V = res; /* Undefined V behavior */
+
+		if(((res|dst) & 0x0f) == 0)
+			res = (res & 0xf0) + 6;
+
+		res = MASK_OUT_ABOVE_8(res + 0x9a);
+
+		FLAG_V &= ~res; /* Undefined V behavior part II */
+
+		m68ki_write_8(state, ea, MASK_OUT_ABOVE_8(res));
+
+		FLAG_Z |= res;
+		FLAG_C = CFLAG_SET;
+		FLAG_X = XFLAG_SET;
+	}
+	else
+	{
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		FLAG_X = XFLAG_CLEAR;
+	}
+	FLAG_N = NFLAG_8(res);	/* Undefined N behavior */
+}
+
+
+static void m68k_op_neg_8_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint res = 0 - MASK_OUT_ABOVE_8(*r_dst);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = FLAG_X = CFLAG_8(res);
+	FLAG_V = *r_dst & res;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_neg_8_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = FLAG_X = CFLAG_8(res);
+	FLAG_V = src & res;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_8_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = FLAG_X = CFLAG_8(res);
+	FLAG_V = src & res;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_8_pi7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = FLAG_X = CFLAG_8(res);
+	FLAG_V = src & res;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_8_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = FLAG_X = CFLAG_8(res);
+	FLAG_V = src & res;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_8_pd7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PD_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = FLAG_X = CFLAG_8(res);
+	FLAG_V = src & res;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_8_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = FLAG_X = CFLAG_8(res);
+	FLAG_V = src & res;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_8_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = FLAG_X = CFLAG_8(res);
+	FLAG_V = src & res;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_8_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = FLAG_X = CFLAG_8(res);
+	FLAG_V = src & res;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_8_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_C = FLAG_X = CFLAG_8(res);
+	FLAG_V = src & res;
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_16_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint res = 0 - MASK_OUT_ABOVE_16(*r_dst);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = FLAG_X = CFLAG_16(res);
+	FLAG_V = (*r_dst & res)>>8;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_neg_16_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = FLAG_X = CFLAG_16(res);
+	FLAG_V = (src & res)>>8;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_16_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = FLAG_X = CFLAG_16(res);
+	FLAG_V = (src & res)>>8;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_16_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = FLAG_X = CFLAG_16(res);
+	FLAG_V = (src & res)>>8;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_16_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = FLAG_X = CFLAG_16(res);
+	FLAG_V = (src & res)>>8;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_16_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = FLAG_X = CFLAG_16(res);
+	FLAG_V = (src & res)>>8;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_16_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = FLAG_X = CFLAG_16(res);
+	FLAG_V = (src & res)>>8;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_16_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_C = FLAG_X = CFLAG_16(res);
+	FLAG_V = (src & res)>>8;
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_32_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint res = 0 - *r_dst;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_C = FLAG_X = CFLAG_SUB_32(*r_dst, 0, res);
+	FLAG_V = (*r_dst & res)>>24;
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_neg_32_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_32();
+	uint src = m68ki_read_32(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
+	FLAG_V = (src & res)>>24;
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_32_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_32();
+	uint src = m68ki_read_32(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
+	FLAG_V = (src & res)>>24;
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_32_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_32();
+	uint src = m68ki_read_32(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
+	FLAG_V = (src & res)>>24;
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_32_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_32();
+	uint src = m68ki_read_32(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
+	FLAG_V = (src & res)>>24;
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_32_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_32();
+	uint src = m68ki_read_32(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
+	FLAG_V = (src & res)>>24;
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_32_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_32();
+	uint src = m68ki_read_32(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
+	FLAG_V = (src & res)>>24;
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_neg_32_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_32();
+	uint src = m68ki_read_32(state, ea);
+	uint res = 0 - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_C = FLAG_X = CFLAG_SUB_32(src, 0, res);
+	FLAG_V = (src & res)>>24;
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_negx_8_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint res = 0 - MASK_OUT_ABOVE_8(*r_dst) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = *r_dst & res;
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+}
+
+
+static void m68k_op_negx_8_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = src & res;
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_negx_8_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = src & res;
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_negx_8_pi7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = src & res;
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_negx_8_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = src & res;
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_negx_8_pd7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PD_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = src & res;
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_negx_8_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = src & res;
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_negx_8_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = src & res;
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_negx_8_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = src & res;
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_negx_8_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_8();
+	uint src = m68ki_read_8(state, ea);
+	uint res = 0 - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = src & res;
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_negx_16_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint res = 0 - MASK_OUT_ABOVE_16(*r_dst) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = (*r_dst & res)>>8;
+
+	res = MASK_OUT_ABOVE_16(res);
+	FLAG_Z |= res;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+}
+
+
+static void m68k_op_negx_16_ai(m68ki_cpu_core *state)
+{
+	uint ea  = EA_AY_AI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = (src & res)>>8;
+
+	res = MASK_OUT_ABOVE_16(res);
+	FLAG_Z |= res;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_negx_16_pi(m68ki_cpu_core *state)
+{
+	uint ea  = EA_AY_PI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = (src & res)>>8;
+
+	res = MASK_OUT_ABOVE_16(res);
+	FLAG_Z |= res;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_negx_16_pd(m68ki_cpu_core *state)
+{
+	uint ea  = EA_AY_PD_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = (src & res)>>8;
+
+	res = MASK_OUT_ABOVE_16(res);
+	FLAG_Z |= res;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_negx_16_di(m68ki_cpu_core *state)
+{
+	uint ea  = EA_AY_DI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = (src & res)>>8;
+
+	res = MASK_OUT_ABOVE_16(res);
+	FLAG_Z |= res;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_negx_16_ix(m68ki_cpu_core *state)
+{
+	uint ea  = EA_AY_IX_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = (src & res)>>8;
+
+	res = MASK_OUT_ABOVE_16(res);
+	FLAG_Z |= res;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_negx_16_aw(m68ki_cpu_core *state)
+{
+	uint ea  = EA_AW_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = (src & res)>>8;
+
+	res = MASK_OUT_ABOVE_16(res);
+	FLAG_Z |= res;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_negx_16_al(m68ki_cpu_core *state)
+{
+	uint ea  = EA_AL_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = (src & res)>>8;
+
+	res = MASK_OUT_ABOVE_16(res);
+	FLAG_Z |= res;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_negx_32_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint res = 0 - MASK_OUT_ABOVE_32(*r_dst) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(*r_dst, 0, res);
+	FLAG_V = (*r_dst & res)>>24;
+
+	res = MASK_OUT_ABOVE_32(res);
+	FLAG_Z |= res;
+
+	*r_dst = res;
+}
+
+
+static void m68k_op_negx_32_ai(m68ki_cpu_core *state)
+{
+	uint ea  = EA_AY_AI_32();
+	uint src = m68ki_read_32(state, ea);
+	uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
+	FLAG_V = (src & res)>>24;
+
+	res = MASK_OUT_ABOVE_32(res);
+	FLAG_Z |= res;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_negx_32_pi(m68ki_cpu_core *state)
+{
+	uint ea  = EA_AY_PI_32();
+	uint src = m68ki_read_32(state, ea);
+	uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
+	FLAG_V = (src & res)>>24;
+
+	res = MASK_OUT_ABOVE_32(res);
+	FLAG_Z |= res;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_negx_32_pd(m68ki_cpu_core *state)
+{
+	uint ea  = EA_AY_PD_32();
+	uint src = m68ki_read_32(state, ea);
+	uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
+	FLAG_V = (src & res)>>24;
+
+	res = MASK_OUT_ABOVE_32(res);
+	FLAG_Z |= res;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_negx_32_di(m68ki_cpu_core *state)
+{
+	uint ea  = EA_AY_DI_32();
+	uint src = m68ki_read_32(state, ea);
+	uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
+	FLAG_V = (src & res)>>24;
+
+	res = MASK_OUT_ABOVE_32(res);
+	FLAG_Z |= res;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_negx_32_ix(m68ki_cpu_core *state)
+{
+	uint ea  = EA_AY_IX_32();
+	uint src = m68ki_read_32(state, ea);
+	uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
+	FLAG_V = (src & res)>>24;
+
+	res = MASK_OUT_ABOVE_32(res);
+	FLAG_Z |= res;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_negx_32_aw(m68ki_cpu_core *state)
+{
+	uint ea  = EA_AW_32();
+	uint src = m68ki_read_32(state, ea);
+	uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
+	FLAG_V = (src & res)>>24;
+
+	res = MASK_OUT_ABOVE_32(res);
+	FLAG_Z |= res;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_negx_32_al(m68ki_cpu_core *state)
+{
+	uint ea  = EA_AL_32();
+	uint src = m68ki_read_32(state, ea);
+	uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, 0, res);
+	FLAG_V = (src & res)>>24;
+
+	res = MASK_OUT_ABOVE_32(res);
+	FLAG_Z |= res;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_nop(m68ki_cpu_core *state)
+{
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+}
+
+
+static void m68k_op_not_8_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint res = MASK_OUT_ABOVE_8(~*r_dst);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_8_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_8();
+	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_8_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_8();
+	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_8_pi7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PI_8();
+	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_8_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_8();
+	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_8_pd7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PD_8();
+	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_8_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_8();
+	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_8_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_8();
+	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_8_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_8();
+	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_8_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_8();
+	uint res = MASK_OUT_ABOVE_8(~m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_16_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint res = MASK_OUT_ABOVE_16(~*r_dst);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_16_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_16_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_16_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_16_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_16_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_16_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_16_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint res = MASK_OUT_ABOVE_16(~m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_32_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint res = *r_dst = MASK_OUT_ABOVE_32(~*r_dst);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_32_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_32();
+	uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(state, ea));
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_32_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_32();
+	uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(state, ea));
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_32_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_32();
+	uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(state, ea));
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_32_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_32();
+	uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(state, ea));
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_32_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_32();
+	uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(state, ea));
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_32_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_32();
+	uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(state, ea));
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_not_32_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_32();
+	uint res = MASK_OUT_ABOVE_32(~m68ki_read_32(state, ea));
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_er_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8((DX |= MASK_OUT_ABOVE_8(DY)));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_er_ai(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_AI_8(state)));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_er_pi(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_PI_8(state)));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_er_pi7(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8((DX |= OPER_A7_PI_8(state)));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_er_pd(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_PD_8(state)));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_er_pd7(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8((DX |= OPER_A7_PD_8(state)));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_er_di(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_DI_8(state)));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_er_ix(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8((DX |= OPER_AY_IX_8(state)));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_er_aw(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8((DX |= OPER_AW_8(state)));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_er_al(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8((DX |= OPER_AL_8(state)));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_er_pcdi(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8((DX |= OPER_PCDI_8(state)));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_er_pcix(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8((DX |= OPER_PCIX_8(state)));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_er_i(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8((DX |= OPER_I_8(state)));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_er_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16((DX |= MASK_OUT_ABOVE_16(DY)));
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_er_ai(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_AI_16(state)));
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_er_pi(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_PI_16(state)));
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_er_pd(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_PD_16(state)));
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_er_di(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_DI_16(state)));
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_er_ix(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16((DX |= OPER_AY_IX_16(state)));
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_er_aw(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16((DX |= OPER_AW_16(state)));
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_er_al(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16((DX |= OPER_AL_16(state)));
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_er_pcdi(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16((DX |= OPER_PCDI_16(state)));
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_er_pcix(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16((DX |= OPER_PCIX_16(state)));
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_er_i(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16((DX |= OPER_I_16(state)));
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_er_d(m68ki_cpu_core *state)
+{
+	uint res = DX |= DY;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_er_ai(m68ki_cpu_core *state)
+{
+	uint res = DX |= OPER_AY_AI_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_er_pi(m68ki_cpu_core *state)
+{
+	uint res = DX |= OPER_AY_PI_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_er_pd(m68ki_cpu_core *state)
+{
+	uint res = DX |= OPER_AY_PD_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_er_di(m68ki_cpu_core *state)
+{
+	uint res = DX |= OPER_AY_DI_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_er_ix(m68ki_cpu_core *state)
+{
+	uint res = DX |= OPER_AY_IX_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_er_aw(m68ki_cpu_core *state)
+{
+	uint res = DX |= OPER_AW_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_er_al(m68ki_cpu_core *state)
+{
+	uint res = DX |= OPER_AL_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_er_pcdi(m68ki_cpu_core *state)
+{
+	uint res = DX |= OPER_PCDI_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_er_pcix(m68ki_cpu_core *state)
+{
+	uint res = DX |= OPER_PCIX_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_er_i(m68ki_cpu_core *state)
+{
+	uint res = DX |= OPER_I_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_re_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_8();
+	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_re_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_8();
+	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_re_pi7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PI_8();
+	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_re_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_8();
+	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_re_pd7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PD_8();
+	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_re_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_8();
+	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_re_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_8();
+	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_re_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_8();
+	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_8_re_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_8();
+	uint res = MASK_OUT_ABOVE_8(DX | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_re_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_re_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_re_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_re_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_re_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_re_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_16_re_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint res = MASK_OUT_ABOVE_16(DX | m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_re_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_32();
+	uint res = DX | m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_re_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_32();
+	uint res = DX | m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_re_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_32();
+	uint res = DX | m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_re_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_32();
+	uint res = DX | m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_re_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_32();
+	uint res = DX | m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_re_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_32();
+	uint res = DX | m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_or_32_re_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_32();
+	uint res = DX | m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_8_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8((DY |= OPER_I_8(state)));
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_8_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_AI_8();
+	uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_8_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_PI_8();
+	uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_8_pi7(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_A7_PI_8();
+	uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_8_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_PD_8();
+	uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_8_pd7(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_A7_PD_8();
+	uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_8_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_DI_8();
+	uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_8_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_IX_8();
+	uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_8_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AW_8();
+	uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_8_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AL_8();
+	uint res = MASK_OUT_ABOVE_8(src | m68ki_read_8(state, ea));
+
+	m68ki_write_8(state, ea, res);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_16_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(DY |= OPER_I_16(state));
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_16_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_AI_16();
+	uint res = MASK_OUT_ABOVE_16(src | m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_16_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_PI_16();
+	uint res = MASK_OUT_ABOVE_16(src | m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_16_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_PD_16();
+	uint res = MASK_OUT_ABOVE_16(src | m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_16_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_DI_16();
+	uint res = MASK_OUT_ABOVE_16(src | m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_16_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_IX_16();
+	uint res = MASK_OUT_ABOVE_16(src | m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_16_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AW_16();
+	uint res = MASK_OUT_ABOVE_16(src | m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_16_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AL_16();
+	uint res = MASK_OUT_ABOVE_16(src | m68ki_read_16(state, ea));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_32_d(m68ki_cpu_core *state)
+{
+	uint res = DY |= OPER_I_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_32_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_AI_32();
+	uint res = src | m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_32_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_PI_32();
+	uint res = src | m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_32_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_PD_32();
+	uint res = src | m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_32_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_DI_32();
+	uint res = src | m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_32_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_IX_32();
+	uint res = src | m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_32_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AW_32();
+	uint res = src | m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_32_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AL_32();
+	uint res = src | m68ki_read_32(state, ea);
+
+	m68ki_write_32(state, ea, res);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ori_16_toc(m68ki_cpu_core *state)
+{
+	m68ki_set_ccr(state, m68ki_get_ccr(state) | OPER_I_8(state));
+}
+
+
+static void m68k_op_ori_16_tos(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint src = OPER_I_16(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		m68ki_set_sr(state, m68ki_get_sr() | src);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_pack_16_rr(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		/* Note: DX and DY are reversed in Motorola's docs */
+		uint src = DY + OPER_I_16(state);
+		uint* r_dst = &DX;
+
+		*r_dst = MASK_OUT_BELOW_8(*r_dst) | ((src >> 4) & 0x00f0) | (src & 0x000f);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_pack_16_mm_ax7(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		/* Note: AX and AY are reversed in Motorola's docs */
+		uint ea_src = EA_AY_PD_8();
+		uint src = m68ki_read_8(state, ea_src);
+		ea_src = EA_AY_PD_8();
+		src = ((src << 8) | m68ki_read_8(state, ea_src)) + OPER_I_16(state);
+
+		m68ki_write_8(state, EA_A7_PD_8(), ((src >> 8) & 0x000f) | ((src<<4) & 0x00f0));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_pack_16_mm_ay7(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		/* Note: AX and AY are reversed in Motorola's docs */
+		uint ea_src = EA_A7_PD_8();
+		uint src = m68ki_read_8(state, ea_src);
+		ea_src = EA_A7_PD_8();
+		src = (src | (m68ki_read_8(state, ea_src) << 8)) + OPER_I_16(state);
+
+		m68ki_write_8(state, EA_AX_PD_8(), ((src >> 4) & 0x00f0) | (src & 0x000f));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_pack_16_mm_axy7(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint ea_src = EA_A7_PD_8();
+		uint src = m68ki_read_8(state, ea_src);
+		ea_src = EA_A7_PD_8();
+		src = (src | (m68ki_read_8(state, ea_src) << 8)) + OPER_I_16(state);
+
+		m68ki_write_8(state, EA_A7_PD_8(), ((src >> 4) & 0x00f0) | (src & 0x000f));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_pack_16_mm(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		/* Note: AX and AY are reversed in Motorola's docs */
+		uint ea_src = EA_AY_PD_8();
+		uint src = m68ki_read_8(state, ea_src);
+		ea_src = EA_AY_PD_8();
+		src = (src | (m68ki_read_8(state, ea_src) << 8)) + OPER_I_16(state);
+
+		m68ki_write_8(state, EA_AX_PD_8(), ((src >> 4) & 0x00f0) | (src & 0x000f));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_pea_32_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_32();
+
+	m68ki_push_32(state, ea);
+}
+
+
+static void m68k_op_pea_32_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_32();
+
+	m68ki_push_32(state, ea);
+}
+
+
+static void m68k_op_pea_32_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_32();
+
+	m68ki_push_32(state, ea);
+}
+
+
+static void m68k_op_pea_32_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_32();
+
+	m68ki_push_32(state, ea);
+}
+
+
+static void m68k_op_pea_32_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_32();
+
+	m68ki_push_32(state, ea);
+}
+
+
+static void m68k_op_pea_32_pcdi(m68ki_cpu_core *state)
+{
+	uint ea = EA_PCDI_32();
+
+	m68ki_push_32(state, ea);
+}
+
+
+static void m68k_op_pea_32_pcix(m68ki_cpu_core *state)
+{
+	uint ea = EA_PCIX_32();
+
+	m68ki_push_32(state, ea);
+}
+
+
+static void m68k_op_pflusha_32(m68ki_cpu_core *state)
+{
+	if (HAS_PMMU)
+	{
+		fprintf(stderr,"68040: unhandled PFLUSHA (ir=%04x)\n", REG_IR);
+		return;
+	}
+	m68ki_exception_1111(state);
+}
+
+
+static void m68k_op_pflushan_32(m68ki_cpu_core *state)
+{
+	if (HAS_PMMU)
+	{
+		fprintf(stderr,"68040: unhandled PFLUSHAN (ir=%04x)\n", REG_IR);
+		return;
+	}
+	m68ki_exception_1111(state);
+}
+
+
+static void m68k_op_pmmu_32(m68ki_cpu_core *state)
+{
+	if ((CPU_TYPE_IS_EC020_PLUS(CPU_TYPE)) && (HAS_PMMU))
+	{
+		m68851_mmu_ops(state);
+	}
+	else
+	{
+		m68ki_exception_1111(state);
+	}
+}
+
+
+static void m68k_op_reset(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		m68ki_output_reset();		   /* auto-disable (see m68kcpu.h) */
+		USE_CYCLES(CYC_RESET);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_ror_8_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint orig_shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint shift = orig_shift & 7;
+	uint src = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = ROR_8(src, shift);
+
+	if(orig_shift != 0)
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = src << (9-orig_shift);
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ror_16_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = ROR_16(src, shift);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src << (9-shift);
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ror_32_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint64 src = *r_dst;
+	uint res = ROR_32(src, shift);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = src << (9-shift);
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ror_8_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint orig_shift = DX & 0x3f;
+	uint shift = orig_shift & 7;
+	uint src = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = ROR_8(src, shift);
+
+	if(orig_shift != 0)
+	{
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+		*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+		FLAG_C = src << (8-((shift-1)&7));
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_8(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ror_16_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint orig_shift = DX & 0x3f;
+	uint shift = orig_shift & 15;
+	uint src = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = ROR_16(src, shift);
+
+	if(orig_shift != 0)
+	{
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		FLAG_C = (src >> ((shift - 1) & 15)) << 8;
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_16(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ror_32_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint orig_shift = DX & 0x3f;
+	uint shift = orig_shift & 31;
+	uint64 src = *r_dst;
+	uint res = ROR_32(src, shift);
+
+	if(orig_shift != 0)
+	{
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+		*r_dst = res;
+		FLAG_C = (src >> ((shift - 1) & 31)) << 8;
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_32(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ror_16_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROR_16(src, 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src << 8;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ror_16_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROR_16(src, 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src << 8;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ror_16_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROR_16(src, 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src << 8;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ror_16_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROR_16(src, 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src << 8;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ror_16_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROR_16(src, 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src << 8;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ror_16_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROR_16(src, 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src << 8;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_ror_16_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROR_16(src, 1);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src << 8;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_rol_8_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint orig_shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint shift = orig_shift & 7;
+	uint src = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = ROL_8(src, shift);
+
+	if(orig_shift != 0)
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_C = src << orig_shift;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_rol_16_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = ROL_16(src, shift);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src >> (8-shift);
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_rol_32_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint64 src = *r_dst;
+	uint res = ROL_32(src, shift);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_C = src >> (24-shift);
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_rol_8_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint orig_shift = DX & 0x3f;
+	uint shift = orig_shift & 7;
+	uint src = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = ROL_8(src, shift);
+
+	if(orig_shift != 0)
+	{
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+		if(shift != 0)
+		{
+			*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+			FLAG_C = src << shift;
+			FLAG_N = NFLAG_8(res);
+			FLAG_Z = res;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+		FLAG_C = (src & 1)<<8;
+		FLAG_N = NFLAG_8(src);
+		FLAG_Z = src;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_8(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_rol_16_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint orig_shift = DX & 0x3f;
+	uint shift = orig_shift & 15;
+	uint src = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = MASK_OUT_ABOVE_16(ROL_16(src, shift));
+
+	if(orig_shift != 0)
+	{
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+		if(shift != 0)
+		{
+			*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+			FLAG_C = (src << shift) >> 8;
+			FLAG_N = NFLAG_16(res);
+			FLAG_Z = res;
+			FLAG_V = VFLAG_CLEAR;
+			return;
+		}
+		FLAG_C = (src & 1)<<8;
+		FLAG_N = NFLAG_16(src);
+		FLAG_Z = src;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_16(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_rol_32_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint orig_shift = DX & 0x3f;
+	uint shift = orig_shift & 31;
+	uint64 src = *r_dst;
+	uint res = ROL_32(src, shift);
+
+	if(orig_shift != 0)
+	{
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+		*r_dst = res;
+
+		FLAG_C = (src >> ((32 - shift) & 0x1f)) << 8;
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_N = NFLAG_32(src);
+	FLAG_Z = src;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_rol_16_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src >> 7;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_rol_16_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src >> 7;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_rol_16_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src >> 7;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_rol_16_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src >> 7;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_rol_16_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src >> 7;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_rol_16_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src >> 7;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_rol_16_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_C = src >> 7;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxr_8_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = ROR_9(src | (XFLAG_AS_1() << 8), shift);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	FLAG_C = FLAG_X = res;
+	res = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxr_16_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = ROR_17(src | (XFLAG_AS_1() << 16), shift);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxr_32_s(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	uint*  r_dst = &DY;
+	uint   shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint64 src   = *r_dst;
+	uint64 res   = src | (((uint64)XFLAG_AS_1()) << 32);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	res = ROR_33_64(res, shift);
+
+	FLAG_C = FLAG_X = res >> 24;
+	res = MASK_OUT_ABOVE_32(res);
+
+	*r_dst =  res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+
+#else
+
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = *r_dst;
+	uint res = MASK_OUT_ABOVE_32((ROR_33(src, shift) & ~(1 << (32 - shift))) | (XFLAG_AS_1() << (32 - shift)));
+	uint new_x_flag = src & (1 << (shift - 1));
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = res;
+
+	FLAG_C = FLAG_X = (new_x_flag != 0)<<8;
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+
+#endif
+}
+
+
+static void m68k_op_roxr_8_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint orig_shift = DX & 0x3f;
+
+	if(orig_shift != 0)
+	{
+		uint shift = orig_shift % 9;
+		uint src   = MASK_OUT_ABOVE_8(*r_dst);
+		uint res   = ROR_9(src | (XFLAG_AS_1() << 8), shift);
+
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+		FLAG_C = FLAG_X = res;
+		res = MASK_OUT_ABOVE_8(res);
+
+		*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = FLAG_X;
+	FLAG_N = NFLAG_8(*r_dst);
+	FLAG_Z = MASK_OUT_ABOVE_8(*r_dst);
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxr_16_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint orig_shift = DX & 0x3f;
+
+	if(orig_shift != 0)
+	{
+		uint shift = orig_shift % 17;
+		uint src   = MASK_OUT_ABOVE_16(*r_dst);
+		uint res   = ROR_17(src | (XFLAG_AS_1() << 16), shift);
+
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+		FLAG_C = FLAG_X = res >> 8;
+		res = MASK_OUT_ABOVE_16(res);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = FLAG_X;
+	FLAG_N = NFLAG_16(*r_dst);
+	FLAG_Z = MASK_OUT_ABOVE_16(*r_dst);
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxr_32_r(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	uint*  r_dst = &DY;
+	uint   orig_shift = DX & 0x3f;
+
+	if(orig_shift != 0)
+	{
+		uint   shift = orig_shift % 33;
+		uint64 src   = *r_dst;
+		uint64 res   = src | (((uint64)XFLAG_AS_1()) << 32);
+
+		res = ROR_33_64(res, shift);
+
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+		FLAG_C = FLAG_X = res >> 24;
+		res = MASK_OUT_ABOVE_32(res);
+
+		*r_dst = res;
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = FLAG_X;
+	FLAG_N = NFLAG_32(*r_dst);
+	FLAG_Z = *r_dst;
+	FLAG_V = VFLAG_CLEAR;
+
+#else
+
+	uint* r_dst = &DY;
+	uint orig_shift = DX & 0x3f;
+	uint shift = orig_shift % 33;
+	uint src = *r_dst;
+	uint res = MASK_OUT_ABOVE_32((ROR_33(src, shift) & ~(1 << (32 - shift))) | (XFLAG_AS_1() << (32 - shift)));
+	uint new_x_flag = src & (1 << (shift - 1));
+
+	if(orig_shift != 0)
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+	if(shift != 0)
+	{
+		*r_dst = res;
+		FLAG_X = (new_x_flag != 0)<<8;
+	}
+	else
+		res = src;
+	FLAG_C = FLAG_X;
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+
+#endif
+}
+
+
+static void m68k_op_roxr_16_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxr_16_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxr_16_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxr_16_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxr_16_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxr_16_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxr_16_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxl_8_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = ROL_9(src | (XFLAG_AS_1() << 8), shift);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	FLAG_C = FLAG_X = res;
+	res = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxl_16_s(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = ROL_17(src | (XFLAG_AS_1() << 16), shift);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxl_32_s(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	uint*  r_dst = &DY;
+	uint   shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint64 src   = *r_dst;
+	uint64 res   = src | (((uint64)XFLAG_AS_1()) << 32);
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	res = ROL_33_64(res, shift);
+
+	FLAG_C = FLAG_X = res >> 24;
+	res = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = res;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+
+#else
+
+	uint* r_dst = &DY;
+	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint src = *r_dst;
+	uint res = MASK_OUT_ABOVE_32((ROL_33(src, shift) & ~(1 << (shift - 1))) | (XFLAG_AS_1() << (shift - 1)));
+	uint new_x_flag = src & (1 << (32 - shift));
+
+	if(shift != 0)
+		USE_CYCLES(shift<<CYC_SHIFT);
+
+	*r_dst = res;
+
+	FLAG_C = FLAG_X = (new_x_flag != 0)<<8;
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+
+#endif
+}
+
+
+static void m68k_op_roxl_8_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint orig_shift = DX & 0x3f;
+
+
+	if(orig_shift != 0)
+	{
+		uint shift = orig_shift % 9;
+		uint src   = MASK_OUT_ABOVE_8(*r_dst);
+		uint res   = ROL_9(src | (XFLAG_AS_1() << 8), shift);
+
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+		FLAG_C = FLAG_X = res;
+		res = MASK_OUT_ABOVE_8(res);
+
+		*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = FLAG_X;
+	FLAG_N = NFLAG_8(*r_dst);
+	FLAG_Z = MASK_OUT_ABOVE_8(*r_dst);
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxl_16_r(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint orig_shift = DX & 0x3f;
+
+	if(orig_shift != 0)
+	{
+		uint shift = orig_shift % 17;
+		uint src   = MASK_OUT_ABOVE_16(*r_dst);
+		uint res   = ROL_17(src | (XFLAG_AS_1() << 16), shift);
+
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+		FLAG_C = FLAG_X = res >> 8;
+		res = MASK_OUT_ABOVE_16(res);
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = FLAG_X;
+	FLAG_N = NFLAG_16(*r_dst);
+	FLAG_Z = MASK_OUT_ABOVE_16(*r_dst);
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxl_32_r(m68ki_cpu_core *state)
+{
+#if M68K_USE_64_BIT
+
+	uint*  r_dst = &DY;
+	uint   orig_shift = DX & 0x3f;
+
+	if(orig_shift != 0)
+	{
+		uint   shift = orig_shift % 33;
+		uint64 src   = *r_dst;
+		uint64 res   = src | (((uint64)XFLAG_AS_1()) << 32);
+
+		res = ROL_33_64(res, shift);
+
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+		FLAG_C = FLAG_X = res >> 24;
+		res = MASK_OUT_ABOVE_32(res);
+
+		*r_dst = res;
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		return;
+	}
+
+	FLAG_C = FLAG_X;
+	FLAG_N = NFLAG_32(*r_dst);
+	FLAG_Z = *r_dst;
+	FLAG_V = VFLAG_CLEAR;
+
+#else
+
+	uint* r_dst = &DY;
+	uint orig_shift = DX & 0x3f;
+	uint shift = orig_shift % 33;
+	uint src = *r_dst;
+	uint res = MASK_OUT_ABOVE_32((ROL_33(src, shift) & ~(1 << (shift - 1))) | (XFLAG_AS_1() << (shift - 1)));
+	uint new_x_flag = src & (1 << (32 - shift));
+
+	if(orig_shift != 0)
+		USE_CYCLES(orig_shift<<CYC_SHIFT);
+
+	if(shift != 0)
+	{
+		*r_dst = res;
+		FLAG_X = (new_x_flag != 0)<<8;
+	}
+	else
+		res = src;
+	FLAG_C = FLAG_X;
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+
+#endif
+}
+
+
+static void m68k_op_roxl_16_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxl_16_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxl_16_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxl_16_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxl_16_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxl_16_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_roxl_16_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint src = m68ki_read_16(state, ea);
+	uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
+
+	FLAG_C = FLAG_X = res >> 8;
+	res = MASK_OUT_ABOVE_16(res);
+
+	m68ki_write_16(state, ea, res);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_rtd_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
+	{
+		uint new_pc = m68ki_pull_32(state);
+
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		REG_A[7] = MASK_OUT_ABOVE_32(REG_A[7] + MAKE_INT_16(OPER_I_16(state)));
+		m68ki_jump(state, new_pc);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_rte_32(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint new_sr;
+		uint new_pc;
+		uint format_word;
+		uint16 frame[4];	/* SR, PC and the format word, read in one go */
+
+		m68ki_rte_callback();		   /* auto-disable (see m68kcpu.h) */
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+
+		if(CPU_TYPE_IS_000(CPU_TYPE))
+		{
+			m68ki_read_words(state, REG_A[7], frame, 3);
+			new_sr = frame[0];
+			new_pc = (frame[1] << 16) | frame[2];
+			REG_A[7] += 6;
+			m68ki_jump(state, new_pc);
+			m68ki_set_sr(state, new_sr);
+
+			CPU_INSTR_MODE = INSTRUCTION_YES;
+			CPU_RUN_MODE = RUN_MODE_NORMAL;
+
+			return;
+		}
+
+		if(CPU_TYPE_IS_010(CPU_TYPE))
+		{
+			m68ki_read_words(state, REG_A[7], frame, 4);
+			format_word = frame[3] >> 12;
+			if(format_word == 0)
+			{
+				new_sr = frame[0];
+				new_pc = (frame[1] << 16) | frame[2];
+				REG_A[7] += 6;
+				m68ki_fake_pull_16(state);	/* format word */
+				m68ki_jump(state, new_pc);
+				m68ki_set_sr(state, new_sr);
+				CPU_INSTR_MODE = INSTRUCTION_YES;
+				CPU_RUN_MODE = RUN_MODE_NORMAL;
+				return;
+			} else if (format_word == 8) {
+				/* Format 8 stack frame -- 68010 only. 29 word bus/address error */
+				new_sr = frame[0];
+				new_pc = (frame[1] << 16) | frame[2];
+				REG_A[7] += 6;
+				m68ki_fake_pull_16(state);	/* format word */
+				m68ki_jump(state, new_pc);
+				m68ki_set_sr(state, new_sr);
+				CPU_INSTR_MODE = INSTRUCTION_YES;
+				CPU_RUN_MODE = RUN_MODE_NORMAL;
+				m68ki_fake_pull_16(state);  /* special status */
+				m68ki_fake_pull_32(state);	/* fault address */
+				m68ki_fake_pull_32(state);  /* reserved and data output buffer */
+				m68ki_fake_pull_32(state);  /* reserved and data input buffer */
+				m68ki_fake_pull_32(state);  /* reserved and instruction input buffer */
+				m68ki_fake_pull_32(state);  /* 8 dwords of CPU specific undocumented data */
+				m68ki_fake_pull_32(state);
+				m68ki_fake_pull_32(state);
+				m68ki_fake_pull_32(state);
+				m68ki_fake_pull_32(state);
+				m68ki_fake_pull_32(state);
+				m68ki_fake_pull_32(state);
+				m68ki_fake_pull_32(state);
+				return;
+			}
+			CPU_INSTR_MODE = INSTRUCTION_YES;
+			CPU_RUN_MODE = RUN_MODE_NORMAL;
+			/* Not handling other exception types (9) */
+			m68ki_exception_format_error(state);
+			return;
+		}
+
+		/* Otherwise it's 020 */
+rte_loop:
+		m68ki_read_words(state, REG_A[7], frame, 4);
+		format_word = frame[3] >> 12;
+		switch(format_word)
+		{
+			case 0: /* Normal */
+				new_sr = frame[0];
+				new_pc = (frame[1] << 16) | frame[2];
+				REG_A[7] += 6;
+				m68ki_fake_pull_16(state);	/* format word */
+				m68ki_jump(state, new_pc);
+				m68ki_set_sr(state, new_sr);
+				CPU_INSTR_MODE = INSTRUCTION_YES;
+				CPU_RUN_MODE = RUN_MODE_NORMAL;
+				return;
+			case 1: /* Throwaway */
+				new_sr = frame[0];
+				m68ki_fake_pull_16(state);	/* status register */
+				m68ki_fake_pull_32(state);	/* program counter */
+				m68ki_fake_pull_16(state);	/* format word */
+				m68ki_set_sr_noint(state, new_sr);
+				goto rte_loop;
+			case 2: /* Trap */
+				new_sr = frame[0];
+				new_pc = (frame[1] << 16) | frame[2];
+				REG_A[7] += 6;
+				m68ki_fake_pull_16(state);	/* format word */
+				m68ki_fake_pull_32(state);	/* address */
+				m68ki_jump(state, new_pc);
+				m68ki_set_sr(state, new_sr);
+				CPU_INSTR_MODE = INSTRUCTION_YES;
+				CPU_RUN_MODE = RUN_MODE_NORMAL;
+				return;
+			case 7: /* 68040 access error */
+				new_sr = frame[0];
+				new_pc = (frame[1] << 16) | frame[2];
+				REG_A[7] += 6;
+				m68ki_fake_pull_16(state);   /* $06: format word */
+				m68ki_fake_pull_32(state);   /* $08: effective address */
+				m68ki_fake_pull_16(state);   /* $0c: special status word */
+				m68ki_fake_pull_16(state);   /* $0e: wb3s */
+				m68ki_fake_pull_16(state);   /* $10: wb2s */
+				m68ki_fake_pull_16(state);   /* $12: wb1s */
+				m68ki_fake_pull_32(state);   /* $14: data fault address */
+				m68ki_fake_pull_32(state);   /* $18: wb3a */
+				m68ki_fake_pull_32(state);   /* $1c: wb3d */
+				m68ki_fake_pull_32(state);   /* $20: wb2a */
+				m68ki_fake_pull_32(state);   /* $24: wb2d */
+				m68ki_fake_pull_32(state);   /* $28: wb1a */
+				m68ki_fake_pull_32(state);   /* $2c: wb1d/pd0 */
+				m68ki_fake_pull_32(state);   /* $30: pd1 */
+				m68ki_fake_pull_32(state);   /* $34: pd2 */
+				m68ki_fake_pull_32(state);   /* $38: pd3 */
+				m68ki_jump(state, new_pc);
+				m68ki_set_sr(state, new_sr);
+				CPU_INSTR_MODE = INSTRUCTION_YES;
+				CPU_RUN_MODE = RUN_MODE_NORMAL;
+				return;
+
+			case 0x0a: /* Bus Error at instruction boundary */
+				new_sr = frame[0];
+				new_pc = (frame[1] << 16) | frame[2];
+				REG_A[7] += 6;
+				m68ki_fake_pull_16(state);   /* $06: format word */
+				m68ki_fake_pull_16(state);   /* $08: internal register */
+				m68ki_fake_pull_16(state);   /* $0a: special status word */
+				m68ki_fake_pull_16(state);   /* $0c: instruction pipe stage c */
+				m68ki_fake_pull_16(state);   /* $0e: instruction pipe stage b */
+				m68ki_fake_pull_32(state);   /* $10: data fault address */
+				m68ki_fake_pull_32(state);   /* $14: internal registers */
+				m68ki_fake_pull_32(state);   /* $18: data output buffer */
+				m68ki_fake_pull_32(state);   /* $1c: internal registers */
+
+				m68ki_jump(state, new_pc);
+				m68ki_set_sr(state, new_sr);
+				CPU_INSTR_MODE = INSTRUCTION_YES;
+				CPU_RUN_MODE = RUN_MODE_NORMAL;
+				return;
+
+			case 0x0b: /* Bus Error - Instruction Execution in Progress */
+				new_sr = frame[0];
+				new_pc = (frame[1] << 16) | frame[2];
+				REG_A[7] += 6;
+				m68ki_fake_pull_16(state);   /* $06: format word */
+				m68ki_fake_pull_16(state);   /* $08: internal register */
+				m68ki_fake_pull_16(state);   /* $0a: special status word */
+				m68ki_fake_pull_16(state);   /* $0c: instruction pipe stage c */
+				m68ki_fake_pull_16(state);   /* $0e: instruction pipe stage b */
+				m68ki_fake_pull_32(state);   /* $10: data fault address */
+				m68ki_fake_pull_32(state);   /* $14: internal registers */
+				m68ki_fake_pull_32(state);   /* $18: data output buffer */
+				m68ki_fake_pull_32(state);   /* $1c: internal registers */
+				m68ki_fake_pull_32(state);   /* $20:  */
+				m68ki_fake_pull_32(state);   /* $24: stage B address */
+				m68ki_fake_pull_32(state);   /* $28:  */
+				m68ki_fake_pull_32(state);   /* $2c: data input buffer */
+				m68ki_fake_pull_32(state);   /* $30:  */
+				m68ki_fake_pull_16(state);   /* $34:  */
+				m68ki_fake_pull_16(state);   /* $36: version #, internal information */
+				m68ki_fake_pull_32(state);   /* $38:  */
+				m68ki_fake_pull_32(state);   /* $3c:  */
+				m68ki_fake_pull_32(state);   /* $40:  */
+				m68ki_fake_pull_32(state);   /* $44:  */
+				m68ki_fake_pull_32(state);   /* $48:  */
+				m68ki_fake_pull_32(state);   /* $4c:  */
+				m68ki_fake_pull_32(state);   /* $50:  */
+				m68ki_fake_pull_32(state);   /* $54:  */
+				m68ki_fake_pull_32(state);   /* $58:  */
+
+				m68ki_jump(state, new_pc);
+				m68ki_set_sr(state, new_sr);
+				CPU_INSTR_MODE = INSTRUCTION_YES;
+				CPU_RUN_MODE = RUN_MODE_NORMAL;
+				return;
+		}
+		/* Not handling long or short bus fault */
+		CPU_INSTR_MODE = INSTRUCTION_YES;
+		CPU_RUN_MODE = RUN_MODE_NORMAL;
+		m68ki_exception_format_error(state);
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_rtm_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_020_VARIANT(CPU_TYPE))
+	{
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		M68K_DO_LOG((M68K_LOG_FILEHANDLE "%s at %08x: called unimplemented instruction %04x (%s)\n",
+					 m68ki_cpu_names[CPU_TYPE], ADDRESS_68K(REG_PC - 2), REG_IR,
+					 m68ki_disassemble_quick(ADDRESS_68K(REG_PC - 2),CPU_TYPE)));
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_rtr_32(m68ki_cpu_core *state)
+{
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+	m68ki_set_ccr(state, m68ki_pull_16(state));
+	m68ki_jump(state, m68ki_pull_32(state));
+}
+
+
+static void m68k_op_rts_32(m68ki_cpu_core *state)
+{
+	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
+	m68ki_jump(state, m68ki_pull_32(state));
+}
+
+
+static void m68k_op_sbcd_8_rr(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = DY;
+	uint dst = *r_dst;
+	uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
+	uint corf = 0;
+
+	if(res > 0xf)
+		corf = 6;
+	res += HIGH_NIBBLE(dst) - HIGH_NIBBLE(src);
+	FLAG_V = res; /* Undefined V behavior */
+	if(res > 0xff) {
+		res += 0xa0;
+		FLAG_X = FLAG_C = CFLAG_SET;
+	} else if(res < corf)
+		FLAG_X = FLAG_C = CFLAG_SET;
+	else
+		FLAG_N = FLAG_X = FLAG_C = 0;
+
+	res = MASK_OUT_ABOVE_8(res - corf);
+
+	FLAG_V &= ~res; /* Undefined V behavior part II */
+	FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+	FLAG_Z |= res;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+}
+
+
+static void m68k_op_sbcd_8_mm_ax7(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_8(state);
+	uint ea  = EA_A7_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
+	uint corf = 0;
+
+	if(res > 0xf)
+		corf = 6;
+	res += HIGH_NIBBLE(dst) - HIGH_NIBBLE(src);
+	FLAG_V = res; /* Undefined V behavior */
+	if(res > 0xff) {
+		res += 0xa0;
+		FLAG_X = FLAG_C = CFLAG_SET;
+	} else if(res < corf)
+		FLAG_X = FLAG_C = CFLAG_SET;
+	else
+		FLAG_N = FLAG_X = FLAG_C = 0;
+
+	res = MASK_OUT_ABOVE_8(res - corf);
+
+	FLAG_V &= ~res; /* Undefined V behavior part II */
+	FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_sbcd_8_mm_ay7(m68ki_cpu_core *state)
+{
+	uint src = OPER_A7_PD_8(state);
+	uint ea  = EA_AX_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
+	uint corf = 0;
+
+	if(res > 0xf)
+		corf = 6;
+	res += HIGH_NIBBLE(dst) - HIGH_NIBBLE(src);
+	FLAG_V = res; /* Undefined V behavior */
+	if(res > 0xff) {
+		res += 0xa0;
+		FLAG_X = FLAG_C = CFLAG_SET;
+	} else if(res < corf)
+		FLAG_X = FLAG_C = CFLAG_SET;
+	else
+		FLAG_N = FLAG_X = FLAG_C = 0;
+
+	res = MASK_OUT_ABOVE_8(res - corf);
+
+	FLAG_V &= ~res; /* Undefined V behavior part II */
+	FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_sbcd_8_mm_axy7(m68ki_cpu_core *state)
+{
+	uint src = OPER_A7_PD_8(state);
+	uint ea  = EA_A7_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
+	uint corf = 0;
+
+	if(res > 0xf)
+		corf = 6;
+	res += HIGH_NIBBLE(dst) - HIGH_NIBBLE(src);
+	FLAG_V = res; /* Undefined V behavior */
+	if(res > 0xff) {
+		res += 0xa0;
+		FLAG_X = FLAG_C = CFLAG_SET;
+	} else if(res < corf)
+		FLAG_X = FLAG_C = CFLAG_SET;
+	else
+		FLAG_N = FLAG_X = FLAG_C = 0;
+
+	res = MASK_OUT_ABOVE_8(res - corf);
+
+	FLAG_V &= ~res; /* Undefined V behavior part II */
+	FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_sbcd_8_mm(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_8(state);
+	uint ea  = EA_AX_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = LOW_NIBBLE(dst) - LOW_NIBBLE(src) - XFLAG_AS_1();
+	uint corf = 0;
+
+	if(res > 0xf)
+		corf = 6;
+	res += HIGH_NIBBLE(dst) - HIGH_NIBBLE(src);
+	FLAG_V = res; /* Undefined V behavior */
+	if(res > 0xff) {
+		res += 0xa0;
+		FLAG_X = FLAG_C = CFLAG_SET;
+	} else if(res < corf)
+		FLAG_X = FLAG_C = CFLAG_SET;
+	else
+		FLAG_N = FLAG_X = FLAG_C = 0;
+
+	res = MASK_OUT_ABOVE_8(res - corf);
+
+	FLAG_V &= ~res; /* Undefined V behavior part II */
+	FLAG_N = NFLAG_8(res); /* Undefined N behavior */
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_st_8_d(m68ki_cpu_core *state)
+{
+	DY |= 0xff;
+}
+
+
+static void m68k_op_st_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), 0xff);
+}
+
+
+static void m68k_op_st_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), 0xff);
+}
+
+
+static void m68k_op_st_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), 0xff);
+}
+
+
+static void m68k_op_st_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), 0xff);
+}
+
+
+static void m68k_op_st_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), 0xff);
+}
+
+
+static void m68k_op_st_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), 0xff);
+}
+
+
+static void m68k_op_st_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), 0xff);
+}
+
+
+static void m68k_op_st_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), 0xff);
+}
+
+
+static void m68k_op_st_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), 0xff);
+}
+
+
+static void m68k_op_sf_8_d(m68ki_cpu_core *state)
+{
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_sf_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), 0);
+}
+
+
+static void m68k_op_sf_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), 0);
+}
+
+
+static void m68k_op_sf_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), 0);
+}
+
+
+static void m68k_op_sf_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), 0);
+}
+
+
+static void m68k_op_sf_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), 0);
+}
+
+
+static void m68k_op_sf_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), 0);
+}
+
+
+static void m68k_op_sf_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), 0);
+}
+
+
+static void m68k_op_sf_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), 0);
+}
+
+
+static void m68k_op_sf_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), 0);
+}
+
+
+static void m68k_op_shi_8_d(m68ki_cpu_core *state)
+{
+	if(COND_HI())
+	{
+		DY |= 0xff;
+		USE_CYCLES(CYC_SCC_R_TRUE);
+		return;
+	}
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_sls_8_d(m68ki_cpu_core *state)
+{
+	if(COND_LS())
+	{
+		DY |= 0xff;
+		USE_CYCLES(CYC_SCC_R_TRUE);
+		return;
+	}
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_scc_8_d(m68ki_cpu_core *state)
+{
+	if(COND_CC())
+	{
+		DY |= 0xff;
+		USE_CYCLES(CYC_SCC_R_TRUE);
+		return;
+	}
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_scs_8_d(m68ki_cpu_core *state)
+{
+	if(COND_CS())
+	{
+		DY |= 0xff;
+		USE_CYCLES(CYC_SCC_R_TRUE);
+		return;
+	}
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_sne_8_d(m68ki_cpu_core *state)
+{
+	if(COND_NE())
+	{
+		DY |= 0xff;
+		USE_CYCLES(CYC_SCC_R_TRUE);
+		return;
+	}
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_seq_8_d(m68ki_cpu_core *state)
+{
+	if(COND_EQ())
+	{
+		DY |= 0xff;
+		USE_CYCLES(CYC_SCC_R_TRUE);
+		return;
+	}
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_svc_8_d(m68ki_cpu_core *state)
+{
+	if(COND_VC())
+	{
+		DY |= 0xff;
+		USE_CYCLES(CYC_SCC_R_TRUE);
+		return;
+	}
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_svs_8_d(m68ki_cpu_core *state)
+{
+	if(COND_VS())
+	{
+		DY |= 0xff;
+		USE_CYCLES(CYC_SCC_R_TRUE);
+		return;
+	}
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_spl_8_d(m68ki_cpu_core *state)
+{
+	if(COND_PL())
+	{
+		DY |= 0xff;
+		USE_CYCLES(CYC_SCC_R_TRUE);
+		return;
+	}
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_smi_8_d(m68ki_cpu_core *state)
+{
+	if(COND_MI())
+	{
+		DY |= 0xff;
+		USE_CYCLES(CYC_SCC_R_TRUE);
+		return;
+	}
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_sge_8_d(m68ki_cpu_core *state)
+{
+	if(COND_GE())
+	{
+		DY |= 0xff;
+		USE_CYCLES(CYC_SCC_R_TRUE);
+		return;
+	}
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_slt_8_d(m68ki_cpu_core *state)
+{
+	if(COND_LT())
+	{
+		DY |= 0xff;
+		USE_CYCLES(CYC_SCC_R_TRUE);
+		return;
+	}
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_sgt_8_d(m68ki_cpu_core *state)
+{
+	if(COND_GT())
+	{
+		DY |= 0xff;
+		USE_CYCLES(CYC_SCC_R_TRUE);
+		return;
+	}
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_sle_8_d(m68ki_cpu_core *state)
+{
+	if(COND_LE())
+	{
+		DY |= 0xff;
+		USE_CYCLES(CYC_SCC_R_TRUE);
+		return;
+	}
+	DY &= 0xffffff00;
+}
+
+
+static void m68k_op_shi_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), COND_HI() ? 0xff : 0);
+}
+
+
+static void m68k_op_shi_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), COND_HI() ? 0xff : 0);
+}
+
+
+static void m68k_op_shi_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), COND_HI() ? 0xff : 0);
+}
+
+
+static void m68k_op_shi_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), COND_HI() ? 0xff : 0);
+}
+
+
+static void m68k_op_shi_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), COND_HI() ? 0xff : 0);
+}
+
+
+static void m68k_op_shi_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), COND_HI() ? 0xff : 0);
+}
+
+
+static void m68k_op_shi_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), COND_HI() ? 0xff : 0);
+}
+
+
+static void m68k_op_shi_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), COND_HI() ? 0xff : 0);
+}
+
+
+static void m68k_op_shi_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), COND_HI() ? 0xff : 0);
+}
+
+
+static void m68k_op_sls_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), COND_LS() ? 0xff : 0);
+}
+
+
+static void m68k_op_sls_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), COND_LS() ? 0xff : 0);
+}
+
+
+static void m68k_op_sls_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), COND_LS() ? 0xff : 0);
+}
+
+
+static void m68k_op_sls_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), COND_LS() ? 0xff : 0);
+}
+
+
+static void m68k_op_sls_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), COND_LS() ? 0xff : 0);
+}
+
+
+static void m68k_op_sls_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), COND_LS() ? 0xff : 0);
+}
+
+
+static void m68k_op_sls_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), COND_LS() ? 0xff : 0);
+}
+
+
+static void m68k_op_sls_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), COND_LS() ? 0xff : 0);
+}
+
+
+static void m68k_op_sls_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), COND_LS() ? 0xff : 0);
+}
+
+
+static void m68k_op_scc_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), COND_CC() ? 0xff : 0);
+}
+
+
+static void m68k_op_scc_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), COND_CC() ? 0xff : 0);
+}
+
+
+static void m68k_op_scc_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), COND_CC() ? 0xff : 0);
+}
+
+
+static void m68k_op_scc_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), COND_CC() ? 0xff : 0);
+}
+
+
+static void m68k_op_scc_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), COND_CC() ? 0xff : 0);
+}
+
+
+static void m68k_op_scc_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), COND_CC() ? 0xff : 0);
+}
+
+
+static void m68k_op_scc_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), COND_CC() ? 0xff : 0);
+}
+
+
+static void m68k_op_scc_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), COND_CC() ? 0xff : 0);
+}
+
+
+static void m68k_op_scc_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), COND_CC() ? 0xff : 0);
+}
+
+
+static void m68k_op_scs_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), COND_CS() ? 0xff : 0);
+}
+
+
+static void m68k_op_scs_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), COND_CS() ? 0xff : 0);
+}
+
+
+static void m68k_op_scs_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), COND_CS() ? 0xff : 0);
+}
+
+
+static void m68k_op_scs_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), COND_CS() ? 0xff : 0);
+}
+
+
+static void m68k_op_scs_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), COND_CS() ? 0xff : 0);
+}
+
+
+static void m68k_op_scs_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), COND_CS() ? 0xff : 0);
+}
+
+
+static void m68k_op_scs_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), COND_CS() ? 0xff : 0);
+}
+
+
+static void m68k_op_scs_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), COND_CS() ? 0xff : 0);
+}
+
+
+static void m68k_op_scs_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), COND_CS() ? 0xff : 0);
+}
+
+
+static void m68k_op_sne_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), COND_NE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sne_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), COND_NE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sne_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), COND_NE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sne_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), COND_NE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sne_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), COND_NE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sne_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), COND_NE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sne_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), COND_NE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sne_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), COND_NE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sne_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), COND_NE() ? 0xff : 0);
+}
+
+
+static void m68k_op_seq_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), COND_EQ() ? 0xff : 0);
+}
+
+
+static void m68k_op_seq_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), COND_EQ() ? 0xff : 0);
+}
+
+
+static void m68k_op_seq_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), COND_EQ() ? 0xff : 0);
+}
+
+
+static void m68k_op_seq_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), COND_EQ() ? 0xff : 0);
+}
+
+
+static void m68k_op_seq_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), COND_EQ() ? 0xff : 0);
+}
+
+
+static void m68k_op_seq_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), COND_EQ() ? 0xff : 0);
+}
+
+
+static void m68k_op_seq_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), COND_EQ() ? 0xff : 0);
+}
+
+
+static void m68k_op_seq_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), COND_EQ() ? 0xff : 0);
+}
+
+
+static void m68k_op_seq_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), COND_EQ() ? 0xff : 0);
+}
+
+
+static void m68k_op_svc_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), COND_VC() ? 0xff : 0);
+}
+
+
+static void m68k_op_svc_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), COND_VC() ? 0xff : 0);
+}
+
+
+static void m68k_op_svc_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), COND_VC() ? 0xff : 0);
+}
+
+
+static void m68k_op_svc_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), COND_VC() ? 0xff : 0);
+}
+
+
+static void m68k_op_svc_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), COND_VC() ? 0xff : 0);
+}
+
+
+static void m68k_op_svc_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), COND_VC() ? 0xff : 0);
+}
+
+
+static void m68k_op_svc_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), COND_VC() ? 0xff : 0);
+}
+
+
+static void m68k_op_svc_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), COND_VC() ? 0xff : 0);
+}
+
+
+static void m68k_op_svc_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), COND_VC() ? 0xff : 0);
+}
+
+
+static void m68k_op_svs_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), COND_VS() ? 0xff : 0);
+}
+
+
+static void m68k_op_svs_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), COND_VS() ? 0xff : 0);
+}
+
+
+static void m68k_op_svs_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), COND_VS() ? 0xff : 0);
+}
+
+
+static void m68k_op_svs_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), COND_VS() ? 0xff : 0);
+}
+
+
+static void m68k_op_svs_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), COND_VS() ? 0xff : 0);
+}
+
+
+static void m68k_op_svs_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), COND_VS() ? 0xff : 0);
+}
+
+
+static void m68k_op_svs_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), COND_VS() ? 0xff : 0);
+}
+
+
+static void m68k_op_svs_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), COND_VS() ? 0xff : 0);
+}
+
+
+static void m68k_op_svs_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), COND_VS() ? 0xff : 0);
+}
+
+
+static void m68k_op_spl_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), COND_PL() ? 0xff : 0);
+}
+
+
+static void m68k_op_spl_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), COND_PL() ? 0xff : 0);
+}
+
+
+static void m68k_op_spl_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), COND_PL() ? 0xff : 0);
+}
+
+
+static void m68k_op_spl_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), COND_PL() ? 0xff : 0);
+}
+
+
+static void m68k_op_spl_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), COND_PL() ? 0xff : 0);
+}
+
+
+static void m68k_op_spl_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), COND_PL() ? 0xff : 0);
+}
+
+
+static void m68k_op_spl_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), COND_PL() ? 0xff : 0);
+}
+
+
+static void m68k_op_spl_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), COND_PL() ? 0xff : 0);
+}
+
+
+static void m68k_op_spl_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), COND_PL() ? 0xff : 0);
+}
+
+
+static void m68k_op_smi_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), COND_MI() ? 0xff : 0);
+}
+
+
+static void m68k_op_smi_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), COND_MI() ? 0xff : 0);
+}
+
+
+static void m68k_op_smi_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), COND_MI() ? 0xff : 0);
+}
+
+
+static void m68k_op_smi_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), COND_MI() ? 0xff : 0);
+}
+
+
+static void m68k_op_smi_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), COND_MI() ? 0xff : 0);
+}
+
+
+static void m68k_op_smi_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), COND_MI() ? 0xff : 0);
+}
+
+
+static void m68k_op_smi_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), COND_MI() ? 0xff : 0);
+}
+
+
+static void m68k_op_smi_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), COND_MI() ? 0xff : 0);
+}
+
+
+static void m68k_op_smi_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), COND_MI() ? 0xff : 0);
+}
+
+
+static void m68k_op_sge_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), COND_GE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sge_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), COND_GE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sge_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), COND_GE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sge_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), COND_GE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sge_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), COND_GE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sge_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), COND_GE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sge_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), COND_GE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sge_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), COND_GE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sge_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), COND_GE() ? 0xff : 0);
+}
+
+
+static void m68k_op_slt_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), COND_LT() ? 0xff : 0);
+}
+
+
+static void m68k_op_slt_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), COND_LT() ? 0xff : 0);
+}
+
+
+static void m68k_op_slt_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), COND_LT() ? 0xff : 0);
+}
+
+
+static void m68k_op_slt_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), COND_LT() ? 0xff : 0);
+}
+
+
+static void m68k_op_slt_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), COND_LT() ? 0xff : 0);
+}
+
+
+static void m68k_op_slt_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), COND_LT() ? 0xff : 0);
+}
+
+
+static void m68k_op_slt_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), COND_LT() ? 0xff : 0);
+}
+
+
+static void m68k_op_slt_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), COND_LT() ? 0xff : 0);
+}
+
+
+static void m68k_op_slt_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), COND_LT() ? 0xff : 0);
+}
+
+
+static void m68k_op_sgt_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), COND_GT() ? 0xff : 0);
+}
+
+
+static void m68k_op_sgt_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), COND_GT() ? 0xff : 0);
+}
+
+
+static void m68k_op_sgt_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), COND_GT() ? 0xff : 0);
+}
+
+
+static void m68k_op_sgt_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), COND_GT() ? 0xff : 0);
+}
+
+
+static void m68k_op_sgt_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), COND_GT() ? 0xff : 0);
+}
+
+
+static void m68k_op_sgt_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), COND_GT() ? 0xff : 0);
+}
+
+
+static void m68k_op_sgt_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), COND_GT() ? 0xff : 0);
+}
+
+
+static void m68k_op_sgt_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), COND_GT() ? 0xff : 0);
+}
+
+
+static void m68k_op_sgt_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), COND_GT() ? 0xff : 0);
+}
+
+
+static void m68k_op_sle_8_ai(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_AI_8(), COND_LE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sle_8_pi(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PI_8(), COND_LE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sle_8_pi7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PI_8(), COND_LE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sle_8_pd(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_PD_8(), COND_LE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sle_8_pd7(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_A7_PD_8(), COND_LE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sle_8_di(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_DI_8(), COND_LE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sle_8_ix(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AY_IX_8(), COND_LE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sle_8_aw(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AW_8(), COND_LE() ? 0xff : 0);
+}
+
+
+static void m68k_op_sle_8_al(m68ki_cpu_core *state)
+{
+	m68ki_write_8(state, EA_AL_8(), COND_LE() ? 0xff : 0);
+}
+
+
+static void m68k_op_stop(m68ki_cpu_core *state)
+{
+	if(FLAG_S)
+	{
+		uint new_sr = OPER_I_16(state);
+		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
+		CPU_STOPPED |= STOP_LEVEL_STOP;
+		m68ki_set_sr(state, new_sr);
+		if(m68ki_remaining_cycles >= CYC_INSTRUCTION[REG_IR])
+			m68ki_remaining_cycles = CYC_INSTRUCTION[REG_IR];
+		else
+			USE_ALL_CYCLES();
+		return;
+	}
+	m68ki_exception_privilege_violation(state);
+}
+
+
+static void m68k_op_sub_8_er_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = MASK_OUT_ABOVE_8(DY);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_8_er_ai(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_AI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_8_er_pi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_PI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_8_er_pi7(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_A7_PI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_8_er_pd(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_PD_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_8_er_pd7(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_A7_PD_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_8_er_di(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_DI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_8_er_ix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_IX_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_8_er_aw(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AW_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_8_er_al(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AL_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_8_er_pcdi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_PCDI_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_8_er_pcix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_PCIX_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_8_er_i(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_I_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_16_er_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = MASK_OUT_ABOVE_16(DY);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_16_er_a(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = MASK_OUT_ABOVE_16(AY);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_16_er_ai(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_AI_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_16_er_pi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_PI_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_16_er_pd(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_PD_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_16_er_di(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_DI_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_16_er_ix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_IX_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_16_er_aw(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AW_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_16_er_al(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AL_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_16_er_pcdi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_PCDI_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_16_er_pcix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_PCIX_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_16_er_i(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_I_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_sub_32_er_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = DY;
+	uint dst = *r_dst;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_sub_32_er_a(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = AY;
+	uint dst = *r_dst;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_sub_32_er_ai(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_AI_32(state);
+	uint dst = *r_dst;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_sub_32_er_pi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_PI_32(state);
+	uint dst = *r_dst;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_sub_32_er_pd(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_PD_32(state);
+	uint dst = *r_dst;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_sub_32_er_di(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_DI_32(state);
+	uint dst = *r_dst;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_sub_32_er_ix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AY_IX_32(state);
+	uint dst = *r_dst;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_sub_32_er_aw(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AW_32(state);
+	uint dst = *r_dst;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_sub_32_er_al(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_AL_32(state);
+	uint dst = *r_dst;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_sub_32_er_pcdi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_PCDI_32(state);
+	uint dst = *r_dst;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_sub_32_er_pcix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_PCIX_32(state);
+	uint dst = *r_dst;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_sub_32_er_i(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = OPER_I_32(state);
+	uint dst = *r_dst;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_sub_8_re_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_8_re_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_8_re_pi7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PI_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_8_re_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_8_re_pd7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PD_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_8_re_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_8_re_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_8_re_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_8_re_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_8();
+	uint src = MASK_OUT_ABOVE_8(DX);
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_16_re_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_16();
+	uint src = MASK_OUT_ABOVE_16(DX);
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_16_re_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_16();
+	uint src = MASK_OUT_ABOVE_16(DX);
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_16_re_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_16();
+	uint src = MASK_OUT_ABOVE_16(DX);
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_16_re_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_16();
+	uint src = MASK_OUT_ABOVE_16(DX);
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_16_re_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_16();
+	uint src = MASK_OUT_ABOVE_16(DX);
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_16_re_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_16();
+	uint src = MASK_OUT_ABOVE_16(DX);
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_16_re_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_16();
+	uint src = MASK_OUT_ABOVE_16(DX);
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_32_re_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_32();
+	uint src = DX;
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_32_re_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_32();
+	uint src = DX;
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_32_re_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_32();
+	uint src = DX;
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_32_re_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_32();
+	uint src = DX;
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_32_re_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_32();
+	uint src = DX;
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_32_re_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_32();
+	uint src = DX;
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_sub_32_re_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_32();
+	uint src = DX;
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_suba_16_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - MAKE_INT_16(DY));
+}
+
+
+static void m68k_op_suba_16_a(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - MAKE_INT_16(AY));
+}
+
+
+static void m68k_op_suba_16_ai(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_AY_AI_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_16_pi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_AY_PI_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_16_pd(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_AY_PD_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_16_di(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_AY_DI_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_16_ix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_AY_IX_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_16_aw(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_AW_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_16_al(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_AL_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_16_pcdi(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_PCDI_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_16_pcix(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_PCIX_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_16_i(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+	uint src = MAKE_INT_16(OPER_I_16(state));
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_32_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - DY);
+}
+
+
+static void m68k_op_suba_32_a(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - AY);
+}
+
+
+static void m68k_op_suba_32_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_AI_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_32_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PI_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_32_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_32_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_DI_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_32_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_IX_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_32_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_AW_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_32_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_AL_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_32_pcdi(m68ki_cpu_core *state)
+{
+	uint src = OPER_PCDI_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_32_pcix(m68ki_cpu_core *state)
+{
+	uint src = OPER_PCIX_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_suba_32_i(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint* r_dst = &AX;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - src);
+}
+
+
+static void m68k_op_subi_8_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint src = OPER_I_8(state);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_subi_8_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_AI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_8_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_PI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_8_pi7(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_A7_PI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_8_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_8_pd7(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_A7_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_8_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_DI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_8_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AY_IX_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_8_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AW_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_8_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_8(state);
+	uint ea = EA_AL_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_16_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint src = OPER_I_16(state);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_subi_16_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_AI_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_16_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_PI_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_16_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_PD_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_16_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_DI_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_16_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AY_IX_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_16_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AW_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_16_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_16(state);
+	uint ea = EA_AL_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_32_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint src = OPER_I_32(state);
+	uint dst = *r_dst;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_subi_32_ai(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_AI_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_32_pi(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_PI_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_32_pd(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_PD_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_32_di(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_DI_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_32_ix(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AY_IX_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_32_aw(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AW_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subi_32_al(m68ki_cpu_core *state)
+{
+	uint src = OPER_I_32(state);
+	uint ea = EA_AL_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_8_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_subq_8_ai(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_AI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_8_pi(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_PI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_8_pi7(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_A7_PI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_8_pd(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_8_pd7(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_A7_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_8_di(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_DI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_8_ix(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_IX_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_8_aw(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AW_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_8_al(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AL_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = MASK_OUT_ABOVE_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	m68ki_write_8(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_16_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
+}
+
+
+static void m68k_op_subq_16_a(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AY;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - ((((REG_IR >> 9) - 1) & 7) + 1));
+}
+
+
+static void m68k_op_subq_16_ai(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_AI_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_16_pi(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_PI_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_16_pd(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_PD_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_16_di(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_DI_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_16_ix(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_IX_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_16_aw(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AW_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_16_al(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AL_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = MASK_OUT_ABOVE_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	m68ki_write_16(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_32_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint dst = *r_dst;
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	*r_dst = FLAG_Z;
+}
+
+
+static void m68k_op_subq_32_a(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AY;
+
+	*r_dst = MASK_OUT_ABOVE_32(*r_dst - ((((REG_IR >> 9) - 1) & 7) + 1));
+}
+
+
+static void m68k_op_subq_32_ai(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_AI_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_32_pi(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_PI_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_32_pd(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_PD_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_32_di(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_DI_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_32_ix(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AY_IX_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_32_aw(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AW_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subq_32_al(m68ki_cpu_core *state)
+{
+	uint src = (((REG_IR >> 9) - 1) & 7) + 1;
+	uint ea = EA_AL_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = MASK_OUT_ABOVE_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	m68ki_write_32(state, ea, FLAG_Z);
+}
+
+
+static void m68k_op_subx_8_rr(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = MASK_OUT_ABOVE_8(DY);
+	uint dst = MASK_OUT_ABOVE_8(*r_dst);
+	uint res = dst - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	*r_dst = MASK_OUT_BELOW_8(*r_dst) | res;
+}
+
+
+static void m68k_op_subx_16_rr(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = MASK_OUT_ABOVE_16(DY);
+	uint dst = MASK_OUT_ABOVE_16(*r_dst);
+	uint res = dst - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	res = MASK_OUT_ABOVE_16(res);
+	FLAG_Z |= res;
+
+	*r_dst = MASK_OUT_BELOW_16(*r_dst) | res;
+}
+
+
+static void m68k_op_subx_32_rr(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DX;
+	uint src = DY;
+	uint dst = *r_dst;
+	uint res = dst - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	res = MASK_OUT_ABOVE_32(res);
+	FLAG_Z |= res;
+
+	*r_dst = res;
+}
+
+
+static void m68k_op_subx_8_mm_ax7(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_8(state);
+	uint ea  = EA_A7_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_subx_8_mm_ay7(m68ki_cpu_core *state)
+{
+	uint src = OPER_A7_PD_8(state);
+	uint ea  = EA_AX_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_subx_8_mm_axy7(m68ki_cpu_core *state)
+{
+	uint src = OPER_A7_PD_8(state);
+	uint ea  = EA_A7_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_subx_8_mm(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_8(state);
+	uint ea  = EA_AX_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint res = dst - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_X = FLAG_C = CFLAG_8(res);
+	FLAG_V = VFLAG_SUB_8(src, dst, res);
+
+	res = MASK_OUT_ABOVE_8(res);
+	FLAG_Z |= res;
+
+	m68ki_write_8(state, ea, res);
+}
+
+
+static void m68k_op_subx_16_mm(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_16(state);
+	uint ea  = EA_AX_PD_16();
+	uint dst = m68ki_read_16(state, ea);
+	uint res = dst - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_X = FLAG_C = CFLAG_16(res);
+	FLAG_V = VFLAG_SUB_16(src, dst, res);
+
+	res = MASK_OUT_ABOVE_16(res);
+	FLAG_Z |= res;
+
+	m68ki_write_16(state, ea, res);
+}
+
+
+static void m68k_op_subx_32_mm(m68ki_cpu_core *state)
+{
+	uint src = OPER_AY_PD_32(state);
+	uint ea  = EA_AX_PD_32();
+	uint dst = m68ki_read_32(state, ea);
+	uint res = dst - src - XFLAG_AS_1();
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
+	FLAG_V = VFLAG_SUB_32(src, dst, res);
+
+	res = MASK_OUT_ABOVE_32(res);
+	FLAG_Z |= res;
+
+	m68ki_write_32(state, ea, res);
+}
+
+
+static void m68k_op_swap_32(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+
+	FLAG_Z = MASK_OUT_ABOVE_32(*r_dst<<16);
+	*r_dst = (*r_dst>>16) | FLAG_Z;
+
+	FLAG_Z = *r_dst;
+	FLAG_N = NFLAG_32(*r_dst);
+	FLAG_C = CFLAG_CLEAR;
+	FLAG_V = VFLAG_CLEAR;
+}
+
+
+static void m68k_op_tas_8_d(m68ki_cpu_core *state)
+{
+	uint* r_dst = &DY;
+
+	FLAG_Z = MASK_OUT_ABOVE_8(*r_dst);
+	FLAG_N = NFLAG_8(*r_dst);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+	*r_dst |= 0x80;
+}
+
+
+static void m68k_op_tas_8_ai(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_AI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint allow_writeback;
+
+	FLAG_Z = dst;
+	FLAG_N = NFLAG_8(dst);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+
+	/* The Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS writeback
+       disabled in order to function properly.  Some Amiga software may also rely
+       on this, but only when accessing specific addresses so additional functionality
+       will be needed. */
+	allow_writeback = m68ki_tas_callback();
+
+	if (allow_writeback==1) m68ki_write_8(state, ea, dst | 0x80);
+}
+
+
+static void m68k_op_tas_8_pi(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint allow_writeback;
+
+	FLAG_Z = dst;
+	FLAG_N = NFLAG_8(dst);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+
+	/* The Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS writeback
+       disabled in order to function properly.  Some Amiga software may also rely
+       on this, but only when accessing specific addresses so additional functionality
+       will be needed. */
+	allow_writeback = m68ki_tas_callback();
+
+	if (allow_writeback==1) m68ki_write_8(state, ea, dst | 0x80);
+}
+
+
+static void m68k_op_tas_8_pi7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint allow_writeback;
+
+	FLAG_Z = dst;
+	FLAG_N = NFLAG_8(dst);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+
+	/* The Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS writeback
+       disabled in order to function properly.  Some Amiga software may also rely
+       on this, but only when accessing specific addresses so additional functionality
+       will be needed. */
+	allow_writeback = m68ki_tas_callback();
+
+	if (allow_writeback==1) m68ki_write_8(state, ea, dst | 0x80);
+}
+
+
+static void m68k_op_tas_8_pd(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint allow_writeback;
+
+	FLAG_Z = dst;
+	FLAG_N = NFLAG_8(dst);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+
+	/* The Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS writeback
+       disabled in order to function properly.  Some Amiga software may also rely
+       on this, but only when accessing specific addresses so additional functionality
+       will be needed. */
+	allow_writeback = m68ki_tas_callback();
+
+	if (allow_writeback==1) m68ki_write_8(state, ea, dst | 0x80);
+}
+
+
+static void m68k_op_tas_8_pd7(m68ki_cpu_core *state)
+{
+	uint ea = EA_A7_PD_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint allow_writeback;
+
+	FLAG_Z = dst;
+	FLAG_N = NFLAG_8(dst);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+
+	/* The Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS writeback
+       disabled in order to function properly.  Some Amiga software may also rely
+       on this, but only when accessing specific addresses so additional functionality
+       will be needed. */
+	allow_writeback = m68ki_tas_callback();
+
+	if (allow_writeback==1) m68ki_write_8(state, ea, dst | 0x80);
+}
+
+
+static void m68k_op_tas_8_di(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_DI_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint allow_writeback;
+
+	FLAG_Z = dst;
+	FLAG_N = NFLAG_8(dst);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+
+	/* The Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS writeback
+       disabled in order to function properly.  Some Amiga software may also rely
+       on this, but only when accessing specific addresses so additional functionality
+       will be needed. */
+	allow_writeback = m68ki_tas_callback();
+
+	if (allow_writeback==1) m68ki_write_8(state, ea, dst | 0x80);
+}
+
+
+static void m68k_op_tas_8_ix(m68ki_cpu_core *state)
+{
+	uint ea = EA_AY_IX_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint allow_writeback;
+
+	FLAG_Z = dst;
+	FLAG_N = NFLAG_8(dst);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+
+	/* The Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS writeback
+       disabled in order to function properly.  Some Amiga software may also rely
+       on this, but only when accessing specific addresses so additional functionality
+       will be needed. */
+	allow_writeback = m68ki_tas_callback();
+
+	if (allow_writeback==1) m68ki_write_8(state, ea, dst | 0x80);
+}
+
+
+static void m68k_op_tas_8_aw(m68ki_cpu_core *state)
+{
+	uint ea = EA_AW_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint allow_writeback;
+
+	FLAG_Z = dst;
+	FLAG_N = NFLAG_8(dst);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+
+	/* The Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS writeback
+       disabled in order to function properly.  Some Amiga software may also rely
+       on this, but only when accessing specific addresses so additional functionality
+       will be needed. */
+	allow_writeback = m68ki_tas_callback();
+
+	if (allow_writeback==1) m68ki_write_8(state, ea, dst | 0x80);
+}
+
+
+static void m68k_op_tas_8_al(m68ki_cpu_core *state)
+{
+	uint ea = EA_AL_8();
+	uint dst = m68ki_read_8(state, ea);
+	uint allow_writeback;
+
+	FLAG_Z = dst;
+	FLAG_N = NFLAG_8(dst);
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+
+	/* The Genesis/Megadrive games Gargoyles and Ex-Mutants need the TAS writeback
+       disabled in order to function properly.  Some Amiga software may also rely
+       on this, but only when accessing specific addresses so additional functionality
+       will be needed. */
+	allow_writeback = m68ki_tas_callback();
+
+	if (allow_writeback==1) m68ki_write_8(state, ea, dst | 0x80);
+}
+
+
+static void m68k_op_trap(m68ki_cpu_core *state)
+{
+	/* Trap#n stacks exception frame type 0 */
+	m68ki_exception_trapN(state, EXCEPTION_TRAP_BASE + (REG_IR & 0xf));	/* HJB 990403 */
+}
+
+
+static void m68k_op_trapt(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapt_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+        REG_PC += 2; // JFF else stackframe & return addresses are incorrect
+		m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapt_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+        REG_PC += 4; // JFF else stackframe & return addresses are incorrect
+		m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapf(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapf_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		REG_PC += 2;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapf_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		REG_PC += 4;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_traphi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_HI())
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapls(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_LS())
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapcc(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_CC())
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapcs(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_CS())
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapne(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_NE())
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapeq(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_EQ())
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapvc(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_VC())
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapvs(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_VS())
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trappl(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_PL())
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapmi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_MI())
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapge(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_GE())
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_traplt(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_LT())
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapgt(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_GT())
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_traple(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		if(COND_LE())
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_traphi_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+     	REG_PC += 2;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_HI())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapls_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+     	REG_PC += 2;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_LS())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapcc_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+     	REG_PC += 2;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_CC())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapcs_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+     	REG_PC += 2;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_CS())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapne_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+     	REG_PC += 2;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_NE())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapeq_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+     	REG_PC += 2;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_EQ())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapvc_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+     	REG_PC += 2;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_VC())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapvs_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+     	REG_PC += 2;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_VS())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trappl_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+     	REG_PC += 2;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_PL())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapmi_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+     	REG_PC += 2;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_MI())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapge_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+     	REG_PC += 2;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_GE())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_traplt_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+     	REG_PC += 2;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_LT())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapgt_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+     	REG_PC += 2;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_GT())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_traple_16(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+     	REG_PC += 2;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_LE())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_traphi_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+		REG_PC += 4;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_HI())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapls_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+		REG_PC += 4;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_LS())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapcc_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+		REG_PC += 4;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_CC())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapcs_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+		REG_PC += 4;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_CS())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapne_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+		REG_PC += 4;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_NE())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapeq_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+		REG_PC += 4;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_EQ())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapvc_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+		REG_PC += 4;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_VC())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapvs_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+		REG_PC += 4;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_VS())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trappl_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+		REG_PC += 4;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_PL())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapmi_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+		REG_PC += 4;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_MI())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapge_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+		REG_PC += 4;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_GE())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_traplt_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+		REG_PC += 4;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_LT())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapgt_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+		REG_PC += 4;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_GT())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_traple_32(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+	// TODO: review this... as mame is not using it...
+		REG_PC += 4;  /* JFF increase before or 1) stackframe is incorrect 2) RTE address is wrong if trap is taken */
+		if(COND_LE())
+		{
+			m68ki_exception_trap(state, EXCEPTION_TRAPV);	/* HJB 990403 */
+			return;
+		}
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_trapv(m68ki_cpu_core *state)
+{
+	if(COND_VC())
+	{
+		return;
+	}
+	m68ki_exception_trap(state, EXCEPTION_TRAPV);  /* HJB 990403 */
+}
+
+
+static void m68k_op_tst_8_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_8(DY);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_8_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_8(state);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_8_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_8(state);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_8_pi7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PI_8(state);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_8_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_8(state);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_8_pd7(m68ki_cpu_core *state)
+{
+	uint res = OPER_A7_PD_8(state);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_8_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_8(state);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_8_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_8(state);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_8_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_8(state);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_8_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_8(state);
+
+	FLAG_N = NFLAG_8(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_8_pcdi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint res = OPER_PCDI_8(state);
+
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_tst_8_pcix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint res = OPER_PCIX_8(state);
+
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_tst_8_i(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint res = OPER_I_8(state);
+
+		FLAG_N = NFLAG_8(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_tst_16_d(m68ki_cpu_core *state)
+{
+	uint res = MASK_OUT_ABOVE_16(DY);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_16_a(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint res = MAKE_INT_16(AY);
+
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_tst_16_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_16(state);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_16_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_16(state);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_16_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_16(state);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_16_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_16(state);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_16_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_16(state);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_16_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_16(state);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_16_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_16(state);
+
+	FLAG_N = NFLAG_16(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_16_pcdi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint res = OPER_PCDI_16(state);
+
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_tst_16_pcix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint res = OPER_PCIX_16(state);
+
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_tst_16_i(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint res = OPER_I_16(state);
+
+		FLAG_N = NFLAG_16(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_tst_32_d(m68ki_cpu_core *state)
+{
+	uint res = DY;
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_32_a(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint res = AY;
+
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_tst_32_ai(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_AI_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_32_pi(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PI_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_32_pd(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_PD_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_32_di(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_DI_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_32_ix(m68ki_cpu_core *state)
+{
+	uint res = OPER_AY_IX_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_32_aw(m68ki_cpu_core *state)
+{
+	uint res = OPER_AW_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_32_al(m68ki_cpu_core *state)
+{
+	uint res = OPER_AL_32(state);
+
+	FLAG_N = NFLAG_32(res);
+	FLAG_Z = res;
+	FLAG_V = VFLAG_CLEAR;
+	FLAG_C = CFLAG_CLEAR;
+}
+
+
+static void m68k_op_tst_32_pcdi(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint res = OPER_PCDI_32(state);
+
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_tst_32_pcix(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint res = OPER_PCIX_32(state);
+
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_tst_32_i(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint res = OPER_I_32(state);
+
+		FLAG_N = NFLAG_32(res);
+		FLAG_Z = res;
+		FLAG_V = VFLAG_CLEAR;
+		FLAG_C = CFLAG_CLEAR;
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_unlk_32_a7(m68ki_cpu_core *state)
+{
+	REG_A[7] = m68ki_read_32(state, REG_A[7]);
+}
+
+
+static void m68k_op_unlk_32(m68ki_cpu_core *state)
+{
+	uint* r_dst = &AY;
+
+	REG_A[7] = *r_dst;
+	*r_dst = m68ki_pull_32(state);
+}
+
+
+static void m68k_op_unpk_16_rr(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		/* Note: DX and DY are reversed in Motorola's docs */
+		uint src = DY;
+		uint* r_dst = &DX;
+
+		*r_dst = MASK_OUT_BELOW_16(*r_dst) | (((((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16(state)) & 0xffff);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_unpk_16_mm_ax7(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		/* Note: AX and AY are reversed in Motorola's docs */
+		uint src = OPER_AY_PD_8(state);
+		uint ea_dst;
+
+		src = (((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16(state);
+		ea_dst = EA_A7_PD_8();
+		m68ki_write_8(state, ea_dst, src & 0xff);
+		ea_dst = EA_A7_PD_8();
+		m68ki_write_8(state, ea_dst, (src >> 8) & 0xff);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_unpk_16_mm_ay7(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		/* Note: AX and AY are reversed in Motorola's docs */
+		uint src = OPER_A7_PD_8(state);
+		uint ea_dst;
+
+		src = (((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16(state);
+		ea_dst = EA_AX_PD_8();
+		m68ki_write_8(state, ea_dst, src & 0xff);
+		ea_dst = EA_AX_PD_8();
+		m68ki_write_8(state, ea_dst, (src >> 8) & 0xff);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_unpk_16_mm_axy7(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		uint src = OPER_A7_PD_8(state);
+		uint ea_dst;
+
+		src = (((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16(state);
+		ea_dst = EA_A7_PD_8();
+		m68ki_write_8(state, ea_dst, src & 0xff);
+		ea_dst = EA_A7_PD_8();
+		m68ki_write_8(state, ea_dst, (src >> 8) & 0xff);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+static void m68k_op_unpk_16_mm(m68ki_cpu_core *state)
+{
+	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
+	{
+		/* Note: AX and AY are reversed in Motorola's docs */
+		uint src = OPER_AY_PD_8(state);
+		uint ea_dst;
+
+		src = (((src << 4) & 0x0f00) | (src & 0x000f)) + OPER_I_16(state);
+		ea_dst = EA_AX_PD_8();
+		m68ki_write_8(state, ea_dst, src & 0xff);
+		ea_dst = EA_AX_PD_8();
+		m68ki_write_8(state, ea_dst, (src >> 8) & 0xff);
+		return;
+	}
+	m68ki_exception_illegal(state);
+}
+
+
+/* ======================================================================== */
+/* ======================= FUSED INSTRUCTION HANDLERS ===================== */
+/* ======================================================================== */
+
+/* generated from m68kfuse.txt */
+
+extern void (*m68ki_instruction_jump_table[0x10000])(m68ki_cpu_core *state);
+
+static void m68k_fuse_move_32_pi_pi(m68ki_cpu_core *state);
+static void m68k_fuse_move_16_pi_pi(m68ki_cpu_core *state);
+static void m68k_fuse_move_8_pi_pi(m68ki_cpu_core *state);
+static void m68k_fuse_dbf_16(m68ki_cpu_core *state);
+static void m68k_fuse_move_32_d_pi(m68ki_cpu_core *state);
+static void m68k_fuse_clr_32_pi(m68ki_cpu_core *state);
+static void m68k_fuse_move_8_d_pi(m68ki_cpu_core *state);
+static void m68k_fuse_cmp_8_d(m68ki_cpu_core *state);
+static void m68k_fuse_cmp_16_d(m68ki_cpu_core *state);
+static void m68k_fuse_cmp_32_d(m68ki_cpu_core *state);
+static void m68k_fuse_cmpa_32_d(m68ki_cpu_core *state);
+static void m68k_fuse_cmpa_32_a(m68ki_cpu_core *state);
+static void m68k_fuse_cmpi_8_d(m68ki_cpu_core *state);
+static void m68k_fuse_cmpi_16_d(m68ki_cpu_core *state);
+static void m68k_fuse_cmpi_32_d(m68ki_cpu_core *state);
+static void m68k_fuse_tst_8_d(m68ki_cpu_core *state);
+static void m68k_fuse_tst_16_d(m68ki_cpu_core *state);
+static void m68k_fuse_tst_32_d(m68ki_cpu_core *state);
+static void m68k_fuse_tst_8_ai(m68ki_cpu_core *state);
+static void m68k_fuse_tst_16_ai(m68ki_cpu_core *state);
+static void m68k_fuse_tst_16_aw(m68ki_cpu_core *state);
+static void m68k_fuse_move_16_d_d(m68ki_cpu_core *state);
+static void m68k_fuse_move_32_d_d(m68ki_cpu_core *state);
+static void m68k_fuse_move_16_d_ai(m68ki_cpu_core *state);
+static void m68k_fuse_move_32_d_ai(m68ki_cpu_core *state);
+static void m68k_fuse_subq_16_d(m68ki_cpu_core *state);
+static void m68k_fuse_subq_32_d(m68ki_cpu_core *state);
+
+static void m68k_fuse_move_32_pi_pi(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_move_32_pi_pi(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_dbf_16 || next == m68k_fuse_dbf_16)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_dbf_16(state);
+	}
+	else if(next == m68k_op_move_32_pi_pi || next == m68k_fuse_move_32_pi_pi)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_move_32_pi_pi(state);
+	}
+}
+
+
+static void m68k_fuse_move_16_pi_pi(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_move_16_pi_pi(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_dbf_16 || next == m68k_fuse_dbf_16)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_dbf_16(state);
+	}
+}
+
+
+static void m68k_fuse_move_8_pi_pi(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_move_8_pi_pi(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_dbf_16 || next == m68k_fuse_dbf_16)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_dbf_16(state);
+	}
+	else if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_dbf_16(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_dbf_16(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_move_32_pi_pi || next == m68k_fuse_move_32_pi_pi)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_move_32_pi_pi(state);
+	}
+	else if(next == m68k_op_move_16_pi_pi || next == m68k_fuse_move_16_pi_pi)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_move_16_pi_pi(state);
+	}
+	else if(next == m68k_op_move_8_pi_pi || next == m68k_fuse_move_8_pi_pi)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_move_8_pi_pi(state);
+	}
+}
+
+
+static void m68k_fuse_move_32_d_pi(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_move_32_d_pi(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_dbf_16 || next == m68k_fuse_dbf_16)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_dbf_16(state);
+	}
+}
+
+
+static void m68k_fuse_clr_32_pi(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_clr_32_pi(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_dbf_16 || next == m68k_fuse_dbf_16)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_dbf_16(state);
+	}
+}
+
+
+static void m68k_fuse_move_8_d_pi(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_move_8_d_pi(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+	else if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+}
+
+
+static void m68k_fuse_cmp_8_d(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_cmp_8_d(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+	else if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+}
+
+
+static void m68k_fuse_cmp_16_d(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_cmp_16_d(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+	else if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+}
+
+
+static void m68k_fuse_cmp_32_d(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_cmp_32_d(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+	else if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+	else if(next == m68k_op_bcs_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bcs_8(state);
+	}
+}
+
+
+static void m68k_fuse_cmpa_32_d(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_cmpa_32_d(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_cmpa_32_a(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_cmpa_32_a(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_bcs_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bcs_8(state);
+	}
+}
+
+
+static void m68k_fuse_cmpi_8_d(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_cmpi_8_d(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+	else if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_cmpi_16_d(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_cmpi_16_d(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+	else if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_cmpi_32_d(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_cmpi_32_d(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+	else if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_tst_8_d(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_tst_8_d(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+	else if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_tst_16_d(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_tst_16_d(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+	else if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+	else if(next == m68k_op_bmi_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bmi_8(state);
+	}
+}
+
+
+static void m68k_fuse_tst_32_d(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_tst_32_d(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+	else if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_tst_8_ai(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_tst_8_ai(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+	else if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_tst_16_ai(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_tst_16_ai(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+	else if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_tst_16_aw(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_tst_16_aw(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+	else if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_move_16_d_d(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_move_16_d_d(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+	else if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_move_32_d_d(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_move_32_d_d(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+	else if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_move_16_d_ai(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_move_16_d_ai(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+	else if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_move_32_d_ai(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_move_32_d_ai(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_beq_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_beq_8(state);
+	}
+	else if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_subq_16_d(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_subq_16_d(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+static void m68k_fuse_subq_32_d(m68ki_cpu_core *state)
+{
+	void (*next)(m68ki_cpu_core *state);
+
+	m68k_op_subq_32_d(state);
+
+	if(!m68ki_fuse_ready(state))
+		return;
+
+	next = m68ki_instruction_jump_table[MASK_OUT_ABOVE_16(CPU_PREF_DATA)];
+
+	if(next == m68k_op_bne_8)
+	{
+		m68ki_fuse_fetch(state);
+		m68k_op_bne_8(state);
+	}
+}
+
+
+/* Handlers in m68k_opcode_handler_table order, m68k_op_illegal last */
+void (*const M68KI_MODEL_NAME(m68ki_handlers)[])(m68ki_cpu_core *state) =
+{
+	m68k_op_1010,
+	m68k_op_1111,
+	m68k_op_moveq_32,
+	m68k_op_cpbcc_32,
+	m68k_op_cpgen_32,
+	m68k_op_cpscc_32,
+	m68k_op_pmmu_32,
+	m68k_op_bra_8,
+	m68k_op_bsr_8,
+	m68k_op_bhi_8,
+	m68k_op_bls_8,
+	m68k_op_bcc_8,
+	m68k_op_bcs_8,
+	m68k_op_bne_8,
+	m68k_op_beq_8,
+	m68k_op_bvc_8,
+	m68k_op_bvs_8,
+	m68k_op_bpl_8,
+	m68k_op_bmi_8,
+	m68k_op_bge_8,
+	m68k_op_blt_8,
+	m68k_op_bgt_8,
+	m68k_op_ble_8,
+	m68k_op_040fpu0_32,
+	m68k_op_040fpu1_32,
+	m68k_op_btst_32_r_d,
+	m68k_op_movep_16_er,
+	m68k_op_btst_8_r_ai,
+	m68k_op_btst_8_r_pi,
+	m68k_op_btst_8_r_pd,
+	m68k_op_btst_8_r_di,
+	m68k_op_btst_8_r_ix,
+	m68k_op_bchg_32_r_d,
+	m68k_op_movep_32_er,
+	m68k_op_bchg_8_r_ai,
+	m68k_op_bchg_8_r_pi,
+	m68k_op_bchg_8_r_pd,
+	m68k_op_bchg_8_r_di,
+	m68k_op_bchg_8_r_ix,
+	m68k_op_bclr_32_r_d,
+	m68k_op_movep_16_re,
+	m68k_op_bclr_8_r_ai,
+	m68k_op_bclr_8_r_pi,
+	m68k_op_bclr_8_r_pd,
+	m68k_op_bclr_8_r_di,
+	m68k_op_bclr_8_r_ix,
+	m68k_op_bset_32_r_d,
+	m68k_op_movep_32_re,
+	m68k_op_bset_8_r_ai,
+	m68k_op_bset_8_r_pi,
+	m68k_op_bset_8_r_pd,
+	m68k_op_bset_8_r_di,
+	m68k_op_bset_8_r_ix,
+	m68k_op_move_8_d_d,
+	m68k_op_move_8_d_ai,
+	m68k_op_move_8_d_pi,
+	m68k_op_move_8_d_pd,
+	m68k_op_move_8_d_di,
+	m68k_op_move_8_d_ix,
+	m68k_op_move_8_ai_d,
+	m68k_op_move_8_ai_ai,
+	m68k_op_move_8_ai_pi,
+	m68k_op_move_8_ai_pd,
+	m68k_op_move_8_ai_di,
+	m68k_op_move_8_ai_ix,
+	m68k_op_move_8_pi_d,
+	m68k_op_move_8_pi_ai,
+	m68k_op_move_8_pi_pi,
+	m68k_op_move_8_pi_pd,
+	m68k_op_move_8_pi_di,
+	m68k_op_move_8_pi_ix,
+	m68k_op_move_8_pd_d,
+	m68k_op_move_8_pd_ai,
+	m68k_op_move_8_pd_pi,
+	m68k_op_move_8_pd_pd,
+	m68k_op_move_8_pd_di,
+	m68k_op_move_8_pd_ix,
+	m68k_op_move_8_di_d,
+	m68k_op_move_8_di_ai,
+	m68k_op_move_8_di_pi,
+	m68k_op_move_8_di_pd,
+	m68k_op_move_8_di_di,
+	m68k_op_move_8_di_ix,
+	m68k_op_move_8_ix_d,
+	m68k_op_move_8_ix_ai,
+	m68k_op_move_8_ix_pi,
+	m68k_op_move_8_ix_pd,
+	m68k_op_move_8_ix_di,
+	m68k_op_move_8_ix_ix,
+	m68k_op_move_32_d_d,
+	m68k_op_move_32_d_a,
+	m68k_op_move_32_d_ai,
+	m68k_op_move_32_d_pi,
+	m68k_op_move_32_d_pd,
+	m68k_op_move_32_d_di,
+	m68k_op_move_32_d_ix,
+	m68k_op_movea_32_d,
+	m68k_op_movea_32_a,
+	m68k_op_movea_32_ai,
+	m68k_op_movea_32_pi,
+	m68k_op_movea_32_pd,
+	m68k_op_movea_32_di,
+	m68k_op_movea_32_ix,
+	m68k_op_move_32_ai_d,
+	m68k_op_move_32_ai_a,
+	m68k_op_move_32_ai_ai,
+	m68k_op_move_32_ai_pi,
+	m68k_op_move_32_ai_pd,
+	m68k_op_move_32_ai_di,
+	m68k_op_move_32_ai_ix,
+	m68k_op_move_32_pi_d,
+	m68k_op_move_32_pi_a,
+	m68k_op_move_32_pi_ai,
+	m68k_op_move_32_pi_pi,
+	m68k_op_move_32_pi_pd,
+	m68k_op_move_32_pi_di,
+	m68k_op_move_32_pi_ix,
+	m68k_op_move_32_pd_d,
+	m68k_op_move_32_pd_a,
+	m68k_op_move_32_pd_ai,
+	m68k_op_move_32_pd_pi,
+	m68k_op_move_32_pd_pd,
+	m68k_op_move_32_pd_di,
+	m68k_op_move_32_pd_ix,
+	m68k_op_move_32_di_d,
+	m68k_op_move_32_di_a,
+	m68k_op_move_32_di_ai,
+	m68k_op_move_32_di_pi,
+	m68k_op_move_32_di_pd,
+	m68k_op_move_32_di_di,
+	m68k_op_move_32_di_ix,
+	m68k_op_move_32_ix_d,
+	m68k_op_move_32_ix_a,
+	m68k_op_move_32_ix_ai,
+	m68k_op_move_32_ix_pi,
+	m68k_op_move_32_ix_pd,
+	m68k_op_move_32_ix_di,
+	m68k_op_move_32_ix_ix,
+	m68k_op_move_16_d_d,
+	m68k_op_move_16_d_a,
+	m68k_op_move_16_d_ai,
+	m68k_op_move_16_d_pi,
+	m68k_op_move_16_d_pd,
+	m68k_op_move_16_d_di,
+	m68k_op_move_16_d_ix,
+	m68k_op_movea_16_d,
+	m68k_op_movea_16_a,
+	m68k_op_movea_16_ai,
+	m68k_op_movea_16_pi,
+	m68k_op_movea_16_pd,
+	m68k_op_movea_16_di,
+	m68k_op_movea_16_ix,
+	m68k_op_move_16_ai_d,
+	m68k_op_move_16_ai_a,
+	m68k_op_move_16_ai_ai,
+	m68k_op_move_16_ai_pi,
+	m68k_op_move_16_ai_pd,
+	m68k_op_move_16_ai_di,
+	m68k_op_move_16_ai_ix,
+	m68k_op_move_16_pi_d,
+	m68k_op_move_16_pi_a,
+	m68k_op_move_16_pi_ai,
+	m68k_op_move_16_pi_pi,
+	m68k_op_move_16_pi_pd,
+	m68k_op_move_16_pi_di,
+	m68k_op_move_16_pi_ix,
+	m68k_op_move_16_pd_d,
+	m68k_op_move_16_pd_a,
+	m68k_op_move_16_pd_ai,
+	m68k_op_move_16_pd_pi,
+	m68k_op_move_16_pd_pd,
+	m68k_op_move_16_pd_di,
+	m68k_op_move_16_pd_ix,
+	m68k_op_move_16_di_d,
+	m68k_op_move_16_di_a,
+	m68k_op_move_16_di_ai,
+	m68k_op_move_16_di_pi,
+	m68k_op_move_16_di_pd,
+	m68k_op_move_16_di_di,
+	m68k_op_move_16_di_ix,
+	m68k_op_move_16_ix_d,
+	m68k_op_move_16_ix_a,
+	m68k_op_move_16_ix_ai,
+	m68k_op_move_16_ix_pi,
+	m68k_op_move_16_ix_pd,
+	m68k_op_move_16_ix_di,
+	m68k_op_move_16_ix_ix,
+	m68k_op_chk_32_d,
+	m68k_op_chk_32_ai,
+	m68k_op_chk_32_pi,
+	m68k_op_chk_32_pd,
+	m68k_op_chk_32_di,
+	m68k_op_chk_32_ix,
+	m68k_op_chk_16_d,
+	m68k_op_chk_16_ai,
+	m68k_op_chk_16_pi,
+	m68k_op_chk_16_pd,
+	m68k_op_chk_16_di,
+	m68k_op_chk_16_ix,
+	m68k_op_lea_32_ai,
+	m68k_op_lea_32_di,
+	m68k_op_lea_32_ix,
+	m68k_op_addq_8_d,
+	m68k_op_addq_8_ai,
+	m68k_op_addq_8_pi,
+	m68k_op_addq_8_pd,
+	m68k_op_addq_8_di,
+	m68k_op_addq_8_ix,
+	m68k_op_addq_16_d,
+	m68k_op_addq_16_a,
+	m68k_op_addq_16_ai,
+	m68k_op_addq_16_pi,
+	m68k_op_addq_16_pd,
+	m68k_op_addq_16_di,
+	m68k_op_addq_16_ix,
+	m68k_op_addq_32_d,
+	m68k_op_addq_32_a,
+	m68k_op_addq_32_ai,
+	m68k_op_addq_32_pi,
+	m68k_op_addq_32_pd,
+	m68k_op_addq_32_di,
+	m68k_op_addq_32_ix,
+	m68k_op_subq_8_d,
+	m68k_op_subq_8_ai,
+	m68k_op_subq_8_pi,
+	m68k_op_subq_8_pd,
+	m68k_op_subq_8_di,
+	m68k_op_subq_8_ix,
+	m68k_op_subq_16_d,
+	m68k_op_subq_16_a,
+	m68k_op_subq_16_ai,
+	m68k_op_subq_16_pi,
+	m68k_op_subq_16_pd,
+	m68k_op_subq_16_di,
+	m68k_op_subq_16_ix,
+	m68k_op_subq_32_d,
+	m68k_op_subq_32_a,
+	m68k_op_subq_32_ai,
+	m68k_op_subq_32_pi,
+	m68k_op_subq_32_pd,
+	m68k_op_subq_32_di,
+	m68k_op_subq_32_ix,
+	m68k_op_or_8_er_d,
+	m68k_op_or_8_er_ai,
+	m68k_op_or_8_er_pi,
+	m68k_op_or_8_er_pd,
+	m68k_op_or_8_er_di,
+	m68k_op_or_8_er_ix,
+	m68k_op_or_16_er_d,
+	m68k_op_or_16_er_ai,
+	m68k_op_or_16_er_pi,
+	m68k_op_or_16_er_pd,
+	m68k_op_or_16_er_di,
+	m68k_op_or_16_er_ix,
+	m68k_op_or_32_er_d,
+	m68k_op_or_32_er_ai,
+	m68k_op_or_32_er_pi,
+	m68k_op_or_32_er_pd,
+	m68k_op_or_32_er_di,
+	m68k_op_or_32_er_ix,
+	m68k_op_divu_16_d,
+	m68k_op_divu_16_ai,
+	m68k_op_divu_16_pi,
+	m68k_op_divu_16_pd,
+	m68k_op_divu_16_di,
+	m68k_op_divu_16_ix,
+	m68k_op_sbcd_8_rr,
+	m68k_op_sbcd_8_mm,
+	m68k_op_or_8_re_ai,
+	m68k_op_or_8_re_pi,
+	m68k_op_or_8_re_pd,
+	m68k_op_or_8_re_di,
+	m68k_op_or_8_re_ix,
+	m68k_op_pack_16_rr,
+	m68k_op_pack_16_mm,
+	m68k_op_or_16_re_ai,
+	m68k_op_or_16_re_pi,
+	m68k_op_or_16_re_pd,
+	m68k_op_or_16_re_di,
+	m68k_op_or_16_re_ix,
+	m68k_op_unpk_16_rr,
+	m68k_op_unpk_16_mm,
+	m68k_op_or_32_re_ai,
+	m68k_op_or_32_re_pi,
+	m68k_op_or_32_re_pd,
+	m68k_op_or_32_re_di,
+	m68k_op_or_32_re_ix,
+	m68k_op_divs_16_d,
+	m68k_op_divs_16_ai,
+	m68k_op_divs_16_pi,
+	m68k_op_divs_16_pd,
+	m68k_op_divs_16_di,
+	m68k_op_divs_16_ix,
+	m68k_op_sub_8_er_d,
+	m68k_op_sub_8_er_ai,
+	m68k_op_sub_8_er_pi,
+	m68k_op_sub_8_er_pd,
+	m68k_op_sub_8_er_di,
+	m68k_op_sub_8_er_ix,
+	m68k_op_sub_16_er_d,
+	m68k_op_sub_16_er_a,
+	m68k_op_sub_16_er_ai,
+	m68k_op_sub_16_er_pi,
+	m68k_op_sub_16_er_pd,
+	m68k_op_sub_16_er_di,
+	m68k_op_sub_16_er_ix,
+	m68k_op_sub_32_er_d,
+	m68k_op_sub_32_er_a,
+	m68k_op_sub_32_er_ai,
+	m68k_op_sub_32_er_pi,
+	m68k_op_sub_32_er_pd,
+	m68k_op_sub_32_er_di,
+	m68k_op_sub_32_er_ix,
+	m68k_op_suba_16_d,
+	m68k_op_suba_16_a,
+	m68k_op_suba_16_ai,
+	m68k_op_suba_16_pi,
+	m68k_op_suba_16_pd,
+	m68k_op_suba_16_di,
+	m68k_op_suba_16_ix,
+	m68k_op_subx_8_rr,
+	m68k_op_subx_8_mm,
+	m68k_op_sub_8_re_ai,
+	m68k_op_sub_8_re_pi,
+	m68k_op_sub_8_re_pd,
+	m68k_op_sub_8_re_di,
+	m68k_op_sub_8_re_ix,
+	m68k_op_subx_16_rr,
+	m68k_op_subx_16_mm,
+	m68k_op_sub_16_re_ai,
+	m68k_op_sub_16_re_pi,
+	m68k_op_sub_16_re_pd,
+	m68k_op_sub_16_re_di,
+	m68k_op_sub_16_re_ix,
+	m68k_op_subx_32_rr,
+	m68k_op_subx_32_mm,
+	m68k_op_sub_32_re_ai,
+	m68k_op_sub_32_re_pi,
+	m68k_op_sub_32_re_pd,
+	m68k_op_sub_32_re_di,
+	m68k_op_sub_32_re_ix,
+	m68k_op_suba_32_d,
+	m68k_op_suba_32_a,
+	m68k_op_suba_32_ai,
+	m68k_op_suba_32_pi,
+	m68k_op_suba_32_pd,
+	m68k_op_suba_32_di,
+	m68k_op_suba_32_ix,
+	m68k_op_cmp_8_d,
+	m68k_op_cmp_8_ai,
+	m68k_op_cmp_8_pi,
+	m68k_op_cmp_8_pd,
+	m68k_op_cmp_8_di,
+	m68k_op_cmp_8_ix,
+	m68k_op_cmp_16_d,
+	m68k_op_cmp_16_a,
+	m68k_op_cmp_16_ai,
+	m68k_op_cmp_16_pi,
+	m68k_op_cmp_16_pd,
+	m68k_op_cmp_16_di,
+	m68k_op_cmp_16_ix,
+	m68k_op_cmp_32_d,
+	m68k_op_cmp_32_a,
+	m68k_op_cmp_32_ai,
+	m68k_op_cmp_32_pi,
+	m68k_op_cmp_32_pd,
+	m68k_op_cmp_32_di,
+	m68k_op_cmp_32_ix,
+	m68k_op_cmpa_16_d,
+	m68k_op_cmpa_16_a,
+	m68k_op_cmpa_16_ai,
+	m68k_op_cmpa_16_pi,
+	m68k_op_cmpa_16_pd,
+	m68k_op_cmpa_16_di,
+	m68k_op_cmpa_16_ix,
+	m68k_op_eor_8_d,
+	m68k_op_cmpm_8,
+	m68k_op_eor_8_ai,
+	m68k_op_eor_8_pi,
+	m68k_op_eor_8_pd,
+	m68k_op_eor_8_di,
+	m68k_op_eor_8_ix,
+	m68k_op_eor_16_d,
+	m68k_op_cmpm_16,
+	m68k_op_eor_16_ai,
+	m68k_op_eor_16_pi,
+	m68k_op_eor_16_pd,
+	m68k_op_eor_16_di,
+	m68k_op_eor_16_ix,
+	m68k_op_eor_32_d,
+	m68k_op_cmpm_32,
+	m68k_op_eor_32_ai,
+	m68k_op_eor_32_pi,
+	m68k_op_eor_32_pd,
+	m68k_op_eor_32_di,
+	m68k_op_eor_32_ix,
+	m68k_op_cmpa_32_d,
+	m68k_op_cmpa_32_a,
+	m68k_op_cmpa_32_ai,
+	m68k_op_cmpa_32_pi,
+	m68k_op_cmpa_32_pd,
+	m68k_op_cmpa_32_di,
+	m68k_op_cmpa_32_ix,
+	m68k_op_and_8_er_d,
+	m68k_op_and_8_er_ai,
+	m68k_op_and_8_er_pi,
+	m68k_op_and_8_er_pd,
+	m68k_op_and_8_er_di,
+	m68k_op_and_8_er_ix,
+	m68k_op_and_16_er_d,
+	m68k_op_and_16_er_ai,
+	m68k_op_and_16_er_pi,
+	m68k_op_and_16_er_pd,
+	m68k_op_and_16_er_di,
+	m68k_op_and_16_er_ix,
+	m68k_op_and_32_er_d,
+	m68k_op_and_32_er_ai,
+	m68k_op_and_32_er_pi,
+	m68k_op_and_32_er_pd,
+	m68k_op_and_32_er_di,
+	m68k_op_and_32_er_ix,
+	m68k_op_mulu_16_d,
+	m68k_op_mulu_16_ai,
+	m68k_op_mulu_16_pi,
+	m68k_op_mulu_16_pd,
+	m68k_op_mulu_16_di,
+	m68k_op_mulu_16_ix,
+	m68k_op_abcd_8_rr,
+	m68k_op_abcd_8_mm,
+	m68k_op_and_8_re_ai,
+	m68k_op_and_8_re_pi,
+	m68k_op_and_8_re_pd,
+	m68k_op_and_8_re_di,
+	m68k_op_and_8_re_ix,
+	m68k_op_exg_32_dd,
+	m68k_op_exg_32_aa,
+	m68k_op_and_16_re_ai,
+	m68k_op_and_16_re_pi,
+	m68k_op_and_16_re_pd,
+	m68k_op_and_16_re_di,
+	m68k_op_and_16_re_ix,
+	m68k_op_exg_32_da,
+	m68k_op_and_32_re_ai,
+	m68k_op_and_32_re_pi,
+	m68k_op_and_32_re_pd,
+	m68k_op_and_32_re_di,
+	m68k_op_and_32_re_ix,
+	m68k_op_muls_16_d,
+	m68k_op_muls_16_ai,
+	m68k_op_muls_16_pi,
+	m68k_op_muls_16_pd,
+	m68k_op_muls_16_di,
+	m68k_op_muls_16_ix,
+	m68k_op_add_8_er_d,
+	m68k_op_add_8_er_ai,
+	m68k_op_add_8_er_pi,
+	m68k_op_add_8_er_pd,
+	m68k_op_add_8_er_di,
+	m68k_op_add_8_er_ix,
+	m68k_op_add_16_er_d,
+	m68k_op_add_16_er_a,
+	m68k_op_add_16_er_ai,
+	m68k_op_add_16_er_pi,
+	m68k_op_add_16_er_pd,
+	m68k_op_add_16_er_di,
+	m68k_op_add_16_er_ix,
+	m68k_op_add_32_er_d,
+	m68k_op_add_32_er_a,
+	m68k_op_add_32_er_ai,
+	m68k_op_add_32_er_pi,
+	m68k_op_add_32_er_pd,
+	m68k_op_add_32_er_di,
+	m68k_op_add_32_er_ix,
+	m68k_op_adda_16_d,
+	m68k_op_adda_16_a,
+	m68k_op_adda_16_ai,
+	m68k_op_adda_16_pi,
+	m68k_op_adda_16_pd,
+	m68k_op_adda_16_di,
+	m68k_op_adda_16_ix,
+	m68k_op_addx_8_rr,
+	m68k_op_addx_8_mm,
+	m68k_op_add_8_re_ai,
+	m68k_op_add_8_re_pi,
+	m68k_op_add_8_re_pd,
+	m68k_op_add_8_re_di,
+	m68k_op_add_8_re_ix,
+	m68k_op_addx_16_rr,
+	m68k_op_addx_16_mm,
+	m68k_op_add_16_re_ai,
+	m68k_op_add_16_re_pi,
+	m68k_op_add_16_re_pd,
+	m68k_op_add_16_re_di,
+	m68k_op_add_16_re_ix,
+	m68k_op_addx_32_rr,
+	m68k_op_addx_32_mm,
+	m68k_op_add_32_re_ai,
+	m68k_op_add_32_re_pi,
+	m68k_op_add_32_re_pd,
+	m68k_op_add_32_re_di,
+	m68k_op_add_32_re_ix,
+	m68k_op_adda_32_d,
+	m68k_op_adda_32_a,
+	m68k_op_adda_32_ai,
+	m68k_op_adda_32_pi,
+	m68k_op_adda_32_pd,
+	m68k_op_adda_32_di,
+	m68k_op_adda_32_ix,
+	m68k_op_asr_8_s,
+	m68k_op_lsr_8_s,
+	m68k_op_roxr_8_s,
+	m68k_op_ror_8_s,
+	m68k_op_asr_8_r,
+	m68k_op_lsr_8_r,
+	m68k_op_roxr_8_r,
+	m68k_op_ror_8_r,
+	m68k_op_asr_16_s,
+	m68k_op_lsr_16_s,
+	m68k_op_roxr_16_s,
+	m68k_op_ror_16_s,
+	m68k_op_asr_16_r,
+	m68k_op_lsr_16_r,
+	m68k_op_roxr_16_r,
+	m68k_op_ror_16_r,
+	m68k_op_asr_32_s,
+	m68k_op_lsr_32_s,
+	m68k_op_roxr_32_s,
+	m68k_op_ror_32_s,
+	m68k_op_asr_32_r,
+	m68k_op_lsr_32_r,
+	m68k_op_roxr_32_r,
+	m68k_op_ror_32_r,
+	m68k_op_asl_8_s,
+	m68k_op_lsl_8_s,
+	m68k_op_roxl_8_s,
+	m68k_op_rol_8_s,
+	m68k_op_asl_8_r,
+	m68k_op_lsl_8_r,
+	m68k_op_roxl_8_r,
+	m68k_op_rol_8_r,
+	m68k_op_asl_16_s,
+	m68k_op_lsl_16_s,
+	m68k_op_roxl_16_s,
+	m68k_op_rol_16_s,
+	m68k_op_asl_16_r,
+	m68k_op_lsl_16_r,
+	m68k_op_roxl_16_r,
+	m68k_op_rol_16_r,
+	m68k_op_asl_32_s,
+	m68k_op_lsl_32_s,
+	m68k_op_roxl_32_s,
+	m68k_op_rol_32_s,
+	m68k_op_asl_32_r,
+	m68k_op_lsl_32_r,
+	m68k_op_roxl_32_r,
+	m68k_op_rol_32_r,
+	m68k_op_cpdbcc_32,
+	m68k_op_cptrapcc_32,
+	m68k_op_rtm_32,
+	m68k_op_trap,
+	m68k_op_btst_8_r_pi7,
+	m68k_op_btst_8_r_pd7,
+	m68k_op_btst_8_r_aw,
+	m68k_op_btst_8_r_al,
+	m68k_op_btst_8_r_pcdi,
+	m68k_op_btst_8_r_pcix,
+	m68k_op_btst_8_r_i,
+	m68k_op_bchg_8_r_pi7,
+	m68k_op_bchg_8_r_pd7,
+	m68k_op_bchg_8_r_aw,
+	m68k_op_bchg_8_r_al,
+	m68k_op_bclr_8_r_pi7,
+	m68k_op_bclr_8_r_pd7,
+	m68k_op_bclr_8_r_aw,
+	m68k_op_bclr_8_r_al,
+	m68k_op_bset_8_r_pi7,
+	m68k_op_bset_8_r_pd7,
+	m68k_op_bset_8_r_aw,
+	m68k_op_bset_8_r_al,
+	m68k_op_move_8_d_pi7,
+	m68k_op_move_8_d_pd7,
+	m68k_op_move_8_d_aw,
+	m68k_op_move_8_d_al,
+	m68k_op_move_8_d_pcdi,
+	m68k_op_move_8_d_pcix,
+	m68k_op_move_8_d_i,
+	m68k_op_move_8_ai_pi7,
+	m68k_op_move_8_ai_pd7,
+	m68k_op_move_8_ai_aw,
+	m68k_op_move_8_ai_al,
+	m68k_op_move_8_ai_pcdi,
+	m68k_op_move_8_ai_pcix,
+	m68k_op_move_8_ai_i,
+	m68k_op_move_8_pi_pi7,
+	m68k_op_move_8_pi_pd7,
+	m68k_op_move_8_pi_aw,
+	m68k_op_move_8_pi_al,
+	m68k_op_move_8_pi_pcdi,
+	m68k_op_move_8_pi_pcix,
+	m68k_op_move_8_pi_i,
+	m68k_op_move_8_pd_pi7,
+	m68k_op_move_8_pd_pd7,
+	m68k_op_move_8_pd_aw,
+	m68k_op_move_8_pd_al,
+	m68k_op_move_8_pd_pcdi,
+	m68k_op_move_8_pd_pcix,
+	m68k_op_move_8_pd_i,
+	m68k_op_move_8_di_pi7,
+	m68k_op_move_8_di_pd7,
+	m68k_op_move_8_di_aw,
+	m68k_op_move_8_di_al,
+	m68k_op_move_8_di_pcdi,
+	m68k_op_move_8_di_pcix,
+	m68k_op_move_8_di_i,
+	m68k_op_move_8_ix_pi7,
+	m68k_op_move_8_ix_pd7,
+	m68k_op_move_8_ix_aw,
+	m68k_op_move_8_ix_al,
+	m68k_op_move_8_ix_pcdi,
+	m68k_op_move_8_ix_pcix,
+	m68k_op_move_8_ix_i,
+	m68k_op_move_32_d_aw,
+	m68k_op_move_32_d_al,
+	m68k_op_move_32_d_pcdi,
+	m68k_op_move_32_d_pcix,
+	m68k_op_move_32_d_i,
+	m68k_op_movea_32_aw,
+	m68k_op_movea_32_al,
+	m68k_op_movea_32_pcdi,
+	m68k_op_movea_32_pcix,
+	m68k_op_movea_32_i,
+	m68k_op_move_32_ai_aw,
+	m68k_op_move_32_ai_al,
+	m68k_op_move_32_ai_pcdi,
+	m68k_op_move_32_ai_pcix,
+	m68k_op_move_32_ai_i,
+	m68k_op_move_32_pi_aw,
+	m68k_op_move_32_pi_al,
+	m68k_op_move_32_pi_pcdi,
+	m68k_op_move_32_pi_pcix,
+	m68k_op_move_32_pi_i,
+	m68k_op_move_32_pd_aw,
+	m68k_op_move_32_pd_al,
+	m68k_op_move_32_pd_pcdi,
+	m68k_op_move_32_pd_pcix,
+	m68k_op_move_32_pd_i,
+	m68k_op_move_32_di_aw,
+	m68k_op_move_32_di_al,
+	m68k_op_move_32_di_pcdi,
+	m68k_op_move_32_di_pcix,
+	m68k_op_move_32_di_i,
+	m68k_op_move_32_ix_aw,
+	m68k_op_move_32_ix_al,
+	m68k_op_move_32_ix_pcdi,
+	m68k_op_move_32_ix_pcix,
+	m68k_op_move_32_ix_i,
+	m68k_op_move_16_d_aw,
+	m68k_op_move_16_d_al,
+	m68k_op_move_16_d_pcdi,
+	m68k_op_move_16_d_pcix,
+	m68k_op_move_16_d_i,
+	m68k_op_movea_16_aw,
+	m68k_op_movea_16_al,
+	m68k_op_movea_16_pcdi,
+	m68k_op_movea_16_pcix,
+	m68k_op_movea_16_i,
+	m68k_op_move_16_ai_aw,
+	m68k_op_move_16_ai_al,
+	m68k_op_move_16_ai_pcdi,
+	m68k_op_move_16_ai_pcix,
+	m68k_op_move_16_ai_i,
+	m68k_op_move_16_pi_aw,
+	m68k_op_move_16_pi_al,
+	m68k_op_move_16_pi_pcdi,
+	m68k_op_move_16_pi_pcix,
+	m68k_op_move_16_pi_i,
+	m68k_op_move_16_pd_aw,
+	m68k_op_move_16_pd_al,
+	m68k_op_move_16_pd_pcdi,
+	m68k_op_move_16_pd_pcix,
+	m68k_op_move_16_pd_i,
+	m68k_op_move_16_di_aw,
+	m68k_op_move_16_di_al,
+	m68k_op_move_16_di_pcdi,
+	m68k_op_move_16_di_pcix,
+	m68k_op_move_16_di_i,
+	m68k_op_move_16_ix_aw,
+	m68k_op_move_16_ix_al,
+	m68k_op_move_16_ix_pcdi,
+	m68k_op_move_16_ix_pcix,
+	m68k_op_move_16_ix_i,
+	m68k_op_chk_32_aw,
+	m68k_op_chk_32_al,
+	m68k_op_chk_32_pcdi,
+	m68k_op_chk_32_pcix,
+	m68k_op_chk_32_i,
+	m68k_op_chk_16_aw,
+	m68k_op_chk_16_al,
+	m68k_op_chk_16_pcdi,
+	m68k_op_chk_16_pcix,
+	m68k_op_chk_16_i,
+	m68k_op_lea_32_aw,
+	m68k_op_lea_32_al,
+	m68k_op_lea_32_pcdi,
+	m68k_op_lea_32_pcix,
+	m68k_op_addq_8_pi7,
+	m68k_op_addq_8_pd7,
+	m68k_op_addq_8_aw,
+	m68k_op_addq_8_al,
+	m68k_op_addq_16_aw,
+	m68k_op_addq_16_al,
+	m68k_op_addq_32_aw,
+	m68k_op_addq_32_al,
+	m68k_op_subq_8_pi7,
+	m68k_op_subq_8_pd7,
+	m68k_op_subq_8_aw,
+	m68k_op_subq_8_al,
+	m68k_op_subq_16_aw,
+	m68k_op_subq_16_al,
+	m68k_op_subq_32_aw,
+	m68k_op_subq_32_al,
+	m68k_op_or_8_er_pi7,
+	m68k_op_or_8_er_pd7,
+	m68k_op_or_8_er_aw,
+	m68k_op_or_8_er_al,
+	m68k_op_or_8_er_pcdi,
+	m68k_op_or_8_er_pcix,
+	m68k_op_or_8_er_i,
+	m68k_op_or_16_er_aw,
+	m68k_op_or_16_er_al,
+	m68k_op_or_16_er_pcdi,
+	m68k_op_or_16_er_pcix,
+	m68k_op_or_16_er_i,
+	m68k_op_or_32_er_aw,
+	m68k_op_or_32_er_al,
+	m68k_op_or_32_er_pcdi,
+	m68k_op_or_32_er_pcix,
+	m68k_op_or_32_er_i,
+	m68k_op_divu_16_aw,
+	m68k_op_divu_16_al,
+	m68k_op_divu_16_pcdi,
+	m68k_op_divu_16_pcix,
+	m68k_op_divu_16_i,
+	m68k_op_sbcd_8_mm_ay7,
+	m68k_op_or_8_re_pi7,
+	m68k_op_or_8_re_pd7,
+	m68k_op_or_8_re_aw,
+	m68k_op_or_8_re_al,
+	m68k_op_pack_16_mm_ay7,
+	m68k_op_or_16_re_aw,
+	m68k_op_or_16_re_al,
+	m68k_op_unpk_16_mm_ay7,
+	m68k_op_or_32_re_aw,
+	m68k_op_or_32_re_al,
+	m68k_op_divs_16_aw,
+	m68k_op_divs_16_al,
+	m68k_op_divs_16_pcdi,
+	m68k_op_divs_16_pcix,
+	m68k_op_divs_16_i,
+	m68k_op_sub_8_er_pi7,
+	m68k_op_sub_8_er_pd7,
+	m68k_op_sub_8_er_aw,
+	m68k_op_sub_8_er_al,
+	m68k_op_sub_8_er_pcdi,
+	m68k_op_sub_8_er_pcix,
+	m68k_op_sub_8_er_i,
+	m68k_op_sub_16_er_aw,
+	m68k_op_sub_16_er_al,
+	m68k_op_sub_16_er_pcdi,
+	m68k_op_sub_16_er_pcix,
+	m68k_op_sub_16_er_i,
+	m68k_op_sub_32_er_aw,
+	m68k_op_sub_32_er_al,
+	m68k_op_sub_32_er_pcdi,
+	m68k_op_sub_32_er_pcix,
+	m68k_op_sub_32_er_i,
+	m68k_op_suba_16_aw,
+	m68k_op_suba_16_al,
+	m68k_op_suba_16_pcdi,
+	m68k_op_suba_16_pcix,
+	m68k_op_suba_16_i,
+	m68k_op_subx_8_mm_ay7,
+	m68k_op_sub_8_re_pi7,
+	m68k_op_sub_8_re_pd7,
+	m68k_op_sub_8_re_aw,
+	m68k_op_sub_8_re_al,
+	m68k_op_sub_16_re_aw,
+	m68k_op_sub_16_re_al,
+	m68k_op_sub_32_re_aw,
+	m68k_op_sub_32_re_al,
+	m68k_op_suba_32_aw,
+	m68k_op_suba_32_al,
+	m68k_op_suba_32_pcdi,
+	m68k_op_suba_32_pcix,
+	m68k_op_suba_32_i,
+	m68k_op_cmp_8_pi7,
+	m68k_op_cmp_8_pd7,
+	m68k_op_cmp_8_aw,
+	m68k_op_cmp_8_al,
+	m68k_op_cmp_8_pcdi,
+	m68k_op_cmp_8_pcix,
+	m68k_op_cmp_8_i,
+	m68k_op_cmp_16_aw,
+	m68k_op_cmp_16_al,
+	m68k_op_cmp_16_pcdi,
+	m68k_op_cmp_16_pcix,
+	m68k_op_cmp_16_i,
+	m68k_op_cmp_32_aw,
+	m68k_op_cmp_32_al,
+	m68k_op_cmp_32_pcdi,
+	m68k_op_cmp_32_pcix,
+	m68k_op_cmp_32_i,
+	m68k_op_cmpa_16_aw,
+	m68k_op_cmpa_16_al,
+	m68k_op_cmpa_16_pcdi,
+	m68k_op_cmpa_16_pcix,
+	m68k_op_cmpa_16_i,
+	m68k_op_cmpm_8_ay7,
+	m68k_op_eor_8_pi7,
+	m68k_op_eor_8_pd7,
+	m68k_op_eor_8_aw,
+	m68k_op_eor_8_al,
+	m68k_op_eor_16_aw,
+	m68k_op_eor_16_al,
+	m68k_op_eor_32_aw,
+	m68k_op_eor_32_al,
+	m68k_op_cmpa_32_aw,
+	m68k_op_cmpa_32_al,
+	m68k_op_cmpa_32_pcdi,
+	m68k_op_cmpa_32_pcix,
+	m68k_op_cmpa_32_i,
+	m68k_op_and_8_er_pi7,
+	m68k_op_and_8_er_pd7,
+	m68k_op_and_8_er_aw,
+	m68k_op_and_8_er_al,
+	m68k_op_and_8_er_pcdi,
+	m68k_op_and_8_er_pcix,
+	m68k_op_and_8_er_i,
+	m68k_op_and_16_er_aw,
+	m68k_op_and_16_er_al,
+	m68k_op_and_16_er_pcdi,
+	m68k_op_and_16_er_pcix,
+	m68k_op_and_16_er_i,
+	m68k_op_and_32_er_aw,
+	m68k_op_and_32_er_al,
+	m68k_op_and_32_er_pcdi,
+	m68k_op_and_32_er_pcix,
+	m68k_op_and_32_er_i,
+	m68k_op_mulu_16_aw,
+	m68k_op_mulu_16_al,
+	m68k_op_mulu_16_pcdi,
+	m68k_op_mulu_16_pcix,
+	m68k_op_mulu_16_i,
+	m68k_op_abcd_8_mm_ay7,
+	m68k_op_and_8_re_pi7,
+	m68k_op_and_8_re_pd7,
+	m68k_op_and_8_re_aw,
+	m68k_op_and_8_re_al,
+	m68k_op_and_16_re_aw,
+	m68k_op_and_16_re_al,
+	m68k_op_and_32_re_aw,
+	m68k_op_and_32_re_al,
+	m68k_op_muls_16_aw,
+	m68k_op_muls_16_al,
+	m68k_op_muls_16_pcdi,
+	m68k_op_muls_16_pcix,
+	m68k_op_muls_16_i,
+	m68k_op_add_8_er_pi7,
+	m68k_op_add_8_er_pd7,
+	m68k_op_add_8_er_aw,
+	m68k_op_add_8_er_al,
+	m68k_op_add_8_er_pcdi,
+	m68k_op_add_8_er_pcix,
+	m68k_op_add_8_er_i,
+	m68k_op_add_16_er_aw,
+	m68k_op_add_16_er_al,
+	m68k_op_add_16_er_pcdi,
+	m68k_op_add_16_er_pcix,
+	m68k_op_add_16_er_i,
+	m68k_op_add_32_er_aw,
+	m68k_op_add_32_er_al,
+	m68k_op_add_32_er_pcdi,
+	m68k_op_add_32_er_pcix,
+	m68k_op_add_32_er_i,
+	m68k_op_adda_16_aw,
+	m68k_op_adda_16_al,
+	m68k_op_adda_16_pcdi,
+	m68k_op_adda_16_pcix,
+	m68k_op_adda_16_i,
+	m68k_op_addx_8_mm_ay7,
+	m68k_op_add_8_re_pi7,
+	m68k_op_add_8_re_pd7,
+	m68k_op_add_8_re_aw,
+	m68k_op_add_8_re_al,
+	m68k_op_add_16_re_aw,
+	m68k_op_add_16_re_al,
+	m68k_op_add_32_re_aw,
+	m68k_op_add_32_re_al,
+	m68k_op_adda_32_aw,
+	m68k_op_adda_32_al,
+	m68k_op_adda_32_pcdi,
+	m68k_op_adda_32_pcix,
+	m68k_op_adda_32_i,
+	m68k_op_ori_8_d,
+	m68k_op_ori_8_ai,
+	m68k_op_ori_8_pi,
+	m68k_op_ori_8_pd,
+	m68k_op_ori_8_di,
+	m68k_op_ori_8_ix,
+	m68k_op_ori_16_d,
+	m68k_op_ori_16_ai,
+	m68k_op_ori_16_pi,
+	m68k_op_ori_16_pd,
+	m68k_op_ori_16_di,
+	m68k_op_ori_16_ix,
+	m68k_op_ori_32_d,
+	m68k_op_ori_32_ai,
+	m68k_op_ori_32_pi,
+	m68k_op_ori_32_pd,
+	m68k_op_ori_32_di,
+	m68k_op_ori_32_ix,
+	m68k_op_chk2cmp2_8_ai,
+	m68k_op_chk2cmp2_8_di,
+	m68k_op_chk2cmp2_8_ix,
+	m68k_op_andi_8_d,
+	m68k_op_andi_8_ai,
+	m68k_op_andi_8_pi,
+	m68k_op_andi_8_pd,
+	m68k_op_andi_8_di,
+	m68k_op_andi_8_ix,
+	m68k_op_andi_16_d,
+	m68k_op_andi_16_ai,
+	m68k_op_andi_16_pi,
+	m68k_op_andi_16_pd,
+	m68k_op_andi_16_di,
+	m68k_op_andi_16_ix,
+	m68k_op_andi_32_d,
+	m68k_op_andi_32_ai,
+	m68k_op_andi_32_pi,
+	m68k_op_andi_32_pd,
+	m68k_op_andi_32_di,
+	m68k_op_andi_32_ix,
+	m68k_op_chk2cmp2_16_ai,
+	m68k_op_chk2cmp2_16_di,
+	m68k_op_chk2cmp2_16_ix,
+	m68k_op_subi_8_d,
+	m68k_op_subi_8_ai,
+	m68k_op_subi_8_pi,
+	m68k_op_subi_8_pd,
+	m68k_op_subi_8_di,
+	m68k_op_subi_8_ix,
+	m68k_op_subi_16_d,
+	m68k_op_subi_16_ai,
+	m68k_op_subi_16_pi,
+	m68k_op_subi_16_pd,
+	m68k_op_subi_16_di,
+	m68k_op_subi_16_ix,
+	m68k_op_subi_32_d,
+	m68k_op_subi_32_ai,
+	m68k_op_subi_32_pi,
+	m68k_op_subi_32_pd,
+	m68k_op_subi_32_di,
+	m68k_op_subi_32_ix,
+	m68k_op_chk2cmp2_32_ai,
+	m68k_op_chk2cmp2_32_di,
+	m68k_op_chk2cmp2_32_ix,
+	m68k_op_addi_8_d,
+	m68k_op_addi_8_ai,
+	m68k_op_addi_8_pi,
+	m68k_op_addi_8_pd,
+	m68k_op_addi_8_di,
+	m68k_op_addi_8_ix,
+	m68k_op_addi_16_d,
+	m68k_op_addi_16_ai,
+	m68k_op_addi_16_pi,
+	m68k_op_addi_16_pd,
+	m68k_op_addi_16_di,
+	m68k_op_addi_16_ix,
+	m68k_op_addi_32_d,
+	m68k_op_addi_32_ai,
+	m68k_op_addi_32_pi,
+	m68k_op_addi_32_pd,
+	m68k_op_addi_32_di,
+	m68k_op_addi_32_ix,
+	m68k_op_callm_32_ai,
+	m68k_op_callm_32_di,
+	m68k_op_callm_32_ix,
+	m68k_op_btst_32_s_d,
+	m68k_op_btst_8_s_ai,
+	m68k_op_btst_8_s_pi,
+	m68k_op_btst_8_s_pd,
+	m68k_op_btst_8_s_di,
+	m68k_op_btst_8_s_ix,
+	m68k_op_bchg_32_s_d,
+	m68k_op_bchg_8_s_ai,
+	m68k_op_bchg_8_s_pi,
+	m68k_op_bchg_8_s_pd,
+	m68k_op_bchg_8_s_di,
+	m68k_op_bchg_8_s_ix,
+	m68k_op_bclr_32_s_d,
+	m68k_op_bclr_8_s_ai,
+	m68k_op_bclr_8_s_pi,
+	m68k_op_bclr_8_s_pd,
+	m68k_op_bclr_8_s_di,
+	m68k_op_bclr_8_s_ix,
+	m68k_op_bset_32_s_d,
+	m68k_op_bset_8_s_ai,
+	m68k_op_bset_8_s_pi,
+	m68k_op_bset_8_s_pd,
+	m68k_op_bset_8_s_di,
+	m68k_op_bset_8_s_ix,
+	m68k_op_eori_8_d,
+	m68k_op_eori_8_ai,
+	m68k_op_eori_8_pi,
+	m68k_op_eori_8_pd,
+	m68k_op_eori_8_di,
+	m68k_op_eori_8_ix,
+	m68k_op_eori_16_d,
+	m68k_op_eori_16_ai,
+	m68k_op_eori_16_pi,
+	m68k_op_eori_16_pd,
+	m68k_op_eori_16_di,
+	m68k_op_eori_16_ix,
+	m68k_op_eori_32_d,
+	m68k_op_eori_32_ai,
+	m68k_op_eori_32_pi,
+	m68k_op_eori_32_pd,
+	m68k_op_eori_32_di,
+	m68k_op_eori_32_ix,
+	m68k_op_cas_8_ai,
+	m68k_op_cas_8_pi,
+	m68k_op_cas_8_pd,
+	m68k_op_cas_8_di,
+	m68k_op_cas_8_ix,
+	m68k_op_cmpi_8_d,
+	m68k_op_cmpi_8_ai,
+	m68k_op_cmpi_8_pi,
+	m68k_op_cmpi_8_pd,
+	m68k_op_cmpi_8_di,
+	m68k_op_cmpi_8_ix,
+	m68k_op_cmpi_16_d,
+	m68k_op_cmpi_16_ai,
+	m68k_op_cmpi_16_pi,
+	m68k_op_cmpi_16_pd,
+	m68k_op_cmpi_16_di,
+	m68k_op_cmpi_16_ix,
+	m68k_op_cmpi_32_d,
+	m68k_op_cmpi_32_ai,
+	m68k_op_cmpi_32_pi,
+	m68k_op_cmpi_32_pd,
+	m68k_op_cmpi_32_di,
+	m68k_op_cmpi_32_ix,
+	m68k_op_cas_16_ai,
+	m68k_op_cas_16_pi,
+	m68k_op_cas_16_pd,
+	m68k_op_cas_16_di,
+	m68k_op_cas_16_ix,
+	m68k_op_moves_8_ai,
+	m68k_op_moves_8_pi,
+	m68k_op_moves_8_pd,
+	m68k_op_moves_8_di,
+	m68k_op_moves_8_ix,
+	m68k_op_moves_16_ai,
+	m68k_op_moves_16_pi,
+	m68k_op_moves_16_pd,
+	m68k_op_moves_16_di,
+	m68k_op_moves_16_ix,
+	m68k_op_moves_32_ai,
+	m68k_op_moves_32_pi,
+	m68k_op_moves_32_pd,
+	m68k_op_moves_32_di,
+	m68k_op_moves_32_ix,
+	m68k_op_cas_32_ai,
+	m68k_op_cas_32_pi,
+	m68k_op_cas_32_pd,
+	m68k_op_cas_32_di,
+	m68k_op_cas_32_ix,
+	m68k_op_move_8_aw_d,
+	m68k_op_move_8_aw_ai,
+	m68k_op_move_8_aw_pi,
+	m68k_op_move_8_aw_pd,
+	m68k_op_move_8_aw_di,
+	m68k_op_move_8_aw_ix,
+	m68k_op_move_8_al_d,
+	m68k_op_move_8_al_ai,
+	m68k_op_move_8_al_pi,
+	m68k_op_move_8_al_pd,
+	m68k_op_move_8_al_di,
+	m68k_op_move_8_al_ix,
+	m68k_op_move_8_pi7_d,
+	m68k_op_move_8_pi7_ai,
+	m68k_op_move_8_pi7_pi,
+	m68k_op_move_8_pi7_pd,
+	m68k_op_move_8_pi7_di,
+	m68k_op_move_8_pi7_ix,
+	m68k_op_move_8_pd7_d,
+	m68k_op_move_8_pd7_ai,
+	m68k_op_move_8_pd7_pi,
+	m68k_op_move_8_pd7_pd,
+	m68k_op_move_8_pd7_di,
+	m68k_op_move_8_pd7_ix,
+	m68k_op_move_32_aw_d,
+	m68k_op_move_32_aw_a,
+	m68k_op_move_32_aw_ai,
+	m68k_op_move_32_aw_pi,
+	m68k_op_move_32_aw_pd,
+	m68k_op_move_32_aw_di,
+	m68k_op_move_32_aw_ix,
+	m68k_op_move_32_al_d,
+	m68k_op_move_32_al_a,
+	m68k_op_move_32_al_ai,
+	m68k_op_move_32_al_pi,
+	m68k_op_move_32_al_pd,
+	m68k_op_move_32_al_di,
+	m68k_op_move_32_al_ix,
+	m68k_op_move_16_aw_d,
+	m68k_op_move_16_aw_a,
+	m68k_op_move_16_aw_ai,
+	m68k_op_move_16_aw_pi,
+	m68k_op_move_16_aw_pd,
+	m68k_op_move_16_aw_di,
+	m68k_op_move_16_aw_ix,
+	m68k_op_move_16_al_d,
+	m68k_op_move_16_al_a,
+	m68k_op_move_16_al_ai,
+	m68k_op_move_16_al_pi,
+	m68k_op_move_16_al_pd,
+	m68k_op_move_16_al_di,
+	m68k_op_move_16_al_ix,
+	m68k_op_negx_8_d,
+	m68k_op_negx_8_ai,
+	m68k_op_negx_8_pi,
+	m68k_op_negx_8_pd,
+	m68k_op_negx_8_di,
+	m68k_op_negx_8_ix,
+	m68k_op_negx_16_d,
+	m68k_op_negx_16_ai,
+	m68k_op_negx_16_pi,
+	m68k_op_negx_16_pd,
+	m68k_op_negx_16_di,
+	m68k_op_negx_16_ix,
+	m68k_op_negx_32_d,
+	m68k_op_negx_32_ai,
+	m68k_op_negx_32_pi,
+	m68k_op_negx_32_pd,
+	m68k_op_negx_32_di,
+	m68k_op_negx_32_ix,
+	m68k_op_move_16_frs_d,
+	m68k_op_move_16_frs_ai,
+	m68k_op_move_16_frs_pi,
+	m68k_op_move_16_frs_pd,
+	m68k_op_move_16_frs_di,
+	m68k_op_move_16_frs_ix,
+	m68k_op_clr_8_d,
+	m68k_op_clr_8_ai,
+	m68k_op_clr_8_pi,
+	m68k_op_clr_8_pd,
+	m68k_op_clr_8_di,
+	m68k_op_clr_8_ix,
+	m68k_op_clr_16_d,
+	m68k_op_clr_16_ai,
+	m68k_op_clr_16_pi,
+	m68k_op_clr_16_pd,
+	m68k_op_clr_16_di,
+	m68k_op_clr_16_ix,
+	m68k_op_clr_32_d,
+	m68k_op_clr_32_ai,
+	m68k_op_clr_32_pi,
+	m68k_op_clr_32_pd,
+	m68k_op_clr_32_di,
+	m68k_op_clr_32_ix,
+	m68k_op_move_16_frc_d,
+	m68k_op_move_16_frc_ai,
+	m68k_op_move_16_frc_pi,
+	m68k_op_move_16_frc_pd,
+	m68k_op_move_16_frc_di,
+	m68k_op_move_16_frc_ix,
+	m68k_op_neg_8_d,
+	m68k_op_neg_8_ai,
+	m68k_op_neg_8_pi,
+	m68k_op_neg_8_pd,
+	m68k_op_neg_8_di,
+	m68k_op_neg_8_ix,
+	m68k_op_neg_16_d,
+	m68k_op_neg_16_ai,
+	m68k_op_neg_16_pi,
+	m68k_op_neg_16_pd,
+	m68k_op_neg_16_di,
+	m68k_op_neg_16_ix,
+	m68k_op_neg_32_d,
+	m68k_op_neg_32_ai,
+	m68k_op_neg_32_pi,
+	m68k_op_neg_32_pd,
+	m68k_op_neg_32_di,
+	m68k_op_neg_32_ix,
+	m68k_op_move_16_toc_d,
+	m68k_op_move_16_toc_ai,
+	m68k_op_move_16_toc_pi,
+	m68k_op_move_16_toc_pd,
+	m68k_op_move_16_toc_di,
+	m68k_op_move_16_toc_ix,
+	m68k_op_not_8_d,
+	m68k_op_not_8_ai,
+	m68k_op_not_8_pi,
+	m68k_op_not_8_pd,
+	m68k_op_not_8_di,
+	m68k_op_not_8_ix,
+	m68k_op_not_16_d,
+	m68k_op_not_16_ai,
+	m68k_op_not_16_pi,
+	m68k_op_not_16_pd,
+	m68k_op_not_16_di,
+	m68k_op_not_16_ix,
+	m68k_op_not_32_d,
+	m68k_op_not_32_ai,
+	m68k_op_not_32_pi,
+	m68k_op_not_32_pd,
+	m68k_op_not_32_di,
+	m68k_op_not_32_ix,
+	m68k_op_move_16_tos_d,
+	m68k_op_move_16_tos_ai,
+	m68k_op_move_16_tos_pi,
+	m68k_op_move_16_tos_pd,
+	m68k_op_move_16_tos_di,
+	m68k_op_move_16_tos_ix,
+	m68k_op_nbcd_8_d,
+	m68k_op_link_32,
+	m68k_op_nbcd_8_ai,
+	m68k_op_nbcd_8_pi,
+	m68k_op_nbcd_8_pd,
+	m68k_op_nbcd_8_di,
+	m68k_op_nbcd_8_ix,
+	m68k_op_swap_32,
+	m68k_op_bkpt,
+	m68k_op_pea_32_ai,
+	m68k_op_pea_32_di,
+	m68k_op_pea_32_ix,
+	m68k_op_ext_16,
+	m68k_op_movem_16_re_ai,
+	m68k_op_movem_16_re_pd,
+	m68k_op_movem_16_re_di,
+	m68k_op_movem_16_re_ix,
+	m68k_op_ext_32,
+	m68k_op_movem_32_re_ai,
+	m68k_op_movem_32_re_pd,
+	m68k_op_movem_32_re_di,
+	m68k_op_movem_32_re_ix,
+	m68k_op_extb_32,
+	m68k_op_tst_8_d,
+	m68k_op_tst_8_ai,
+	m68k_op_tst_8_pi,
+	m68k_op_tst_8_pd,
+	m68k_op_tst_8_di,
+	m68k_op_tst_8_ix,
+	m68k_op_tst_16_d,
+	m68k_op_tst_16_a,
+	m68k_op_tst_16_ai,
+	m68k_op_tst_16_pi,
+	m68k_op_tst_16_pd,
+	m68k_op_tst_16_di,
+	m68k_op_tst_16_ix,
+	m68k_op_tst_32_d,
+	m68k_op_tst_32_a,
+	m68k_op_tst_32_ai,
+	m68k_op_tst_32_pi,
+	m68k_op_tst_32_pd,
+	m68k_op_tst_32_di,
+	m68k_op_tst_32_ix,
+	m68k_op_tas_8_d,
+	m68k_op_tas_8_ai,
+	m68k_op_tas_8_pi,
+	m68k_op_tas_8_pd,
+	m68k_op_tas_8_di,
+	m68k_op_tas_8_ix,
+	m68k_op_mull_32_d,
+	m68k_op_mull_32_ai,
+	m68k_op_mull_32_pi,
+	m68k_op_mull_32_pd,
+	m68k_op_mull_32_di,
+	m68k_op_mull_32_ix,
+	m68k_op_divl_32_d,
+	m68k_op_divl_32_ai,
+	m68k_op_divl_32_pi,
+	m68k_op_divl_32_pd,
+	m68k_op_divl_32_di,
+	m68k_op_divl_32_ix,
+	m68k_op_movem_16_er_ai,
+	m68k_op_movem_16_er_pi,
+	m68k_op_movem_16_er_di,
+	m68k_op_movem_16_er_ix,
+	m68k_op_movem_32_er_ai,
+	m68k_op_movem_32_er_pi,
+	m68k_op_movem_32_er_di,
+	m68k_op_movem_32_er_ix,
+	m68k_op_link_16,
+	m68k_op_unlk_32,
+	m68k_op_move_32_tou,
+	m68k_op_move_32_fru,
+	m68k_op_jsr_32_ai,
+	m68k_op_jsr_32_di,
+	m68k_op_jsr_32_ix,
+	m68k_op_jmp_32_ai,
+	m68k_op_jmp_32_di,
+	m68k_op_jmp_32_ix,
+	m68k_op_st_8_d,
+	m68k_op_dbt_16,
+	m68k_op_st_8_ai,
+	m68k_op_st_8_pi,
+	m68k_op_st_8_pd,
+	m68k_op_st_8_di,
+	m68k_op_st_8_ix,
+	m68k_op_sf_8_d,
+	m68k_op_dbf_16,
+	m68k_op_sf_8_ai,
+	m68k_op_sf_8_pi,
+	m68k_op_sf_8_pd,
+	m68k_op_sf_8_di,
+	m68k_op_sf_8_ix,
+	m68k_op_shi_8_d,
+	m68k_op_dbhi_16,
+	m68k_op_shi_8_ai,
+	m68k_op_shi_8_pi,
+	m68k_op_shi_8_pd,
+	m68k_op_shi_8_di,
+	m68k_op_shi_8_ix,
+	m68k_op_sls_8_d,
+	m68k_op_dbls_16,
+	m68k_op_sls_8_ai,
+	m68k_op_sls_8_pi,
+	m68k_op_sls_8_pd,
+	m68k_op_sls_8_di,
+	m68k_op_sls_8_ix,
+	m68k_op_scc_8_d,
+	m68k_op_dbcc_16,
+	m68k_op_scc_8_ai,
+	m68k_op_scc_8_pi,
+	m68k_op_scc_8_pd,
+	m68k_op_scc_8_di,
+	m68k_op_scc_8_ix,
+	m68k_op_scs_8_d,
+	m68k_op_dbcs_16,
+	m68k_op_scs_8_ai,
+	m68k_op_scs_8_pi,
+	m68k_op_scs_8_pd,
+	m68k_op_scs_8_di,
+	m68k_op_scs_8_ix,
+	m68k_op_sne_8_d,
+	m68k_op_dbne_16,
+	m68k_op_sne_8_ai,
+	m68k_op_sne_8_pi,
+	m68k_op_sne_8_pd,
+	m68k_op_sne_8_di,
+	m68k_op_sne_8_ix,
+	m68k_op_seq_8_d,
+	m68k_op_dbeq_16,
+	m68k_op_seq_8_ai,
+	m68k_op_seq_8_pi,
+	m68k_op_seq_8_pd,
+	m68k_op_seq_8_di,
+	m68k_op_seq_8_ix,
+	m68k_op_svc_8_d,
+	m68k_op_dbvc_16,
+	m68k_op_svc_8_ai,
+	m68k_op_svc_8_pi,
+	m68k_op_svc_8_pd,
+	m68k_op_svc_8_di,
+	m68k_op_svc_8_ix,
+	m68k_op_svs_8_d,
+	m68k_op_dbvs_16,
+	m68k_op_svs_8_ai,
+	m68k_op_svs_8_pi,
+	m68k_op_svs_8_pd,
+	m68k_op_svs_8_di,
+	m68k_op_svs_8_ix,
+	m68k_op_spl_8_d,
+	m68k_op_dbpl_16,
+	m68k_op_spl_8_ai,
+	m68k_op_spl_8_pi,
+	m68k_op_spl_8_pd,
+	m68k_op_spl_8_di,
+	m68k_op_spl_8_ix,
+	m68k_op_smi_8_d,
+	m68k_op_dbmi_16,
+	m68k_op_smi_8_ai,
+	m68k_op_smi_8_pi,
+	m68k_op_smi_8_pd,
+	m68k_op_smi_8_di,
+	m68k_op_smi_8_ix,
+	m68k_op_sge_8_d,
+	m68k_op_dbge_16,
+	m68k_op_sge_8_ai,
+	m68k_op_sge_8_pi,
+	m68k_op_sge_8_pd,
+	m68k_op_sge_8_di,
+	m68k_op_sge_8_ix,
+	m68k_op_slt_8_d,
+	m68k_op_dblt_16,
+	m68k_op_slt_8_ai,
+	m68k_op_slt_8_pi,
+	m68k_op_slt_8_pd,
+	m68k_op_slt_8_di,
+	m68k_op_slt_8_ix,
+	m68k_op_sgt_8_d,
+	m68k_op_dbgt_16,
+	m68k_op_sgt_8_ai,
+	m68k_op_sgt_8_pi,
+	m68k_op_sgt_8_pd,
+	m68k_op_sgt_8_di,
+	m68k_op_sgt_8_ix,
+	m68k_op_sle_8_d,
+	m68k_op_dble_16,
+	m68k_op_sle_8_ai,
+	m68k_op_sle_8_pi,
+	m68k_op_sle_8_pd,
+	m68k_op_sle_8_di,
+	m68k_op_sle_8_ix,
+	m68k_op_sbcd_8_mm_ax7,
+	m68k_op_pack_16_mm_ax7,
+	m68k_op_unpk_16_mm_ax7,
+	m68k_op_subx_8_mm_ax7,
+	m68k_op_cmpm_8_ax7,
+	m68k_op_abcd_8_mm_ax7,
+	m68k_op_addx_8_mm_ax7,
+	m68k_op_asr_16_ai,
+	m68k_op_asr_16_pi,
+	m68k_op_asr_16_pd,
+	m68k_op_asr_16_di,
+	m68k_op_asr_16_ix,
+	m68k_op_asl_16_ai,
+	m68k_op_asl_16_pi,
+	m68k_op_asl_16_pd,
+	m68k_op_asl_16_di,
+	m68k_op_asl_16_ix,
+	m68k_op_lsr_16_ai,
+	m68k_op_lsr_16_pi,
+	m68k_op_lsr_16_pd,
+	m68k_op_lsr_16_di,
+	m68k_op_lsr_16_ix,
+	m68k_op_lsl_16_ai,
+	m68k_op_lsl_16_pi,
+	m68k_op_lsl_16_pd,
+	m68k_op_lsl_16_di,
+	m68k_op_lsl_16_ix,
+	m68k_op_roxr_16_ai,
+	m68k_op_roxr_16_pi,
+	m68k_op_roxr_16_pd,
+	m68k_op_roxr_16_di,
+	m68k_op_roxr_16_ix,
+	m68k_op_roxl_16_ai,
+	m68k_op_roxl_16_pi,
+	m68k_op_roxl_16_pd,
+	m68k_op_roxl_16_di,
+	m68k_op_roxl_16_ix,
+	m68k_op_ror_16_ai,
+	m68k_op_ror_16_pi,
+	m68k_op_ror_16_pd,
+	m68k_op_ror_16_di,
+	m68k_op_ror_16_ix,
+	m68k_op_rol_16_ai,
+	m68k_op_rol_16_pi,
+	m68k_op_rol_16_pd,
+	m68k_op_rol_16_di,
+	m68k_op_rol_16_ix,
+	m68k_op_bftst_32_d,
+	m68k_op_bftst_32_ai,
+	m68k_op_bftst_32_di,
+	m68k_op_bftst_32_ix,
+	m68k_op_bfextu_32_d,
+	m68k_op_bfextu_32_ai,
+	m68k_op_bfextu_32_di,
+	m68k_op_bfextu_32_ix,
+	m68k_op_bfchg_32_d,
+	m68k_op_bfchg_32_ai,
+	m68k_op_bfchg_32_di,
+	m68k_op_bfchg_32_ix,
+	m68k_op_bfexts_32_d,
+	m68k_op_bfexts_32_ai,
+	m68k_op_bfexts_32_di,
+	m68k_op_bfexts_32_ix,
+	m68k_op_bfclr_32_d,
+	m68k_op_bfclr_32_ai,
+	m68k_op_bfclr_32_di,
+	m68k_op_bfclr_32_ix,
+	m68k_op_bfffo_32_d,
+	m68k_op_bfffo_32_ai,
+	m68k_op_bfffo_32_di,
+	m68k_op_bfffo_32_ix,
+	m68k_op_bfset_32_d,
+	m68k_op_bfset_32_ai,
+	m68k_op_bfset_32_di,
+	m68k_op_bfset_32_ix,
+	m68k_op_bfins_32_d,
+	m68k_op_bfins_32_ai,
+	m68k_op_bfins_32_di,
+	m68k_op_bfins_32_ix,
+	m68k_op_ftrapcc_32,
+	m68k_op_pflushan_32,
+	m68k_op_pflusha_32,
+	m68k_op_move16_32,
+	m68k_op_ori_8_pi7,
+	m68k_op_ori_8_pd7,
+	m68k_op_ori_8_aw,
+	m68k_op_ori_8_al,
+	m68k_op_ori_16_toc,
+	m68k_op_ori_16_aw,
+	m68k_op_ori_16_al,
+	m68k_op_ori_16_tos,
+	m68k_op_ori_32_aw,
+	m68k_op_ori_32_al,
+	m68k_op_chk2cmp2_8_aw,
+	m68k_op_chk2cmp2_8_al,
+	m68k_op_chk2cmp2_8_pcdi,
+	m68k_op_chk2cmp2_8_pcix,
+	m68k_op_andi_8_pi7,
+	m68k_op_andi_8_pd7,
+	m68k_op_andi_8_aw,
+	m68k_op_andi_8_al,
+	m68k_op_andi_16_toc,
+	m68k_op_andi_16_aw,
+	m68k_op_andi_16_al,
+	m68k_op_andi_16_tos,
+	m68k_op_andi_32_aw,
+	m68k_op_andi_32_al,
+	m68k_op_chk2cmp2_16_aw,
+	m68k_op_chk2cmp2_16_al,
+	m68k_op_chk2cmp2_16_pcdi,
+	m68k_op_chk2cmp2_16_pcix,
+	m68k_op_subi_8_pi7,
+	m68k_op_subi_8_pd7,
+	m68k_op_subi_8_aw,
+	m68k_op_subi_8_al,
+	m68k_op_subi_16_aw,
+	m68k_op_subi_16_al,
+	m68k_op_subi_32_aw,
+	m68k_op_subi_32_al,
+	m68k_op_chk2cmp2_32_aw,
+	m68k_op_chk2cmp2_32_al,
+	m68k_op_chk2cmp2_32_pcdi,
+	m68k_op_chk2cmp2_32_pcix,
+	m68k_op_addi_8_pi7,
+	m68k_op_addi_8_pd7,
+	m68k_op_addi_8_aw,
+	m68k_op_addi_8_al,
+	m68k_op_addi_16_aw,
+	m68k_op_addi_16_al,
+	m68k_op_addi_32_aw,
+	m68k_op_addi_32_al,
+	m68k_op_callm_32_aw,
+	m68k_op_callm_32_al,
+	m68k_op_callm_32_pcdi,
+	m68k_op_callm_32_pcix,
+	m68k_op_btst_8_s_pi7,
+	m68k_op_btst_8_s_pd7,
+	m68k_op_btst_8_s_aw,
+	m68k_op_btst_8_s_al,
+	m68k_op_btst_8_s_pcdi,
+	m68k_op_btst_8_s_pcix,
+	m68k_op_bchg_8_s_pi7,
+	m68k_op_bchg_8_s_pd7,
+	m68k_op_bchg_8_s_aw,
+	m68k_op_bchg_8_s_al,
+	m68k_op_bclr_8_s_pi7,
+	m68k_op_bclr_8_s_pd7,
+	m68k_op_bclr_8_s_aw,
+	m68k_op_bclr_8_s_al,
+	m68k_op_bset_8_s_pi7,
+	m68k_op_bset_8_s_pd7,
+	m68k_op_bset_8_s_aw,
+	m68k_op_bset_8_s_al,
+	m68k_op_eori_8_pi7,
+	m68k_op_eori_8_pd7,
+	m68k_op_eori_8_aw,
+	m68k_op_eori_8_al,
+	m68k_op_eori_16_toc,
+	m68k_op_eori_16_aw,
+	m68k_op_eori_16_al,
+	m68k_op_eori_16_tos,
+	m68k_op_eori_32_aw,
+	m68k_op_eori_32_al,
+	m68k_op_cas_8_pi7,
+	m68k_op_cas_8_pd7,
+	m68k_op_cas_8_aw,
+	m68k_op_cas_8_al,
+	m68k_op_cmpi_8_pi7,
+	m68k_op_cmpi_8_pd7,
+	m68k_op_cmpi_8_aw,
+	m68k_op_cmpi_8_al,
+	m68k_op_cmpi_8_pcdi,
+	m68k_op_cmpi_8_pcix,
+	m68k_op_cmpi_16_aw,
+	m68k_op_cmpi_16_al,
+	m68k_op_cmpi_16_pcdi,
+	m68k_op_cmpi_16_pcix,
+	m68k_op_cmpi_32_aw,
+	m68k_op_cmpi_32_al,
+	m68k_op_cmpi_32_pcdi,
+	m68k_op_cmpi_32_pcix,
+	m68k_op_cas_16_aw,
+	m68k_op_cas_16_al,
+	m68k_op_cas2_16,
+	m68k_op_moves_8_pi7,
+	m68k_op_moves_8_pd7,
+	m68k_op_moves_8_aw,
+	m68k_op_moves_8_al,
+	m68k_op_moves_16_aw,
+	m68k_op_moves_16_al,
+	m68k_op_moves_32_aw,
+	m68k_op_moves_32_al,
+	m68k_op_cas_32_aw,
+	m68k_op_cas_32_al,
+	m68k_op_cas2_32,
+	m68k_op_move_8_aw_pi7,
+	m68k_op_move_8_aw_pd7,
+	m68k_op_move_8_aw_aw,
+	m68k_op_move_8_aw_al,
+	m68k_op_move_8_aw_pcdi,
+	m68k_op_move_8_aw_pcix,
+	m68k_op_move_8_aw_i,
+	m68k_op_move_8_al_pi7,
+	m68k_op_move_8_al_pd7,
+	m68k_op_move_8_al_aw,
+	m68k_op_move_8_al_al,
+	m68k_op_move_8_al_pcdi,
+	m68k_op_move_8_al_pcix,
+	m68k_op_move_8_al_i,
+	m68k_op_move_8_pi7_pi7,
+	m68k_op_move_8_pi7_pd7,
+	m68k_op_move_8_pi7_aw,
+	m68k_op_move_8_pi7_al,
+	m68k_op_move_8_pi7_pcdi,
+	m68k_op_move_8_pi7_pcix,
+	m68k_op_move_8_pi7_i,
+	m68k_op_move_8_pd7_pi7,
+	m68k_op_move_8_pd7_pd7,
+	m68k_op_move_8_pd7_aw,
+	m68k_op_move_8_pd7_al,
+	m68k_op_move_8_pd7_pcdi,
+	m68k_op_move_8_pd7_pcix,
+	m68k_op_move_8_pd7_i,
+	m68k_op_move_32_aw_aw,
+	m68k_op_move_32_aw_al,
+	m68k_op_move_32_aw_pcdi,
+	m68k_op_move_32_aw_pcix,
+	m68k_op_move_32_aw_i,
+	m68k_op_move_32_al_aw,
+	m68k_op_move_32_al_al,
+	m68k_op_move_32_al_pcdi,
+	m68k_op_move_32_al_pcix,
+	m68k_op_move_32_al_i,
+	m68k_op_move_16_aw_aw,
+	m68k_op_move_16_aw_al,
+	m68k_op_move_16_aw_pcdi,
+	m68k_op_move_16_aw_pcix,
+	m68k_op_move_16_aw_i,
+	m68k_op_move_16_al_aw,
+	m68k_op_move_16_al_al,
+	m68k_op_move_16_al_pcdi,
+	m68k_op_move_16_al_pcix,
+	m68k_op_move_16_al_i,
+	m68k_op_negx_8_pi7,
+	m68k_op_negx_8_pd7,
+	m68k_op_negx_8_aw,
+	m68k_op_negx_8_al,
+	m68k_op_negx_16_aw,
+	m68k_op_negx_16_al,
+	m68k_op_negx_32_aw,
+	m68k_op_negx_32_al,
+	m68k_op_move_16_frs_aw,
+	m68k_op_move_16_frs_al,
+	m68k_op_clr_8_pi7,
+	m68k_op_clr_8_pd7,
+	m68k_op_clr_8_aw,
+	m68k_op_clr_8_al,
+	m68k_op_clr_16_aw,
+	m68k_op_clr_16_al,
+	m68k_op_clr_32_aw,
+	m68k_op_clr_32_al,
+	m68k_op_move_16_frc_aw,
+	m68k_op_move_16_frc_al,
+	m68k_op_neg_8_pi7,
+	m68k_op_neg_8_pd7,
+	m68k_op_neg_8_aw,
+	m68k_op_neg_8_al,
+	m68k_op_neg_16_aw,
+	m68k_op_neg_16_al,
+	m68k_op_neg_32_aw,
+	m68k_op_neg_32_al,
+	m68k_op_move_16_toc_aw,
+	m68k_op_move_16_toc_al,
+	m68k_op_move_16_toc_pcdi,
+	m68k_op_move_16_toc_pcix,
+	m68k_op_move_16_toc_i,
+	m68k_op_not_8_pi7,
+	m68k_op_not_8_pd7,
+	m68k_op_not_8_aw,
+	m68k_op_not_8_al,
+	m68k_op_not_16_aw,
+	m68k_op_not_16_al,
+	m68k_op_not_32_aw,
+	m68k_op_not_32_al,
+	m68k_op_move_16_tos_aw,
+	m68k_op_move_16_tos_al,
+	m68k_op_move_16_tos_pcdi,
+	m68k_op_move_16_tos_pcix,
+	m68k_op_move_16_tos_i,
+	m68k_op_link_32_a7,
+	m68k_op_nbcd_8_pi7,
+	m68k_op_nbcd_8_pd7,
+	m68k_op_nbcd_8_aw,
+	m68k_op_nbcd_8_al,
+	m68k_op_pea_32_aw,
+	m68k_op_pea_32_al,
+	m68k_op_pea_32_pcdi,
+	m68k_op_pea_32_pcix,
+	m68k_op_movem_16_re_aw,
+	m68k_op_movem_16_re_al,
+	m68k_op_movem_32_re_aw,
+	m68k_op_movem_32_re_al,
+	m68k_op_tst_8_pi7,
+	m68k_op_tst_8_pd7,
+	m68k_op_tst_8_aw,
+	m68k_op_tst_8_al,
+	m68k_op_tst_8_pcdi,
+	m68k_op_tst_8_pcix,
+	m68k_op_tst_8_i,
+	m68k_op_tst_16_aw,
+	m68k_op_tst_16_al,
+	m68k_op_tst_16_pcdi,
+	m68k_op_tst_16_pcix,
+	m68k_op_tst_16_i,
+	m68k_op_tst_32_aw,
+	m68k_op_tst_32_al,
+	m68k_op_tst_32_pcdi,
+	m68k_op_tst_32_pcix,
+	m68k_op_tst_32_i,
+	m68k_op_tas_8_pi7,
+	m68k_op_tas_8_pd7,
+	m68k_op_tas_8_aw,
+	m68k_op_tas_8_al,
+	m68k_op_illegal,
+	m68k_op_mull_32_aw,
+	m68k_op_mull_32_al,
+	m68k_op_mull_32_pcdi,
+	m68k_op_mull_32_pcix,
+	m68k_op_mull_32_i,
+	m68k_op_divl_32_aw,
+	m68k_op_divl_32_al,
+	m68k_op_divl_32_pcdi,
+	m68k_op_divl_32_pcix,
+	m68k_op_divl_32_i,
+	m68k_op_movem_16_er_aw,
+	m68k_op_movem_16_er_al,
+	m68k_op_movem_16_er_pcdi,
+	m68k_op_movem_16_er_pcix,
+	m68k_op_movem_32_er_aw,
+	m68k_op_movem_32_er_al,
+	m68k_op_movem_32_er_pcdi,
+	m68k_op_movem_32_er_pcix,
+	m68k_op_link_16_a7,
+	m68k_op_unlk_32_a7,
+	m68k_op_reset,
+	m68k_op_nop,
+	m68k_op_stop,
+	m68k_op_rte_32,
+	m68k_op_rtd_32,
+	m68k_op_rts_32,
+	m68k_op_trapv,
+	m68k_op_rtr_32,
+	m68k_op_movec_32_cr,
+	m68k_op_movec_32_rc,
+	m68k_op_jsr_32_aw,
+	m68k_op_jsr_32_al,
+	m68k_op_jsr_32_pcdi,
+	m68k_op_jsr_32_pcix,
+	m68k_op_jmp_32_aw,
+	m68k_op_jmp_32_al,
+	m68k_op_jmp_32_pcdi,
+	m68k_op_jmp_32_pcix,
+	m68k_op_st_8_pi7,
+	m68k_op_st_8_pd7,
+	m68k_op_st_8_aw,
+	m68k_op_st_8_al,
+	m68k_op_trapt_16,
+	m68k_op_trapt_32,
+	m68k_op_trapt,
+	m68k_op_sf_8_pi7,
+	m68k_op_sf_8_pd7,
+	m68k_op_sf_8_aw,
+	m68k_op_sf_8_al,
+	m68k_op_trapf_16,
+	m68k_op_trapf_32,
+	m68k_op_trapf,
+	m68k_op_shi_8_pi7,
+	m68k_op_shi_8_pd7,
+	m68k_op_shi_8_aw,
+	m68k_op_shi_8_al,
+	m68k_op_traphi_16,
+	m68k_op_traphi_32,
+	m68k_op_traphi,
+	m68k_op_sls_8_pi7,
+	m68k_op_sls_8_pd7,
+	m68k_op_sls_8_aw,
+	m68k_op_sls_8_al,
+	m68k_op_trapls_16,
+	m68k_op_trapls_32,
+	m68k_op_trapls,
+	m68k_op_scc_8_pi7,
+	m68k_op_scc_8_pd7,
+	m68k_op_scc_8_aw,
+	m68k_op_scc_8_al,
+	m68k_op_trapcc_16,
+	m68k_op_trapcc_32,
+	m68k_op_trapcc,
+	m68k_op_scs_8_pi7,
+	m68k_op_scs_8_pd7,
+	m68k_op_scs_8_aw,
+	m68k_op_scs_8_al,
+	m68k_op_trapcs_16,
+	m68k_op_trapcs_32,
+	m68k_op_trapcs,
+	m68k_op_sne_8_pi7,
+	m68k_op_sne_8_pd7,
+	m68k_op_sne_8_aw,
+	m68k_op_sne_8_al,
+	m68k_op_trapne_16,
+	m68k_op_trapne_32,
+	m68k_op_trapne,
+	m68k_op_seq_8_pi7,
+	m68k_op_seq_8_pd7,
+	m68k_op_seq_8_aw,
+	m68k_op_seq_8_al,
+	m68k_op_trapeq_16,
+	m68k_op_trapeq_32,
+	m68k_op_trapeq,
+	m68k_op_svc_8_pi7,
+	m68k_op_svc_8_pd7,
+	m68k_op_svc_8_aw,
+	m68k_op_svc_8_al,
+	m68k_op_trapvc_16,
+	m68k_op_trapvc_32,
+	m68k_op_trapvc,
+	m68k_op_svs_8_pi7,
+	m68k_op_svs_8_pd7,
+	m68k_op_svs_8_aw,
+	m68k_op_svs_8_al,
+	m68k_op_trapvs_16,
+	m68k_op_trapvs_32,
+	m68k_op_trapvs,
+	m68k_op_spl_8_pi7,
+	m68k_op_spl_8_pd7,
+	m68k_op_spl_8_aw,
+	m68k_op_spl_8_al,
+	m68k_op_trappl_16,
+	m68k_op_trappl_32,
+	m68k_op_trappl,
+	m68k_op_smi_8_pi7,
+	m68k_op_smi_8_pd7,
+	m68k_op_smi_8_aw,
+	m68k_op_smi_8_al,
+	m68k_op_trapmi_16,
+	m68k_op_trapmi_32,
+	m68k_op_trapmi,
+	m68k_op_sge_8_pi7,
+	m68k_op_sge_8_pd7,
+	m68k_op_sge_8_aw,
+	m68k_op_sge_8_al,
+	m68k_op_trapge_16,
+	m68k_op_trapge_32,
+	m68k_op_trapge,
+	m68k_op_slt_8_pi7,
+	m68k_op_slt_8_pd7,
+	m68k_op_slt_8_aw,
+	m68k_op_slt_8_al,
+	m68k_op_traplt_16,
+	m68k_op_traplt_32,
+	m68k_op_traplt,
+	m68k_op_sgt_8_pi7,
+	m68k_op_sgt_8_pd7,
+	m68k_op_sgt_8_aw,
+	m68k_op_sgt_8_al,
+	m68k_op_trapgt_16,
+	m68k_op_trapgt_32,
+	m68k_op_trapgt,
+	m68k_op_sle_8_pi7,
+	m68k_op_sle_8_pd7,
+	m68k_op_sle_8_aw,
+	m68k_op_sle_8_al,
+	m68k_op_traple_16,
+	m68k_op_traple_32,
+	m68k_op_traple,
+	m68k_op_bra_16,
+	m68k_op_bra_32,
+	m68k_op_bsr_16,
+	m68k_op_bsr_32,
+	m68k_op_bhi_16,
+	m68k_op_bhi_32,
+	m68k_op_bls_16,
+	m68k_op_bls_32,
+	m68k_op_bcc_16,
+	m68k_op_bcc_32,
+	m68k_op_bcs_16,
+	m68k_op_bcs_32,
+	m68k_op_bne_16,
+	m68k_op_bne_32,
+	m68k_op_beq_16,
+	m68k_op_beq_32,
+	m68k_op_bvc_16,
+	m68k_op_bvc_32,
+	m68k_op_bvs_16,
+	m68k_op_bvs_32,
+	m68k_op_bpl_16,
+	m68k_op_bpl_32,
+	m68k_op_bmi_16,
+	m68k_op_bmi_32,
+	m68k_op_bge_16,
+	m68k_op_bge_32,
+	m68k_op_blt_16,
+	m68k_op_blt_32,
+	m68k_op_bgt_16,
+	m68k_op_bgt_32,
+	m68k_op_ble_16,
+	m68k_op_ble_32,
+	m68k_op_sbcd_8_mm_axy7,
+	m68k_op_pack_16_mm_axy7,
+	m68k_op_unpk_16_mm_axy7,
+	m68k_op_subx_8_mm_axy7,
+	m68k_op_cmpm_8_axy7,
+	m68k_op_abcd_8_mm_axy7,
+	m68k_op_addx_8_mm_axy7,
+	m68k_op_asr_16_aw,
+	m68k_op_asr_16_al,
+	m68k_op_asl_16_aw,
+	m68k_op_asl_16_al,
+	m68k_op_lsr_16_aw,
+	m68k_op_lsr_16_al,
+	m68k_op_lsl_16_aw,
+	m68k_op_lsl_16_al,
+	m68k_op_roxr_16_aw,
+	m68k_op_roxr_16_al,
+	m68k_op_roxl_16_aw,
+	m68k_op_roxl_16_al,
+	m68k_op_ror_16_aw,
+	m68k_op_ror_16_al,
+	m68k_op_rol_16_aw,
+	m68k_op_rol_16_al,
+	m68k_op_bftst_32_aw,
+	m68k_op_bftst_32_al,
+	m68k_op_bftst_32_pcdi,
+	m68k_op_bftst_32_pcix,
+	m68k_op_bfextu_32_aw,
+	m68k_op_bfextu_32_al,
+	m68k_op_bfextu_32_pcdi,
+	m68k_op_bfextu_32_pcix,
+	m68k_op_bfchg_32_aw,
+	m68k_op_bfchg_32_al,
+	m68k_op_bfexts_32_aw,
+	m68k_op_bfexts_32_al,
+	m68k_op_bfexts_32_pcdi,
+	m68k_op_bfexts_32_pcix,
+	m68k_op_bfclr_32_aw,
+	m68k_op_bfclr_32_al,
+	m68k_op_bfffo_32_aw,
+	m68k_op_bfffo_32_al,
+	m68k_op_bfffo_32_pcdi,
+	m68k_op_bfffo_32_pcix,
+	m68k_op_bfset_32_aw,
+	m68k_op_bfset_32_al,
+	m68k_op_bfins_32_aw,
+	m68k_op_bfins_32_al,
+	m68k_op_illegal
+};
+
+/* Replace handlers with their fused versions, returns how many opcodes now have one */
+int M68KI_MODEL_NAME(m68ki_fuse_opcode_table)(void)
+{
+	int fused = 0;
+	int i;
+
+	for(i = 0; i < 0x10000; i++)
+	{
+		if(m68ki_instruction_jump_table[i] == m68k_op_move_32_pi_pi)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_move_32_pi_pi;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_move_16_pi_pi)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_move_16_pi_pi;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_move_8_pi_pi)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_move_8_pi_pi;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_dbf_16)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_dbf_16;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_move_32_d_pi)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_move_32_d_pi;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_clr_32_pi)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_clr_32_pi;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_move_8_d_pi)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_move_8_d_pi;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_cmp_8_d)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_cmp_8_d;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_cmp_16_d)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_cmp_16_d;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_cmp_32_d)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_cmp_32_d;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_cmpa_32_d)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_cmpa_32_d;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_cmpa_32_a)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_cmpa_32_a;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_cmpi_8_d)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_cmpi_8_d;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_cmpi_16_d)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_cmpi_16_d;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_cmpi_32_d)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_cmpi_32_d;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_tst_8_d)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_tst_8_d;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_tst_16_d)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_tst_16_d;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_tst_32_d)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_tst_32_d;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_tst_8_ai)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_tst_8_ai;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_tst_16_ai)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_tst_16_ai;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_tst_16_aw)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_tst_16_aw;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_move_16_d_d)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_move_16_d_d;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_move_32_d_d)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_move_32_d_d;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_move_16_d_ai)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_move_16_d_ai;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_move_32_d_ai)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_move_32_d_ai;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_subq_16_d)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_subq_16_d;
+			fused++;
+			continue;
+		}
+		if(m68ki_instruction_jump_table[i] == m68k_op_subq_32_d)
+		{
+			m68ki_instruction_jump_table[i] = m68k_fuse_subq_32_d;
+			fused++;
+			continue;
+		}
+	}
+
+	return fused;
+}
+
+/* ======================================================================== */
+/* ============================== END OF FILE ============================= */
+/* ======================================================================== */
+
+
@@ -1,9 +1,12 @@
 // SPDX-License-Identifier: MIT
 
 #include "config_file/config_file.h"
+#include "memory_mapped.h"
 #include "m68k.h"
 #include <endian.h>
 #include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
 #include "platforms/atari/et4000.h"
 
 //#define CHKRANGE(a, b, c) a >= (unsigned int)b && a < (unsigned int)(b + c)
@@ -35,7 +38,8 @@ extern void *RTGbuffer;
 
 inline int handle_mapped_read ( struct emulator_config *cfg, uint32_t addr, uint32_t *val, unsigned char type ) 
 {
-  uint8_t *read_addr = NULL;
+  uint8_t *read_mem = NULL;
+  uint32_t read_off = 0;
 
   for ( int i = 0; i < MAX_NUM_MAPPED_ITEMS && cfg->map_type [i] != MAPTYPE_NONE; i++ ) 
   {
@@ -56,7 +60,8 @@ inline int handle_mapped_read ( struct emulator_config *cfg, uint32_t addr, uint
           //}
 
           //else
-            read_addr = cfg->map_data [i] + ( addr - cfg->map_offset [i] );
+          read_mem = cfg->map_data [i];
+          read_off = addr - cfg->map_offset [i];
          
           break;
         case MAPTYPE_REGISTER:
@@ -79,21 +84,21 @@ inline int handle_mapped_read ( struct emulator_config *cfg, uint32_t addr, uint
     }
   }
 
-  if ( read_addr == NULL )
+  if ( read_mem == NULL )
     return -1;
 #if (0)
   switch ( type ) 
   {
     case OP_TYPE_BYTE:
-      *val = read_addr [0];
+      *val = mmap_mem_read_8 ( read_mem, read_off );
       //return 1;
       break;
     case OP_TYPE_WORD:
-      *val = be16toh ( ( (uint16_t *)read_addr ) [0] );
+      *val = mmap_mem_read_16 ( read_mem, read_off );
       //return 1;
       break;
     case OP_TYPE_LONGWORD:
-      *val = be32toh ( ( (uint32_t *)read_addr ) [0] );
+      *val = mmap_mem_read_32 ( read_mem, read_off );
       //return 1;
       break;
     case OP_TYPE_MEM:
@@ -107,19 +112,19 @@ inline int handle_mapped_read ( struct emulator_config *cfg, uint32_t addr, uint
 #else
   if ( type == OP_TYPE_BYTE )
   {
-    *val = *read_addr;
+    *val = mmap_mem_read_8 ( read_mem, read_off );
     return 1;
   }
 
   if ( type == OP_TYPE_WORD )
   {
-    *val = be16toh ( *( (uint16_t *)read_addr ) );
+    *val = mmap_mem_read_16 ( read_mem, read_off );
     return 1;
   }
 
   if ( type == OP_TYPE_LONGWORD )
   {
-    *val = be32toh ( *( (uint32_t *)read_addr ) );
+    *val = mmap_mem_read_32 ( read_mem, read_off );
     return 1;
   }
 
@@ -133,7 +138,8 @@ inline int handle_mapped_read ( struct emulator_config *cfg, uint32_t addr, uint
 inline int handle_mapped_write ( struct emulator_config *cfg, uint32_t addr, uint32_t value, unsigned char type ) 
 {
   int res = -1;
-  uint8_t *write_addr = NULL;
+  uint8_t *write_mem = NULL;
+  uint32_t write_off = 0;
 
   for ( int i = 0; i < MAX_NUM_MAPPED_ITEMS && cfg->map_type[i] != MAPTYPE_NONE; i++ ) 
   //for (int i = 0; i < MAX_NUM_MAPPED_ITEMS; i++) 
@@ -170,7 +176,8 @@ inline int handle_mapped_write ( struct emulator_config *cfg, uint32_t addr, uin
 
            // printf ( "mapped write 0x%X\n", addr );
           //else
-            write_addr = cfg->map_data [i] + ( addr - cfg->map_offset [i] );
+          write_mem = cfg->map_data [i];
+          write_off = addr - cfg->map_offset [i];
 
           res = 1;
           
@@ -178,7 +185,8 @@ inline int handle_mapped_write ( struct emulator_config *cfg, uint32_t addr, uin
           break;
         case MAPTYPE_RAM_WTC:
           //printf("Some write to WTC RAM.\n");
-          write_addr = cfg->map_data [i] + ( addr - cfg->map_offset [i] );
+          write_mem = cfg->map_data [i];
+          write_off = addr - cfg->map_offset [i];
           res = -1;
           goto write_value;
           break;
@@ -200,19 +208,19 @@ write_value:
   {
     case OP_TYPE_BYTE:
 
-      write_addr[0] = (unsigned char)value;
+      mmap_mem_write_8 ( write_mem, write_off, value );
       
       break;
 
     case OP_TYPE_WORD:
 
-      ((uint16_t *)write_addr)[0] = htobe16 ( value );
+      mmap_mem_write_16 ( write_mem, write_off, value );
 
       break;
 
     case OP_TYPE_LONGWORD:
 
-      ((uint32_t *)write_addr)[0] = htobe32 ( value );
+      mmap_mem_write_32 ( write_mem, write_off, value );
 
       break;
 
@@ -225,3 +233,230 @@ write_value:
 
   return res;
 }
+
+
+
+/*
+ * Block access to host backed memory in its storage layout (memory_mapped.h)
+ *
+ * These take a big endian byte stream, the way a file or the 68k sees it.
+ * With the byte XOR the aligned middle of a transfer is still a memcpy or
+ * memset on whole words, only an odd start or end needs single bytes.
+ */
+
+/* big endian image <-> storage layout, in place - the word swap is its own inverse */
+void mmap_mem_swap ( uint8_t *mem, uint32_t len )
+{
+#if MMAP_BYTE_XOR
+  uint16_t *w = (uint16_t *)mem;
+
+  for ( uint32_t n = 0; n < len / 2; n++ )
+    w [n] = be16toh ( w [n] );
+#else
+  (void)mem;
+  (void)len;
+#endif
+}
+
+
+void mmap_mem_copy_in ( uint8_t *mem, uint32_t off, const uint8_t *src, uint32_t len )
+{
+#if MMAP_BYTE_XOR
+  for ( ; len && ( off & 1 ); off++, src++, len-- )
+    mmap_mem_write_8 ( mem, off, *src );
+
+  for ( ; len >= 2; off += 2, src += 2, len -= 2 )
+    mmap_mem_write_16 ( mem, off, ( src [0] << 8 ) | src [1] );
+
+  if ( len )
+    mmap_mem_write_8 ( mem, off, *src );
+#else
+  memcpy ( mem + off, src, len );
+#endif
+}
+
+
+void mmap_mem_copy_out ( uint8_t *dst, const uint8_t *mem, uint32_t off, uint32_t len )
+{
+#if MMAP_BYTE_XOR
+  for ( uint32_t n = 0; n < len; n++ )
+    dst [n] = mmap_mem_read_8 ( mem, off + n );
+#else
+  memcpy ( dst, mem + off, len );
+#endif
+}
+
+
+/* between two mappings, both in storage layout - the ranges may overlap like memmove */
+void mmap_mem_copy ( uint8_t *dst, uint32_t doff, const uint8_t *src, uint32_t soff, uint32_t len )
+{
+#if MMAP_BYTE_XOR
+  uint32_t lead;
+  uint32_t words;
+  uint8_t first;
+  uint8_t last;
+
+  if ( ( doff ^ soff ) & 1 )
+  {
+    if ( dst + doff > src + soff )
+    {
+      for ( uint32_t n = len; n > 0; n-- )
+        mmap_mem_write_8 ( dst, doff + n - 1, mmap_mem_read_8 ( src, soff + n - 1 ) );
+    }
+    else
+    {
+      for ( uint32_t n = 0; n < len; n++ )
+        mmap_mem_write_8 ( dst, doff + n, mmap_mem_read_8 ( src, soff + n ) );
+    }
+
+    return;
+  }
+
+  /* odd first and last bytes share a word with bytes outside the range */
+  lead  = len && ( doff & 1 );
+  words = ( len - lead ) & ~1u;
+  first = lead ? mmap_mem_read_8 ( src, soff ) : 0;
+  last  = ( len - lead ) & 1 ? mmap_mem_read_8 ( src, soff + len - 1 ) : 0;
+
+  memmove ( dst + doff + lead, src + soff + lead, words );
+
+  if ( lead )
+    mmap_mem_write_8 ( dst, doff, first );
+
+  if ( ( len - lead ) & 1 )
+    mmap_mem_write_8 ( dst, doff + len - 1, last );
+#else
+  memmove ( dst + doff, src + soff, len );
+#endif
+}
+
+
+void mmap_mem_fill ( uint8_t *mem, uint32_t off, uint8_t val, uint32_t len )
+{
+#if MMAP_BYTE_XOR
+  if ( len && ( off & 1 ) )
+  {
+    mmap_mem_write_8 ( mem, off++, val );
+    len--;
+  }
+
+  memset ( mem + off, val, len & ~1u );
+
+  if ( len & 1 )
+    mmap_mem_write_8 ( mem, off + len - 1, val );
+#else
+  memset ( mem + off, val, len );
+#endif
+}
+
+
+
+/*
+ * Page table dispatch
+ *
+ * Every 64K page of the 32 bit address space says where an access goes, so
+ * m68k_read/write_memory_* do one lookup instead of walking the device range
+ * checks and the map list. Pages that are only partly covered by a device or
+ * mapping, or covered by more than one, are marked MMAP_SLOW and take the
+ * original range check path.
+ */
+mmap_page_t   mmap_pages [MMAP_NUM_PAGES];
+mmap_device_t mmap_devices [MMAP_DEV_NUM];
+
+static const char *mmap_type_names [MMAP_NUM] = {
+  "bus",
+  "ram",
+  "rom",
+  "device",
+  "slow",
+};
+
+
+void mmap_clear ( void )
+{
+  memset ( mmap_pages, 0, sizeof ( mmap_pages ) );
+}
+
+
+void mmap_set_range ( uint32_t lo, uint32_t hi, uint8_t type, uint8_t *host, uint8_t dev )
+{
+  uint64_t page_lo;
+  uint64_t page_hi;
+  mmap_page_t *page;
+
+  if ( hi <= lo )
+    return;
+
+  for ( uint32_t p = lo >> MMAP_PAGE_SHIFT; p <= ( ( hi - 1 ) >> MMAP_PAGE_SHIFT ); p++ )
+  {
+    page    = &mmap_pages [p];
+    page_lo = (uint64_t)p << MMAP_PAGE_SHIFT;
+    page_hi = page_lo + MMAP_PAGE_SIZE;
+
+    /* partial cover or a second owner - leave it to the range checks */
+    if ( lo > page_lo || hi < page_hi || page->type != MMAP_BUS )
+    {
+      page->type = MMAP_SLOW;
+      page->host = NULL;
+      page->dev  = MMAP_DEV_NONE;
+
+      continue;
+    }
+
+    page->type = type;
+    page->dev  = dev;
+    page->host = host ? host + ( page_lo - lo ) : NULL;
+  }
+}
+
+
+void mmap_build ( struct emulator_config *cfg )
+{
+  mmap_clear ();
+
+  for ( int i = 0; i < MAX_NUM_MAPPED_ITEMS && cfg->map_type [i] != MAPTYPE_NONE; i++ )
+  {
+    switch ( cfg->map_type [i] )
+    {
+      case MAPTYPE_ROM:
+        mmap_set_range ( cfg->map_offset [i], cfg->map_high [i], MMAP_HOST_ROM, cfg->map_data [i], MMAP_DEV_NONE );
+        break;
+
+      case MAPTYPE_RAM:
+      case MAPTYPE_FILE:
+        mmap_set_range ( cfg->map_offset [i], cfg->map_high [i], MMAP_HOST_RAM, cfg->map_data [i], MMAP_DEV_NONE );
+        break;
+
+      case MAPTYPE_REGISTER:
+        mmap_set_range ( cfg->map_offset [i], cfg->map_high [i], MMAP_DEVICE, NULL, MMAP_DEV_REGISTER );
+        break;
+
+      /* write-through and no-alloc mappings are rare, keep the old behaviour */
+      default:
+        mmap_set_range ( cfg->map_offset [i], cfg->map_high [i], MMAP_SLOW, NULL, MMAP_DEV_NONE );
+        break;
+    }
+  }
+}
+
+
+void mmap_dump ( void )
+{
+  uint32_t start = 0;
+
+  for ( uint32_t p = 1; p <= MMAP_NUM_PAGES; p++ )
+  {
+    if ( p < MMAP_NUM_PAGES 
+      && mmap_pages [p].type == mmap_pages [start].type 
+      && mmap_pages [p].dev == mmap_pages [start].dev )
+      continue;
+
+    if ( mmap_pages [start].type != MMAP_BUS )
+      printf ( "[MMAP] 0x%08X-0x%08X %s\n", 
+        start << MMAP_PAGE_SHIFT, 
+        ( p << MMAP_PAGE_SHIFT ) - 1, 
+        mmap_type_names [mmap_pages [start].type] );
+
+    start = p;
+  }
+}
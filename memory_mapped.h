@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: MIT
+/**
+ * pistorm
+ * flat page table used to dispatch 68k memory accesses
+ */
+
+#ifndef _MEMORY_MAPPED_H
+#define _MEMORY_MAPPED_H
+
+#include <stdint.h>
+#include <endian.h>
+#include "config_file/config_file.h"
+
+/* 64K pages over the full 32 bit address space */
+#define MMAP_PAGE_SHIFT 16
+#define MMAP_PAGE_SIZE  (1 << MMAP_PAGE_SHIFT)
+#define MMAP_PAGE_MASK  (MMAP_PAGE_SIZE - 1)
+#define MMAP_NUM_PAGES  (1 << (32 - MMAP_PAGE_SHIFT))
+
+typedef enum {
+  MMAP_BUS,       /* physical Atari bus - default for every page */
+  MMAP_HOST_RAM,  /* host memory, read/write */
+  MMAP_HOST_ROM,  /* host memory, writes are ignored */
+  MMAP_DEVICE,    /* whole page belongs to one emulated device */
+  MMAP_SLOW,      /* page is shared - walk platform_read_check () and friends */
+  MMAP_NUM,
+} mmap_page_types;
+
+typedef enum {
+  MMAP_DEV_NONE,
+  MMAP_DEV_BLITTER,
+  MMAP_DEV_ET4000,
+  MMAP_DEV_RTC,
+  MMAP_DEV_REGISTER,
+  MMAP_DEV_NUM,
+} mmap_devices_ids;
+
+typedef struct {
+  int (*read)  ( uint8_t type, uint32_t addr, uint32_t *res );
+  int (*write) ( uint8_t type, uint32_t addr, uint32_t val );
+} mmap_device_t;
+
+/* keep this small - 8 bytes on the Pi, the whole table is 512KB */
+typedef struct {
+  uint8_t *host;  /* host address of the first byte in the page */
+  uint8_t  type;
+  uint8_t  dev;
+  uint8_t  code;  /* block cache has recorded code here, CPU writes must be tracked */
+} mmap_page_t;
+
+extern mmap_page_t   mmap_pages [MMAP_NUM_PAGES];
+extern mmap_device_t mmap_devices [MMAP_DEV_NUM];
+
+void mmap_clear ( void );
+void mmap_set_range ( uint32_t lo, uint32_t hi, uint8_t type, uint8_t *host, uint8_t dev );
+void mmap_build ( struct emulator_config *cfg );
+void mmap_dump ( void );
+
+
+static inline mmap_page_t *mmap_lookup ( uint32_t addr )
+{
+  return &mmap_pages [addr >> MMAP_PAGE_SHIFT];
+}
+
+/* true when an access of size bytes would run off the end of its page */
+static inline int mmap_crosses_page ( uint32_t addr, int size )
+{
+  return ( addr & MMAP_PAGE_MASK ) > ( MMAP_PAGE_SIZE - size );
+}
+
+/*
+ * Storage layout of host backed 68k memory - ROM, RAM and file maps
+ *
+ * With MMAP_HOST_ENDIAN (on unless make is run with HOSTENDIAN=OFF) every
+ * 16 bit word is kept in host byte order, so an aligned word access is a plain load or
+ * store and a long is two words, high word first. On a little endian host
+ * the byte at 68k address a then lives at offset a ^ 1. Images are word
+ * swapped once when they are loaded (mmap_mem_swap) and anything that
+ * copies bytes in or out of map_data must use the helpers below.
+ *
+ * mem is the start of a mapping and must be 16 bit aligned, off is the
+ * offset from it - the parity of off is the parity of the 68k address.
+ */
+#ifndef MMAP_HOST_ENDIAN
+#define MMAP_HOST_ENDIAN 0
+#endif
+
+#if MMAP_HOST_ENDIAN && __BYTE_ORDER == __LITTLE_ENDIAN
+#define MMAP_BYTE_XOR 1
+#else
+#define MMAP_BYTE_XOR 0
+#endif
+
+/* host memory is allocated in whole words so the last byte has its pair */
+#define MMAP_MEM_SIZE(s) ( ( (s) + 1 ) & ~1u )
+
+static inline uint32_t mmap_mem_read_8 ( const uint8_t *mem, uint32_t off )
+{
+  return mem [off ^ MMAP_BYTE_XOR];
+}
+
+static inline void mmap_mem_write_8 ( uint8_t *mem, uint32_t off, uint32_t val )
+{
+  mem [off ^ MMAP_BYTE_XOR] = (uint8_t)val;
+}
+
+static inline uint32_t mmap_mem_read_16 ( const uint8_t *mem, uint32_t off )
+{
+#if MMAP_BYTE_XOR
+  if ( off & 1 )
+    return ( mmap_mem_read_8 ( mem, off ) << 8 ) | mmap_mem_read_8 ( mem, off + 1 );
+
+  return *(const uint16_t *)( mem + off );
+#else
+  return be16toh ( *(const uint16_t *)( mem + off ) );
+#endif
+}
+
+static inline void mmap_mem_write_16 ( uint8_t *mem, uint32_t off, uint32_t val )
+{
+#if MMAP_BYTE_XOR
+  if ( off & 1 )
+  {
+    mmap_mem_write_8 ( mem, off, val >> 8 );
+    mmap_mem_write_8 ( mem, off + 1, val );
+
+    return;
+  }
+
+  *(uint16_t *)( mem + off ) = (uint16_t)val;
+#else
+  *(uint16_t *)( mem + off ) = htobe16 ( val );
+#endif
+}
+
+static inline uint32_t mmap_mem_read_32 ( const uint8_t *mem, uint32_t off )
+{
+#if MMAP_BYTE_XOR
+  uint32_t v;
+
+  if ( off & 1 )
+    return ( mmap_mem_read_8 ( mem, off ) << 24 ) 
+      | ( mmap_mem_read_16 ( mem, off + 1 ) << 8 ) 
+      | mmap_mem_read_8 ( mem, off + 3 );
+
+  /* the two words come back low word first - one rotate puts them right */
+  v = *(const uint32_t *)( mem + off );
+
+  return ( v << 16 ) | ( v >> 16 );
+#else
+  return be32toh ( *(const uint32_t *)( mem + off ) );
+#endif
+}
+
+static inline void mmap_mem_write_32 ( uint8_t *mem, uint32_t off, uint32_t val )
+{
+#if MMAP_BYTE_XOR
+  if ( off & 1 )
+  {
+    mmap_mem_write_8 ( mem, off, val >> 24 );
+    mmap_mem_write_16 ( mem, off + 1, val >> 8 );
+    mmap_mem_write_8 ( mem, off + 3, val );
+
+    return;
+  }
+
+  *(uint32_t *)( mem + off ) = ( val << 16 ) | ( val >> 16 );
+#else
+  *(uint32_t *)( mem + off ) = htobe32 ( val );
+#endif
+}
+
+void mmap_mem_swap ( uint8_t *mem, uint32_t len );
+void mmap_mem_copy_in ( uint8_t *mem, uint32_t off, const uint8_t *src, uint32_t len );
+void mmap_mem_copy_out ( uint8_t *dst, const uint8_t *mem, uint32_t off, uint32_t len );
+void mmap_mem_copy ( uint8_t *dst, uint32_t doff, const uint8_t *src, uint32_t soff, uint32_t len );
+void mmap_mem_fill ( uint8_t *mem, uint32_t off, uint8_t val, uint32_t len );
+
+
+static inline uint32_t mmap_host_read_8 ( mmap_page_t *page, uint32_t addr )
+{
+  return mmap_mem_read_8 ( page->host, addr & MMAP_PAGE_MASK );
+}
+
+static inline uint32_t mmap_host_read_16 ( mmap_page_t *page, uint32_t addr )
+{
+  return mmap_mem_read_16 ( page->host, addr & MMAP_PAGE_MASK );
+}
+
+static inline uint32_t mmap_host_read_32 ( mmap_page_t *page, uint32_t addr )
+{
+  return mmap_mem_read_32 ( page->host, addr & MMAP_PAGE_MASK );
+}
+
+static inline void mmap_host_write_8 ( mmap_page_t *page, uint32_t addr, uint32_t val )
+{
+  mmap_mem_write_8 ( page->host, addr & MMAP_PAGE_MASK, val );
+}
+
+static inline void mmap_host_write_16 ( mmap_page_t *page, uint32_t addr, uint32_t val )
+{
+  mmap_mem_write_16 ( page->host, addr & MMAP_PAGE_MASK, val );
+}
+
+static inline void mmap_host_write_32 ( mmap_page_t *page, uint32_t addr, uint32_t val )
+{
+  mmap_mem_write_32 ( page->host, addr & MMAP_PAGE_MASK, val );
+}
+
+#endif /* _MEMORY_MAPPED_H */
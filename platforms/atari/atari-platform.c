@@ -50,6 +50,21 @@ extern bool FPU68020_SELECTED;
 extern bool RTC_enabled;
 extern bool WTC_enabled;
 extern bool Blitter_enabled;
+extern uint8_t ps_burst;
+extern uint8_t ps_posted;
+extern uint8_t ps_stats_enabled;
+extern unsigned int IPL_poll_ns;
+extern bool Slice_adaptive;
+extern unsigned int Idle_us;
+extern bool Bcache_enabled;
+extern bool Fuse_enabled;
+extern bool Vector_shadow;
+extern bool Write_combine;
+extern bool ROM_shadow;
+extern bool ROM_shadow_cart;
+extern bool ROM_shadow_verify;
+extern unsigned int WTC_fill;
+extern uint32_t Icache_bytes;
 
 extern const char *op_type_names[OP_TYPE_NUM];
 //extern uint8_t cdtv_mode;
@@ -271,8 +286,79 @@ void setvar_atari(struct emulator_config *cfg, char *var, char *val)
     if CHKVAR ( "wtc" )
         WTC_enabled = true;
 
+    /* what a WTC read miss fetches - none, word, line or adaptive (default) */
+    if CHKVAR ( "wtcfill" )
+    {
+        WTC_fill = 3;
+
+        if ( val && strcmp ( val, "none" ) == 0 )
+            WTC_fill = 0;
+
+        else if ( val && strcmp ( val, "word" ) == 0 )
+            WTC_fill = 1;
+
+        else if ( val && strcmp ( val, "line" ) == 0 )
+            WTC_fill = 2;
+    }
+
     if CHKVAR ( "blitter" )
         Blitter_enabled = true;
+
+    /* CPLD firmware with burst mode - ADDR_HI_BIT_BURST */
+    if CHKVAR ( "burst" )
+        ps_burst = 1;
+
+    /* don't wait for ST bus writes to complete */
+    if CHKVAR ( "posted" )
+        ps_posted = 1;
+
+    /* no bus latency timing - ataritest --busstats has nothing to show */
+    if CHKVAR ( "nobusstats" )
+        ps_stats_enabled = 0;
+
+    /* how often a masked, unchanged IPL is re-read from the CPLD */
+    if CHKVAR ( "iplpoll" )
+        IPL_poll_ns = strtoul ( val, &endptr, 0 ) * 1000;
+
+    /* sleep up to <n> microseconds in STOP and polling loops instead of spinning */
+    if CHKVAR ( "idle" )
+        Idle_us = val && *val ? strtoul ( val, &endptr, 0 ) : 200;
+
+    /* size timeslices between loopcycles / 8 and loopcycles * 8 */
+    if CHKVAR ( "adaptive" )
+        Slice_adaptive = true;
+
+    /* replay predecoded blocks of code running from ROM/ALT-RAM */
+    if CHKVAR ( "blockcache" )
+        Bcache_enabled = true;
+
+    /* run hot instruction pairs (m68kfuse.txt) from one handler */
+    if CHKVAR ( "fuse" )
+        Fuse_enabled = true;
+
+    /* serve exception vector fetches from a write-through host copy */
+    if CHKVAR ( "vectors" )
+        Vector_shadow = true;
+
+    /* merge adjacent byte/word stores to ST-RAM into word/long bus writes */
+    if CHKVAR ( "combine" )
+        Write_combine = true;
+
+    /* copy the motherboard TOS (and cartridge) to host ROM, cached on disk */
+    if CHKVAR ( "romshadow" )
+    {
+        ROM_shadow = true;
+
+        if ( val && strstr ( val, "cart" ) )
+            ROM_shadow_cart = true;
+
+        if ( val && strstr ( val, "verify" ) )
+            ROM_shadow_verify = true;
+    }
+
+    /* 68020/030 instruction cache size in bytes, 256 is the real thing */
+    if CHKVAR ( "icache" )
+        Icache_bytes = strtoul ( val, &endptr, 0 );
         
 #ifdef PISCSI
     // PiSCSI stuff
@@ -7,6 +7,7 @@
 #include "blitter.h"
 #include "../../config_file/config_file.h"
 #include "../../gpio/ps_protocol.h"
+#include "../../icache.h"
 
 
 /*
@@ -173,6 +174,8 @@ static void Blitter_WriteWord(uint32_t addr, uint16_t value)
             //ps_write_8 ( addr,  value >> 8 );
             //ps_write_8 ( addr + 1, value & 0xFF );
             //printf ( "%s 0x%X 0x%X\n", __func__, addr, value );
+
+	        icache_write ( addr, 2 );
         }
     }
 }
@@ -591,13 +594,17 @@ static void Blitter_Start(void)
     //interrupt = ps_read_8 ( 0xFFFA01 );
     //ps_write_8 ( 0xFFFA01, interrupt |= 0x08 );
 
-	/* Now we enter the main blitting loop */
+	/* Now we enter the main blitting loop - the bus is ours until the blit is done */
+    ps_bus_acquire ();
+
 	do
 	{
 		Blitter_Step();
 	}
 	while ( BlitterRegs.y_count > 0 ); //&& BlitterVars.hog );
 
+    ps_bus_release ();
+
 
 	BlitterRegs.ctrl = (BlitterRegs.ctrl & 0xF0) | BlitterVars.halftone_line;
 
@@ -1451,7 +1458,8 @@ int blitWrite ( uint8_t type, uint32_t addr, uint32_t value )
 
             break;
     }
-    
+
+    return 1;
 }
 
 
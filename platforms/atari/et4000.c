@@ -37,6 +37,7 @@
 #include <sys/ioctl.h>
 #include <sys/time.h>
 #include "../../config_file/config_file.h"
+#include "../../gpio/ps_bus.h"
 #include <stdbool.h>
 #include "et4000.h"
 
@@ -146,7 +147,6 @@ static int ix;
 volatile nova_xcb_t nova_xcb;
 volatile nova_xcb_t *xcb;
 volatile bool RTG_LOCK;
-volatile bool PS_LOCK;
 volatile bool ET4000enabled;
 volatile int COLOURDEPTH;
 volatile uint32_t RTG_VSYNC;
@@ -233,9 +233,19 @@ static uint32_t pixel;
 static int      SCREEN_SIZE;
 static struct   timeval stop, start;
 
+/* keep off the memory bus while the CPU thread has a transaction on the wire, once per line */
+#define STEP_ASIDE_EVERY(p, n) \
+    if ( (p) >= line_end ) \
+    { \
+        ps_bus_step_aside (); \
+        line_end = (p) + (n); \
+    }
+
 
 void et4000Draw ( int windowWidth, int windowHeight )
 {
+    uint32_t line_end = 0;
+
     SCREEN_SIZE = windowWidth * windowHeight;
     RTG_VSYNC = 0;
 
@@ -247,11 +257,10 @@ void et4000Draw ( int windowWidth, int windowHeight )
 
         for ( uint32_t address = 0, pixel = 0; pixel < SCREEN_SIZE; address++ ) 
         {
+            STEP_ASIDE_EVERY ( pixel, windowWidth );
+
             for ( int ppb = 0; ppb < 8; ppb++, pixel++ )
             {
-                while ( PS_LOCK )
-                    ;
-
                 dptr [pixel] = ( sptr [address] >> (7 - ppb) ) & 0x1 ? 0x0020 : 0xffff;
             }
         }
@@ -269,8 +278,7 @@ void et4000Draw ( int windowWidth, int windowHeight )
 
         for ( address = 0, pixel = 0; pixel < SCREEN_SIZE; pixel++, address++ ) 
         {
-            while ( PS_LOCK )
-                ;
+            STEP_ASIDE_EVERY ( pixel, windowWidth );
 
             ix = sptr [address] * 3;                // pointer to palette index
             
@@ -350,8 +358,7 @@ void et4000Draw ( int windowWidth, int windowHeight )
 
         for ( pixel = 0; pixel < SCREEN_SIZE; pixel++ )
         {
-            while ( PS_LOCK )
-                ;
+            STEP_ASIDE_EVERY ( pixel, windowWidth );
 
             dptr [pixel] = sptr [pixel];
         }
@@ -366,8 +373,7 @@ void et4000Draw ( int windowWidth, int windowHeight )
 
         for ( address = 0, pixel = 0; pixel < SCREEN_SIZE; ) 
         {
-            while ( PS_LOCK )
-                ;
+            STEP_ASIDE_EVERY ( pixel, windowWidth );
 
             dptr [pixel++] = (uint32_t)( sptr [address++] << 16 | sptr [address++] << 8 | sptr [address++] );
         }
@@ -375,14 +381,14 @@ void et4000Draw ( int windowWidth, int windowHeight )
 
     if ( fbp != (void *)NULL )
     {
-        /* cryptodad - can't use memcpy as have to check for active ps_read/write */
-        //memcpy ( fbp, RTGbuffer, screensize );
-        for ( int n = 0; n < screensize; n++ )
+        /* one framebuffer line at a time, stepping aside for the bus in between */
+        size_t line = finfo.line_length ? finfo.line_length : screensize;
+
+        for ( size_t n = 0; n < screensize; n += line )
         {
-            while ( PS_LOCK )
-                ;
+            ps_bus_step_aside ();
 
-            *((char *)fbp + n) = *((char *)RTGbuffer + n);
+            memcpy ( (char *)fbp + n, (char *)RTGbuffer + n, n + line > screensize ? screensize - n : line );
         }
     }
 }
@@ -402,6 +408,8 @@ void *et4000Render ( void* vptr )
 
     //sched_setscheduler ( 0, SCHED_FIFO, &priority );
 
+    ps_bus_register ( "rtg" );
+
     while ( !cpu_emulation_running )
         ;
 
@@ -413,7 +421,7 @@ void *et4000Render ( void* vptr )
         gettimeofday ( &start, NULL );
         unknown = false;
 
-        while ( PS_LOCK );
+        ps_bus_step_aside ();
 
         if ( ET4000enabled && RTGresChanged )
         {
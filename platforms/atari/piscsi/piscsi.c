@@ -10,6 +10,7 @@
 
 #include "config_file/config_file.h"
 #include "gpio/ps_protocol.h"
+#include "memory_mapped.h"
 #include "piscsi-enums.h"
 #include "piscsi.h"
 #include "platforms/atari/hunk-reloc.h"
@@ -611,9 +612,38 @@ void piscsi_debugme(uint32_t index) {
     }
 }
 
+// "DMA" between a drive and a mapped range, which may keep its words in host order (memory_mapped.h)
+static void piscsi_dma_read(int fd, uint8_t *mem, uint32_t off, uint32_t len) {
+    if (!MMAP_BYTE_XOR || !((off | len) & 1)) {
+        read(fd, mem + off, len);
+        mmap_mem_swap(mem + off, len);
+        return;
+    }
+
+    uint8_t *tmp = malloc(len);
+    if (tmp) {
+        read(fd, tmp, len);
+        mmap_mem_copy_in(mem, off, tmp, len);
+        free(tmp);
+    }
+}
+
+static void piscsi_dma_write(int fd, uint8_t *mem, uint32_t off, uint32_t len) {
+    if (!MMAP_BYTE_XOR) {
+        write(fd, mem + off, len);
+        return;
+    }
+
+    uint8_t *tmp = malloc(len);
+    if (tmp) {
+        mmap_mem_copy_out(tmp, mem, off, len);
+        write(fd, tmp, len);
+        free(tmp);
+    }
+}
+
 void handle_piscsi_write(uint32_t addr, uint32_t val, uint8_t type) {
     int32_t r;
-    uint8_t *map;
 #ifndef PISCSI_DEBUG
     if (type) {}
 #endif
@@ -651,10 +681,10 @@ void handle_piscsi_write(uint32_t addr, uint32_t val, uint8_t type) {
                 lseek64(d->fd, src, SEEK_SET);
             }
 
-            map = get_mapped_data_pointer_by_address(cfg, piscsi_u32[2]);
-            if (map) {
+            r = get_mapped_item_by_address(cfg, piscsi_u32[2]);
+            if (r != -1) {
                 DEBUG_TRIVIAL("[PISCSI-%d] \"DMA\" Read goes to mapped range %d.\n", val, r);
-                read(d->fd, map, piscsi_u32[1]);
+                piscsi_dma_read(d->fd, cfg->map_data[r], piscsi_u32[2] - cfg->map_offset[r], piscsi_u32[1]);
             }
             else {
                 DEBUG_TRIVIAL("[PISCSI-%d] No mapped range found for read.\n", val);
@@ -693,10 +723,10 @@ void handle_piscsi_write(uint32_t addr, uint32_t val, uint8_t type) {
                 lseek64(d->fd, src, SEEK_SET);
             }
 
-            map = get_mapped_data_pointer_by_address(cfg, piscsi_u32[2]);
-            if (map) {
+            r = get_mapped_item_by_address(cfg, piscsi_u32[2]);
+            if (r != -1) {
                 DEBUG_TRIVIAL("[PISCSI-%d] \"DMA\" Write comes from mapped range %d.\n", val, r);
-                write(d->fd, map, piscsi_u32[1]);
+                piscsi_dma_write(d->fd, cfg->map_data[r], piscsi_u32[2] - cfg->map_offset[r], piscsi_u32[1]);
             }
             else {
                 DEBUG_TRIVIAL("[PISCSI-%d] No mapped range found for write.\n", val);
@@ -737,6 +767,15 @@ void handle_piscsi_write(uint32_t addr, uint32_t val, uint8_t type) {
                 uint32_t addr = val - cfg->map_offset[r];
                 uint8_t *dst_data = cfg->map_data[r];
                 uint8_t cur_partition = 0;
+                uint32_t span = 0x4000;
+
+                // the driver and its DOS nodes are patched big endian, swap the words they land on around it
+                for (int i = 0; i < NUM_UNITS; i++) {
+                    if (devs[i].fd != -1)
+                        span += devs[i].num_partitions * 0x100;
+                }
+                mmap_mem_swap(dst_data + addr, span);
+
                 memcpy(dst_data + addr, piscsi_rom_ptr + PISCSI_DRIVER_OFFSET, 0x4000 - PISCSI_DRIVER_OFFSET);
 
                 piscsi_hinfo.base_offset = val;
@@ -805,6 +844,8 @@ void handle_piscsi_write(uint32_t addr, uint32_t val, uint8_t type) {
                     }
 skip_disk:;
                 }
+
+                mmap_mem_swap(dst_data + addr, span);
             }
 
             break;
@@ -821,9 +862,12 @@ skip_disk:;
             r = get_mapped_item_by_address(cfg, piscsi_u32[2]);
             if (r != -1) {
                 uint32_t addr = piscsi_u32[2] - cfg->map_offset[r];
+                uint32_t size = MMAP_MEM_SIZE(filesystems[rom_cur_fs].h_info.byte_size);
+                mmap_mem_swap(cfg->map_data[r] + addr, size);
                 memcpy(cfg->map_data[r] + addr, filesystems[rom_cur_fs].binary_data, filesystems[rom_cur_fs].h_info.byte_size);
                 filesystems[rom_cur_fs].h_info.base_offset = piscsi_u32[2];
                 reloc_hunks(filesystems[rom_cur_fs].relocs, cfg->map_data[r] + addr, &filesystems[rom_cur_fs].h_info);
+                mmap_mem_swap(cfg->map_data[r] + addr, size);
                 filesystems[rom_cur_fs].handler = piscsi_u32[2];
             }
             break;
@@ -834,6 +878,7 @@ skip_disk:;
             if (r != -1) {
                 uint32_t addr = val - cfg->map_offset[r];
                 struct DeviceNode *node = (struct DeviceNode *)(cfg->map_data[r] + addr);
+                mmap_mem_swap((uint8_t *)node, sizeof(struct DeviceNode));
                 char *dosID = (char *)&rom_partition_dostype[rom_cur_partition];
 
                 DEBUG("[PISCSI] Partition DOSType is %c%c%c/%d\n", dosID[0], dosID[1], dosID[2], dosID[3]);
@@ -854,6 +899,7 @@ fs_found:;
                 DEBUG("[FS-HANDLER] Priority: %d Startup: %d (%.8X)\n", BE((uint32_t)node->dn_Priority), BE(node->dn_Startup), BE(node->dn_Startup));
                 DEBUG("[FS-HANDLER] SegList: %.8X GlobalVec: %d\n", BE((uint32_t)node->dn_SegList), BE(node->dn_GlobalVec));
                 DEBUG("[PISCSI] Handler for partition %.8X set to %.8X (%.8X).\n", BE((uint32_t)node->dn_Name), filesystems[i].FS_ID, filesystems[i].handler);
+                mmap_mem_swap((uint8_t *)node, sizeof(struct DeviceNode));
             }
             break;
         }
@@ -10,6 +10,7 @@
 #include "pistorm-dev-enums.h"
 #include "platforms/platforms.h"
 #include "gpio/ps_protocol.h"
+#include "memory_mapped.h"
 //#include "platforms/amiga/rtg/rtg.h"
 #include "platforms/atari/piscsi/piscsi.h"
 //#include "platforms/amiga/net/pi-net.h"
@@ -106,9 +107,9 @@ int32_t grab_atari_string(uint32_t addr, uint8_t *dest, uint32_t str_max_len) {
         } while (dest[index - 1] != 0x00 && index < str_max_len);
     }
     else {
-        uint8_t *src = cfg->map_data[r] + (addr - cfg->map_offset[r]);
+        uint32_t src = addr - cfg->map_offset[r];
         do {
-            dest[index] = src[index];
+            dest[index] = mmap_mem_read_8(cfg->map_data[r], src + index);
             index++;
         } while (dest[index - 1] != 0x00 && index < str_max_len);
     }
@@ -141,8 +142,14 @@ int32_t atari_transfer_file(uint32_t addr, char *filename) {
             m68k_write_memory_8(addr + i, tmp_read);
         }
     } else {
-        uint8_t *dst = cfg->map_data[r] + (addr - cfg->map_offset[r]);
-        fread(dst, filesize, 1, in);
+        uint8_t *tmp = malloc(filesize);
+        if (tmp == NULL) {
+            fclose(in);
+            return -1;
+        }
+        fread(tmp, filesize, 1, in);
+        mmap_mem_copy_in(cfg->map_data[r], addr - cfg->map_offset[r], tmp, filesize);
+        free(tmp);
     }
     fclose(in);
     DEBUG("[ATARI_TRANSFER_FILE] Copied %d bytes to address $%.8X.\n", filesize, addr);
@@ -253,27 +260,46 @@ void handle_pistorm_dev_write(uint32_t addr_, uint32_t val, uint8_t type) {
                     break;
                 if (dst != -1 && src != -1) {
                     //DEBUG("super memcpy\n");
-                    uint8_t *src_ptr = &cfg->map_data[src][(pi_ptr[0] - cfg->map_offset[src])];
-                    uint8_t *dst_ptr = &cfg->map_data[dst][(pi_ptr[1] - cfg->map_offset[dst])];
-                    memcpy(dst_ptr, src_ptr, val);
+                    mmap_mem_copy(cfg->map_data[dst], pi_ptr[1] - cfg->map_offset[dst], cfg->map_data[src], pi_ptr[0] - cfg->map_offset[src], val);
+                } else if (((pi_ptr[0] | pi_ptr[1]) & 1) == 0) {
+                    /* the unmapped side goes through the word block calls, plain ST-RAM as a bus burst */
+                    uint16_t words[256];
+                    uint32_t i = 0, n;
+                    for (; i + 1 < val; i += n * 2) {
+                        n = (val - i) / 2 > 256 ? 256 : (val - i) / 2;
+
+                        if (src == -1) m68k_read_memory_words(pi_ptr[0] + i, words, n);
+                        else for (uint32_t j = 0; j < n; j++) words[j] = mmap_mem_read_16(cfg->map_data[src], pi_ptr[0] - cfg->map_offset[src] + i + j * 2);
+
+                        if (dst == -1) m68k_write_memory_words(pi_ptr[1] + i, words, n);
+                        else for (uint32_t j = 0; j < n; j++) mmap_mem_write_16(cfg->map_data[dst], pi_ptr[1] - cfg->map_offset[dst] + i + j * 2, words[j]);
+                    }
+                    if (i < val) {
+                        uint8_t tmp;
+                        if (src == -1) tmp = (uint8_t)m68k_read_memory_8(pi_ptr[0] + i);
+                        else tmp = (uint8_t)mmap_mem_read_8(cfg->map_data[src], pi_ptr[0] - cfg->map_offset[src] + i);
+
+                        if (dst == -1) m68k_write_memory_8(pi_ptr[1] + i, tmp);
+                        else mmap_mem_write_8(cfg->map_data[dst], pi_ptr[1] - cfg->map_offset[dst] + i, tmp);
+                    }
                 } else {
                     //DEBUG("slow memcpy\n");
                     uint8_t tmp = 0;
                     uint16_t tmps = 0;
                     for (uint32_t i = 0; i < val; i++) {
                         while (i + 2 < val) {
-                            if (src == -1) tmps = (uint16_t)htobe16(m68k_read_memory_16(pi_ptr[0] + i));
-                            else memcpy(&tmps, &cfg->map_data[src][pi_ptr[0] - cfg->map_offset[src] + i], 2);
+                            if (src == -1) tmps = (uint16_t)m68k_read_memory_16(pi_ptr[0] + i);
+                            else tmps = (uint16_t)mmap_mem_read_16(cfg->map_data[src], pi_ptr[0] - cfg->map_offset[src] + i);
 
-                            if (dst == -1) m68k_write_memory_16(pi_ptr[1] + i, be16toh(tmps));
-                            else memcpy(&cfg->map_data[dst][pi_ptr[1] - cfg->map_offset[dst] + i], &tmps, 2);
+                            if (dst == -1) m68k_write_memory_16(pi_ptr[1] + i, tmps);
+                            else mmap_mem_write_16(cfg->map_data[dst], pi_ptr[1] - cfg->map_offset[dst] + i, tmps);
                             i += 2;
                         }
                         if (src == -1) tmp = (uint8_t)m68k_read_memory_8(pi_ptr[0] + i);
-                        else tmp = cfg->map_data[src][pi_ptr[0] - cfg->map_offset[src] + i];
+                        else tmp = (uint8_t)mmap_mem_read_8(cfg->map_data[src], pi_ptr[0] - cfg->map_offset[src] + i);
                         
                         if (dst == -1) m68k_write_memory_8(pi_ptr[1] + i, tmp);
-                        else cfg->map_data[dst][pi_ptr[1] - cfg->map_offset[dst] + i] = tmp;
+                        else mmap_mem_write_8(cfg->map_data[dst], pi_ptr[1] - cfg->map_offset[dst] + i, tmp);
                     }
                 }
                 //DEBUG("[PISTORM-DEV] Copied %d bytes from $%.8X to $%.8X\n", val, pi_ptr[0], pi_ptr[1]);
@@ -292,12 +318,22 @@ void handle_pistorm_dev_write(uint32_t addr_, uint32_t val, uint8_t type) {
                 if (cfg->map_type[dst] == MAPTYPE_ROM)
                     break;
                 if (dst != -1) {
-                    uint8_t *dst_ptr = &cfg->map_data[dst][(pi_ptr[0] - cfg->map_offset[dst])];
-                    memset(dst_ptr, pi_byte[0], val);
+                    mmap_mem_fill(cfg->map_data[dst], pi_ptr[0] - cfg->map_offset[dst], pi_byte[0], val);
                 } else {
-                    for (uint32_t i = 0; i < val; i++) {
-                        m68k_write_memory_8(pi_ptr[0] + i, pi_byte[0]);
+                    uint16_t words[256];
+                    uint32_t i = 0, n;
+                    if (pi_ptr[0] & 1) {
+                        m68k_write_memory_8(pi_ptr[0], pi_byte[0]);
+                        i++;
+                    }
+                    for (n = 0; n < 256; n++)
+                        words[n] = pi_byte[0] * 0x0101;
+                    for (; i + 1 < val; i += n * 2) {
+                        n = (val - i) / 2 > 256 ? 256 : (val - i) / 2;
+                        m68k_write_memory_words(pi_ptr[0] + i, words, n);
                     }
+                    if (i < val)
+                        m68k_write_memory_8(pi_ptr[0] + i, pi_byte[0]);
                 }
             }
             break;
@@ -320,8 +356,8 @@ void handle_pistorm_dev_write(uint32_t addr_, uint32_t val, uint8_t type) {
                 }
 
                 if (dst != -1 && src != -1) {
-                    uint8_t *src_ptr = &cfg->map_data[src][(pi_ptr[0] - cfg->map_offset[src])];
-                    uint8_t *dst_ptr = &cfg->map_data[dst][(pi_ptr[1] - cfg->map_offset[dst])];
+                    uint32_t src_off = pi_ptr[0] - cfg->map_offset[src];
+                    uint32_t dst_off = pi_ptr[1] - cfg->map_offset[dst];
 
                     if (addr == PI_CMD_COPYRECT_EX) {
                         /*DEBUG("COPYRECT_EX:\n");
@@ -330,15 +366,15 @@ void handle_pistorm_dev_write(uint32_t addr_, uint32_t val, uint8_t type) {
                         DEBUG("Src X: %d Src Y: %d:\n", pi_word[4], pi_word[5]);
                         DEBUG("Dst X: %d Dst Y: %d:\n", pi_word[6], pi_word[7]);*/
                         // Adjust pointers in the case of available src/dst coordinates.
-                        src_ptr += pi_word[4] + (pi_word[5] * pi_word[0]);
-                        dst_ptr += pi_word[6] + (pi_word[7] * pi_word[1]);
+                        src_off += pi_word[4] + (pi_word[5] * pi_word[0]);
+                        dst_off += pi_word[6] + (pi_word[7] * pi_word[1]);
                     }
 
                     for (int i = 0; i < pi_word[3]; i++) {
-                        memcpy(dst_ptr, src_ptr, pi_word[2]);
+                        mmap_mem_copy(cfg->map_data[dst], dst_off, cfg->map_data[src], src_off, pi_word[2]);
 
-                        src_ptr += pi_word[0];
-                        dst_ptr += pi_word[1];
+                        src_off += pi_word[0];
+                        dst_off += pi_word[1];
                     }
                 } else {
                     uint32_t src_offset = 0, dst_offset = 0;
@@ -352,10 +388,10 @@ void handle_pistorm_dev_write(uint32_t addr_, uint32_t val, uint8_t type) {
                     for (uint32_t y = 0; y < pi_word[3]; y++) {
                         for (uint32_t x = 0; x < pi_word[2]; x++) {
                             if (src == -1) tmp = (unsigned char)m68k_read_memory_8(pi_ptr[0] + src_offset + x);
-                            else tmp = cfg->map_data[src][(pi_ptr[0] + src_offset + x) - cfg->map_offset[src]];
+                            else tmp = (uint8_t)mmap_mem_read_8(cfg->map_data[src], (pi_ptr[0] + src_offset + x) - cfg->map_offset[src]);
                             
                             if (dst == -1) m68k_write_memory_8(pi_ptr[1] + dst_offset + x, tmp);
-                            else cfg->map_data[dst][(pi_ptr[1] + dst_offset + x) - cfg->map_offset[dst]] = tmp;
+                            else mmap_mem_write_8(cfg->map_data[dst], (pi_ptr[1] + dst_offset + x) - cfg->map_offset[dst], tmp);
                         }
                         src_offset += pi_word[0];
                         dst_offset += pi_word[1];
@@ -381,21 +417,24 @@ void handle_pistorm_dev_write(uint32_t addr_, uint32_t val, uint8_t type) {
                 int32_t dst = get_mapped_item_by_address(cfg, pi_ptr[1]);
 
                 if (dst != -1 && src != -1) {
-                    uint8_t *src_ptr = &cfg->map_data[src][(pi_ptr[0] - cfg->map_offset[src])];
-                    uint8_t *dst_ptr = &cfg->map_data[dst][(pi_ptr[1] - cfg->map_offset[dst])];
+                    uint32_t src_off = pi_ptr[0] - cfg->map_offset[src];
+                    uint32_t dst_off = pi_ptr[1] - cfg->map_offset[dst];
+                    uint8_t tmp;
 
-                    src_ptr += pi_word[4] + (pi_word[5] * pi_word[0]);
-                    dst_ptr += pi_word[6] + (pi_word[7] * pi_word[1]);
+                    src_off += pi_word[4] + (pi_word[5] * pi_word[0]);
+                    dst_off += pi_word[6] + (pi_word[7] * pi_word[1]);
 
                     for (int y = 0; y < pi_word[3]; y++) {
                         for (int x = 0; x < pi_word[2]; x++) {
-                            if (src_ptr[x] != pi_byte[0]) {
-                                dst_ptr[x] = src_ptr[x];
+                            tmp = (uint8_t)mmap_mem_read_8(cfg->map_data[src], src_off + x);
+
+                            if (tmp != pi_byte[0]) {
+                                mmap_mem_write_8(cfg->map_data[dst], dst_off + x, tmp);
                             }
                         }
 
-                        src_ptr += pi_word[0];
-                        dst_ptr += pi_word[1];
+                        src_off += pi_word[0];
+                        dst_off += pi_word[1];
                     }
                 } else {
                     uint32_t src_offset = 0, dst_offset = 0;
@@ -407,11 +446,11 @@ void handle_pistorm_dev_write(uint32_t addr_, uint32_t val, uint8_t type) {
                     for (uint32_t y = 0; y < pi_word[3]; y++) {
                         for (uint32_t x = 0; x < pi_word[2]; x++) {
                             if (src == -1) tmp = (unsigned char)m68k_read_memory_8(pi_ptr[0] + src_offset + x);
-                            else tmp = cfg->map_data[src][(pi_ptr[0] + src_offset + x) - cfg->map_offset[src]];
+                            else tmp = (uint8_t)mmap_mem_read_8(cfg->map_data[src], (pi_ptr[0] + src_offset + x) - cfg->map_offset[src]);
 
                             if (tmp != pi_byte[0]) {
                                 if (dst == -1) m68k_write_memory_8(pi_ptr[1] + dst_offset + x, tmp);
-                                else cfg->map_data[dst][(pi_ptr[1] + dst_offset + x) - cfg->map_offset[dst]] = tmp;
+                                else mmap_mem_write_8(cfg->map_data[dst], (pi_ptr[1] + dst_offset + x) - cfg->map_offset[dst], tmp);
                             }
                         }
                         src_offset += pi_word[0];
@@ -438,13 +477,13 @@ void handle_pistorm_dev_write(uint32_t addr_, uint32_t val, uint8_t type) {
                 uint8_t tmp = (unsigned char)pi_longword[0];
 
                 if (dst != -1) {
-                    uint8_t *dst_ptr = &cfg->map_data[dst][(pi_ptr[1] - cfg->map_offset[dst])];
+                    uint32_t dst_off = pi_ptr[1] - cfg->map_offset[dst];
 
-                    dst_ptr += pi_word[6] + (pi_word[7] * pi_word[1]);
+                    dst_off += pi_word[6] + (pi_word[7] * pi_word[1]);
 
                     for (int y = 0; y < pi_word[3]; y++) {
-                        memset(dst_ptr, tmp, pi_word[2]);
-                        dst_ptr += pi_word[1];
+                        mmap_mem_fill(cfg->map_data[dst], dst_off, tmp, pi_word[2]);
+                        dst_off += pi_word[1];
                     }
                 } else {
                     uint32_t dst_offset = 0;
@@ -453,7 +492,7 @@ void handle_pistorm_dev_write(uint32_t addr_, uint32_t val, uint8_t type) {
                     for (uint32_t y = 0; y < pi_word[3]; y++) {
                         for (uint32_t x = 0; x < pi_word[2]; x++) {
                             if (dst == -1) m68k_write_memory_8(pi_ptr[1] + dst_offset + x, tmp);
-                            else cfg->map_data[dst][(pi_ptr[1] + dst_offset + x) - cfg->map_offset[dst]] = tmp;
+                            else mmap_mem_write_8(cfg->map_data[dst], (pi_ptr[1] + dst_offset + x) - cfg->map_offset[dst], tmp);
                         }
                         dst_offset += pi_word[1];
                     }
@@ -472,15 +511,15 @@ void handle_pistorm_dev_write(uint32_t addr_, uint32_t val, uint8_t type) {
                 int32_t dst = get_mapped_item_by_address(cfg, pi_ptr[1]);
 
                 if (dst != -1 && src != -1) {
-                    uint8_t *src_ptr = &cfg->map_data[src][(pi_ptr[0] - cfg->map_offset[src])];
-                    uint8_t *dst_ptr = &cfg->map_data[dst][(pi_ptr[1] - cfg->map_offset[dst])];
-                    uint8_t *pal_ptr = 0;
+                    uint32_t src_off = pi_ptr[0] - cfg->map_offset[src];
+                    uint32_t dst_off = pi_ptr[1] - cfg->map_offset[dst];
+                    int32_t pal = -1;
 
                     if (pi_ptr[2] != 0) {
-                        pal_ptr = get_mapped_data_pointer_by_address(cfg, pi_ptr[2]);
+                        pal = get_mapped_item_by_address(cfg, pi_ptr[2]);
                     }
 
-                    uint8_t tmp = *src_ptr++;
+                    uint8_t tmp = (uint8_t)mmap_mem_read_8(cfg->map_data[src], src_off++);
                     uint8_t num_bits = 8;
 
                     for (int y = 0; y < pi_word[3] && y + pi_word[4] < pi_word[5]; y++) {
@@ -488,17 +527,18 @@ void handle_pistorm_dev_write(uint32_t addr_, uint32_t val, uint8_t type) {
                             int32_t color = (tmp >> (8 - val)) & 0xFF;
 
                             if (color && y + pi_word[4] >= 0) {
-                                *dst_ptr = (pal_ptr) ? pal_ptr[color] : color;
+                                if (pal != -1) color = mmap_mem_read_8(cfg->map_data[pal], pi_ptr[2] - cfg->map_offset[pal] + color);
+                                mmap_mem_write_8(cfg->map_data[dst], dst_off, color);
                             }
-                            dst_ptr++;
+                            dst_off++;
                             tmp <<= val;
                             num_bits -= val;
                             if (num_bits == 0) {
-                                tmp = *src_ptr++;
+                                tmp = (uint8_t)mmap_mem_read_8(cfg->map_data[src], src_off++);
                                 num_bits = 8;
                             }
                         }
-                        dst_ptr += pi_word[1];
+                        dst_off += pi_word[1];
                     }
                 } else {
                     // NYI
@@ -0,0 +1,189 @@
+// SPDX-License-Identifier: MIT
+
+/*
+  Execution profiler
+
+  Counting is done inline (profiler.h) from m68k_execute_bef (), the block
+  cache replay and the fused handlers. This file allocates the counters and
+  writes the profile.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "profiler.h"
+#include "config_file/config_file.h"
+
+#define PROF_TOP_PAIRS  1000
+
+uint64_t    *prof_opcodes;
+t_prof_slot *prof_pairs;
+t_prof_slot *prof_pcs;
+uint32_t     prof_countdown = PROF_SAMPLE_EVERY;
+uint16_t     prof_last_ir;
+uint64_t     prof_dropped;
+
+extern struct emulator_config *cfg;
+
+static const char *prof_filename;
+
+
+int prof_start ( const char *filename )
+{
+  prof_opcodes = calloc ( 0x10000, sizeof ( uint64_t ) );
+  prof_pairs   = calloc ( PROF_SLOTS, sizeof ( t_prof_slot ) );
+  prof_pcs     = calloc ( PROF_SLOTS, sizeof ( t_prof_slot ) );
+
+  if ( !prof_opcodes || !prof_pairs || !prof_pcs )
+  {
+    printf ( "[PROF] Cannot allocate the profile counters\n" );
+
+    free ( prof_opcodes );
+    free ( prof_pairs );
+    free ( prof_pcs );
+    prof_opcodes = NULL;
+
+    return -1;
+  }
+
+  prof_filename = filename;
+
+  printf ( "[PROF] Profiling to %s, PC sampled every %d instructions\n", filename, PROF_SAMPLE_EVERY );
+
+  return 0;
+}
+
+
+static int slot_compare ( const void *a, const void *b )
+{
+  const t_prof_slot *x = a;
+  const t_prof_slot *y = b;
+
+  return x->count < y->count ? 1 : x->count > y->count ? -1 : 0;
+}
+
+
+/* where pc is, for symbolising - ROM images and RAM by their map id from the config */
+static void write_region ( FILE *f, uint32_t pc )
+{
+  if ( cfg )
+  {
+    for ( int i = 0; i < MAX_NUM_MAPPED_ITEMS; i++ )
+    {
+      if ( cfg->map_type [i] == MAPTYPE_NONE || !cfg->map_id [i] )
+        continue;
+
+      if ( pc >= cfg->map_offset [i] && pc < cfg->map_high [i] )
+      {
+        fprintf ( f, " %s+0x%lx", cfg->map_id [i], pc - cfg->map_offset [i] );
+
+        return;
+      }
+    }
+  }
+
+  /* TOS in the machine's own ROM */
+  if ( pc >= 0xFC0000 && pc < 0xFF0000 )
+    fprintf ( f, " TOS+0x%x", pc - 0xFC0000 );
+
+  else if ( pc >= 0xE00000 && pc < 0xE40000 )
+    fprintf ( f, " TOS+0x%x", pc - 0xE00000 );
+}
+
+
+/*
+ * The profile is text, one record per line, each list sorted by count:
+ *
+ *   op   <opcode> <count>
+ *   pair <opcode> <opcode> <count>     the first ran just before the second
+ *   pc   <address> <samples> [<region>+<offset>]
+ *
+ * Lines starting with # are comments.
+ */
+void prof_stop ( void )
+{
+  FILE *f;
+  uint64_t total = 0;
+  uint64_t samples = 0;
+  int ops = 0;
+  int pcs = 0;
+
+  if ( !prof_opcodes || !prof_filename )
+    return;
+
+  f = fopen ( prof_filename, "w" );
+
+  if ( !f )
+  {
+    printf ( "[PROF] Cannot create %s\n", prof_filename );
+
+    return;
+  }
+
+  for ( int i = 0; i < 0x10000; i++ )
+    total += prof_opcodes [i];
+
+  fprintf ( f, "# pistorm execution profile\n" );
+  fprintf ( f, "# %llu instructions, PC sampled every %d, %llu pairs/PCs not recorded\n",
+    (unsigned long long)total, PROF_SAMPLE_EVERY, (unsigned long long)prof_dropped );
+
+  /* opcodes - reuse the PC table's sort by packing them as slots */
+  {
+    t_prof_slot *sorted = calloc ( 0x10000, sizeof ( t_prof_slot ) );
+
+    if ( sorted )
+    {
+      for ( int i = 0; i < 0x10000; i++ )
+        if ( prof_opcodes [i] )
+        {
+          sorted [ops].key   = i;
+          sorted [ops].count = prof_opcodes [i];
+          ops++;
+        }
+
+      qsort ( sorted, ops, sizeof ( t_prof_slot ), slot_compare );
+
+      for ( int i = 0; i < ops; i++ )
+        fprintf ( f, "op %04x %llu\n", sorted [i].key, (unsigned long long)sorted [i].count );
+
+      free ( sorted );
+    }
+  }
+
+  /* the CPU thread may still be counting - sort copies */
+  t_prof_slot *pairs = malloc ( PROF_SLOTS * sizeof ( t_prof_slot ) );
+  t_prof_slot *pc    = malloc ( PROF_SLOTS * sizeof ( t_prof_slot ) );
+
+  if ( pairs && pc )
+  {
+    memcpy ( pairs, prof_pairs, PROF_SLOTS * sizeof ( t_prof_slot ) );
+    memcpy ( pc, prof_pcs, PROF_SLOTS * sizeof ( t_prof_slot ) );
+
+    qsort ( pairs, PROF_SLOTS, sizeof ( t_prof_slot ), slot_compare );
+
+    for ( int i = 0; i < PROF_TOP_PAIRS && pairs [i].count; i++ )
+      fprintf ( f, "pair %04x %04x %llu\n", pairs [i].key >> 16, pairs [i].key & 0xffff,
+        (unsigned long long)pairs [i].count );
+
+    qsort ( pc, PROF_SLOTS, sizeof ( t_prof_slot ), slot_compare );
+
+    for ( int i = 0; i < PROF_SLOTS && pc [i].count; i++ )
+    {
+      fprintf ( f, "pc %08x %llu", pc [i].key, (unsigned long long)pc [i].count );
+      write_region ( f, pc [i].key );
+      fprintf ( f, "\n" );
+
+      samples += pc [i].count;
+      pcs++;
+    }
+  }
+
+  free ( pairs );
+  free ( pc );
+  fclose ( f );
+
+  printf ( "[PROF] %llu instructions, %d opcodes, %d PCs (%llu samples) written to %s\n",
+    (unsigned long long)total, ops, pcs, (unsigned long long)samples, prof_filename );
+
+  prof_filename = NULL;
+}
@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: MIT
+/**
+ * pistorm
+ * execution profiler - opcode counts, opcode pairs and sampled PCs
+ */
+
+#ifndef _PROFILER_H
+#define _PROFILER_H
+
+#include <stdint.h>
+
+/*
+ * Every executed instruction bumps the counter of its opcode word and of the
+ * pair it forms with the previous one; every PROF_SAMPLE_EVERY instructions
+ * the PC is sampled. --profile <file> writes it all out on exit, see
+ * prof_stop () for the format. m68kmake reads the opcode counts back
+ * (make PROFILE=<file>), the pairs are what m68kfuse.txt is made from.
+ */
+#define PROF_SAMPLE_EVERY  64
+#define PROF_SLOTS         ( 1 << 16 )     /* per hash table, pairs and PCs */
+#define PROF_PROBES        16
+
+typedef struct {
+  uint32_t key;             /* PC, or previous opcode << 16 | opcode */
+  uint64_t count;           /* 0 when the slot is free */
+} t_prof_slot;
+
+extern uint64_t    *prof_opcodes;    /* NULL unless profiling */
+extern t_prof_slot *prof_pairs;
+extern t_prof_slot *prof_pcs;
+extern uint32_t     prof_countdown;
+extern uint16_t     prof_last_ir;
+extern uint64_t     prof_dropped;
+
+int  prof_start ( const char *filename );
+void prof_stop ( void );
+
+
+static inline void prof_slot_add ( t_prof_slot *table, uint32_t key )
+{
+  uint32_t h = ( key * 2654435761u ) >> 16;
+
+  for ( int n = 0; n < PROF_PROBES; n++, h = ( h + 1 ) & ( PROF_SLOTS - 1 ) )
+  {
+    if ( table [h].key == key && table [h].count )
+    {
+      table [h].count++;
+
+      return;
+    }
+
+    if ( !table [h].count )
+    {
+      table [h].key   = key;
+      table [h].count = 1;
+
+      return;
+    }
+  }
+
+  prof_dropped++;
+}
+
+
+/* instruction ir at pc is about to run */
+static inline void prof_insn ( uint32_t pc, uint16_t ir )
+{
+  prof_opcodes [ir]++;
+
+  prof_slot_add ( prof_pairs, (uint32_t)prof_last_ir << 16 | ir );
+  prof_last_ir = ir;
+
+  if ( --prof_countdown == 0 )
+  {
+    prof_countdown = PROF_SAMPLE_EVERY;
+    prof_slot_add ( prof_pcs, pc );
+  }
+}
+
+#endif /* _PROFILER_H */
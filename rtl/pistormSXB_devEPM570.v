@@ -1,4 +1,7 @@
 /*
+ * Burst mode - ADDR_HI bit 10 keeps the CPLD starting a cycle on every
+ * ADDR_LO write until REG_STATUS is written (ps_read_block/ps_write_block)
+ *
  * 13th October 2023
  *
  * EPM240 / 570
@@ -290,9 +293,11 @@ module pistormsxb_devEPM570(
 	
 	
 	/* Transaction flag */
+	/* burst mode - ADDR_LO writes also start a transaction, see ADDR_HI_BIT_BURST */
 	wire TXNstart;
 	reg TXNreset 							= LO; 
-	assign TXNstart 						= (PI_A == REG_ADDR_HI && CMDWR);
+	reg burst 								= LO;
+	assign TXNstart 						= (PI_A == REG_ADDR_HI && CMDWR) || (PI_A == REG_ADDR_LO && CMDWR && burst);
 	
 	always @(TXNstart or TXNreset or PI_TXN_IN_PROGRESS) begin
 	
@@ -308,6 +313,7 @@ module pistormsxb_devEPM570(
 	
 	/* WRITE commands */
 	reg [2:0] op_fc 						= 3'b111;
+	reg op_byte 							= LO;
 	
 	assign CMDWR = PI_WR;
 	
@@ -326,19 +332,29 @@ module pistormsxb_devEPM570(
 					a0 						<= PI_D[0];
 					LTCH_A_0				<= HI;
 					LTCH_A_8				<= HI;
+					
+					/* burst - rw, fc and A23-A16 are kept from ADDR_HI */
+					if ( burst ) begin
+					
+						op_uds_n 			<= op_byte ? PI_D[0] : LO;
+						op_lds_n 			<= op_byte ? !PI_D[0] : LO;
+					end
 				end
 				
 				REG_ADDR_HI: begin
 					op_rw 					<= PI_D[9];
+					op_byte 				<= PI_D[8];
 					op_uds_n 				<= PI_D[8] ? a0 : LO;
 					op_lds_n 				<= PI_D[8] ? !a0 : LO;
 					op_fc 					<= PI_D[15:13];
+					burst 					<= PI_D[10];
 					LTCH_A_16				<= HI;
 					LTCH_A_24				<= HI;
 				end
 				
 				REG_STATUS: begin
 					status 					<= PI_D;
+					burst 					<= LO;
 				end
 			endcase
 		end
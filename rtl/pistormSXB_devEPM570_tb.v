@@ -0,0 +1,251 @@
+/*
+ * Burst mode testbench for pistormSXB_devEPM570.v
+ *
+ * iverilog -o burst_tb rtl/pistormSXB_devEPM570.v rtl/pistormSXB_devEPM570_tb.v && vvp burst_tb
+ *
+ * Drives the Pi side register writes the way gpio_write_block () does, models
+ * the external address/data latches and answers every AS with DTACK. Checks
+ *   - a plain ADDR_HI write starts one cycle, ADDR_LO alone does not
+ *   - with ADDR_HI_BIT_BURST every ADDR_LO write starts a cycle, ADDR_HI skipped
+ *   - across 64K an ADDR_LO write still runs with the old A23-A16, which is
+ *     why ps_read_block ()/ps_write_block () split bursts there
+ *   - a REG_STATUS write leaves burst mode
+ *   - the next block starting at a 64K boundary goes to the right address
+ */
+
+`timescale 1ns/1ps
+
+module pistormSXB_devEPM570_tb;
+
+	localparam REG_DATA 					= 2'd0;
+	localparam REG_ADDR_LO 					= 2'd1;
+	localparam REG_ADDR_HI 					= 2'd2;
+	localparam REG_STATUS 					= 2'd3;
+
+	localparam STATUS_RUN 					= 16'h0002;	/* reset released */
+
+	reg pi_clk 								= 0;
+	reg m68k_clk 							= 0;
+
+	always #2.5 	pi_clk 					= ~pi_clk;		/* 200 MHz */
+	always #62.5 	m68k_clk 				= ~m68k_clk;	/* 8 MHz */
+
+	reg [1:0] 	pi_a 						= REG_STATUS;
+	reg 		pi_rd 						= 0;
+	reg 		pi_wr 						= 0;
+	reg [15:0] 	pi_dout 					= 16'h0000;
+	reg 		pi_drive 					= 0;
+	wire [15:0] pi_d 						= pi_drive ? pi_dout : 16'bz;
+
+	wire txn, ipl_zero, pi_reset;
+	wire ltch_a_0, ltch_a_8, ltch_a_16, ltch_a_24, ltch_a_oe_n;
+	wire ltch_d_rd_u, ltch_d_rd_l, ltch_d_rd_oe_n, ltch_d_wr_u, ltch_d_wr_l, ltch_d_wr_oe_n;
+	wire [2:0] fc;
+	wire as_n, uds_n, lds_n, rw, e, vma_n, bg_n;
+	wire reset_n, halt_n;
+	reg  dtack_n 							= 1;
+
+	pullup ( reset_n );
+	pullup ( halt_n );
+
+	pistormsxb_devEPM570 dut (
+		.PI_TXN_IN_PROGRESS ( txn ),
+		.PI_IPL_ZERO 		( ipl_zero ),
+		.PI_A 				( pi_a ),
+		.PI_CLK 			( pi_clk ),
+		.PI_RESET 			( pi_reset ),
+		.PI_RD 				( pi_rd ),
+		.PI_WR 				( pi_wr ),
+		.PI_D 				( pi_d ),
+		.LTCH_A_0 			( ltch_a_0 ),
+		.LTCH_A_8 			( ltch_a_8 ),
+		.LTCH_A_16 			( ltch_a_16 ),
+		.LTCH_A_24 			( ltch_a_24 ),
+		.LTCH_A_OE_n 		( ltch_a_oe_n ),
+		.LTCH_D_RD_U 		( ltch_d_rd_u ),
+		.LTCH_D_RD_L 		( ltch_d_rd_l ),
+		.LTCH_D_RD_OE_n 	( ltch_d_rd_oe_n ),
+		.LTCH_D_WR_U 		( ltch_d_wr_u ),
+		.LTCH_D_WR_L 		( ltch_d_wr_l ),
+		.LTCH_D_WR_OE_n 	( ltch_d_wr_oe_n ),
+		.M68K_CLK 			( m68k_clk ),
+		.M68K_FC 			( fc ),
+		.M68K_AS_n 			( as_n ),
+		.M68K_UDS_n 		( uds_n ),
+		.M68K_LDS_n 		( lds_n ),
+		.M68K_RW 			( rw ),
+		.M68K_DTACK_n 		( dtack_n ),
+		.M68K_BERR_n 		( 1'b1 ),
+		.M68K_VPA_n 		( 1'b1 ),
+		.M68K_E 			( e ),
+		.M68K_VMA_n 		( vma_n ),
+		.M68K_IPL_n 		( 3'b111 ),
+		.M68K_RESET_n 		( reset_n ),
+		.M68K_HALT_n 		( halt_n ),
+		.M68K_BR_n 			( 1'b1 ),
+		.M68K_BG_n 			( bg_n ),
+		.M68K_BGACK_n 		( 1'b1 )
+	);
+
+	/* the external latches - the CPLD only clocks them */
+	reg [23:0] 	bus_addr 					= 24'h000000;
+	reg [15:0] 	bus_data 					= 16'h0000;
+
+	always @(posedge ltch_a_0) 	bus_addr[15:0] 	<= pi_d;
+	always @(posedge ltch_a_16) bus_addr[23:16] <= pi_d[7:0];
+	always @(posedge ltch_d_wr_u) bus_data 		<= pi_d;
+
+	/* the ST - DTACK for every cycle, note what went out */
+	integer 	cycles 						= 0;
+	reg [23:0] 	cycle_addr;
+	reg [15:0] 	cycle_data;
+	reg 		cycle_rw;
+
+	always @(negedge as_n) begin
+
+		#1; /* RW and AS change in the same clock */
+
+		cycles 								= cycles + 1;
+		cycle_addr 							= bus_addr;
+		cycle_data 							= bus_data;
+		cycle_rw 							= rw;
+
+		@(posedge m68k_clk);
+		dtack_n 							<= 0;
+	end
+
+	always @(posedge as_n)
+		dtack_n 							<= 1;
+
+	integer errors 							= 0;
+
+	/* PI_D[15:13] fc, [10] burst, [9] read, [8] byte, [7:0] A23-A16 */
+	function [15:0] addr_hi ( input burst, input read, input [7:0] a23_16 );
+		addr_hi 							= { 3'b101, 2'b00, burst, read, 1'b0, a23_16 };
+	endfunction
+
+	/* gpio [7] = reg/data, gpio [7] = WR, gpio [10] = WR */
+	task pi_write ( input [1:0] r, input [15:0] v );
+	begin
+		@(posedge pi_clk);
+		pi_a 								= r;
+		pi_dout 							= v;
+		pi_drive 							= 1;
+		#10 pi_wr 							= 1;
+		#20 pi_wr 							= 0;
+		#10 pi_drive 						= 0;
+	end
+	endtask
+
+	/* TXN_WAIT () */
+	task txn_wait;
+		integer n;
+	begin
+		n 									= 0;
+
+		while ( txn && n < 100000 ) begin
+			@(posedge pi_clk);
+			n 								= n + 1;
+		end
+
+		if ( txn ) begin
+			$display ( "FAIL: transaction never finished" );
+			errors 							= errors + 1;
+		end
+
+		#200;
+	end
+	endtask
+
+	task expect_cycle ( input integer count, input [23:0] addr, input [15:0] data, input [255:0] what );
+	begin
+		if ( cycles != count || cycle_addr != addr || cycle_data != data || cycle_rw != 0 ) begin
+			$display ( "FAIL: %0s - %0d cycles, last 0x%06X = 0x%04X rw %b (expected %0d, 0x%06X = 0x%04X)",
+				what, cycles, cycle_addr, cycle_data, cycle_rw, count, addr, data );
+			errors 							= errors + 1;
+		end
+
+		else
+			$display ( "ok:   %0s - 0x%06X = 0x%04X", what, cycle_addr, cycle_data );
+	end
+	endtask
+
+	task expect_no_cycle ( input integer count, input [255:0] what );
+	begin
+		#4000;
+
+		if ( cycles != count || txn ) begin
+			$display ( "FAIL: %0s - %0d cycles, txn %b (expected %0d, idle)", what, cycles, txn, count );
+			errors 							= errors + 1;
+		end
+
+		else
+			$display ( "ok:   %0s", what );
+	end
+	endtask
+
+	initial begin
+		$dumpfile ( "burst_tb.vcd" );
+		$dumpvars ( 0, pistormSXB_devEPM570_tb );
+
+		pi_write ( REG_STATUS, STATUS_RUN );
+		#5000;
+
+		/* single cycle - ADDR_HI starts it */
+		pi_write ( REG_DATA, 16'h1111 );
+		pi_write ( REG_ADDR_LO, 16'h1000 );
+		pi_write ( REG_ADDR_HI, addr_hi ( 0, 0, 8'h02 ) );
+		txn_wait;
+		expect_cycle ( 1, 24'h021000, 16'h1111, "single write" );
+
+		pi_write ( REG_ADDR_LO, 16'h1002 );
+		expect_no_cycle ( 1, "ADDR_LO without burst starts nothing" );
+
+		/* burst - first word with ADDR_HI, the next one on ADDR_LO alone */
+		pi_write ( REG_DATA, 16'h2222 );
+		pi_write ( REG_ADDR_LO, 16'hFFFC );
+		pi_write ( REG_ADDR_HI, addr_hi ( 1, 0, 8'h02 ) );
+		txn_wait;
+		expect_cycle ( 2, 24'h02FFFC, 16'h2222, "burst first word" );
+
+		pi_write ( REG_DATA, 16'h3333 );
+		pi_write ( REG_ADDR_LO, 16'hFFFE );
+		txn_wait;
+		expect_cycle ( 3, 24'h02FFFE, 16'h3333, "burst auto-start, ADDR_HI skipped" );
+
+		/* across 64K ADDR_LO starts the cycle before a new ADDR_HI could arrive */
+		pi_write ( REG_DATA, 16'h4444 );
+		pi_write ( REG_ADDR_LO, 16'h0000 );
+		txn_wait;
+		expect_cycle ( 4, 24'h020000, 16'h4444, "64K crossing keeps old A23-A16 (host must split)" );
+
+		/* REG_STATUS leaves burst mode */
+		pi_write ( REG_STATUS, STATUS_RUN );
+		pi_write ( REG_ADDR_LO, 16'h0002 );
+		expect_no_cycle ( 4, "ADDR_LO after leaving burst starts nothing" );
+
+		/* the split off block - starts at the boundary with its own ADDR_HI */
+		pi_write ( REG_DATA, 16'h5555 );
+		pi_write ( REG_ADDR_LO, 16'h0000 );
+		pi_write ( REG_ADDR_HI, addr_hi ( 1, 0, 8'h03 ) );
+		txn_wait;
+		expect_cycle ( 5, 24'h030000, 16'h5555, "next block at 64K boundary" );
+
+		pi_write ( REG_DATA, 16'h6666 );
+		pi_write ( REG_ADDR_LO, 16'h0002 );
+		txn_wait;
+		expect_cycle ( 6, 24'h030002, 16'h6666, "next block auto-start" );
+
+		pi_write ( REG_STATUS, STATUS_RUN );
+		expect_no_cycle ( 6, "burst left at block end" );
+
+		if ( errors )
+			$display ( "FAILED - %0d errors", errors );
+
+		else
+			$display ( "PASSED" );
+
+		$finish;
+	end
+
+endmodule